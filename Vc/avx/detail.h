@@ -602,6 +602,8 @@ Vc_INTRINSIC Vc_CONST __m256i one( short) { return AVX::setone_epi16(); }
 Vc_INTRINSIC Vc_CONST __m256i one(ushort) { return AVX::setone_epu16(); }
 Vc_INTRINSIC Vc_CONST __m256i one( schar) { return AVX::setone_epi8 (); }
 Vc_INTRINSIC Vc_CONST __m256i one( uchar) { return AVX::setone_epu8 (); }
+Vc_INTRINSIC Vc_CONST __m256i one( llong) { return _mm256_set1_epi64x(1); }
+Vc_INTRINSIC Vc_CONST __m256i one(ullong) { return _mm256_set1_epi64x(1); }
 
 // negate{{{1
 Vc_ALWAYS_INLINE Vc_CONST __m256 negate(__m256 v, std::integral_constant<std::size_t, 4>)
@@ -612,6 +614,16 @@ Vc_ALWAYS_INLINE Vc_CONST __m256d negate(__m256d v, std::integral_constant<std::
 {
     return _mm256_xor_pd(v, AVX::setsignmask_pd());
 }
+#ifdef Vc_IMPL_AVX2
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm256_sub_epi64(_mm256_setzero_si256(), v);
+}
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 1>)
+{
+    return _mm256_sign_epi8(v, Detail::allone<__m256i>());
+}
+#endif
 Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 4>)
 {
     return AVX::sign_epi32(v, Detail::allone<__m256i>());
@@ -691,6 +703,10 @@ Vc_INTRINSIC __m256i abs(__m256i a,  short) { return AVX::abs_epi16(a); }
 Vc_INTRINSIC __m256i abs(__m256i a, ushort) { return a; }
 Vc_INTRINSIC __m256i abs(__m256i a,  schar) { return AVX::abs_epi8 (a); }
 Vc_INTRINSIC __m256i abs(__m256i a,  uchar) { return a; }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i abs(__m256i a,  llong) { return AVX::abs_epi64(a); }
+Vc_INTRINSIC __m256i abs(__m256i a, ullong) { return a; }
+#endif
 
 // add{{{1
 Vc_INTRINSIC __m256  add(__m256  a, __m256  b,  float) { return _mm256_add_ps(a, b); }
@@ -699,6 +715,12 @@ Vc_INTRINSIC __m256i add(__m256i a, __m256i b,    int) { return AVX::add_epi32(a
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   uint) { return AVX::add_epi32(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  short) { return AVX::add_epi16(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ushort) { return AVX::add_epi16(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  llong) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ullong) { return AVX::add_epi64(a, b); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  schar) { return _mm256_add_epi8(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  uchar) { return _mm256_add_epi8(a, b); }
+#endif
 
 // sub{{{1
 Vc_INTRINSIC __m256  sub(__m256  a, __m256  b,  float) { return _mm256_sub_ps(a, b); }
@@ -707,6 +729,12 @@ Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,    int) { return AVX::sub_epi32(a
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   uint) { return AVX::sub_epi32(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  short) { return AVX::sub_epi16(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ushort) { return AVX::sub_epi16(a, b); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  llong) { return _mm256_sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ullong) { return _mm256_sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  schar) { return _mm256_sub_epi8(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  uchar) { return _mm256_sub_epi8(a, b); }
+#endif
 
 // mul{{{1
 Vc_INTRINSIC __m256  mul(__m256  a, __m256  b,  float) { return _mm256_mul_ps(a, b); }
@@ -715,6 +743,31 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,    int) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  llong) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ullong) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  schar) { return AVX::mullo_epi8(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  uchar) { return AVX::mullo_epi8(a, b); }
+#endif
+
+#ifdef Vc_IMPL_AVX2
+// mulhi{{{1
+// The upper half of the double-width product, i.e. (a * b) >> (8 * sizeof(T)).
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,    int) {
+    const __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+    const __m256i odd =
+        _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(even, odd, 0xaa);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,   uint) {
+    const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+    const __m256i odd =
+        _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(even, odd, 0xaa);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,  short) { return _mm256_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b, ushort) { return _mm256_mulhi_epu16(a, b); }
+#endif
 
 // mul{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
@@ -756,6 +809,37 @@ Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  short) {
         _mm256_div_ps(convert<short, float>(hi128(a)), convert<short, float>(hi128(b)));
     return concat(convert<float, short>(lo), convert<float, short>(hi));
 }
+#ifdef Vc_IMPL_AVX2
+// There is no SIMD division for 64-bit integers (not even with AVX-512) and the detour
+// via double would lose precision beyond 2^53.
+template <typename T> Vc_INTRINSIC __m256i div_epi64(__m256i a, __m256i b)
+{
+    alignas(32) T x[4];
+    alignas(32) T y[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(x), a);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(y), b);
+    return _mm256_setr_epi64x(x[0] / y[0], x[1] / y[1], x[2] / y[2], x[3] / y[3]);
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  llong) { return div_epi64< llong>(a, b); }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b, ullong) { return div_epi64<ullong>(a, b); }
+// every 8-bit quotient is exact in the 16-bit division; the narrowing is modular so that
+// -128 / -1 wraps like the other integer types
+template <typename T> Vc_INTRINSIC __m256i div_epi8(__m256i a, __m256i b)
+{
+    const auto widen = [](__m128i x) {
+        return std::is_signed<T>::value ? _mm256_cvtepi8_epi16(x) : _mm256_cvtepu8_epi16(x);
+    };
+    const __m256i lo = div(widen(AVX::lo128(a)), widen(AVX::lo128(b)), short());
+    const __m256i hi = div(widen(AVX::hi128(a)), widen(AVX::hi128(b)), short());
+    const __m256i mask = _mm256_set1_epi16(0x00ff);
+    // packus works per 128-bit lane, the permute restores the entry order
+    return _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask)),
+        _MM_SHUFFLE(3, 1, 2, 0));
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  schar) { return div_epi8< schar>(a, b); }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  uchar) { return div_epi8< uchar>(a, b); }
+#endif
 
 // horizontal add{{{1
 template <typename T> Vc_INTRINSIC T add(Common::IntrinsicType<T, 32 / sizeof(T)> a, T)
@@ -787,6 +871,10 @@ Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,    int) { return AvxIntrinsics:
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,   uint) { return AvxIntrinsics::cmpeq_epi32(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  short) { return AvxIntrinsics::cmpeq_epi16(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ushort) { return AvxIntrinsics::cmpeq_epi16(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  schar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  uchar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  llong) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ullong) { return AvxIntrinsics::cmpeq_epi64(a, b); }
 
 // cmpneq{{{1
 Vc_INTRINSIC __m256  cmpneq(__m256  a, __m256  b,  float) { return AvxIntrinsics::cmpneq_ps(a, b); }
@@ -797,6 +885,8 @@ Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  short) { return not_(AvxIntri
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ushort) { return not_(AvxIntrinsics::cmpeq_epi16(a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  schar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  uchar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  llong) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ullong) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
 
 // cmpgt{{{1
 Vc_INTRINSIC __m256  cmpgt(__m256  a, __m256  b,  float) { return AVX::cmpgt_ps(a, b); }
@@ -807,6 +897,10 @@ Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (a, b); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  llong) { return AVX::cmpgt_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ullong) { return AVX::cmpgt_epu64(a, b); }
+#endif
 
 // cmpge{{{1
 Vc_INTRINSIC __m256  cmpge(__m256  a, __m256  b,  float) { return AVX::cmpge_ps(a, b); }
@@ -817,6 +911,10 @@ Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (b, a)); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  llong) { return not_(AVX::cmpgt_epi64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ullong) { return not_(AVX::cmpgt_epu64(b, a)); }
+#endif
 
 // cmple{{{1
 Vc_INTRINSIC __m256  cmple(__m256  a, __m256  b,  float) { return AVX::cmple_ps(a, b); }
@@ -827,6 +925,10 @@ Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (a, b)); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  llong) { return not_(AVX::cmpgt_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ullong) { return not_(AVX::cmpgt_epu64(a, b)); }
+#endif
 
 // cmplt{{{1
 Vc_INTRINSIC __m256  cmplt(__m256  a, __m256  b,  float) { return AVX::cmplt_ps(a, b); }
@@ -837,6 +939,10 @@ Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (b, a); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  llong) { return AVX::cmpgt_epi64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ullong) { return AVX::cmpgt_epu64(b, a); }
+#endif
 
 // fma{{{1
 Vc_INTRINSIC __m256 fma(__m256  a, __m256  b, __m256  c,  float) {
@@ -890,30 +996,46 @@ template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,    int) { return
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   uint) { return AVX::srli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  short) { return AVX::srai_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ushort) { return AVX::srli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::srai_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srli_epi8 <shift>(a); }
+#ifdef Vc_IMPL_AVX2
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::sra_epi8(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srl_epi8(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  llong) { return AVX::srai_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ullong) { return _mm256_srli_epi64(a, shift); }
+#endif
 
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,    int) { return AVX::sra_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   uint) { return AVX::srl_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  short) { return AVX::sra_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ushort) { return AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8 (a, _mm_cvtsi32_si128(shift)); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8(a, shift); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8(a, shift); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  llong) { return AVX::sra_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ullong) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
+#endif
 
 // shiftLeft{{{1
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,    int) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   uint) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  short) { return AVX::slli_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ushort) { return AVX::slli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::slli_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::slli_epi8 <shift>(a); }
+#ifdef Vc_IMPL_AVX2
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::sll_epi8(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::sll_epi8(a, shift); }
+#endif
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  llong) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ullong) { return AVX::slli_epi64<shift>(a); }
 
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,    int) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   uint) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  short) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ushort) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8(a, shift); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8(a, shift); }
+#endif
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  llong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ullong) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
 
 // zeroExtendIfNeeded{{{1
 Vc_INTRINSIC __m256  zeroExtendIfNeeded(__m256  x) { return x; }
@@ -933,6 +1055,8 @@ Vc_INTRINSIC __m256i avx_broadcast(ushort x) { return _mm256_set1_epi16(x); }
 Vc_INTRINSIC __m256i avx_broadcast(  char x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( schar x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( uchar x) { return _mm256_set1_epi8(x); }
+Vc_INTRINSIC __m256i avx_broadcast( llong x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(ullong x) { return _mm256_set1_epi64x(x); }
 
 // sorted{{{1
 template <Vc::Implementation Impl, typename T,
@@ -940,7 +1064,9 @@ template <Vc::Implementation Impl, typename T,
 Vc_CONST_L AVX2::Vector<T> sorted(AVX2::Vector<T> x) Vc_CONST_R;
 template <typename T> Vc_INTRINSIC Vc_CONST AVX2::Vector<T> sorted(AVX2::Vector<T> x)
 {
-    return sorted<CurrentImplementation::current()>(x);
+    // AVX-512 builds keep the 16-bit vectors on AVX2 and reuse its sort network
+    return sorted<CurrentImplementation::is(AVX512Impl) ? AVX2Impl
+                                                         : CurrentImplementation::current()>(x);
 }
 
 // shifted{{{1
@@ -1084,6 +1210,14 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 8), V> rotated(V
                                                                                int amount)
 {
     using namespace AVX;
+#ifdef Vc_IMPL_AVX2
+    // a single cross-lane permutation, also for an amount that is unknown at compile time
+    const __m256i perm =
+        _mm256_and_si256(_mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                          _mm256_set1_epi32(amount)),
+                         _mm256_set1_epi32(N - 1));
+    return avx_cast<V>(_mm256_permutevar8x32_epi32(avx_cast<__m256i>(v), perm));
+#else
     const __m128i vLo = avx_cast<__m128i>(lo128(v));
     const __m128i vHi = avx_cast<__m128i>(hi128(v));
     switch (static_cast<unsigned int>(amount) % N) {
@@ -1111,6 +1245,7 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 8), V> rotated(V
                                   SSE::alignr_epi8<3 * sizeof(T)>(vHi, vLo)));
     }
     return avx_cast<V>(_mm256_setzero_ps());
+#endif
 }
 
 #ifdef Vc_IMPL_AVX2
@@ -1169,6 +1304,27 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 16), V> rotated(
     }
     return avx_cast<V>(_mm256_setzero_ps());
 }
+
+template <typename T, size_t N, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 32), V> rotated(
+    V v, int amount)
+{
+    using namespace AVX;
+    // vpshufb only selects within 128-bit lanes. The entries that cross lanes are taken
+    // from a copy with swapped lanes.
+    const __m256i x = avx_cast<__m256i>(v);
+    const __m256i swapped = _mm256_permute2x128_si256(x, x, 0x01);
+    const __m256i iota =
+        _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+                         19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    const __m256i idx = _mm256_and_si256(_mm256_add_epi8(iota, _mm256_set1_epi8(amount)),
+                                         _mm256_set1_epi8(N - 1));
+    const __m256i otherLane = _mm256_cmpeq_epi8(
+        _mm256_and_si256(_mm256_xor_si256(idx, iota), _mm256_set1_epi8(16)),
+        _mm256_set1_epi8(16));
+    return avx_cast<V>(_mm256_blendv_epi8(_mm256_shuffle_epi8(x, idx),
+                                          _mm256_shuffle_epi8(swapped, idx), otherLane));
+}
 #endif  // Vc_IMPL_AVX2
 
 // testc{{{1
@@ -1319,12 +1475,136 @@ template <> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m256i k)
 {
     return _pext_u32(movemask(k), 0x55555555u);
 }
+#else
+template <> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m256i k)
+{
+    return _mm_movemask_epi8(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k)));
+}
 #endif
 template <> Vc_INTRINSIC Vc_CONST int mask_to_int<32>(__m256i k)
 {
     return movemask(k);
 }
 
+// compress / expand{{{1
+/**\internal
+ * Compresses/expands the two 128-bit halves of \p x with the SSE implementation and joins
+ * them in memory. Used for the entry types where AVX(2) has no lane-crossing permutation.
+ */
+template <typename T> Vc_INTRINSIC __m256i compress_halves(__m256i x, unsigned int bits)
+{
+    constexpr int N = 16 / sizeof(T);
+    const unsigned int lo = bits & ((1u << N) - 1);
+    alignas(32) T tmp[2 * N];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(tmp), _mm256_setzero_si256());
+    _mm_store_si128(reinterpret_cast<__m128i *>(tmp), compress(AVX::lo128(x), lo, T()));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(tmp + popcnt32(lo)),
+                     compress(AVX::hi128(x), bits >> N, T()));
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(tmp));
+}
+template <typename T> Vc_INTRINSIC __m256i expand_halves(__m256i x, unsigned int bits)
+{
+    constexpr int N = 16 / sizeof(T);
+    const unsigned int lo = bits & ((1u << N) - 1);
+    alignas(32) T tmp[2 * N];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(tmp), x);
+    return AVX::concat(
+        expand(AVX::lo128(x), lo, T()),
+        expand(_mm_loadu_si128(reinterpret_cast<const __m128i *>(tmp + popcnt32(lo))),
+               bits >> N, T()));
+}
+
+#ifdef Vc_IMPL_AVX2
+// 32-bit entries use vpermd, 64-bit entries use it on the 32-bit halves
+Vc_INTRINSIC __m256i compress_epi32(__m256i x, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512
+    return _mm256_maskz_compress_epi32(__mmask8(bits), x);
+#else
+    const __m256i idx = _mm256_cvtepi8_epi32(load_lane_indexes(SSE::_CompressIndexes8[bits]));
+    return _mm256_andnot_si256(_mm256_srai_epi32(idx, 31),
+                               _mm256_permutevar8x32_epi32(x, idx));
+#endif
+}
+Vc_INTRINSIC __m256i expand_epi32(__m256i x, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512
+    return _mm256_maskz_expand_epi32(__mmask8(bits), x);
+#else
+    const __m256i idx = _mm256_cvtepi8_epi32(load_lane_indexes(SSE::_ExpandIndexes8[bits]));
+    return _mm256_andnot_si256(_mm256_srai_epi32(idx, 31),
+                               _mm256_permutevar8x32_epi32(x, idx));
+#endif
+}
+// duplicates every bit of a 4-bit mask for the 32-bit halves of 64-bit entries
+Vc_INTRINSIC unsigned int mask_bits_epi64_to_epi32(unsigned int bits)
+{
+    return ((bits & 1) | (bits & 2) << 1 | (bits & 4) << 2 | (bits & 8) << 3) * 3;
+}
+Vc_INTRINSIC __m256i compress_epi64(__m256i x, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512
+    return _mm256_maskz_compress_epi64(__mmask8(bits), x);
+#else
+    return compress_epi32(x, mask_bits_epi64_to_epi32(bits));
+#endif
+}
+Vc_INTRINSIC __m256i expand_epi64(__m256i x, unsigned int bits)
+{
+#ifdef Vc_IMPL_AVX512
+    return _mm256_maskz_expand_epi64(__mmask8(bits), x);
+#else
+    return expand_epi32(x, mask_bits_epi64_to_epi32(bits));
+#endif
+}
+
+template <typename T> Vc_INTRINSIC __m256i compress(__m256i x, unsigned int bits, T)
+{
+    return sizeof(T) == 8 ? compress_epi64(x, bits)
+                          : sizeof(T) == 4 ? compress_epi32(x, bits)
+                                           : compress_halves<T>(x, bits);
+}
+template <typename T> Vc_INTRINSIC __m256i expand(__m256i x, unsigned int bits, T)
+{
+    return sizeof(T) == 8 ? expand_epi64(x, bits)
+                          : sizeof(T) == 4 ? expand_epi32(x, bits)
+                                           : expand_halves<T>(x, bits);
+}
+Vc_INTRINSIC __m256 compress(__m256 x, unsigned int bits, float)
+{
+    return AVX::avx_cast<__m256>(compress_epi32(AVX::avx_cast<__m256i>(x), bits));
+}
+Vc_INTRINSIC __m256d compress(__m256d x, unsigned int bits, double)
+{
+    return AVX::avx_cast<__m256d>(compress_epi64(AVX::avx_cast<__m256i>(x), bits));
+}
+Vc_INTRINSIC __m256 expand(__m256 x, unsigned int bits, float)
+{
+    return AVX::avx_cast<__m256>(expand_epi32(AVX::avx_cast<__m256i>(x), bits));
+}
+Vc_INTRINSIC __m256d expand(__m256d x, unsigned int bits, double)
+{
+    return AVX::avx_cast<__m256d>(expand_epi64(AVX::avx_cast<__m256i>(x), bits));
+}
+#else   // Vc_IMPL_AVX2
+Vc_INTRINSIC __m256 compress(__m256 x, unsigned int bits, float)
+{
+    return AVX::avx_cast<__m256>(compress_halves<int>(AVX::avx_cast<__m256i>(x), bits));
+}
+Vc_INTRINSIC __m256d compress(__m256d x, unsigned int bits, double)
+{
+    return AVX::avx_cast<__m256d>(compress_halves<llong>(AVX::avx_cast<__m256i>(x), bits));
+}
+Vc_INTRINSIC __m256 expand(__m256 x, unsigned int bits, float)
+{
+    return AVX::avx_cast<__m256>(expand_halves<int>(AVX::avx_cast<__m256i>(x), bits));
+}
+Vc_INTRINSIC __m256d expand(__m256d x, unsigned int bits, double)
+{
+    return AVX::avx_cast<__m256d>(expand_halves<llong>(AVX::avx_cast<__m256i>(x), bits));
+}
+#endif  // Vc_IMPL_AVX2
+
 //InterleaveImpl{{{1
 template<typename V> struct InterleaveImpl<V, 16, 32> {
     template<typename I> static inline void interleave(typename V::EntryType *const data, const I &i,/*{{{*/
@@ -486,6 +486,101 @@ static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
     }
 #endif
 
+#ifdef Vc_IMPL_AVX2
+/////////////////////////////////////////////////////////////////////////
+// 64-bit integer operations that AVX2 lacks (AVX-512VL/DQ has most of them)
+/////////////////////////////////////////////////////////////////////////
+static Vc_INTRINSIC m256i Vc_CONST cmpgt_epu64(__m256i a, __m256i b) {
+    const m256i signbit = _mm256_set1_epi64x(0x8000000000000000ll);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(a, signbit), _mm256_xor_si256(b, signbit));
+}
+static Vc_INTRINSIC m256i Vc_CONST cmplt_epu64(__m256i a, __m256i b) {
+    return cmpgt_epu64(b, a);
+}
+// all bits set in the entries where a is negative
+static Vc_INTRINSIC m256i Vc_CONST signbits_epi64(__m256i a) {
+    return _mm256_srai_epi32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+}
+template <int shift> Vc_INTRINSIC Vc_CONST m256i srai_epi64(__m256i a) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_srai_epi64(a, shift);
+#else
+    const m256i sign = signbits_epi64(a);
+    return _mm256_xor_si256(_mm256_srli_epi64(_mm256_xor_si256(a, sign), shift), sign);
+#endif
+}
+Vc_INTRINSIC Vc_CONST m256i sra_epi64(__m256i a, __m128i shift) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_sra_epi64(a, shift);
+#else
+    const m256i sign = signbits_epi64(a);
+    return _mm256_xor_si256(_mm256_srl_epi64(_mm256_xor_si256(a, sign), shift), sign);
+#endif
+}
+Vc_INTRINSIC Vc_CONST m256i srav_epi64(__m256i a, __m256i shift) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_srav_epi64(a, shift);
+#else
+    const m256i sign = signbits_epi64(a);
+    return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(a, sign), shift), sign);
+#endif
+}
+Vc_INTRINSIC Vc_CONST m256i mullo_epi64(__m256i a, __m256i b) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_mullo_epi64(a, b);
+#else
+    // lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+    const m256i cross = _mm256_add_epi64(
+        _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+        _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+#endif
+}
+Vc_INTRINSIC Vc_CONST m256i abs_epi64(__m256i a) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_abs_epi64(a);
+#else
+    const m256i sign = signbits_epi64(a);
+    return _mm256_sub_epi64(_mm256_xor_si256(a, sign), sign);
+#endif
+}
+#ifdef Vc_IMPL_AVX512
+Vc_INTRINSIC Vc_CONST m256i min_epi64(__m256i a, __m256i b) { return _mm256_min_epi64(a, b); }
+Vc_INTRINSIC Vc_CONST m256i max_epi64(__m256i a, __m256i b) { return _mm256_max_epi64(a, b); }
+Vc_INTRINSIC Vc_CONST m256i min_epu64(__m256i a, __m256i b) { return _mm256_min_epu64(a, b); }
+Vc_INTRINSIC Vc_CONST m256i max_epu64(__m256i a, __m256i b) { return _mm256_max_epu64(a, b); }
+#else
+Vc_INTRINSIC Vc_CONST m256i min_epi64(__m256i a, __m256i b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+Vc_INTRINSIC Vc_CONST m256i max_epi64(__m256i a, __m256i b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+Vc_INTRINSIC Vc_CONST m256i min_epu64(__m256i a, __m256i b) { return _mm256_blendv_epi8(a, b, cmpgt_epu64(a, b)); }
+Vc_INTRINSIC Vc_CONST m256i max_epu64(__m256i a, __m256i b) { return _mm256_blendv_epi8(b, a, cmpgt_epu64(a, b)); }
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+// 8-bit integer operations that AVX2 lacks, emulated with 16-bit instructions
+/////////////////////////////////////////////////////////////////////////
+Vc_INTRINSIC Vc_CONST m256i mullo_epi8(__m256i a, __m256i b) {
+    const m256i even = _mm256_mullo_epi16(a, b);
+    const m256i odd = _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+    return _mm256_or_si256(_mm256_slli_epi16(odd, 8),
+                           _mm256_and_si256(even, _mm256_set1_epi16(0x00ff)));
+}
+Vc_INTRINSIC Vc_CONST m256i sll_epi8(__m256i a, int shift) {
+    return _mm256_and_si256(_mm256_sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                            _mm256_set1_epi8(char(0xff << shift)));
+}
+Vc_INTRINSIC Vc_CONST m256i srl_epi8(__m256i a, int shift) {
+    return _mm256_and_si256(_mm256_srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                            _mm256_set1_epi8(char(0xff >> shift)));
+}
+Vc_INTRINSIC Vc_CONST m256i sra_epi8(__m256i a, int shift) {
+    // (a + 128) >> shift == (a >> shift) + (128 >> shift) for shift < 8
+    const m256i bias = _mm256_set1_epi8(char(0x80 >> shift));
+    return _mm256_sub_epi8(srl_epi8(_mm256_xor_si256(a, _mm256_set1_epi8(char(0x80))), shift),
+                           bias);
+}
+#endif  // Vc_IMPL_AVX2
+
 static Vc_INTRINSIC void _mm256_maskstore(float *mem, const __m256 mask, const __m256 v) {
     _mm256_maskstore_ps(mem, _mm256_castps_si256(mask), v);
 }
@@ -510,6 +605,24 @@ static Vc_INTRINSIC void _mm256_maskstore(short *mem, const __m256i mask, const
 static Vc_INTRINSIC void _mm256_maskstore(unsigned short *mem, const __m256i mask, const __m256i v) {
     _mm256_maskstore(reinterpret_cast<short *>(mem), mask, v);
 }
+static Vc_INTRINSIC void _mm256_maskstore(signed char *mem, const __m256i mask, const __m256i v) {
+    using namespace AVX;
+    _mm_maskmoveu_si128(_mm256_castsi256_si128(v), _mm256_castsi256_si128(mask), reinterpret_cast<char *>(&mem[0]));
+    _mm_maskmoveu_si128(extract128<1>(v), extract128<1>(mask), reinterpret_cast<char *>(&mem[16]));
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned char *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<signed char *>(mem), mask, v);
+}
+static Vc_INTRINSIC void _mm256_maskstore(long long *mem, const __m256i mask, const __m256i v) {
+#ifdef Vc_IMPL_AVX2
+    _mm256_maskstore_epi64(mem, mask, v);
+#else
+    _mm256_maskstore_pd(reinterpret_cast<double *>(mem), mask, _mm256_castsi256_pd(v));
+#endif
+}
+static Vc_INTRINSIC void _mm256_maskstore(unsigned long long *mem, const __m256i mask, const __m256i v) {
+    _mm256_maskstore(reinterpret_cast<long long *>(mem), mask, v);
+}
 
 #undef Vc_AVX_TO_SSE_1
 #undef Vc_AVX_TO_SSE_1_128
@@ -620,6 +733,24 @@ __m256i gather(__m256i src, __m256i k, const unsigned *addr, __m256i idx)
 {
     return _mm256_mask_i32gather_epi32(src, aliasing_cast<int>(addr), idx, k, Scale);
 }
+template <int Scale> __m256i gather(const long long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+template <int Scale> __m256i gather(const unsigned long long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const long long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const unsigned long long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
 #endif
 
 }  // namespace AvxIntrinsics
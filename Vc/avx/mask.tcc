@@ -137,6 +137,19 @@ Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 16 + 32>)
                              gen(12) ? 0xfffful : 0, gen(13) ? 0xfffful : 0,
                              gen(14) ? 0xfffful : 0, gen(15) ? 0xfffful : 0);
 }
+template <typename M, typename G>
+Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 32 + 32>)
+{
+    return _mm256_setr_epi8(
+        gen(0) ? 0xff : 0, gen(1) ? 0xff : 0, gen(2) ? 0xff : 0, gen(3) ? 0xff : 0,
+        gen(4) ? 0xff : 0, gen(5) ? 0xff : 0, gen(6) ? 0xff : 0, gen(7) ? 0xff : 0,
+        gen(8) ? 0xff : 0, gen(9) ? 0xff : 0, gen(10) ? 0xff : 0, gen(11) ? 0xff : 0,
+        gen(12) ? 0xff : 0, gen(13) ? 0xff : 0, gen(14) ? 0xff : 0, gen(15) ? 0xff : 0,
+        gen(16) ? 0xff : 0, gen(17) ? 0xff : 0, gen(18) ? 0xff : 0, gen(19) ? 0xff : 0,
+        gen(20) ? 0xff : 0, gen(21) ? 0xff : 0, gen(22) ? 0xff : 0, gen(23) ? 0xff : 0,
+        gen(24) ? 0xff : 0, gen(25) ? 0xff : 0, gen(26) ? 0xff : 0, gen(27) ? 0xff : 0,
+        gen(28) ? 0xff : 0, gen(29) ? 0xff : 0, gen(30) ? 0xff : 0, gen(31) ? 0xff : 0);
+}
 template <typename T>
 template <typename G>
 Vc_INTRINSIC AVX2::Mask<T> Mask<T, VectorAbi::Avx>::generate(G &&gen)
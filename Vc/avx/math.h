@@ -44,6 +44,14 @@ Vc_ALWAYS_INLINE AVX2::int_v    max(const AVX2::int_v    &x, const AVX2::int_v
 Vc_ALWAYS_INLINE AVX2::uint_v   max(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_max_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  max(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_max_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v max(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_max_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::llong_v  min(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return AVX::min_epi64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ullong_v min(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return AVX::min_epu64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::llong_v  max(const AVX2::llong_v  &x, const AVX2::llong_v  &y) { return AVX::max_epi64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ullong_v max(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return AVX::max_epu64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  min(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_min_epi8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  min(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_min_epu8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  max(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_max_epi8(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  max(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_max_epu8(x.data(), y.data()); }
 #endif
 Vc_ALWAYS_INLINE AVX2::float_v  min(const AVX2::float_v  &x, const AVX2::float_v  &y) { return _mm256_min_ps(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::double_v min(const AVX2::double_v &x, const AVX2::double_v &y) { return _mm256_min_pd(x.data(), y.data()); }
@@ -96,6 +104,38 @@ Vc_INTRINSIC Vc_CONST AVX2::short_v abs(AVX2::short_v x)
 {
     return _mm256_abs_epi16(x.data());
 }
+Vc_INTRINSIC Vc_CONST AVX2::llong_v abs(AVX2::llong_v x)
+{
+    return AVX::abs_epi64(x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX2::schar_v abs(AVX2::schar_v x)
+{
+    return _mm256_abs_epi8(x.data());
+}
+#endif
+
+#ifdef Vc_IMPL_AVX2
+// saturating arithmetic {{{1
+Vc_ALWAYS_INLINE AVX2::schar_v  add_sat(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_adds_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  add_sat(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_adds_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::short_v  add_sat(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_adds_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v add_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_adds_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  sub_sat(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_subs_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  sub_sat(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_subs_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::short_v  sub_sat(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_subs_epi16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ushort_v sub_sat(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_subs_epu16(x.data(), y.data()); }
+
+// table_lookup {{{1
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<T, schar>::value || std::is_same<T, uchar>::value,
+                       AVX2::Vector<T>>
+table_lookup(const T (&table)[16], const AVX2::Vector<T> &idx)
+{
+    // vpshufb looks up within each 128-bit lane, thus both lanes get a copy of the table
+    const __m256i t = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(table)));
+    return _mm256_shuffle_epi8(t, _mm256_adds_epu8(idx.data(), _mm256_set1_epi8(0x70)));
+}
 #endif
 
 // isfinite {{{1
@@ -169,14 +209,14 @@ inline AVX2::double_v frexp(AVX2::double_v::AsArg v, SimdArray<int, 4> *e)
     AVX2::double_v ret =
         _mm256_and_pd(exponentMaximized,
                       _mm256_broadcast_sd(reinterpret_cast<const double *>(&AVX::c_general::frexpMask)));
-    const double_m zeroMask = v == AVX2::double_v::Zero();
+    const AVX2::double_m zeroMask = v == AVX2::double_v::Zero();
     ret(isnan(v) || !isfinite(v) || zeroMask) = v;
     exponent.setZero(simd_cast<SSE::int_m>(zeroMask));
     internal_data(*e) = exponent;
     return ret;
 }
 
-#ifdef Vc_IMPL_AVX2
+#if defined Vc_IMPL_AVX2 && !defined Vc_IMPL_AVX512
 inline SimdArray<double, 8> frexp(const SimdArray<double, 8> &v, SimdArray<int, 8> *e)
 {
     const __m256d exponentBits = AVX::Const<double>::exponentMask().dataD();
@@ -210,13 +250,13 @@ inline SimdArray<double, 8> frexp(const SimdArray<double, 8> &v, SimdArray<int,
         Detail::andnot_(simd_cast<AVX2::int_m>(zeroMask).dataI(), exponent);
     return ret;
 }
-#endif  // Vc_IMPL_AVX2
+#endif  // Vc_IMPL_AVX2 && !Vc_IMPL_AVX512
 
 namespace Detail
 {
 Vc_INTRINSIC AVX2::float_v::IndexType extractExponent(__m256 e)
 {
-    SimdArray<uint, float_v::Size> exponentPart;
+    SimdArray<uint, AVX2::float_v::Size> exponentPart;
     const auto ee = AVX::avx_cast<__m256i>(e);
 #ifdef Vc_IMPL_AVX2
     exponentPart = AVX2::uint_v(ee);
@@ -35,6 +35,75 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Vc_VERSIONED_NAMESPACE
 {
+namespace Detail
+{
+// is_sse_sized_avx2_vector {{{1
+/* True for AVX2 vectors with as many entries as the SSE vector of the same EntryType.
+ * The SSE vector is only instantiated for AVX2 vectors, such that simd_cast<To> stays
+ * SFINAE-friendly for To types with non-arithmetic EntryType.
+ */
+template <typename To, bool = AVX2::is_vector<To>::value>
+struct is_sse_sized_avx2_vector : public std::false_type {
+};
+template <typename To>
+struct is_sse_sized_avx2_vector<To, true>
+    : public std::integral_constant<bool, SSE::Vector<typename To::EntryType>::Size ==
+                                              To::Size> {
+};
+
+// is_int64_avx2_cast {{{1
+/* True for simd_casts between SSE/AVX2 vectors where an AVX2 vector is involved and
+ * either side has 64-bit integral entries. Those casts are implemented via
+ * Detail::Int64Cast instead of one overload per type combination.
+ */
+template <typename V, bool = AVX2::is_vector<V>::value || SSE::is_vector<V>::value>
+struct is_int64_vector : public std::false_type {
+};
+template <typename V>
+struct is_int64_vector<V, true>
+    : public std::integral_constant<bool,
+                                    std::is_integral<typename V::EntryType>::value &&
+                                        sizeof(typename V::EntryType) == 8> {
+};
+template <typename To, typename From>
+struct is_int64_avx2_cast
+    : public std::integral_constant<
+          bool, (AVX2::is_vector<To>::value || SSE::is_vector<To>::value) &&
+                    (AVX2::is_vector<From>::value || SSE::is_vector<From>::value) &&
+                    (AVX2::is_vector<To>::value || AVX2::is_vector<From>::value) &&
+                    (is_int64_vector<To>::value || is_int64_vector<From>::value) &&
+                    !std::is_same<To, From>::value> {
+};
+
+// is_int8_avx2_cast {{{1
+/* True for simd_casts between SSE/AVX2 vectors where an AVX2 vector is involved and
+ * either side has 8-bit integral entries. Combinations already covered by the int64
+ * casts or the SSE-sized AVX2 casts are excluded. The rest are implemented via
+ * Detail::Int8Cast.
+ */
+template <typename V, bool = AVX2::is_vector<V>::value || SSE::is_vector<V>::value>
+struct is_int8_vector : public std::false_type {
+};
+template <typename V>
+struct is_int8_vector<V, true>
+    : public std::integral_constant<bool,
+                                    std::is_integral<typename V::EntryType>::value &&
+                                        sizeof(typename V::EntryType) == 1> {
+};
+template <typename To, typename From>
+struct is_int8_avx2_cast
+    : public std::integral_constant<
+          bool, (AVX2::is_vector<To>::value || SSE::is_vector<To>::value) &&
+                    (AVX2::is_vector<From>::value || SSE::is_vector<From>::value) &&
+                    (AVX2::is_vector<To>::value || AVX2::is_vector<From>::value) &&
+                    (is_int8_vector<To>::value || is_int8_vector<From>::value) &&
+                    !is_int64_vector<To>::value && !is_int64_vector<From>::value &&
+                    !(SSE::is_vector<From>::value &&
+                      is_sse_sized_avx2_vector<To>::value) &&
+                    !std::is_same<To, From>::value> {
+};
+}  // namespace Detail
+
 // Declarations: helper macros Vc_SIMD_CAST_AVX_[124] & Vc_SIMD_CAST_[124] {{{1
 #define Vc_SIMD_CAST_AVX_1(from_, to_)                                                   \
     template <typename To>                                                               \
@@ -116,29 +185,29 @@ namespace Vc_VERSIONED_NAMESPACE
 // as the equivalent SSE Vector
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To
-simd_cast(From x, enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-                             SSE::Vector<typename To::EntryType>::Size == To::Size)> =
+simd_cast(From x, enable_if<(SSE::is_vector<From>::value &&
+                             Detail::is_sse_sized_avx2_vector<To>::value)> =
                       nullarg);
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To simd_cast(
     From x0, From x1,
-    enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-               SSE::Vector<typename To::EntryType>::Size == To::Size)> = nullarg);
+    enable_if<(SSE::is_vector<From>::value &&
+               Detail::is_sse_sized_avx2_vector<To>::value)> = nullarg);
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To simd_cast(
     From x0, From x1, From x2,
-    enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-               SSE::Vector<typename To::EntryType>::Size == To::Size)> = nullarg);
+    enable_if<(SSE::is_vector<From>::value &&
+               Detail::is_sse_sized_avx2_vector<To>::value)> = nullarg);
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To simd_cast(
     From x0, From x1, From x2, From x3,
-    enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-               SSE::Vector<typename To::EntryType>::Size == To::Size)> = nullarg);
+    enable_if<(SSE::is_vector<From>::value &&
+               Detail::is_sse_sized_avx2_vector<To>::value)> = nullarg);
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To simd_cast(
     From x0, From x1, From x2, From x3, From x4, From x5, From x6, From x7,
-    enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-               SSE::Vector<typename To::EntryType>::Size == To::Size)> = nullarg);
+    enable_if<(SSE::is_vector<From>::value &&
+               Detail::is_sse_sized_avx2_vector<To>::value)> = nullarg);
 
 // Declarations: Vector casts without offset {{{1
 // AVX2::Vector {{{2
@@ -417,6 +486,11 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)> = nullarg);
 #endif
 
 // 2 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -445,6 +519,11 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)> = nullarg);
 #endif
 
 // 3 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -473,6 +552,11 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)> = nullarg);
 #endif
 
 // 4 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -507,6 +591,12 @@ Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
           Scalar::Vector<T> x3,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)> = nullarg);
 #endif
 
 // 5 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -792,6 +882,42 @@ template <typename To, typename FromT>
 Vc_INTRINSIC Vc_CONST To simd_cast(AVX2::Vector<FromT> x,
                                    enable_if<Scalar::is_vector<To>::value> = nullarg);
 
+// 1-4 Vector to 1 Vector, where one side is an AVX2 (u)llong_v {{{2
+#ifdef Vc_IMPL_AVX2
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<Detail::is_int64_avx2_cast<To, From>::value> = nullarg);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1,
+          enable_if<Detail::is_int64_avx2_cast<To, From>::value> = nullarg);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2,
+          enable_if<Detail::is_int64_avx2_cast<To, From>::value> = nullarg);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2, From x3,
+          enable_if<Detail::is_int64_avx2_cast<To, From>::value> = nullarg);
+#endif
+
+// 1-4 Vector to 1 Vector, where one side is an 8-bit integer vector {{{2
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<Detail::is_int8_avx2_cast<To, From>::value> = nullarg);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1,
+          enable_if<Detail::is_int8_avx2_cast<To, From>::value> = nullarg);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2,
+          enable_if<Detail::is_int8_avx2_cast<To, From>::value> = nullarg);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2, From x3,
+          enable_if<Detail::is_int8_avx2_cast<To, From>::value> = nullarg);
+
 // Declarations: Mask casts without offset {{{1
 // 1 AVX2::Mask to 1 AVX2::Mask {{{2
 template <typename Return, typename T>
@@ -1179,40 +1305,40 @@ simd_cast(AVX2::Mask<T> x);
 // equivalent SSE Vector
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To
-simd_cast(From x, enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-                             SSE::Vector<typename To::EntryType>::Size == To::Size)>)
+simd_cast(From x, enable_if<(SSE::is_vector<From>::value &&
+                             Detail::is_sse_sized_avx2_vector<To>::value)>)
 {
     return simd_cast<SSE::Vector<typename To::EntryType>>(x).data();
 }
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To
 simd_cast(From x0, From x1,
-          enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-                     SSE::Vector<typename To::EntryType>::Size == To::Size)>)
+          enable_if<(SSE::is_vector<From>::value &&
+                     Detail::is_sse_sized_avx2_vector<To>::value)>)
 {
     return simd_cast<SSE::Vector<typename To::EntryType>>(x0, x1).data();
 }
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To
 simd_cast(From x0, From x1, From x2,
-          enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-                     SSE::Vector<typename To::EntryType>::Size == To::Size)>)
+          enable_if<(SSE::is_vector<From>::value &&
+                     Detail::is_sse_sized_avx2_vector<To>::value)>)
 {
     return simd_cast<SSE::Vector<typename To::EntryType>>(x0, x1, x2).data();
 }
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To
 simd_cast(From x0, From x1, From x2, From x3,
-          enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-                     SSE::Vector<typename To::EntryType>::Size == To::Size)>)
+          enable_if<(SSE::is_vector<From>::value &&
+                     Detail::is_sse_sized_avx2_vector<To>::value)>)
 {
     return simd_cast<SSE::Vector<typename To::EntryType>>(x0, x1, x2, x3).data();
 }
 template <typename To, typename From>
 Vc_INTRINSIC Vc_CONST To
 simd_cast(From x0, From x1, From x2, From x3, From x4, From x5, From x6, From x7,
-          enable_if<(AVX2::is_vector<To>::value && SSE::is_vector<From>::value &&
-                     SSE::Vector<typename To::EntryType>::Size == To::Size)>)
+          enable_if<(SSE::is_vector<From>::value &&
+                     Detail::is_sse_sized_avx2_vector<To>::value)>)
 {
     return simd_cast<SSE::Vector<typename To::EntryType>>(x0, x1, x2, x3, x4, x5, x6, x7)
         .data();
@@ -2232,6 +2358,47 @@ simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
                              x10.data(), x11.data(), x12.data(), x13.data(), x14.data(),
                              x15.data());
 }
+
+// 1-4 Scalar::Vector to 1 AVX2::llong_v/ullong_v {{{2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x.data()), 0, 0, 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x0.data()), static_cast<U>(x1.data()), 0, 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x0.data()), static_cast<U>(x1.data()),
+                              static_cast<U>(x2.data()), 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x0.data()), static_cast<U>(x1.data()),
+                              static_cast<U>(x2.data()), static_cast<U>(x3.data()));
+}
 #endif
 
 // 1 AVX2::Vector to 1 Scalar::Vector {{{2
@@ -2242,6 +2409,468 @@ simd_cast(AVX2::Vector<FromT> x, enable_if<Scalar::is_vector<To>::value>)
     return static_cast<To>(x[0]);
 }
 
+// ElementwiseCast {{{2
+namespace Detail
+{
+// converts entry by entry; entries of To beyond the inputs are zero
+template <typename To, typename From> struct ElementwiseCast {
+    template <typename... Froms> static Vc_INTRINSIC To cast(const Froms &... xs)
+    {
+        using T = typename To::EntryType;
+        const From x[] = {xs...};
+        return To::generate([&](int i) {
+            return std::size_t(i) < sizeof...(Froms) * From::Size
+                       ? static_cast<T>(x[i / From::Size][i % From::Size])
+                       : T();
+        });
+    }
+};
+}  // namespace Detail
+
+// 1-4 Vector to 1 Vector, where one side is an AVX2 (u)llong_v {{{2
+#ifdef Vc_IMPL_AVX2
+namespace Detail
+{
+
+// Int64Cast {{{3
+template <typename To, typename From>
+struct Int64Cast : public ElementwiseCast<To, From> {
+};
+
+// llong_v <-> ullong_v {{{3
+template <>
+struct Int64Cast<AVX2::llong_v, AVX2::ullong_v>
+    : public ElementwiseCast<AVX2::llong_v, AVX2::ullong_v> {
+    using ElementwiseCast<AVX2::llong_v, AVX2::ullong_v>::cast;
+    static Vc_INTRINSIC AVX2::llong_v cast(AVX2::ullong_v x) { return x.data(); }
+};
+template <>
+struct Int64Cast<AVX2::ullong_v, AVX2::llong_v>
+    : public ElementwiseCast<AVX2::ullong_v, AVX2::llong_v> {
+    using ElementwiseCast<AVX2::ullong_v, AVX2::llong_v>::cast;
+    static Vc_INTRINSIC AVX2::ullong_v cast(AVX2::llong_v x) { return x.data(); }
+};
+
+// (u)llong_v <-> double_v {{{3
+template <typename T>
+struct Int64Cast<AVX2::double_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::double_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::double_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::double_v cast(AVX2::Vector<T> x)
+    {
+#ifdef Vc_IMPL_AVX512
+        return std::is_signed<T>::value ? _mm256_cvtepi64_pd(x.data())
+                                        : _mm256_cvtepu64_pd(x.data());
+#else
+        return AVX::concat(SSE::convert<T, double>(AVX::lo128(x.data())),
+                           SSE::convert<T, double>(AVX::hi128(x.data())));
+#endif
+    }
+};
+template <typename T>
+struct Int64Cast<AVX2::Vector<T>, AVX2::double_v>
+    : public ElementwiseCast<AVX2::Vector<T>, AVX2::double_v> {
+    using ElementwiseCast<AVX2::Vector<T>, AVX2::double_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(AVX2::double_v x)
+    {
+#ifdef Vc_IMPL_AVX512
+        return std::is_signed<T>::value ? _mm256_cvttpd_epi64(x.data())
+                                        : _mm256_cvttpd_epu64(x.data());
+#else
+        return AVX::concat(SSE::convert<double, T>(AVX::lo128(x.data())),
+                           SSE::convert<double, T>(AVX::hi128(x.data())));
+#endif
+    }
+};
+
+// (u)llong_v -> float_v {{{3
+template <typename T>
+struct Int64Cast<AVX2::float_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::float_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::float_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::float_v cast(AVX2::Vector<T> x)
+    {
+        return AVX::zeroExtend(
+            _mm256_cvtpd_ps(Int64Cast<AVX2::double_v, AVX2::Vector<T>>::cast(x).data()));
+    }
+    static Vc_INTRINSIC AVX2::float_v cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1)
+    {
+        return AVX::concat(
+            _mm256_cvtpd_ps(Int64Cast<AVX2::double_v, AVX2::Vector<T>>::cast(x0).data()),
+            _mm256_cvtpd_ps(Int64Cast<AVX2::double_v, AVX2::Vector<T>>::cast(x1).data()));
+    }
+};
+template <typename T>
+struct Int64Cast<SSE::float_v, AVX2::Vector<T>>
+    : public ElementwiseCast<SSE::float_v, AVX2::Vector<T>> {
+    using ElementwiseCast<SSE::float_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC SSE::float_v cast(AVX2::Vector<T> x)
+    {
+        return _mm256_cvtpd_ps(Int64Cast<AVX2::double_v, AVX2::Vector<T>>::cast(x).data());
+    }
+};
+
+// (u)int_v -> (u)llong_v {{{3
+template <typename T>
+struct Int64Cast<AVX2::Vector<T>, SSE::int_v>
+    : public ElementwiseCast<AVX2::Vector<T>, SSE::int_v> {
+    using ElementwiseCast<AVX2::Vector<T>, SSE::int_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(SSE::int_v x)
+    {
+        return _mm256_cvtepi32_epi64(x.data());
+    }
+};
+template <typename T>
+struct Int64Cast<AVX2::Vector<T>, SSE::uint_v>
+    : public ElementwiseCast<AVX2::Vector<T>, SSE::uint_v> {
+    using ElementwiseCast<AVX2::Vector<T>, SSE::uint_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(SSE::uint_v x)
+    {
+        return _mm256_cvtepu32_epi64(x.data());
+    }
+};
+template <typename T>
+struct Int64Cast<AVX2::Vector<T>, AVX2::int_v>
+    : public ElementwiseCast<AVX2::Vector<T>, AVX2::int_v> {
+    using ElementwiseCast<AVX2::Vector<T>, AVX2::int_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(AVX2::int_v x)
+    {
+        return _mm256_cvtepi32_epi64(AVX::lo128(x.data()));
+    }
+};
+template <typename T>
+struct Int64Cast<AVX2::Vector<T>, AVX2::uint_v>
+    : public ElementwiseCast<AVX2::Vector<T>, AVX2::uint_v> {
+    using ElementwiseCast<AVX2::Vector<T>, AVX2::uint_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(AVX2::uint_v x)
+    {
+        return _mm256_cvtepu32_epi64(AVX::lo128(x.data()));
+    }
+};
+
+// (u)llong_v -> (u)int_v {{{3
+// truncates to the low 32 bits of each entry
+Vc_INTRINSIC __m128i truncate_epi64_epi32(__m256i x)
+{
+    return AVX::lo128(
+        _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+}
+template <typename T>
+struct Int64Cast<SSE::int_v, AVX2::Vector<T>>
+    : public ElementwiseCast<SSE::int_v, AVX2::Vector<T>> {
+    using ElementwiseCast<SSE::int_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC SSE::int_v cast(AVX2::Vector<T> x) { return truncate_epi64_epi32(x.data()); }
+};
+template <typename T>
+struct Int64Cast<SSE::uint_v, AVX2::Vector<T>>
+    : public ElementwiseCast<SSE::uint_v, AVX2::Vector<T>> {
+    using ElementwiseCast<SSE::uint_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC SSE::uint_v cast(AVX2::Vector<T> x) { return truncate_epi64_epi32(x.data()); }
+};
+template <typename T>
+struct Int64Cast<AVX2::int_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::int_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::int_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::int_v cast(AVX2::Vector<T> x)
+    {
+        return AVX::zeroExtend(truncate_epi64_epi32(x.data()));
+    }
+    static Vc_INTRINSIC AVX2::int_v cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1)
+    {
+        return AVX::concat(truncate_epi64_epi32(x0.data()), truncate_epi64_epi32(x1.data()));
+    }
+};
+template <typename T>
+struct Int64Cast<AVX2::uint_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::uint_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::uint_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::uint_v cast(AVX2::Vector<T> x)
+    {
+        return AVX::zeroExtend(truncate_epi64_epi32(x.data()));
+    }
+    static Vc_INTRINSIC AVX2::uint_v cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1)
+    {
+        return AVX::concat(truncate_epi64_epi32(x0.data()), truncate_epi64_epi32(x1.data()));
+    }
+};
+
+// SSE::(u)llong_v <-> AVX2::(u)llong_v {{{3
+template <typename T>
+struct Int64Cast<AVX2::Vector<T>, SSE::Vector<T>>
+    : public ElementwiseCast<AVX2::Vector<T>, SSE::Vector<T>> {
+    using ElementwiseCast<AVX2::Vector<T>, SSE::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(SSE::Vector<T> x)
+    {
+        return AVX::zeroExtend(x.data());
+    }
+    static Vc_INTRINSIC AVX2::Vector<T> cast(SSE::Vector<T> x0, SSE::Vector<T> x1)
+    {
+        return AVX::concat(x0.data(), x1.data());
+    }
+};
+template <typename T>
+struct Int64Cast<SSE::Vector<T>, AVX2::Vector<T>>
+    : public ElementwiseCast<SSE::Vector<T>, AVX2::Vector<T>> {
+    using ElementwiseCast<SSE::Vector<T>, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC SSE::Vector<T> cast(AVX2::Vector<T> x) { return AVX::lo128(x.data()); }
+};
+// }}}3
+}  // namespace Detail
+
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<Detail::is_int64_avx2_cast<To, From>::value>)
+{
+    return Detail::Int64Cast<To, From>::cast(x);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, enable_if<Detail::is_int64_avx2_cast<To, From>::value>)
+{
+    return Detail::Int64Cast<To, From>::cast(x0, x1);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To simd_cast(From x0, From x1, From x2,
+                                   enable_if<Detail::is_int64_avx2_cast<To, From>::value>)
+{
+    return Detail::Int64Cast<To, From>::cast(x0, x1, x2);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To simd_cast(From x0, From x1, From x2, From x3,
+                                   enable_if<Detail::is_int64_avx2_cast<To, From>::value>)
+{
+    return Detail::Int64Cast<To, From>::cast(x0, x1, x2, x3);
+}
+#endif
+
+// 1-4 Vector to 1 Vector, where one side is an 8-bit integer vector {{{2
+namespace Detail
+{
+// Int8Cast {{{3
+template <typename To, typename From>
+struct Int8Cast : public ElementwiseCast<To, From> {
+};
+
+// SSE::(u)schar_v -> float_v, double_v {{{3
+template <typename T>
+struct Int8Cast<AVX2::float_v, SSE::Vector<T>>
+    : public ElementwiseCast<AVX2::float_v, SSE::Vector<T>> {
+    using ElementwiseCast<AVX2::float_v, SSE::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::float_v cast(SSE::Vector<T> x)
+    {
+        const __m128i lo = std::is_signed<T>::value ? SSE::cvtepi8_epi32(x.data())
+                                                    : SSE::cvtepu8_epi32(x.data());
+        const __m128i hi =
+            std::is_signed<T>::value ? SSE::cvtepi8_epi32(_mm_srli_si128(x.data(), 4))
+                                     : SSE::cvtepu8_epi32(_mm_srli_si128(x.data(), 4));
+        return _mm256_cvtepi32_ps(AVX::concat(lo, hi));
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::double_v, SSE::Vector<T>>
+    : public ElementwiseCast<AVX2::double_v, SSE::Vector<T>> {
+    using ElementwiseCast<AVX2::double_v, SSE::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::double_v cast(SSE::Vector<T> x)
+    {
+        return _mm256_cvtepi32_pd(std::is_signed<T>::value
+                                      ? SSE::cvtepi8_epi32(x.data())
+                                      : SSE::cvtepu8_epi32(x.data()));
+    }
+};
+
+#ifdef Vc_IMPL_AVX2
+// schar_v <-> uchar_v {{{3
+template <>
+struct Int8Cast<AVX2::schar_v, AVX2::uchar_v>
+    : public ElementwiseCast<AVX2::schar_v, AVX2::uchar_v> {
+    using ElementwiseCast<AVX2::schar_v, AVX2::uchar_v>::cast;
+    static Vc_INTRINSIC AVX2::schar_v cast(AVX2::uchar_v x) { return x.data(); }
+};
+template <>
+struct Int8Cast<AVX2::uchar_v, AVX2::schar_v>
+    : public ElementwiseCast<AVX2::uchar_v, AVX2::schar_v> {
+    using ElementwiseCast<AVX2::uchar_v, AVX2::schar_v>::cast;
+    static Vc_INTRINSIC AVX2::uchar_v cast(AVX2::schar_v x) { return x.data(); }
+};
+
+// (u)schar_v -> (u)short_v, (u)int_v, float_v, double_v {{{3
+// the extension only depends on the signedness of the source
+template <typename T> Vc_INTRINSIC __m256i convert_int8_to_int16(__m128i x)
+{
+    return std::is_signed<T>::value ? _mm256_cvtepi8_epi16(x) : _mm256_cvtepu8_epi16(x);
+}
+template <typename T> Vc_INTRINSIC __m256i convert_int8_to_int32(__m128i x)
+{
+    return std::is_signed<T>::value ? _mm256_cvtepi8_epi32(x) : _mm256_cvtepu8_epi32(x);
+}
+template <typename T>
+struct Int8Cast<AVX2::short_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::short_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::short_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::short_v cast(AVX2::Vector<T> x)
+    {
+        return convert_int8_to_int16<T>(AVX::lo128(x.data()));
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::ushort_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::ushort_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::ushort_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::ushort_v cast(AVX2::Vector<T> x)
+    {
+        return convert_int8_to_int16<T>(AVX::lo128(x.data()));
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::int_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::int_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::int_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::int_v cast(AVX2::Vector<T> x)
+    {
+        return convert_int8_to_int32<T>(AVX::lo128(x.data()));
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::uint_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::uint_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::uint_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::uint_v cast(AVX2::Vector<T> x)
+    {
+        return convert_int8_to_int32<T>(AVX::lo128(x.data()));
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::float_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::float_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::float_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::float_v cast(AVX2::Vector<T> x)
+    {
+        return _mm256_cvtepi32_ps(convert_int8_to_int32<T>(AVX::lo128(x.data())));
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::double_v, AVX2::Vector<T>>
+    : public ElementwiseCast<AVX2::double_v, AVX2::Vector<T>> {
+    using ElementwiseCast<AVX2::double_v, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::double_v cast(AVX2::Vector<T> x)
+    {
+        return _mm256_cvtepi32_pd(std::is_signed<T>::value
+                                      ? SSE::cvtepi8_epi32(AVX::lo128(x.data()))
+                                      : SSE::cvtepu8_epi32(AVX::lo128(x.data())));
+    }
+};
+
+// (u)short_v, (u)int_v -> (u)schar_v {{{3
+// the narrowing is modular, i.e. it keeps the low 8 bits of each entry
+Vc_INTRINSIC __m256i convert_int16_to_int8(__m256i a, __m256i b)
+{
+    const __m256i mask = _mm256_set1_epi16(0x00ff);
+    return _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(_mm256_and_si256(a, mask), _mm256_and_si256(b, mask)),
+        _MM_SHUFFLE(3, 1, 2, 0));
+}
+Vc_INTRINSIC __m256i convert_int32_to_int8(__m256i a, __m256i b, __m256i c, __m256i d)
+{
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    const __m256i ab = _mm256_packs_epi32(_mm256_and_si256(a, mask), _mm256_and_si256(b, mask));
+    const __m256i cd = _mm256_packs_epi32(_mm256_and_si256(c, mask), _mm256_and_si256(d, mask));
+    return _mm256_permutevar8x32_epi32(_mm256_packus_epi16(ab, cd),
+                                       _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+template <typename T>
+struct Int8Cast<AVX2::Vector<T>, AVX2::short_v>
+    : public ElementwiseCast<AVX2::Vector<T>, AVX2::short_v> {
+    using ElementwiseCast<AVX2::Vector<T>, AVX2::short_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(AVX2::short_v x0,
+                                             AVX2::short_v x1 = AVX2::short_v::Zero())
+    {
+        return convert_int16_to_int8(x0.data(), x1.data());
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::Vector<T>, AVX2::ushort_v>
+    : public ElementwiseCast<AVX2::Vector<T>, AVX2::ushort_v> {
+    using ElementwiseCast<AVX2::Vector<T>, AVX2::ushort_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(AVX2::ushort_v x0,
+                                             AVX2::ushort_v x1 = AVX2::ushort_v::Zero())
+    {
+        return convert_int16_to_int8(x0.data(), x1.data());
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::Vector<T>, AVX2::int_v>
+    : public ElementwiseCast<AVX2::Vector<T>, AVX2::int_v> {
+    using ElementwiseCast<AVX2::Vector<T>, AVX2::int_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(AVX2::int_v x0,
+                                             AVX2::int_v x1 = AVX2::int_v::Zero(),
+                                             AVX2::int_v x2 = AVX2::int_v::Zero(),
+                                             AVX2::int_v x3 = AVX2::int_v::Zero())
+    {
+        return convert_int32_to_int8(x0.data(), x1.data(), x2.data(), x3.data());
+    }
+};
+template <typename T>
+struct Int8Cast<AVX2::Vector<T>, AVX2::uint_v>
+    : public ElementwiseCast<AVX2::Vector<T>, AVX2::uint_v> {
+    using ElementwiseCast<AVX2::Vector<T>, AVX2::uint_v>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(AVX2::uint_v x0,
+                                             AVX2::uint_v x1 = AVX2::uint_v::Zero(),
+                                             AVX2::uint_v x2 = AVX2::uint_v::Zero(),
+                                             AVX2::uint_v x3 = AVX2::uint_v::Zero())
+    {
+        return convert_int32_to_int8(x0.data(), x1.data(), x2.data(), x3.data());
+    }
+};
+
+// SSE::(u)schar_v <-> AVX2::(u)schar_v {{{3
+template <typename T>
+struct Int8Cast<AVX2::Vector<T>, SSE::Vector<T>>
+    : public ElementwiseCast<AVX2::Vector<T>, SSE::Vector<T>> {
+    using ElementwiseCast<AVX2::Vector<T>, SSE::Vector<T>>::cast;
+    static Vc_INTRINSIC AVX2::Vector<T> cast(SSE::Vector<T> x)
+    {
+        return AVX::zeroExtend(x.data());
+    }
+    static Vc_INTRINSIC AVX2::Vector<T> cast(SSE::Vector<T> x0, SSE::Vector<T> x1)
+    {
+        return AVX::concat(x0.data(), x1.data());
+    }
+};
+template <typename T>
+struct Int8Cast<SSE::Vector<T>, AVX2::Vector<T>>
+    : public ElementwiseCast<SSE::Vector<T>, AVX2::Vector<T>> {
+    using ElementwiseCast<SSE::Vector<T>, AVX2::Vector<T>>::cast;
+    static Vc_INTRINSIC SSE::Vector<T> cast(AVX2::Vector<T> x) { return AVX::lo128(x.data()); }
+};
+#endif  // Vc_IMPL_AVX2
+// }}}3
+}  // namespace Detail
+
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<Detail::is_int8_avx2_cast<To, From>::value>)
+{
+    return Detail::Int8Cast<To, From>::cast(x);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, enable_if<Detail::is_int8_avx2_cast<To, From>::value>)
+{
+    return Detail::Int8Cast<To, From>::cast(x0, x1);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To simd_cast(From x0, From x1, From x2,
+                                   enable_if<Detail::is_int8_avx2_cast<To, From>::value>)
+{
+    return Detail::Int8Cast<To, From>::cast(x0, x1, x2);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To simd_cast(From x0, From x1, From x2, From x3,
+                                   enable_if<Detail::is_int8_avx2_cast<To, From>::value>)
+{
+    return Detail::Int8Cast<To, From>::cast(x0, x1, x2, x3);
+}
+
 // Mask casts without offset {{{1
 // 1 AVX2::Mask to 1 AVX2::Mask {{{2
 template <typename Return, typename T>
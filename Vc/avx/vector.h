@@ -203,6 +203,14 @@ public:
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<T, Vector<U, A>, Scale> &args)
         {
+#ifdef Vc_USE_CALIBRATED_GATHERS
+            const auto impl = Common::calibratedGatherImplementation<Vector>();
+            if (impl != Common::GatherScatterImplementation::Hardware) {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes,
+                                      Mask(true));
+                return;
+            }
+#endif
             d.v() = AVX::gather<sizeof(T) * Scale>(
                 args.address,
                 simd_cast<conditional_t<Size == 4, SSE::int_v, AVX2::int_v>>(args.indexes)
@@ -215,6 +223,13 @@ public:
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<T, Vector<U, A>, Scale> &args, MaskArgument k)
         {
+#ifdef Vc_USE_CALIBRATED_GATHERS
+            const auto impl = Common::calibratedGatherImplementation<Vector>();
+            if (impl != Common::GatherScatterImplementation::Hardware) {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes, k);
+                return;
+            }
+#endif
             d.v() = AVX::gather<sizeof(T) * Scale>(
                 d.v(), k.data(), args.address,
                 simd_cast<conditional_t<Size == 4, SSE::int_v, AVX2::int_v>>(args.indexes)
@@ -278,9 +293,11 @@ public:
         }
 
         ////////////////////////////////////////////////////////////////////////////////
-        // all remaining converting gathers
+        // all remaining converting gathers; fixed_size_simd has no 8-bit entry types,
+        // therefore 8-bit memory types use the generic gather
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
+                                sizeof(MT) != 1 &&
                                 Traits::is_valid_vector_argument<MT>::value &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
@@ -293,6 +310,7 @@ public:
         // masked overload
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
+                                sizeof(MT) != 1 &&
                                 Traits::is_valid_vector_argument<MT>::value &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
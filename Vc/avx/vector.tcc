@@ -76,6 +76,30 @@ Vc_INTRINSIC AVX2::   int_m operator< (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator< (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmplt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator< (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmplt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator< (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmplt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator==(AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator==(AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator!=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator!=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator>=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpgt_epi64(b.data(), a.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator>=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(b.data(), a.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator<=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpgt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator<=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator> (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator> (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator< (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpgt_epi64(b.data(), a.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator< (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(b.data(), a.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator==(AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator==(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator!=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator!=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator>=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8(b.data(), a.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator>=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(_mm256_max_epu8(a.data(), b.data()), a.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator<=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator<=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(_mm256_min_epu8(a.data(), b.data()), a.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator> (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator> (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator< (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8(b.data(), a.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator< (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(b.data(), a.data()); }
 #endif  // Vc_IMPL_AVX2
 
 // bitwise operators {{{1
@@ -229,6 +253,94 @@ template <> template <typename G> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::ge
     const auto tmp15 = gen(15);
     return _mm256_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
 }
+template <> template <typename G> Vc_INTRINSIC AVX2::llong_v AVX2::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::schar_v AVX2::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::uchar_v AVX2::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31);
+}
 #endif
 
 // constants {{{1
@@ -243,6 +355,8 @@ template <> Vc_INTRINSIC Vector< short, VectorAbi::Avx>::Vector(VectorSpecialIni
 template <> Vc_INTRINSIC Vector<ushort, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu16()) {}
 template <> Vc_INTRINSIC Vector< schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi8()) {}
 template <> Vc_INTRINSIC Vector< uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu8()) {}
+template <> Vc_INTRINSIC Vector< llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+template <> Vc_INTRINSIC Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
 #endif
 
 template <typename T>
@@ -262,6 +376,30 @@ Vc_ALWAYS_INLINE Vector<double, VectorAbi::Avx>::Vector(VectorSpecialInitializer
     : Vector(AVX::IndexesFromZeroData<int>::address(), Vc::Aligned)
 {
 }
+#ifdef Vc_IMPL_AVX2
+template <>
+Vc_ALWAYS_INLINE Vector<llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi64x(0, 1, 2, 3))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+                         19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+                         19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31))
+{
+}
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // load member functions {{{1
@@ -343,6 +481,14 @@ template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator>>(AsArg x) const { return AVX::srav_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator>>(AsArg x) const { return _mm256_srlv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <typename T>
 Vc_ALWAYS_INLINE AVX2::Vector<T> &Vector<T, VectorAbi::Avx>::operator<<=(AsArg x)
 {
@@ -426,6 +572,26 @@ Vc_GATHER_IMPL(ushort_v)
                               Vc_M(6), Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11),
                               Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15));
 }
+
+Vc_GATHER_IMPL(llong_v) { d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
+
+Vc_GATHER_IMPL(ullong_v) { d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
+
+Vc_GATHER_IMPL(schar_v)
+{
+    d.v() = _mm256_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6), Vc_M(7),
+                             Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15),
+                             Vc_M(16), Vc_M(17), Vc_M(18), Vc_M(19), Vc_M(20), Vc_M(21), Vc_M(22), Vc_M(23),
+                             Vc_M(24), Vc_M(25), Vc_M(26), Vc_M(27), Vc_M(28), Vc_M(29), Vc_M(30), Vc_M(31));
+}
+
+Vc_GATHER_IMPL(uchar_v)
+{
+    d.v() = _mm256_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6), Vc_M(7),
+                             Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15),
+                             Vc_M(16), Vc_M(17), Vc_M(18), Vc_M(19), Vc_M(20), Vc_M(21), Vc_M(22), Vc_M(23),
+                             Vc_M(24), Vc_M(25), Vc_M(26), Vc_M(27), Vc_M(28), Vc_M(29), Vc_M(30), Vc_M(31));
+}
 #endif
 #undef Vc_M
 #undef Vc_GATHER_IMPL
@@ -538,7 +704,7 @@ template <> Vc_INTRINSIC std::pair<AVX2::float_v, int> AVX2::float_v::minIndex()
 
     // 28 cycles Latency:
     __m256 x = d.v();
-    __m256 idx = Vector<float>::IndexesFromZero().data();
+    __m256 idx = AVX2::float_v::IndexesFromZero().data();
     __m256 y = Mem::permute128<X1, X0>(x);
     __m256 idy = Mem::permute128<X1, X0>(idx);
     __m256 less = AVX::cmplt_ps(x, y);
@@ -797,6 +963,106 @@ template<typename T> Vc_INTRINSIC AVX2::Vector<T> Vector<T, VectorAbi::Avx>::rot
     return Detail::rotated<EntryType, size()>(d.v(), amount);
 }
 // sorted {{{1
+#ifdef Vc_IMPL_AVX2
+namespace Detail
+{
+/**\internal
+ * Sorts the four 64-bit entries of \p x with a bitonic network of three min/max stages.
+ */
+template <typename Min, typename Max>
+Vc_INTRINSIC Vc_CONST __m256i sorted_epi64(__m256i x, Min min, Max max)
+{
+    // sort the pairs (0, 1) and (2, 3)
+    __m256i y = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_epi32(min(x, y), max(x, y), 0xcc);
+    // the pairs are sorted, so comparing (0, 3) and (1, 2) yields the lower and the upper
+    // half
+    y = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(0, 1, 2, 3));
+    x = _mm256_blend_epi32(min(x, y), max(x, y), 0xf0);
+    // sort the pairs of both halves
+    y = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm256_blend_epi32(min(x, y), max(x, y), 0xcc);
+}
+inline Vc_CONST AVX2::llong_v sorted(AVX2::llong_v x)
+{
+    return sorted_epi64(x.data(), AVX::min_epi64, AVX::max_epi64);
+}
+inline Vc_CONST AVX2::ullong_v sorted(AVX2::ullong_v x)
+{
+    return sorted_epi64(x.data(), AVX::min_epu64, AVX::max_epu64);
+}
+
+// returns the entries i ^ J of the 8-bit entries of x
+Vc_INTRINSIC __m256i xor_permute_epi8(__m256i x, std::integral_constant<int, 1>)
+{
+    return _mm256_or_si256(_mm256_slli_epi16(x, 8), _mm256_srli_epi16(x, 8));
+}
+Vc_INTRINSIC __m256i xor_permute_epi8(__m256i x, std::integral_constant<int, 2>)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)),
+                                  _MM_SHUFFLE(2, 3, 0, 1));
+}
+Vc_INTRINSIC __m256i xor_permute_epi8(__m256i x, std::integral_constant<int, 4>)
+{
+    return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+Vc_INTRINSIC __m256i xor_permute_epi8(__m256i x, std::integral_constant<int, 8>)
+{
+    return _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+}
+Vc_INTRINSIC __m256i xor_permute_epi8(__m256i x, std::integral_constant<int, 16>)
+{
+    return _mm256_permute2x128_si256(x, x, 0x01);
+}
+
+/**\internal
+ * One compare-exchange stage of a bitonic sort network, see the SSE variant.
+ */
+template <typename T, int J, int K> Vc_INTRINSIC __m256i bitonic_stage_epi8(__m256i x)
+{
+    const __m256i y = xor_permute_epi8(x, std::integral_constant<int, J>());
+    const __m256i iota =
+        _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+                         19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i takeMax = _mm256_xor_si256(
+        _mm256_cmpeq_epi8(_mm256_and_si256(iota, _mm256_set1_epi8(J)), zero),
+        _mm256_cmpeq_epi8(_mm256_and_si256(iota, _mm256_set1_epi8(K)), zero));
+    const __m256i lo =
+        std::is_signed<T>::value ? _mm256_min_epi8(x, y) : _mm256_min_epu8(x, y);
+    const __m256i hi =
+        std::is_signed<T>::value ? _mm256_max_epi8(x, y) : _mm256_max_epu8(x, y);
+    return _mm256_blendv_epi8(lo, hi, takeMax);
+}
+
+template <typename T> Vc_INTRINSIC __m256i sorted_epi8(__m256i x)
+{
+    x = bitonic_stage_epi8<T, 1, 2>(x);
+    x = bitonic_stage_epi8<T, 2, 4>(x);
+    x = bitonic_stage_epi8<T, 1, 4>(x);
+    x = bitonic_stage_epi8<T, 4, 8>(x);
+    x = bitonic_stage_epi8<T, 2, 8>(x);
+    x = bitonic_stage_epi8<T, 1, 8>(x);
+    x = bitonic_stage_epi8<T, 8, 16>(x);
+    x = bitonic_stage_epi8<T, 4, 16>(x);
+    x = bitonic_stage_epi8<T, 2, 16>(x);
+    x = bitonic_stage_epi8<T, 1, 16>(x);
+    x = bitonic_stage_epi8<T, 16, 32>(x);
+    x = bitonic_stage_epi8<T, 8, 32>(x);
+    x = bitonic_stage_epi8<T, 4, 32>(x);
+    x = bitonic_stage_epi8<T, 2, 32>(x);
+    return bitonic_stage_epi8<T, 1, 32>(x);
+}
+inline Vc_CONST AVX2::schar_v sorted(AVX2::schar_v x)
+{
+    return sorted_epi8<schar>(x.data());
+}
+inline Vc_CONST AVX2::uchar_v sorted(AVX2::uchar_v x)
+{
+    return sorted_epi8<uchar>(x.data());
+}
+}  // namespace Detail
+#endif  // Vc_IMPL_AVX2
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::sorted()
     const
@@ -857,6 +1123,38 @@ template <> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::interleaveHigh(AVX2::ush
     return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi16(data(), x.data()),
                                    _mm256_unpackhi_epi16(data(), x.data()));
 }
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveLow ( AVX2::llong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::llong_v  AVX2::llong_v::interleaveHigh( AVX2::llong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveLow (AVX2::ullong_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC AVX2::ullong_v AVX2::ullong_v::interleaveHigh(AVX2::ullong_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),
+                                   _mm256_unpackhi_epi64(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveLow ( AVX2::schar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveHigh( AVX2::schar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveLow ( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveHigh( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
 #endif
 // permutation via operator[] {{{1
 template <> Vc_INTRINSIC Vc_PURE AVX2::double_v AVX2::double_v::operator[](Permutation::ReversedTag) const
@@ -894,6 +1192,32 @@ Vc_INTRINSIC Vc_PURE AVX2::ushort_v AVX2::ushort_v::operator[](
         AVX::avx_cast<__m256d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
         AVX::avx_cast<__m256d>(Mem::permuteLo<X3, X2, X1, X0>(d.v())))));
 }
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::llong_v AVX2::llong_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm256_permute4x64_epi64(d.v(), _MM_SHUFFLE(0, 1, 2, 3));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::ullong_v AVX2::ullong_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm256_permute4x64_epi64(d.v(), _MM_SHUFFLE(0, 1, 2, 3));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::schar_v AVX2::schar_v::operator[](Permutation::ReversedTag) const
+{
+    const __m256i r = _mm256_shuffle_epi8(
+        d.v(), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14,
+                                13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+    return _mm256_permute4x64_epi64(r, _MM_SHUFFLE(1, 0, 3, 2));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::uchar_v AVX2::uchar_v::operator[](Permutation::ReversedTag) const
+{
+    const __m256i r = _mm256_shuffle_epi8(
+        d.v(), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14,
+                                13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+    return _mm256_permute4x64_epi64(r, _MM_SHUFFLE(1, 0, 3, 2));
+}
 #endif
 template <> Vc_INTRINSIC AVX2::float_v Vector<float, VectorAbi::Avx>::operator[](const IndexType &/*perm*/) const
 {
@@ -0,0 +1,456 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_AVX512_DETAIL_H_
+#define VC_AVX512_DETAIL_H_
+
+#include "../avx/detail.h"
+#include "intrinsics.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// allone{{{1
+template<> Vc_INTRINSIC Vc_CONST __m512i allone<__m512i>() { return _mm512_set1_epi32(-1); }
+template<> Vc_INTRINSIC Vc_CONST __m512  allone<__m512 >() { return _mm512_castsi512_ps(allone<__m512i>()); }
+template<> Vc_INTRINSIC Vc_CONST __m512d allone<__m512d>() { return _mm512_castsi512_pd(allone<__m512i>()); }
+
+// zero{{{1
+template<> Vc_INTRINSIC Vc_CONST __m512  zero<__m512 >() { return _mm512_setzero_ps(); }
+template<> Vc_INTRINSIC Vc_CONST __m512i zero<__m512i>() { return _mm512_setzero_si512(); }
+template<> Vc_INTRINSIC Vc_CONST __m512d zero<__m512d>() { return _mm512_setzero_pd(); }
+
+// load64{{{1
+Vc_INTRINSIC __m512 load64(const float *mem, when_aligned)
+{
+    return _mm512_load_ps(mem);
+}
+Vc_INTRINSIC __m512 load64(const float *mem, when_unaligned)
+{
+    return _mm512_loadu_ps(mem);
+}
+Vc_INTRINSIC __m512 load64(const float *mem, when_streaming)
+{
+    return _mm512_castsi512_ps(_mm512_stream_load_si512(const_cast<float *>(mem)));
+}
+Vc_INTRINSIC __m512d load64(const double *mem, when_aligned)
+{
+    return _mm512_load_pd(mem);
+}
+Vc_INTRINSIC __m512d load64(const double *mem, when_unaligned)
+{
+    return _mm512_loadu_pd(mem);
+}
+Vc_INTRINSIC __m512d load64(const double *mem, when_streaming)
+{
+    return _mm512_castsi512_pd(_mm512_stream_load_si512(const_cast<double *>(mem)));
+}
+template <class T> Vc_INTRINSIC __m512i load64(const T *mem, when_aligned)
+{
+    static_assert(std::is_integral<T>::value, "load64<T> is only intended for integral T");
+    return _mm512_load_si512(mem);
+}
+template <class T> Vc_INTRINSIC __m512i load64(const T *mem, when_unaligned)
+{
+    static_assert(std::is_integral<T>::value, "load64<T> is only intended for integral T");
+    return _mm512_loadu_si512(mem);
+}
+template <class T> Vc_INTRINSIC __m512i load64(const T *mem, when_streaming)
+{
+    static_assert(std::is_integral<T>::value, "load64<T> is only intended for integral T");
+    return _mm512_stream_load_si512(const_cast<T *>(mem));
+}
+
+// store64{{{1
+Vc_INTRINSIC void store64(__m512 v, float *mem, when_aligned) { _mm512_store_ps(mem, v); }
+Vc_INTRINSIC void store64(__m512 v, float *mem, when_unaligned) { _mm512_storeu_ps(mem, v); }
+Vc_INTRINSIC void store64(__m512 v, float *mem, when_streaming) { _mm512_stream_ps(mem, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, when_aligned) { _mm512_store_pd(mem, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, when_unaligned) { _mm512_storeu_pd(mem, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, when_streaming) { _mm512_stream_pd(mem, v); }
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, when_aligned) { _mm512_store_si512(mem, v); }
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, when_unaligned) { _mm512_storeu_si512(mem, v); }
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, when_streaming) { _mm512_stream_si512(reinterpret_cast<__m512i *>(mem), v); }
+
+// masked stores never fault on the masked-off entries, so alignment does not matter
+Vc_INTRINSIC void store64(__m512 v, float *mem, __mmask16 k) { _mm512_mask_storeu_ps(mem, k, v); }
+Vc_INTRINSIC void store64(__m512d v, double *mem, __mmask8 k) { _mm512_mask_storeu_pd(mem, k, v); }
+template <class T> Vc_INTRINSIC void store64(__m512i v, T *mem, __mmask16 k) { _mm512_mask_storeu_epi32(mem, k, v); }
+
+// (converting) load functions {{{1
+// no conversion {{{2
+template <typename Flags>
+Vc_INTRINSIC __m512 load(const float *mem, Flags f, LoadTag<__m512, float>)
+{
+    return load64(mem, f);
+}
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const double *mem, Flags f, LoadTag<__m512d, double>)
+{
+    return load64(mem, f);
+}
+template <typename Flags, typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC __m512i load(const T *mem, Flags f, LoadTag<__m512i, T>)
+{
+    return load64(mem, f);
+}
+
+// int {{{2
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const uint *mem, Flags f, LoadTag<__m512i, int>)
+{
+    return load64(mem, f);
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const ushort *mem, Flags f, LoadTag<__m512i, int>)
+{
+    return _mm512_cvtepu16_epi32(load32(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const short *mem, Flags f, LoadTag<__m512i, int>)
+{
+    return _mm512_cvtepi16_epi32(load32(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const uchar *mem, Flags f, LoadTag<__m512i, int>)
+{
+    return _mm512_cvtepu8_epi32(load16(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const schar *mem, Flags f, LoadTag<__m512i, int>)
+{
+    return _mm512_cvtepi8_epi32(load16(mem, f));
+}
+
+// uint {{{2
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const int *mem, Flags f, LoadTag<__m512i, uint>)
+{
+    return load64(mem, f);
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const ushort *mem, Flags f, LoadTag<__m512i, uint>)
+{
+    return _mm512_cvtepu16_epi32(load32(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const short *mem, Flags f, LoadTag<__m512i, uint>)
+{
+    return _mm512_cvtepi16_epi32(load32(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const uchar *mem, Flags f, LoadTag<__m512i, uint>)
+{
+    return _mm512_cvtepu8_epi32(load16(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512i load(const schar *mem, Flags f, LoadTag<__m512i, uint>)
+{
+    return _mm512_cvtepi8_epi32(load16(mem, f));
+}
+
+// double {{{2
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const float *mem, Flags f, LoadTag<__m512d, double>)
+{
+    return _mm512_cvtps_pd(load32(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const int *mem, Flags f, LoadTag<__m512d, double>)
+{
+    return _mm512_cvtepi32_pd(load32(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const uint *mem, Flags f, LoadTag<__m512d, double>)
+{
+    return _mm512_cvtepu32_pd(load32(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const short *mem, Flags f, LoadTag<__m512d, double>)
+{
+    return _mm512_cvtepi32_pd(_mm256_cvtepi16_epi32(load16(mem, f)));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const ushort *mem, Flags f, LoadTag<__m512d, double>)
+{
+    return _mm512_cvtepi32_pd(_mm256_cvtepu16_epi32(load16(mem, f)));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const schar *mem, Flags, LoadTag<__m512d, double>)
+{
+    return _mm512_cvtepi32_pd(
+        _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem))));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512d load(const uchar *mem, Flags, LoadTag<__m512d, double>)
+{
+    return _mm512_cvtepi32_pd(
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem))));
+}
+
+// float {{{2
+template <typename Flags>
+Vc_INTRINSIC __m512 load(const double *mem, Flags f, LoadTag<__m512, float>)
+{
+    return AVX512::concat(_mm512_cvtpd_ps(load64(&mem[0], f)),
+                          _mm512_cvtpd_ps(load64(&mem[8], f)));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512 load(const int *mem, Flags f, LoadTag<__m512, float>)
+{
+    return _mm512_cvtepi32_ps(load64(mem, f));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512 load(const uint *mem, Flags f, LoadTag<__m512, float>)
+{
+    return _mm512_cvtepu32_ps(load64(mem, f));
+}
+template <typename T, typename Flags,
+          typename = enable_if<(std::is_integral<T>::value && sizeof(T) < 4)>>
+Vc_INTRINSIC __m512 load(const T *mem, Flags f, LoadTag<__m512, float>)
+{
+    return _mm512_cvtepi32_ps(load<__m512i, int>(mem, f));
+}
+
+// broadcast{{{1
+Vc_INTRINSIC __m512  avx512_broadcast(float  x) { return _mm512_set1_ps(x); }
+Vc_INTRINSIC __m512d avx512_broadcast(double x) { return _mm512_set1_pd(x); }
+Vc_INTRINSIC __m512i avx512_broadcast(int    x) { return _mm512_set1_epi32(x); }
+Vc_INTRINSIC __m512i avx512_broadcast(uint   x) { return _mm512_set1_epi32(x); }
+
+// one{{{1
+Vc_INTRINSIC __m512  one64(float ) { return _mm512_set1_ps(1.f); }
+Vc_INTRINSIC __m512d one64(double) { return _mm512_set1_pd(1.); }
+Vc_INTRINSIC __m512i one64(int   ) { return _mm512_set1_epi32(1); }
+Vc_INTRINSIC __m512i one64(uint  ) { return _mm512_set1_epi32(1); }
+
+// xor_{{{1
+Vc_INTRINSIC __m512  xor_(__m512  a, __m512  b) { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+Vc_INTRINSIC __m512d xor_(__m512d a, __m512d b) { return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b))); }
+Vc_INTRINSIC __m512i xor_(__m512i a, __m512i b) { return _mm512_xor_si512(a, b); }
+
+// or_{{{1
+Vc_INTRINSIC __m512  or_(__m512  a, __m512  b) { return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+Vc_INTRINSIC __m512d or_(__m512d a, __m512d b) { return _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b))); }
+Vc_INTRINSIC __m512i or_(__m512i a, __m512i b) { return _mm512_or_si512(a, b); }
+
+// and_{{{1
+Vc_INTRINSIC __m512  and_(__m512  a, __m512  b) { return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+Vc_INTRINSIC __m512d and_(__m512d a, __m512d b) { return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b))); }
+Vc_INTRINSIC __m512i and_(__m512i a, __m512i b) { return _mm512_and_si512(a, b); }
+
+// andnot_{{{1
+Vc_INTRINSIC __m512  andnot_(__m512  a, __m512  b) { return _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+Vc_INTRINSIC __m512d andnot_(__m512d a, __m512d b) { return _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b))); }
+Vc_INTRINSIC __m512i andnot_(__m512i a, __m512i b) { return _mm512_andnot_si512(a, b); }
+
+// blend{{{1
+Vc_INTRINSIC __m512  blend(__m512  a, __m512  b, __mmask16 k) { return _mm512_mask_blend_ps(k, a, b); }
+Vc_INTRINSIC __m512d blend(__m512d a, __m512d b, __mmask8  k) { return _mm512_mask_blend_pd(k, a, b); }
+Vc_INTRINSIC __m512i blend(__m512i a, __m512i b, __mmask16 k) { return _mm512_mask_blend_epi32(k, a, b); }
+
+// add{{{1
+Vc_INTRINSIC __m512  add(__m512  a, __m512  b, float ) { return _mm512_add_ps(a, b); }
+Vc_INTRINSIC __m512d add(__m512d a, __m512d b, double) { return _mm512_add_pd(a, b); }
+Vc_INTRINSIC __m512i add(__m512i a, __m512i b, int   ) { return _mm512_add_epi32(a, b); }
+Vc_INTRINSIC __m512i add(__m512i a, __m512i b, uint  ) { return _mm512_add_epi32(a, b); }
+
+// sub{{{1
+Vc_INTRINSIC __m512  sub(__m512  a, __m512  b, float ) { return _mm512_sub_ps(a, b); }
+Vc_INTRINSIC __m512d sub(__m512d a, __m512d b, double) { return _mm512_sub_pd(a, b); }
+Vc_INTRINSIC __m512i sub(__m512i a, __m512i b, int   ) { return _mm512_sub_epi32(a, b); }
+Vc_INTRINSIC __m512i sub(__m512i a, __m512i b, uint  ) { return _mm512_sub_epi32(a, b); }
+
+// mul{{{1
+Vc_INTRINSIC __m512  mul(__m512  a, __m512  b, float ) { return _mm512_mul_ps(a, b); }
+Vc_INTRINSIC __m512d mul(__m512d a, __m512d b, double) { return _mm512_mul_pd(a, b); }
+Vc_INTRINSIC __m512i mul(__m512i a, __m512i b, int   ) { return _mm512_mullo_epi32(a, b); }
+Vc_INTRINSIC __m512i mul(__m512i a, __m512i b, uint  ) { return _mm512_mullo_epi32(a, b); }
+
+// mulhi{{{1
+// The upper half of the double-width product, i.e. (a * b) >> 32.
+Vc_INTRINSIC __m512i mulhi(__m512i a, __m512i b, int   )
+{
+    const __m512i even = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+    const __m512i odd =
+        _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+Vc_INTRINSIC __m512i mulhi(__m512i a, __m512i b, uint  )
+{
+    const __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+    const __m512i odd =
+        _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+
+// div{{{1
+Vc_INTRINSIC __m512  div(__m512  a, __m512  b, float ) { return _mm512_div_ps(a, b); }
+Vc_INTRINSIC __m512d div(__m512d a, __m512d b, double) { return _mm512_div_pd(a, b); }
+Vc_INTRINSIC __m512i div(__m512i a, __m512i b, int   )
+{
+    // every int is exactly representable as double, and so is the truncated quotient
+    const __m256i lo = _mm512_cvttpd_epi32(_mm512_div_pd(
+        _mm512_cvtepi32_pd(AVX512::lo256(a)), _mm512_cvtepi32_pd(AVX512::lo256(b))));
+    const __m256i hi = _mm512_cvttpd_epi32(_mm512_div_pd(
+        _mm512_cvtepi32_pd(AVX512::hi256(a)), _mm512_cvtepi32_pd(AVX512::hi256(b))));
+    return AVX512::concat(lo, hi);
+}
+Vc_INTRINSIC __m512i div(__m512i a, __m512i b, uint  )
+{
+    const __m256i lo = _mm512_cvttpd_epu32(_mm512_div_pd(
+        _mm512_cvtepu32_pd(AVX512::lo256(a)), _mm512_cvtepu32_pd(AVX512::lo256(b))));
+    const __m256i hi = _mm512_cvttpd_epu32(_mm512_div_pd(
+        _mm512_cvtepu32_pd(AVX512::hi256(a)), _mm512_cvtepu32_pd(AVX512::hi256(b))));
+    return AVX512::concat(lo, hi);
+}
+
+// horizontal add{{{1
+Vc_INTRINSIC float  add(__m512  a, float ) { return _mm512_reduce_add_ps(a); }
+Vc_INTRINSIC double add(__m512d a, double) { return _mm512_reduce_add_pd(a); }
+Vc_INTRINSIC int    add(__m512i a, int   ) { return _mm512_reduce_add_epi32(a); }
+Vc_INTRINSIC uint   add(__m512i a, uint  ) { return _mm512_reduce_add_epi32(a); }
+
+// horizontal mul{{{1
+Vc_INTRINSIC float  mul(__m512  a, float ) { return _mm512_reduce_mul_ps(a); }
+Vc_INTRINSIC double mul(__m512d a, double) { return _mm512_reduce_mul_pd(a); }
+Vc_INTRINSIC int    mul(__m512i a, int   ) { return _mm512_reduce_mul_epi32(a); }
+Vc_INTRINSIC uint   mul(__m512i a, uint  ) { return _mm512_reduce_mul_epi32(a); }
+
+// horizontal min{{{1
+Vc_INTRINSIC float  min(__m512  a, float ) { return _mm512_reduce_min_ps(a); }
+Vc_INTRINSIC double min(__m512d a, double) { return _mm512_reduce_min_pd(a); }
+Vc_INTRINSIC int    min(__m512i a, int   ) { return _mm512_reduce_min_epi32(a); }
+Vc_INTRINSIC uint   min(__m512i a, uint  ) { return _mm512_reduce_min_epu32(a); }
+
+// horizontal max{{{1
+Vc_INTRINSIC float  max(__m512  a, float ) { return _mm512_reduce_max_ps(a); }
+Vc_INTRINSIC double max(__m512d a, double) { return _mm512_reduce_max_pd(a); }
+Vc_INTRINSIC int    max(__m512i a, int   ) { return _mm512_reduce_max_epi32(a); }
+Vc_INTRINSIC uint   max(__m512i a, uint  ) { return _mm512_reduce_max_epu32(a); }
+
+// masked horizontal reductions{{{1
+Vc_INTRINSIC float  add(__m512  a, __mmask16 k, float ) { return _mm512_mask_reduce_add_ps(k, a); }
+Vc_INTRINSIC double add(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_add_pd(k, a); }
+Vc_INTRINSIC int    add(__m512i a, __mmask16 k, int   ) { return _mm512_mask_reduce_add_epi32(k, a); }
+Vc_INTRINSIC uint   add(__m512i a, __mmask16 k, uint  ) { return _mm512_mask_reduce_add_epi32(k, a); }
+Vc_INTRINSIC float  mul(__m512  a, __mmask16 k, float ) { return _mm512_mask_reduce_mul_ps(k, a); }
+Vc_INTRINSIC double mul(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_mul_pd(k, a); }
+Vc_INTRINSIC int    mul(__m512i a, __mmask16 k, int   ) { return _mm512_mask_reduce_mul_epi32(k, a); }
+Vc_INTRINSIC uint   mul(__m512i a, __mmask16 k, uint  ) { return _mm512_mask_reduce_mul_epi32(k, a); }
+Vc_INTRINSIC float  min(__m512  a, __mmask16 k, float ) { return _mm512_mask_reduce_min_ps(k, a); }
+Vc_INTRINSIC double min(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_min_pd(k, a); }
+Vc_INTRINSIC int    min(__m512i a, __mmask16 k, int   ) { return _mm512_mask_reduce_min_epi32(k, a); }
+Vc_INTRINSIC uint   min(__m512i a, __mmask16 k, uint  ) { return _mm512_mask_reduce_min_epu32(k, a); }
+Vc_INTRINSIC float  max(__m512  a, __mmask16 k, float ) { return _mm512_mask_reduce_max_ps(k, a); }
+Vc_INTRINSIC double max(__m512d a, __mmask8  k, double) { return _mm512_mask_reduce_max_pd(k, a); }
+Vc_INTRINSIC int    max(__m512i a, __mmask16 k, int   ) { return _mm512_mask_reduce_max_epi32(k, a); }
+Vc_INTRINSIC uint   max(__m512i a, __mmask16 k, uint  ) { return _mm512_mask_reduce_max_epu32(k, a); }
+
+// cmp{{{1
+template <int Cmp> Vc_INTRINSIC __mmask16 cmp(__m512  a, __m512  b, float ) { return _mm512_cmp_ps_mask(a, b, Cmp); }
+template <int Cmp> Vc_INTRINSIC __mmask8  cmp(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, Cmp); }
+template <int Cmp> Vc_INTRINSIC __mmask16 cmp(__m512i a, __m512i b, int   ) { return _mm512_cmp_epi32_mask(a, b, Cmp & 7); }
+template <int Cmp> Vc_INTRINSIC __mmask16 cmp(__m512i a, __m512i b, uint  ) { return _mm512_cmp_epu32_mask(a, b, Cmp & 7); }
+
+// shiftLeft / shiftRight{{{1
+Vc_INTRINSIC __m512i shiftLeft(__m512i a, int shift, int ) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m512i shiftLeft(__m512i a, int shift, uint) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m512i shiftRight(__m512i a, int shift, int ) { return _mm512_sra_epi32(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m512i shiftRight(__m512i a, int shift, uint) { return _mm512_srl_epi32(a, _mm_cvtsi32_si128(shift)); }
+
+// fma{{{1
+Vc_INTRINSIC __m512  fma(__m512  a, __m512  b, __m512  c, float ) { return _mm512_fmadd_ps(a, b, c); }
+Vc_INTRINSIC __m512d fma(__m512d a, __m512d b, __m512d c, double) { return _mm512_fmadd_pd(a, b, c); }
+Vc_INTRINSIC __m512i fma(__m512i a, __m512i b, __m512i c, int   ) { return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c); }
+Vc_INTRINSIC __m512i fma(__m512i a, __m512i b, __m512i c, uint  ) { return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c); }
+
+// permutexvar{{{1
+Vc_INTRINSIC __m512  permutexvar(__m512i idx, __m512  a) { return _mm512_permutexvar_ps(idx, a); }
+Vc_INTRINSIC __m512d permutexvar(__m512i idx, __m512d a) { return _mm512_permutexvar_pd(idx, a); }
+Vc_INTRINSIC __m512i permutexvar(__m512i idx, __m512i a) { return _mm512_permutexvar_epi32(idx, a); }
+
+// permutex2var{{{1
+Vc_INTRINSIC __m512  permutex2var(__m512  a, __m512i idx, __m512  b) { return _mm512_permutex2var_ps(a, idx, b); }
+Vc_INTRINSIC __m512d permutex2var(__m512d a, __m512i idx, __m512d b) { return _mm512_permutex2var_pd(a, idx, b); }
+Vc_INTRINSIC __m512i permutex2var(__m512i a, __m512i idx, __m512i b) { return _mm512_permutex2var_epi32(a, idx, b); }
+
+// compress / expand{{{1
+Vc_INTRINSIC __m512  compress(__m512  x, int bits, float ) { return _mm512_maskz_compress_ps(__mmask16(bits), x); }
+Vc_INTRINSIC __m512d compress(__m512d x, int bits, double) { return _mm512_maskz_compress_pd(__mmask8(bits), x); }
+Vc_INTRINSIC __m512i compress(__m512i x, int bits, int   ) { return _mm512_maskz_compress_epi32(__mmask16(bits), x); }
+Vc_INTRINSIC __m512i compress(__m512i x, int bits, uint  ) { return _mm512_maskz_compress_epi32(__mmask16(bits), x); }
+Vc_INTRINSIC __m512  expand(__m512  x, int bits, float ) { return _mm512_maskz_expand_ps(__mmask16(bits), x); }
+Vc_INTRINSIC __m512d expand(__m512d x, int bits, double) { return _mm512_maskz_expand_pd(__mmask8(bits), x); }
+Vc_INTRINSIC __m512i expand(__m512i x, int bits, int   ) { return _mm512_maskz_expand_epi32(__mmask16(bits), x); }
+Vc_INTRINSIC __m512i expand(__m512i x, int bits, uint  ) { return _mm512_maskz_expand_epi32(__mmask16(bits), x); }
+
+//InterleaveImpl{{{1
+/**\internal
+ * There is no shuffle network for 16 or 8 entries of 32 or 64 bit that beats a
+ * scatter/gather on AVX-512 for arbitrary struct sizes. Therefore the interleaved access
+ * simply turns the indexes into an index vector and issues one scatter/gather per member.
+ */
+template <typename V, size_t Size> struct Avx512InterleaveImpl {
+    using T = typename V::EntryType;
+    using IV = typename V::IndexType;
+
+    template <typename I> static Vc_INTRINSIC IV indexes(const I &i)
+    {
+        return IV::generate([&](size_t k) { return i[k]; });
+    }
+
+    template <typename I, typename... Vs>
+    static inline void interleave(T *const data, const I &i, const Vs &... vs)
+    {
+        const IV idx = indexes(i);
+        size_t k = 0;
+        auto &&unused = {(vs.scatter(data + k++, idx), 0)...};
+        (void)unused;
+    }
+
+    template <typename I, typename... Vs>
+    static inline void deinterleave(T const *const data, const I &i, Vs &... vs)
+    {
+        const IV idx = indexes(i);
+        size_t k = 0;
+        auto &&unused = {(vs.gather(data + k++, idx), 0)...};
+        (void)unused;
+    }
+};
+template <typename V> struct InterleaveImpl<V, 16, 64> : Avx512InterleaveImpl<V, 16> {};
+template <typename V> struct InterleaveImpl<V, 8, 64> : Avx512InterleaveImpl<V, 8> {};
+// }}}1
+}  // namespace Detail
+}  // namespace Vc
+
+#endif  // VC_AVX512_DETAIL_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,89 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_AVX512_HELPERIMPL_H_
+#define VC_AVX512_HELPERIMPL_H_
+
+#include "../avx/helperimpl.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+template <typename T, typename M, typename A>
+inline void deinterleave(AVX512::Vector<T> &a, AVX512::Vector<T> &b, const M *memory, A)
+{
+    using IV = typename AVX512::Vector<T>::IndexType;
+    const IV idx = IV([](int i) { return 2 * i; });
+    a.gather(memory, idx);
+    b.gather(memory + 1, idx);
+}
+
+// Without conversion two loads and one two-source permute per vector beat the gathers.
+template <typename T, typename A>
+inline void deinterleave(AVX512::Vector<T> &a, AVX512::Vector<T> &b, const T *memory,
+                         A align)
+{
+    using V = AVX512::Vector<T>;
+    using Sz = std::integral_constant<std::size_t, V::Size>;
+    const V lo(memory, align), hi(memory + V::Size, align);
+    // 0, 2, 4, ... and 1, 3, 5, ... index into the concatenation lo:hi
+    const __m512i i = lane_indexes(Sz());
+    const __m512i even =
+        V::Size == 16 ? _mm512_slli_epi32(i, 1) : _mm512_slli_epi64(i, 1);
+    const __m512i odd = V::Size == 16 ? _mm512_or_si512(even, _mm512_set1_epi32(1))
+                                      : _mm512_or_si512(even, _mm512_set1_epi64(1));
+    a = V(permutex2var(lo.data(), even, hi.data()));
+    b = V(permutex2var(lo.data(), odd, hi.data()));
+}
+
+Vc_ALWAYS_INLINE void prefetchForOneRead(const void *addr, VectorAbi::Avx512)
+{
+    prefetchForOneRead(addr, VectorAbi::Sse());
+}
+Vc_ALWAYS_INLINE void prefetchForModify(const void *addr, VectorAbi::Avx512)
+{
+    prefetchForModify(addr, VectorAbi::Sse());
+}
+Vc_ALWAYS_INLINE void prefetchClose(const void *addr, VectorAbi::Avx512)
+{
+    prefetchClose(addr, VectorAbi::Sse());
+}
+Vc_ALWAYS_INLINE void prefetchMid(const void *addr, VectorAbi::Avx512)
+{
+    prefetchMid(addr, VectorAbi::Sse());
+}
+Vc_ALWAYS_INLINE void prefetchFar(const void *addr, VectorAbi::Avx512)
+{
+    prefetchFar(addr, VectorAbi::Sse());
+}
+}  // namespace Detail
+}  // namespace Vc
+
+#endif // VC_AVX512_HELPERIMPL_H_
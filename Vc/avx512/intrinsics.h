@@ -0,0 +1,170 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_AVX512_INTRINSICS_H_
+#define VC_AVX512_INTRINSICS_H_
+
+#include "../avx/intrinsics.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace AVX512
+{
+template <typename T> struct VectorTypeHelper;
+template <> struct VectorTypeHelper<         int  > { typedef __m512i Type; };
+template <> struct VectorTypeHelper<unsigned int  > { typedef __m512i Type; };
+template <> struct VectorTypeHelper<         float> { typedef __m512  Type; };
+template <> struct VectorTypeHelper<        double> { typedef __m512d Type; };
+
+// avx512_cast {{{1
+template <typename To, typename From> Vc_INTRINSIC Vc_CONST To avx512_cast(From v);
+template <> Vc_INTRINSIC Vc_CONST __m512  avx512_cast(__m512  v) { return v; }
+template <> Vc_INTRINSIC Vc_CONST __m512  avx512_cast(__m512d v) { return _mm512_castpd_ps(v); }
+template <> Vc_INTRINSIC Vc_CONST __m512  avx512_cast(__m512i v) { return _mm512_castsi512_ps(v); }
+template <> Vc_INTRINSIC Vc_CONST __m512d avx512_cast(__m512  v) { return _mm512_castps_pd(v); }
+template <> Vc_INTRINSIC Vc_CONST __m512d avx512_cast(__m512d v) { return v; }
+template <> Vc_INTRINSIC Vc_CONST __m512d avx512_cast(__m512i v) { return _mm512_castsi512_pd(v); }
+template <> Vc_INTRINSIC Vc_CONST __m512i avx512_cast(__m512  v) { return _mm512_castps_si512(v); }
+template <> Vc_INTRINSIC Vc_CONST __m512i avx512_cast(__m512d v) { return _mm512_castpd_si512(v); }
+template <> Vc_INTRINSIC Vc_CONST __m512i avx512_cast(__m512i v) { return v; }
+
+// lo256 / hi256 {{{1
+Vc_INTRINSIC Vc_CONST __m256  lo256(__m512  v) { return _mm512_castps512_ps256(v); }
+Vc_INTRINSIC Vc_CONST __m256d lo256(__m512d v) { return _mm512_castpd512_pd256(v); }
+Vc_INTRINSIC Vc_CONST __m256i lo256(__m512i v) { return _mm512_castsi512_si256(v); }
+Vc_INTRINSIC Vc_CONST __m256 hi256(__m512 v)
+{
+    return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1));
+}
+Vc_INTRINSIC Vc_CONST __m256d hi256(__m512d v) { return _mm512_extractf64x4_pd(v, 1); }
+Vc_INTRINSIC Vc_CONST __m256i hi256(__m512i v) { return _mm512_extracti64x4_epi64(v, 1); }
+
+// concat {{{1
+Vc_INTRINSIC Vc_CONST __m512 concat(__m256 a, __m256 b)
+{
+    return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(a)),
+                                               _mm256_castps_pd(b), 1));
+}
+Vc_INTRINSIC Vc_CONST __m512d concat(__m256d a, __m256d b)
+{
+    return _mm512_insertf64x4(_mm512_castpd256_pd512(a), b, 1);
+}
+Vc_INTRINSIC Vc_CONST __m512i concat(__m256i a, __m256i b)
+{
+    return _mm512_inserti64x4(_mm512_castsi256_si512(a), b, 1);
+}
+
+// zeroExtend {{{1
+Vc_INTRINSIC Vc_CONST __m512  zeroExtend(__m256  v) { return concat(v, _mm256_setzero_ps()); }
+Vc_INTRINSIC Vc_CONST __m512d zeroExtend(__m256d v) { return concat(v, _mm256_setzero_pd()); }
+Vc_INTRINSIC Vc_CONST __m512i zeroExtend(__m256i v) { return concat(v, _mm256_setzero_si256()); }
+// gather {{{1
+template <int Scale> Vc_INTRINSIC __m512 gather(const float *addr, __m512i idx)
+{
+    return _mm512_i32gather_ps(idx, addr, Scale);
+}
+template <int Scale> Vc_INTRINSIC __m512d gather(const double *addr, __m256i idx)
+{
+    return _mm512_i32gather_pd(idx, addr, Scale);
+}
+template <int Scale> Vc_INTRINSIC __m512i gather(const int *addr, __m512i idx)
+{
+    return _mm512_i32gather_epi32(idx, addr, Scale);
+}
+template <int Scale> Vc_INTRINSIC __m512i gather(const unsigned *addr, __m512i idx)
+{
+    return _mm512_i32gather_epi32(idx, addr, Scale);
+}
+
+template <int Scale>
+Vc_INTRINSIC __m512 gather(__m512 src, __mmask16 k, const float *addr, __m512i idx)
+{
+    return _mm512_mask_i32gather_ps(src, k, idx, addr, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC __m512d gather(__m512d src, __mmask8 k, const double *addr, __m256i idx)
+{
+    return _mm512_mask_i32gather_pd(src, k, idx, addr, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC __m512i gather(__m512i src, __mmask16 k, const int *addr, __m512i idx)
+{
+    return _mm512_mask_i32gather_epi32(src, k, idx, addr, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC __m512i gather(__m512i src, __mmask16 k, const unsigned *addr, __m512i idx)
+{
+    return _mm512_mask_i32gather_epi32(src, k, idx, addr, Scale);
+}
+
+// scatter {{{1
+template <int Scale> Vc_INTRINSIC void scatter(float *addr, __m512i idx, __m512 v)
+{
+    _mm512_i32scatter_ps(addr, idx, v, Scale);
+}
+template <int Scale> Vc_INTRINSIC void scatter(double *addr, __m256i idx, __m512d v)
+{
+    _mm512_i32scatter_pd(addr, idx, v, Scale);
+}
+template <int Scale> Vc_INTRINSIC void scatter(int *addr, __m512i idx, __m512i v)
+{
+    _mm512_i32scatter_epi32(addr, idx, v, Scale);
+}
+template <int Scale> Vc_INTRINSIC void scatter(unsigned *addr, __m512i idx, __m512i v)
+{
+    _mm512_i32scatter_epi32(addr, idx, v, Scale);
+}
+
+template <int Scale>
+Vc_INTRINSIC void scatter(float *addr, __mmask16 k, __m512i idx, __m512 v)
+{
+    _mm512_mask_i32scatter_ps(addr, k, idx, v, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC void scatter(double *addr, __mmask8 k, __m256i idx, __m512d v)
+{
+    _mm512_mask_i32scatter_pd(addr, k, idx, v, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC void scatter(int *addr, __mmask16 k, __m512i idx, __m512i v)
+{
+    _mm512_mask_i32scatter_epi32(addr, k, idx, v, Scale);
+}
+template <int Scale>
+Vc_INTRINSIC void scatter(unsigned *addr, __mmask16 k, __m512i idx, __m512i v)
+{
+    _mm512_mask_i32scatter_epi32(addr, k, idx, v, Scale);
+}
+// }}}1
+}  // namespace AVX512
+}  // namespace Vc
+
+#endif // VC_AVX512_INTRINSICS_H_
+
+// vim: foldmethod=marker
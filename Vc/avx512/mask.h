@@ -0,0 +1,211 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_AVX512_MASK_H_
+#define VC_AVX512_MASK_H_
+
+#include <array>
+
+#include "intrinsics.h"
+#include "../common/storage.h"
+#include "../common/bitscanintrinsics.h"
+#include "../common/maskbool.h"
+#include "detail.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace AVX512
+{
+/**\internal
+ * The opmask register type that holds one bit per entry of a vector with \p N entries.
+ */
+template <size_t N>
+using MaskRegister = typename std::conditional<(N <= 8), __mmask8, __mmask16>::type;
+}  // namespace AVX512
+
+template <typename T> class Mask<T, VectorAbi::Avx512>
+{
+public:
+    using abi = VectorAbi::Avx512;
+
+    /**
+     * The \c EntryType of masks is always bool, independent of \c T.
+     */
+    typedef bool EntryType;
+    using value_type = EntryType;
+
+    using MaskBool = Common::MaskBool<sizeof(T)>;
+    /**
+     * The \c VectorEntryType, in contrast to \c EntryType, reveals information about the SIMD
+     * implementation. This type is useful for the \c sizeof operator in generic functions.
+     */
+    using VectorEntryType = MaskBool;
+
+    /**
+     * The associated Vector<T> type.
+     */
+    using Vector = AVX512::Vector<T>;
+
+    static constexpr size_t Size = 64 / sizeof(T);
+    static constexpr size_t MemoryAlignment = Size;
+    static constexpr std::size_t size() { return Size; }
+    Vc_FREE_STORE_OPERATORS_ALIGNED(alignof(AVX512::MaskRegister<Size>));
+
+    /**
+     * The \c VectorType reveals the implementation-specific internal type used for the
+     * SIMD type. On AVX-512 this is an opmask (k) register with one bit per entry.
+     */
+    using VectorType = AVX512::MaskRegister<Size>;
+
+    using EntryReference = Vc::Detail::ElementReference<Mask>;
+    using reference = EntryReference;
+
+    // abstracts the way Masks are passed to functions, it can easily be changed to const ref here
+#if defined Vc_MSVC && defined _WIN32
+    typedef const Mask &AsArg;
+#else
+    typedef const Mask AsArg;
+#endif
+
+    Vc_INTRINSIC Mask() {}
+    Vc_INTRINSIC Mask(VectorType x) : k(x) {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerZero) : k(0) {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerOne) : k(FullMask) {}
+    Vc_INTRINSIC explicit Mask(bool b) : k(b ? FullMask : 0) {}
+    Vc_INTRINSIC static Mask Zero() { return Mask{Vc::Zero}; }
+    Vc_INTRINSIC static Mask One() { return Mask{Vc::One}; }
+
+    // implicit cast
+    template <typename U>
+    Vc_INTRINSIC Mask(
+        U &&rhs, Common::enable_if_mask_converts_implicitly<Mask, T, U> = nullarg,
+        enable_if<(std::is_same<typename Traits::decay<U>::abi, abi>::value &&
+                   Traits::decay<U>::Size == Size)> = nullarg)
+        : k(rhs.data())
+    {
+    }
+
+#if Vc_IS_VERSION_1
+    // explicit cast, implemented via simd_cast (in avx512/simd_cast_caller.tcc)
+    template <typename U>
+    Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                  "mask types") Vc_INTRINSIC
+        explicit Mask(U &&rhs, Common::enable_if_mask_converts_explicitly<T, U> = nullarg);
+#endif
+
+    template<typename Flags = DefaultLoadTag> Vc_INTRINSIC explicit Mask(const bool *mem, Flags f = Flags()) { load(mem, f); }
+
+    template<typename Flags = DefaultLoadTag> Vc_INTRINSIC void load(const bool *mem, Flags = Flags());
+
+    template<typename Flags = DefaultLoadTag> Vc_INTRINSIC void store(bool *mem, Flags = Flags()) const;
+
+    Vc_INTRINSIC Mask &operator=(const Mask &) = default;
+    Vc_INTRINSIC_L Mask &operator=(const std::array<bool, Size> &values) Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L operator std::array<bool, Size>() const Vc_INTRINSIC_R;
+
+    Vc_INTRINSIC Vc_PURE bool operator==(const Mask &rhs) const { return k == rhs.k; }
+    Vc_INTRINSIC Vc_PURE bool operator!=(const Mask &rhs) const { return k != rhs.k; }
+
+    Vc_INTRINSIC Mask operator!() const { return VectorType(~k & FullMask); }
+
+    Vc_INTRINSIC Mask &operator&=(const Mask &rhs) { k &= rhs.k; return *this; }
+    Vc_INTRINSIC Mask &operator|=(const Mask &rhs) { k |= rhs.k; return *this; }
+    Vc_INTRINSIC Mask &operator^=(const Mask &rhs) { k ^= rhs.k; return *this; }
+
+    Vc_INTRINSIC Vc_PURE Mask operator&(const Mask &rhs) const { return VectorType(k & rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator|(const Mask &rhs) const { return VectorType(k | rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator^(const Mask &rhs) const { return VectorType(k ^ rhs.k); }
+
+    Vc_INTRINSIC Vc_PURE Mask operator&&(const Mask &rhs) const { return VectorType(k & rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator||(const Mask &rhs) const { return VectorType(k | rhs.k); }
+
+    Vc_INTRINSIC bool isNotEmpty() const { return k != 0; }
+    Vc_INTRINSIC bool isEmpty() const { return k == 0; }
+    Vc_INTRINSIC bool isFull() const { return k == FullMask; }
+    Vc_INTRINSIC bool isMix() const { return k != 0 && k != FullMask; }
+
+    Vc_INTRINSIC Vc_PURE int shiftMask() const { return k; }
+    Vc_INTRINSIC Vc_PURE int toInt() const { return k; }
+
+    Vc_INTRINSIC VectorType data() const { return k; }
+    Vc_INTRINSIC VectorType &data() { return k; }
+
+private:
+    static constexpr VectorType FullMask = VectorType((1u << Size) - 1);
+
+    friend reference;
+    static Vc_INTRINSIC Vc_PURE value_type get(const Mask &m, int i) noexcept
+    {
+        return m.k & (1u << i);
+    }
+    template <typename U>
+    static Vc_INTRINSIC void set(Mask &m, int i, U &&v) noexcept(noexcept(bool(v)))
+    {
+        m.k = bool(v) ? VectorType(m.k | (1u << i)) : VectorType(m.k & ~(1u << i));
+    }
+
+public:
+    /**
+     * \note the returned object models the concept of a reference and
+     * as such it can exist longer than the data it is referencing.
+     * \note to avoid lifetime issues, we strongly advice not to store
+     * any reference objects.
+     */
+    Vc_ALWAYS_INLINE reference operator[](size_t index) noexcept
+    {
+        return {*this, int(index)};
+    }
+    Vc_ALWAYS_INLINE Vc_PURE value_type operator[](size_t index) const noexcept
+    {
+        return get(*this, index);
+    }
+
+    Vc_INTRINSIC Vc_PURE int count() const { return Detail::popcnt16(k); }
+    Vc_INTRINSIC Vc_PURE int firstOne() const { return _bit_scan_forward(k); }
+
+    template <typename G> static Vc_INTRINSIC_L Mask generate(G &&gen) Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vc_PURE_L Mask shifted(int amount) const Vc_INTRINSIC_R Vc_PURE_R;
+
+private:
+#ifdef Vc_COMPILE_BENCHMARKS
+public:
+#endif
+    VectorType k;
+};
+template <typename T> constexpr size_t Mask<T, VectorAbi::Avx512>::Size;
+template <typename T> constexpr size_t Mask<T, VectorAbi::Avx512>::MemoryAlignment;
+template <typename T>
+constexpr typename Mask<T, VectorAbi::Avx512>::VectorType
+    Mask<T, VectorAbi::Avx512>::FullMask;
+
+}  // namespace Vc
+
+#include "mask.tcc"
+
+#endif // VC_AVX512_MASK_H_
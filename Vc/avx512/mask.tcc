@@ -0,0 +1,126 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// mask_load/mask_store {{{1
+template <typename Flags>
+Vc_INTRINSIC __mmask16 mask_load(const bool *mem, Flags, std::integral_constant<int, 16>)
+{
+    static_assert(sizeof(bool) == 1, "Vc expects bool to have a sizeof 1 Byte");
+    return _mm512_test_epi32_mask(
+        _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem))),
+        _mm512_set1_epi32(0xff));
+}
+template <typename Flags>
+Vc_INTRINSIC __mmask8 mask_load(const bool *mem, Flags, std::integral_constant<int, 8>)
+{
+    static_assert(sizeof(bool) == 1, "Vc expects bool to have a sizeof 1 Byte");
+    return _mm512_test_epi64_mask(
+        _mm512_cvtepu8_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem))),
+        _mm512_set1_epi64(0xff));
+}
+
+template <typename Flags>
+Vc_INTRINSIC void mask_store(__mmask16 k, bool *mem, Flags, std::integral_constant<int, 16>)
+{
+    static_assert(sizeof(bool) == 1, "Vc expects bool to have a sizeof 1 Byte");
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem),
+                     _mm512_cvtepi32_epi8(_mm512_maskz_set1_epi32(k, 1)));
+}
+template <typename Flags>
+Vc_INTRINSIC void mask_store(__mmask8 k, bool *mem, Flags, std::integral_constant<int, 8>)
+{
+    static_assert(sizeof(bool) == 1, "Vc expects bool to have a sizeof 1 Byte");
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(mem),
+                     _mm512_cvtepi64_epi8(_mm512_maskz_set1_epi64(k, 1)));
+}
+// }}}1
+}  // namespace Detail
+
+// store {{{1
+template <typename T>
+template <typename Flags>
+Vc_INTRINSIC void Mask<T, VectorAbi::Avx512>::store(bool *mem, Flags f) const
+{
+    Detail::mask_store(k, mem, f, std::integral_constant<int, Size>());
+}
+
+// load {{{1
+template <typename T>
+template <typename Flags>
+Vc_INTRINSIC void Mask<T, VectorAbi::Avx512>::load(const bool *mem, Flags f)
+{
+    k = Detail::mask_load(mem, f, std::integral_constant<int, Size>());
+}
+
+// std::array conversions {{{1
+template <typename T>
+Vc_INTRINSIC Mask<T, VectorAbi::Avx512> &Mask<T, VectorAbi::Avx512>::operator=(
+    const std::array<bool, Size> &values)
+{
+    load(values.data(), Vc::Unaligned);
+    return *this;
+}
+template <typename T>
+Vc_INTRINSIC Mask<T, VectorAbi::Avx512>::operator std::array<bool, Size>() const
+{
+    std::array<bool, Size> r;
+    store(r.data(), Vc::Unaligned);
+    return r;
+}
+
+// generate {{{1
+template <typename T>
+template <typename G>
+Vc_INTRINSIC AVX512::Mask<T> Mask<T, VectorAbi::Avx512>::generate(G &&gen)
+{
+    unsigned int bits = 0;
+    Common::unrolled_loop<std::size_t, 0, Size>(
+        [&](std::size_t i) { bits |= (gen(i) ? 1u : 0u) << i; });
+    return VectorType(bits);
+}
+
+// shifted {{{1
+template <typename T>
+Vc_INTRINSIC Vc_PURE AVX512::Mask<T> Mask<T, VectorAbi::Avx512>::shifted(int amount) const
+{
+    if (amount >= int(Size) || amount <= -int(Size)) {
+        return Zero();
+    } else if (amount >= 0) {
+        return VectorType(k >> amount);
+    } else {
+        return VectorType((k << -amount) & FullMask);
+    }
+}
+// }}}1
+}  // namespace Vc
+
+// vim: foldmethod=marker
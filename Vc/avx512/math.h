@@ -0,0 +1,259 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_AVX512_MATH_H_
+#define VC_AVX512_MATH_H_
+
+#include "../avx/math.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// min & max {{{1
+Vc_ALWAYS_INLINE AVX512::int_v    min(const AVX512::int_v    &x, const AVX512::int_v    &y) { return _mm512_min_epi32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::uint_v   min(const AVX512::uint_v   &x, const AVX512::uint_v   &y) { return _mm512_min_epu32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::float_v  min(const AVX512::float_v  &x, const AVX512::float_v  &y) { return _mm512_min_ps(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::double_v min(const AVX512::double_v &x, const AVX512::double_v &y) { return _mm512_min_pd(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::int_v    max(const AVX512::int_v    &x, const AVX512::int_v    &y) { return _mm512_max_epi32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::uint_v   max(const AVX512::uint_v   &x, const AVX512::uint_v   &y) { return _mm512_max_epu32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::float_v  max(const AVX512::float_v  &x, const AVX512::float_v  &y) { return _mm512_max_ps(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::double_v max(const AVX512::double_v &x, const AVX512::double_v &y) { return _mm512_max_pd(x.data(), y.data()); }
+
+// sqrt {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v  sqrt(const AVX512::float_v  &x) { return _mm512_sqrt_ps(x.data()); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v sqrt(const AVX512::double_v &x) { return _mm512_sqrt_pd(x.data()); }
+
+// rsqrt {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v  rsqrt(const AVX512::float_v  &x) { return _mm512_rsqrt14_ps(x.data()); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v rsqrt(const AVX512::double_v &x) { return _mm512_div_pd(_mm512_set1_pd(1.), _mm512_sqrt_pd(x.data())); }
+
+// reciprocal {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v  reciprocal(const AVX512::float_v  &x) { return _mm512_rcp14_ps(x.data()); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v reciprocal(const AVX512::double_v &x) { return _mm512_div_pd(_mm512_set1_pd(1.), x.data()); }
+
+// round {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v  round(const AVX512::float_v  &x) { return _mm512_roundscale_ps(x.data(), _MM_FROUND_TO_NEAREST_INT); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v round(const AVX512::double_v &x) { return _mm512_roundscale_pd(x.data(), _MM_FROUND_TO_NEAREST_INT); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::int_v    round(const AVX512::int_v    &x) { return x; }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::uint_v   round(const AVX512::uint_v   &x) { return x; }
+
+// abs {{{1
+Vc_INTRINSIC Vc_CONST AVX512::double_v abs(AVX512::double_v x)
+{
+    return Detail::andnot_(_mm512_set1_pd(-0.), x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX512::float_v abs(AVX512::float_v x)
+{
+    return Detail::andnot_(_mm512_set1_ps(-0.f), x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX512::int_v abs(AVX512::int_v x)
+{
+    return _mm512_abs_epi32(x.data());
+}
+
+// isfinite {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_m isfinite(const AVX512::double_v &x)
+{
+    return _mm512_cmp_pd_mask(x.data(), _mm512_mul_pd(Detail::zero<__m512d>(), x.data()),
+                              _CMP_ORD_Q);
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_m isfinite(const AVX512::float_v &x)
+{
+    return _mm512_cmp_ps_mask(x.data(), _mm512_mul_ps(Detail::zero<__m512>(), x.data()),
+                              _CMP_ORD_Q);
+}
+
+// isinf {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_m isinf(const AVX512::double_v &x)
+{
+    return _mm512_cmp_pd_mask(abs(x).data(),
+                              _mm512_set1_pd(std::numeric_limits<double>::infinity()),
+                              _CMP_EQ_OQ);
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_m isinf(const AVX512::float_v &x)
+{
+    return _mm512_cmp_ps_mask(abs(x).data(),
+                              _mm512_set1_ps(std::numeric_limits<float>::infinity()),
+                              _CMP_EQ_OQ);
+}
+
+// isnan {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_m isnan(const AVX512::double_v &x)
+{
+    return _mm512_cmp_pd_mask(x.data(), x.data(), _CMP_UNORD_Q);
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_m isnan(const AVX512::float_v &x)
+{
+    return _mm512_cmp_ps_mask(x.data(), x.data(), _CMP_UNORD_Q);
+}
+
+// copysign {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_v copysign(AVX512::float_v mag, AVX512::float_v sign)
+{
+    // 0xe4 selects the bits of mag where the third operand (the sign mask) is zero
+    return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(
+        _mm512_castps_si512(sign.data()), _mm512_castps_si512(mag.data()),
+        _mm512_set1_epi32(0x80000000u), 0xe4));
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_v copysign(AVX512::double_v mag, AVX512::double_v sign)
+{
+    return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+        _mm512_castpd_si512(sign.data()), _mm512_castpd_si512(mag.data()),
+        _mm512_set1_epi64(0x8000000000000000ull), 0xe4));
+}
+
+// frexp {{{1
+/**
+ * splits \p v into exponent and mantissa, the sign is kept with the mantissa
+ *
+ * The return value will be in the range [0.5, 1.0[
+ * The \p e value will be an integer defining the power-of-two exponent
+ */
+inline AVX512::float_v frexp(AVX512::float_v::AsArg v, SimdArray<int, 16> *e)
+{
+    const __mmask16 special = (isnan(v) || !isfinite(v) || v == AVX512::float_v::Zero()).data();
+    const __m512 mant = _mm512_getmant_ps(v.data(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    const __m512i exp = _mm512_add_epi32(
+        _mm512_cvttps_epi32(_mm512_getexp_ps(v.data())), _mm512_set1_epi32(1));
+    internal_data(*e) = AVX512::int_v(_mm512_maskz_mov_epi32(__mmask16(~special), exp));
+    return _mm512_mask_mov_ps(mant, special, v.data());
+}
+inline AVX512::double_v frexp(AVX512::double_v::AsArg v, SimdArray<int, 8> *e)
+{
+    const __mmask8 special = (isnan(v) || !isfinite(v) || v == AVX512::double_v::Zero()).data();
+    const __m512d mant = _mm512_getmant_pd(v.data(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    const __m256i exp = _mm256_add_epi32(_mm512_cvttpd_epi32(_mm512_getexp_pd(v.data())),
+                                         _mm256_set1_epi32(1));
+    internal_data(*e) = AVX2::int_v(
+        AVX512::lo256(_mm512_maskz_mov_epi32(__mmask8(~special), AVX512::zeroExtend(exp))));
+    return _mm512_mask_mov_pd(mant, special, v.data());
+}
+
+// ldexp {{{1
+/*             -> x * 2^e
+ * x == NaN    -> NaN
+ * x == (-)inf -> (-)inf
+ */
+inline AVX512::float_v ldexp(AVX512::float_v::AsArg v, const SimdArray<int, 16> &e)
+{
+    return _mm512_scalef_ps(v.data(), _mm512_cvtepi32_ps(internal_data(e).data()));
+}
+inline AVX512::double_v ldexp(AVX512::double_v::AsArg v, const SimdArray<int, 8> &e)
+{
+    return _mm512_scalef_pd(v.data(), _mm512_cvtepi32_pd(internal_data(e).data()));
+}
+
+// trunc {{{1
+Vc_ALWAYS_INLINE AVX512::float_v trunc(AVX512::float_v::AsArg v)
+{
+    return _mm512_roundscale_ps(v.data(), _MM_FROUND_TO_ZERO);
+}
+Vc_ALWAYS_INLINE AVX512::double_v trunc(AVX512::double_v::AsArg v)
+{
+    return _mm512_roundscale_pd(v.data(), _MM_FROUND_TO_ZERO);
+}
+
+// floor {{{1
+Vc_ALWAYS_INLINE AVX512::float_v floor(AVX512::float_v::AsArg v)
+{
+    return _mm512_roundscale_ps(v.data(), _MM_FROUND_TO_NEG_INF);
+}
+Vc_ALWAYS_INLINE AVX512::double_v floor(AVX512::double_v::AsArg v)
+{
+    return _mm512_roundscale_pd(v.data(), _MM_FROUND_TO_NEG_INF);
+}
+
+// ceil {{{1
+Vc_ALWAYS_INLINE AVX512::float_v ceil(AVX512::float_v::AsArg v)
+{
+    return _mm512_roundscale_ps(v.data(), _MM_FROUND_TO_POS_INF);
+}
+Vc_ALWAYS_INLINE AVX512::double_v ceil(AVX512::double_v::AsArg v)
+{
+    return _mm512_roundscale_pd(v.data(), _MM_FROUND_TO_POS_INF);
+}
+
+// fma {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> fma(Vector<T, VectorAbi::Avx512> a,
+                                                  Vector<T, VectorAbi::Avx512> b,
+                                                  Vector<T, VectorAbi::Avx512> c)
+{
+    return Detail::fma(a.data(), b.data(), c.data(), T());
+}
+
+// transcendental functions {{{1
+/* The polynomial approximations in common/trigonometric.h, logarithm.h and
+ * exponential.h are only implemented (and, for the trigonometric functions,
+ * instantiated in the library) for SSE and AVX. The AVX-512 overloads therefore apply
+ * the AVX2 implementation to both halves of the vector.
+ */
+#define Vc_AVX512_VIA_AVX2_HALVES(name_)                                                 \
+    template <typename T>                                                                \
+    Vc_INTRINSIC AVX512::Vector<T> name_(const AVX512::Vector<T> &x)                     \
+    {                                                                                    \
+        return simd_cast<AVX512::Vector<T>>(                                             \
+            name_(simd_cast<AVX2::Vector<T>, 0>(x)),                                     \
+            name_(simd_cast<AVX2::Vector<T>, 1>(x)));                                    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_AVX512_VIA_AVX2_HALVES(sin);
+Vc_AVX512_VIA_AVX2_HALVES(cos);
+Vc_AVX512_VIA_AVX2_HALVES(asin);
+Vc_AVX512_VIA_AVX2_HALVES(atan);
+Vc_AVX512_VIA_AVX2_HALVES(exp);
+Vc_AVX512_VIA_AVX2_HALVES(log);
+Vc_AVX512_VIA_AVX2_HALVES(log2);
+Vc_AVX512_VIA_AVX2_HALVES(log10);
+#undef Vc_AVX512_VIA_AVX2_HALVES
+
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> atan2(const AVX512::Vector<T> &y,
+                                     const AVX512::Vector<T> &x)
+{
+    return simd_cast<AVX512::Vector<T>>(
+        atan2(simd_cast<AVX2::Vector<T>, 0>(y), simd_cast<AVX2::Vector<T>, 0>(x)),
+        atan2(simd_cast<AVX2::Vector<T>, 1>(y), simd_cast<AVX2::Vector<T>, 1>(x)));
+}
+
+template <typename T>
+Vc_INTRINSIC void sincos(const AVX512::Vector<T> &x, AVX512::Vector<T> *sin,
+                         AVX512::Vector<T> *cos)
+{
+    AVX2::Vector<T> s[2], c[2];
+    sincos(simd_cast<AVX2::Vector<T>, 0>(x), &s[0], &c[0]);
+    sincos(simd_cast<AVX2::Vector<T>, 1>(x), &s[1], &c[1]);
+    *sin = simd_cast<AVX512::Vector<T>>(s[0], s[1]);
+    *cos = simd_cast<AVX512::Vector<T>>(c[0], c[1]);
+}
+// }}}1
+}  // namespace Vc
+
+#endif // VC_AVX512_MATH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,397 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_AVX512_SIMD_CAST_H_
+#define VC_AVX512_SIMD_CAST_H_
+
+#ifndef VC_AVX512_VECTOR_H_
+#error "Vc/avx512/vector.h needs to be included before Vc/avx512/simd_cast.h"
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// traits {{{1
+/**\internal
+ * True if \p To and \p From are different, non-SimdArray vector types and at least one
+ * of them is an AVX512::Vector. Casts between these types are implemented here.
+ */
+template <typename To, typename From>
+using is_avx512_vector_cast = std::integral_constant<
+    bool, (!std::is_same<To, From>::value &&
+           (AVX512::is_vector<To>::value || AVX512::is_vector<From>::value) &&
+           Traits::is_simd_vector<To>::value && !Traits::isSimdArray<To>::value &&
+           Traits::is_simd_vector<From>::value && !Traits::isSimdArray<From>::value)>;
+template <typename To, typename From>
+using is_avx512_mask_cast = std::integral_constant<
+    bool, (!std::is_same<To, From>::value &&
+           (AVX512::is_mask<To>::value || AVX512::is_mask<From>::value) &&
+           Traits::is_simd_mask<To>::value && !Traits::isSimdMaskArray<To>::value &&
+           Traits::is_simd_mask<From>::value && !Traits::isSimdMaskArray<From>::value)>;
+
+/**\internal
+ * Overload ranking for the cast implementations below: the native implementations take
+ * an avx512_cast_native argument and are therefore preferred over the generic
+ * avx512_cast_generic fallback, which goes through memory.
+ */
+struct avx512_cast_generic {};
+struct avx512_cast_native : avx512_cast_generic {};
+template <typename T> struct avx512_cast_to {};
+
+// generic vector casts {{{1
+// stores the vectors or masks \p x, \p xs... one after the other to \p mem
+template <typename T> Vc_INTRINSIC void avx512_store_consecutive(T *) {}
+template <typename T, typename V, typename... Vs>
+Vc_INTRINSIC void avx512_store_consecutive(T *mem, const V &x, const Vs &... xs)
+{
+    x.store(mem, Vc::Unaligned);
+    avx512_store_consecutive(mem + V::Size, xs...);
+}
+
+template <typename To, typename From, typename... Froms>
+Vc_INTRINSIC To avx512_cast_impl(avx512_cast_to<To>, avx512_cast_generic,
+                                 const From &x0, const Froms &... xs)
+{
+    using T = typename From::EntryType;
+    constexpr std::size_t N = (1 + sizeof...(Froms)) * From::Size;
+    alignas(64) T tmp[N];
+    avx512_store_consecutive(&tmp[0], x0, xs...);
+    return To::generate([&](std::size_t i) {
+        return i < N ? static_cast<typename To::EntryType>(tmp[i])
+                     : typename To::EntryType();
+    });
+}
+
+template <typename To, int Offset, typename From>
+Vc_INTRINSIC To avx512_cast_impl(avx512_cast_to<To>, std::integral_constant<int, Offset>,
+                                 avx512_cast_generic, const From &x)
+{
+    return To::generate([&](std::size_t i) {
+        const std::size_t j = Offset * To::Size + i;
+        return j < From::Size ? static_cast<typename To::EntryType>(x[j])
+                              : typename To::EntryType();
+    });
+}
+
+// generic mask casts {{{1
+template <typename To, typename From, typename... Froms>
+Vc_INTRINSIC To avx512_mask_cast_impl(avx512_cast_to<To>, avx512_cast_generic,
+                                      const From &x0, const Froms &... xs)
+{
+    constexpr std::size_t N = (1 + sizeof...(Froms)) * From::Size;
+    constexpr std::size_t M = N > To::Size ? N : To::Size;
+    bool tmp[M] = {};
+    avx512_store_consecutive(&tmp[0], x0, xs...);
+    return To(&tmp[0]);
+}
+
+template <typename To, int Offset, typename From>
+Vc_INTRINSIC To avx512_mask_cast_impl(avx512_cast_to<To>,
+                                      std::integral_constant<int, Offset>,
+                                      avx512_cast_generic, const From &x)
+{
+    bool tmp[To::Size];
+    for (std::size_t i = 0; i < To::Size; ++i) {
+        const std::size_t j = Offset * To::Size + i;
+        tmp[i] = j < From::Size ? x[j] : false;
+    }
+    return To(&tmp[0]);
+}
+
+// native vector casts {{{1
+// AVX512 <-> AVX512 with equal number of entries {{{2
+Vc_INTRINSIC AVX512::float_v avx512_cast_impl(avx512_cast_to<AVX512::float_v>, avx512_cast_native, AVX512::int_v x) { return _mm512_cvtepi32_ps(x.data()); }
+Vc_INTRINSIC AVX512::float_v avx512_cast_impl(avx512_cast_to<AVX512::float_v>, avx512_cast_native, AVX512::uint_v x) { return _mm512_cvtepu32_ps(x.data()); }
+Vc_INTRINSIC AVX512::int_v avx512_cast_impl(avx512_cast_to<AVX512::int_v>, avx512_cast_native, AVX512::float_v x) { return _mm512_cvttps_epi32(x.data()); }
+Vc_INTRINSIC AVX512::int_v avx512_cast_impl(avx512_cast_to<AVX512::int_v>, avx512_cast_native, AVX512::uint_v x) { return x.data(); }
+Vc_INTRINSIC AVX512::uint_v avx512_cast_impl(avx512_cast_to<AVX512::uint_v>, avx512_cast_native, AVX512::int_v x) { return x.data(); }
+Vc_INTRINSIC AVX512::uint_v avx512_cast_impl(avx512_cast_to<AVX512::uint_v>, avx512_cast_native, AVX512::float_v x)
+{
+    // like the other implementations, values >= 2^31 are converted via the signed
+    // conversion of x - 2^31
+    const __m512 offset = _mm512_set1_ps(2147483648.f);
+    const __mmask16 big = _mm512_cmp_ps_mask(x.data(), offset, _CMP_GE_OQ);
+    return _mm512_mask_xor_epi32(
+        _mm512_cvttps_epi32(x.data()), big,
+        _mm512_cvttps_epi32(_mm512_sub_ps(x.data(), offset)),
+        _mm512_set1_epi32(0x80000000u));
+}
+
+// double_v <-> float_v/int_v/uint_v {{{2
+Vc_INTRINSIC AVX512::double_v avx512_cast_impl(avx512_cast_to<AVX512::double_v>, avx512_cast_native, AVX512::float_v x) { return _mm512_cvtps_pd(AVX512::lo256(x.data())); }
+Vc_INTRINSIC AVX512::double_v avx512_cast_impl(avx512_cast_to<AVX512::double_v>, avx512_cast_native, AVX512::int_v x) { return _mm512_cvtepi32_pd(AVX512::lo256(x.data())); }
+Vc_INTRINSIC AVX512::double_v avx512_cast_impl(avx512_cast_to<AVX512::double_v>, avx512_cast_native, AVX512::uint_v x) { return _mm512_cvtepu32_pd(AVX512::lo256(x.data())); }
+Vc_INTRINSIC AVX512::double_v avx512_cast_impl(avx512_cast_to<AVX512::double_v>, std::integral_constant<int, 1>, avx512_cast_native, AVX512::float_v x) { return _mm512_cvtps_pd(AVX512::hi256(x.data())); }
+Vc_INTRINSIC AVX512::double_v avx512_cast_impl(avx512_cast_to<AVX512::double_v>, std::integral_constant<int, 1>, avx512_cast_native, AVX512::int_v x) { return _mm512_cvtepi32_pd(AVX512::hi256(x.data())); }
+Vc_INTRINSIC AVX512::double_v avx512_cast_impl(avx512_cast_to<AVX512::double_v>, std::integral_constant<int, 1>, avx512_cast_native, AVX512::uint_v x) { return _mm512_cvtepu32_pd(AVX512::hi256(x.data())); }
+Vc_INTRINSIC AVX512::float_v avx512_cast_impl(avx512_cast_to<AVX512::float_v>, avx512_cast_native, AVX512::double_v x) { return AVX512::zeroExtend(_mm512_cvtpd_ps(x.data())); }
+Vc_INTRINSIC AVX512::float_v avx512_cast_impl(avx512_cast_to<AVX512::float_v>, avx512_cast_native, AVX512::double_v x0, AVX512::double_v x1) { return AVX512::concat(_mm512_cvtpd_ps(x0.data()), _mm512_cvtpd_ps(x1.data())); }
+Vc_INTRINSIC AVX512::int_v avx512_cast_impl(avx512_cast_to<AVX512::int_v>, avx512_cast_native, AVX512::double_v x) { return AVX512::zeroExtend(_mm512_cvttpd_epi32(x.data())); }
+Vc_INTRINSIC AVX512::int_v avx512_cast_impl(avx512_cast_to<AVX512::int_v>, avx512_cast_native, AVX512::double_v x0, AVX512::double_v x1) { return AVX512::concat(_mm512_cvttpd_epi32(x0.data()), _mm512_cvttpd_epi32(x1.data())); }
+Vc_INTRINSIC AVX512::uint_v avx512_cast_impl(avx512_cast_to<AVX512::uint_v>, avx512_cast_native, AVX512::double_v x) { return AVX512::zeroExtend(_mm512_cvttpd_epu32(x.data())); }
+Vc_INTRINSIC AVX512::uint_v avx512_cast_impl(avx512_cast_to<AVX512::uint_v>, avx512_cast_native, AVX512::double_v x0, AVX512::double_v x1) { return AVX512::concat(_mm512_cvttpd_epu32(x0.data()), _mm512_cvttpd_epu32(x1.data())); }
+
+// AVX2 halves <-> AVX512 {{{2
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> avx512_cast_impl(avx512_cast_to<AVX512::Vector<T>>,
+                                                avx512_cast_native, AVX2::Vector<T> x0,
+                                                AVX2::Vector<T> x1)
+{
+    return AVX512::concat(x0.data(), x1.data());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> avx512_cast_impl(avx512_cast_to<AVX512::Vector<T>>,
+                                                avx512_cast_native, AVX2::Vector<T> x)
+{
+    return AVX512::zeroExtend(x.data());
+}
+template <typename T>
+Vc_INTRINSIC AVX2::Vector<T> avx512_cast_impl(avx512_cast_to<AVX2::Vector<T>>,
+                                              avx512_cast_native, AVX512::Vector<T> x)
+{
+    return AVX512::lo256(x.data());
+}
+template <typename T>
+Vc_INTRINSIC AVX2::Vector<T> avx512_cast_impl(avx512_cast_to<AVX2::Vector<T>>,
+                                              std::integral_constant<int, 1>,
+                                              avx512_cast_native, AVX512::Vector<T> x)
+{
+    return AVX512::hi256(x.data());
+}
+// the index vector conversions used by the native gathers and scatters
+Vc_INTRINSIC AVX2::int_v avx512_cast_impl(avx512_cast_to<AVX2::int_v>, avx512_cast_native, AVX512::uint_v x) { return AVX512::lo256(x.data()); }
+Vc_INTRINSIC AVX512::int_v avx512_cast_impl(avx512_cast_to<AVX512::int_v>, avx512_cast_native, AVX2::short_v x) { return _mm512_cvtepi16_epi32(x.data()); }
+Vc_INTRINSIC AVX512::int_v avx512_cast_impl(avx512_cast_to<AVX512::int_v>, avx512_cast_native, AVX2::ushort_v x) { return _mm512_cvtepu16_epi32(x.data()); }
+Vc_INTRINSIC AVX512::uint_v avx512_cast_impl(avx512_cast_to<AVX512::uint_v>, avx512_cast_native, AVX2::short_v x) { return _mm512_cvtepi16_epi32(x.data()); }
+Vc_INTRINSIC AVX512::uint_v avx512_cast_impl(avx512_cast_to<AVX512::uint_v>, avx512_cast_native, AVX2::ushort_v x) { return _mm512_cvtepu16_epi32(x.data()); }
+Vc_INTRINSIC AVX2::short_v avx512_cast_impl(avx512_cast_to<AVX2::short_v>, avx512_cast_native, AVX512::int_v x) { return _mm512_cvtepi32_epi16(x.data()); }
+Vc_INTRINSIC AVX2::short_v avx512_cast_impl(avx512_cast_to<AVX2::short_v>, avx512_cast_native, AVX512::uint_v x) { return _mm512_cvtepi32_epi16(x.data()); }
+Vc_INTRINSIC AVX2::ushort_v avx512_cast_impl(avx512_cast_to<AVX2::ushort_v>, avx512_cast_native, AVX512::int_v x) { return _mm512_cvtepi32_epi16(x.data()); }
+Vc_INTRINSIC AVX2::ushort_v avx512_cast_impl(avx512_cast_to<AVX2::ushort_v>, avx512_cast_native, AVX512::uint_v x) { return _mm512_cvtepi32_epi16(x.data()); }
+
+// native mask casts {{{1
+// masks with equal number of entries share the k-register representation
+template <typename T, typename U>
+Vc_INTRINSIC enable_if<AVX512::Mask<T>::Size == AVX512::Mask<U>::Size, AVX512::Mask<T>>
+avx512_mask_cast_impl(avx512_cast_to<AVX512::Mask<T>>, avx512_cast_native,
+                      AVX512::Mask<U> x)
+{
+    return typename AVX512::Mask<T>::VectorType(x.data());
+}
+// 16 -> 8
+template <typename T, typename U, int Offset>
+Vc_INTRINSIC enable_if<(AVX512::Mask<T>::Size == 8 && AVX512::Mask<U>::Size == 16),
+                       AVX512::Mask<T>>
+avx512_mask_cast_impl(avx512_cast_to<AVX512::Mask<T>>,
+                      std::integral_constant<int, Offset>, avx512_cast_native,
+                      AVX512::Mask<U> x)
+{
+    return __mmask8(x.data() >> (8 * Offset));
+}
+template <typename T, typename U>
+Vc_INTRINSIC enable_if<(AVX512::Mask<T>::Size == 8 && AVX512::Mask<U>::Size == 16),
+                       AVX512::Mask<T>>
+avx512_mask_cast_impl(avx512_cast_to<AVX512::Mask<T>>, avx512_cast_native,
+                      AVX512::Mask<U> x)
+{
+    return __mmask8(x.data());
+}
+// 8 -> 16
+template <typename T, typename U>
+Vc_INTRINSIC enable_if<(AVX512::Mask<T>::Size == 16 && AVX512::Mask<U>::Size == 8),
+                       AVX512::Mask<T>>
+avx512_mask_cast_impl(avx512_cast_to<AVX512::Mask<T>>, avx512_cast_native,
+                      AVX512::Mask<U> x)
+{
+    return __mmask16(x.data());
+}
+template <typename T, typename U>
+Vc_INTRINSIC enable_if<(AVX512::Mask<T>::Size == 16 && AVX512::Mask<U>::Size == 8),
+                       AVX512::Mask<T>>
+avx512_mask_cast_impl(avx512_cast_to<AVX512::Mask<T>>, avx512_cast_native,
+                      AVX512::Mask<U> x0, AVX512::Mask<U> x1)
+{
+    return __mmask16(x0.data() | (x1.data() << 8));
+}
+// AVX2 halves <-> AVX512 masks of the same entry type {{{2
+Vc_INTRINSIC __mmask16 avx512_mask_bits(AVX2::float_m x) { return _mm256_movemask_ps(x.dataF()); }
+Vc_INTRINSIC __mmask16 avx512_mask_bits(AVX2::int_m x) { return _mm256_movemask_ps(x.dataF()); }
+Vc_INTRINSIC __mmask16 avx512_mask_bits(AVX2::uint_m x) { return _mm256_movemask_ps(x.dataF()); }
+Vc_INTRINSIC __mmask8 avx512_mask_bits(AVX2::double_m x) { return _mm256_movemask_pd(x.dataD()); }
+template <typename T>
+Vc_INTRINSIC AVX512::Mask<T> avx512_mask_cast_impl(avx512_cast_to<AVX512::Mask<T>>,
+                                                   avx512_cast_native, AVX2::Mask<T> x0,
+                                                   AVX2::Mask<T> x1)
+{
+    return typename AVX512::Mask<T>::VectorType(
+        avx512_mask_bits(x0) | (avx512_mask_bits(x1) << AVX2::Mask<T>::Size));
+}
+template <typename T>
+Vc_INTRINSIC AVX2::Mask<T> avx512_mask_from_bits(__mmask16 k, T)
+{
+    return AVX2::Mask<T>(AVX512::lo256(_mm512_maskz_mov_epi32(k, allone<__m512i>())));
+}
+Vc_INTRINSIC AVX2::Mask<double> avx512_mask_from_bits(__mmask16 k, double)
+{
+    return AVX2::Mask<double>(
+        AVX512::lo256(_mm512_maskz_mov_epi64(__mmask8(k), allone<__m512i>())));
+}
+template <typename T, int Offset>
+Vc_INTRINSIC AVX2::Mask<T> avx512_mask_cast_impl(avx512_cast_to<AVX2::Mask<T>>,
+                                                 std::integral_constant<int, Offset>,
+                                                 avx512_cast_native, AVX512::Mask<T> x)
+{
+    return avx512_mask_from_bits(__mmask16(x.data() >> (Offset * AVX2::Mask<T>::Size)),
+                                 T());
+}
+template <typename T>
+Vc_INTRINSIC AVX2::Mask<T> avx512_mask_cast_impl(avx512_cast_to<AVX2::Mask<T>>,
+                                                 avx512_cast_native, AVX512::Mask<T> x)
+{
+    return avx512_mask_from_bits(x.data(), T());
+}
+// }}}1
+}  // namespace Detail
+
+// simd_cast entry points {{{1
+// N vectors -> 1 vector {{{2
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<Detail::is_avx512_vector_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_cast_impl(Detail::avx512_cast_to<To>(),
+                                    Detail::avx512_cast_native(), x);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1,
+          enable_if<Detail::is_avx512_vector_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_cast_impl(Detail::avx512_cast_to<To>(),
+                                    Detail::avx512_cast_native(), x0, x1);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2,
+          enable_if<Detail::is_avx512_vector_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_cast_impl(Detail::avx512_cast_to<To>(),
+                                    Detail::avx512_cast_native(), x0, x1, x2);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2, From x3,
+          enable_if<Detail::is_avx512_vector_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_cast_impl(Detail::avx512_cast_to<To>(),
+                                    Detail::avx512_cast_native(), x0, x1, x2, x3);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2, From x3, From x4, From x5, From x6, From x7,
+          enable_if<Detail::is_avx512_vector_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_cast_impl(Detail::avx512_cast_to<To>(),
+                                    Detail::avx512_cast_native(), x0, x1, x2, x3, x4,
+                                    x5, x6, x7);
+}
+
+// N masks -> 1 mask {{{2
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<Detail::is_avx512_mask_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_mask_cast_impl(Detail::avx512_cast_to<To>(),
+                                         Detail::avx512_cast_native(), x);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1,
+          enable_if<Detail::is_avx512_mask_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_mask_cast_impl(Detail::avx512_cast_to<To>(),
+                                         Detail::avx512_cast_native(), x0, x1);
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, From x2, From x3,
+          enable_if<Detail::is_avx512_mask_cast<To, From>::value> = nullarg)
+{
+    return Detail::avx512_mask_cast_impl(Detail::avx512_cast_to<To>(),
+                                         Detail::avx512_cast_native(), x0, x1, x2, x3);
+}
+
+// 1 vector/mask -> N vectors/masks (with offset) {{{2
+/* Offset 0 forwards to the casts without offset, just like the other implementations.
+ * Conversions to Scalar::Vector are handled in scalar/simd_cast.h for any source type.
+ */
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(From x, enable_if<(offset == 0 && !Scalar::is_vector<Return>::value &&
+                             !Scalar::is_mask<Return>::value &&
+                             (Detail::is_avx512_vector_cast<Return, From>::value ||
+                              Detail::is_avx512_mask_cast<Return, From>::value) &&
+                             !AVX2::is_vector<From>::value &&
+                             !AVX2::is_mask<From>::value &&
+                             !Scalar::is_vector<From>::value &&
+                             !Scalar::is_mask<From>::value)> = nullarg)
+{
+    return simd_cast<Return>(x);
+}
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(From x, enable_if<(offset != 0 && !Scalar::is_vector<Return>::value &&
+                             (AVX512::is_vector<From>::value ||
+                              (AVX512::is_vector<Return>::value &&
+                               !Scalar::is_vector<From>::value)) &&
+                             Detail::is_avx512_vector_cast<Return, From>::value)> = nullarg)
+{
+    return Detail::avx512_cast_impl(Detail::avx512_cast_to<Return>(),
+                                    std::integral_constant<int, offset>(),
+                                    Detail::avx512_cast_native(), x);
+}
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(From x, enable_if<(offset != 0 && !Scalar::is_mask<Return>::value &&
+                             (AVX512::is_mask<From>::value ||
+                              (AVX512::is_mask<Return>::value &&
+                               !Scalar::is_mask<From>::value)) &&
+                             Detail::is_avx512_mask_cast<Return, From>::value)> = nullarg)
+{
+    return Detail::avx512_mask_cast_impl(Detail::avx512_cast_to<Return>(),
+                                         std::integral_constant<int, offset>(),
+                                         Detail::avx512_cast_native(), x);
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_AVX512_SIMD_CAST_H_
+
+// vim: foldmethod=marker
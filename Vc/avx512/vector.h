@@ -0,0 +1,471 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_AVX512_VECTOR_H_
+#define VC_AVX512_VECTOR_H_
+
+#include "../avx/vector.h"
+#include "intrinsics.h"
+#include "types.h"
+#include "detail.h"
+#include "mask.h"
+#include <algorithm>
+#include <cmath>
+#include "../common/aliasingentryhelper.h"
+#include "../common/memoryfwd.h"
+#include "../common/where.h"
+#include "macros.h"
+
+#ifdef isfinite
+#undef isfinite
+#endif
+#ifdef isnan
+#undef isnan
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+template <typename T> struct VectorTraits<T, VectorAbi::Avx512>
+{
+    using mask_type = Vc::Mask<T, VectorAbi::Avx512>;
+    using vector_type = Vc::Vector<T, VectorAbi::Avx512>;
+    using writemasked_vector_type = Common::WriteMaskedVector<vector_type, mask_type>;
+    using intrinsic_type = typename AVX512::VectorTypeHelper<T>::Type;
+};
+}  // namespace Detail
+
+#define Vc_CURRENT_CLASS_NAME Vector
+template <typename T> class Vector<T, VectorAbi::Avx512>
+{
+public:
+    using abi = VectorAbi::Avx512;
+
+private:
+    using traits_type = Detail::VectorTraits<T, abi>;
+    static_assert(
+        std::is_same<T, double>::value || std::is_same<T, float>::value ||
+            std::is_same<T, int>::value || std::is_same<T, uint>::value,
+        "Vector<T, VectorAbi::Avx512> only supports double, float, int, and uint. "
+        "Use VectorAbi::Avx512Abi<T> to select the ABI for other types.");
+
+    using WriteMaskedVector = typename traits_type::writemasked_vector_type;
+
+public:
+    using VectorType = typename traits_type::intrinsic_type;
+    using vector_type = VectorType;
+
+    using mask_type = typename traits_type::mask_type;
+    using Mask = mask_type;
+    using MaskType = mask_type;
+    using MaskArg Vc_DEPRECATED_ALIAS("Use MaskArgument instead.") = typename Mask::AsArg;
+    using MaskArgument = typename Mask::AsArg;
+    using reference = Detail::ElementReference<Vector>;
+
+    Vc_FREE_STORE_OPERATORS_ALIGNED(alignof(VectorType));
+
+    using EntryType = T;
+    using value_type = EntryType;
+    typedef EntryType VectorEntryType;
+    static constexpr size_t Size = sizeof(VectorType) / sizeof(EntryType);
+    static constexpr size_t MemoryAlignment = alignof(VectorType);
+    using IndexType = fixed_size_simd<int, Size>;
+    typedef Vector<T, abi> AsArg;
+    typedef VectorType VectorTypeArg;
+    // the index vector type matching the native gather/scatter instructions
+    using NativeIndexType = typename std::conditional<Size == 8, AVX2::int_v, AVX512::int_v>::type;
+
+protected:
+    template <typename U> using V = Vector<U, abi>;
+
+    typedef Common::VectorMemoryUnion<VectorType, EntryType> StorageType;
+    StorageType d;
+
+    using WidthT = Common::WidthT<VectorType>;
+
+public:
+#include "../common/generalinterface.h"
+
+    static Vc_ALWAYS_INLINE_L Vector Random() Vc_ALWAYS_INLINE_R;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    // internal: required to enable returning objects of VectorType
+    Vc_ALWAYS_INLINE Vector(VectorTypeArg x) : d(x) {}
+
+    // implict conversion from compatible Vector<U, abi>
+    template <typename U>
+    Vc_INTRINSIC Vector(
+        V<U> x, typename std::enable_if<Traits::is_implicit_cast_allowed<U, T>::value,
+                                        void *>::type = nullptr)
+        : d(AVX512::avx512_cast<VectorType>(x.data()))
+    {
+    }
+
+#if Vc_IS_VERSION_1
+    // static_cast from the remaining Vector<U, abi>
+    template <typename U>
+    Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                  "vector types") Vc_INTRINSIC explicit Vector(
+        V<U> x,
+        typename std::enable_if<!Traits::is_implicit_cast_allowed<U, T>::value,
+                                void *>::type = nullptr)
+        : d(simd_cast<Vector>(x).data())
+    {
+    }
+
+    // static_cast from other types, implemented via the non-member simd_cast function in
+    // simd_cast_caller.tcc
+    template <typename U,
+              typename = enable_if<Traits::is_simd_vector<U>::value &&
+                                   !std::is_same<Vector, Traits::decay<U>>::value>>
+    Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                  "vector types") Vc_INTRINSIC_L
+        explicit Vector(U &&x) Vc_INTRINSIC_R;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    // broadcast
+    Vc_INTRINSIC Vector(EntryType a) : d(Detail::avx512_broadcast(a)) {}
+    template <typename U>
+    Vc_INTRINSIC Vector(U a,
+                        typename std::enable_if<std::is_same<U, int>::value &&
+                                                    !std::is_same<U, EntryType>::value,
+                                                void *>::type = nullptr)
+        : Vector(static_cast<EntryType>(a))
+    {
+    }
+
+    //template<typename U>
+    explicit Vector(std::initializer_list<EntryType>)
+    {
+        static_assert(std::is_same<EntryType, void>::value,
+                      "A SIMD vector object cannot be initialized from an initializer list "
+                      "because the number of entries in the vector is target-dependent.");
+    }
+
+#include "../common/loadinterface.h"
+#include "../common/storeinterface.h"
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    // zeroing
+    Vc_INTRINSIC_L void setZero() Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L void setZero(const Mask &k) Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L void setZeroInverted(const Mask &k) Vc_INTRINSIC_R;
+
+    Vc_INTRINSIC_L void setQnan() Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L void setQnan(MaskArgument k) Vc_INTRINSIC_R;
+
+#include "../common/gatherinterface.h"
+#include "../common/scatterinterface.h"
+#ifndef Vc_MSVC
+    ////////////////////////////////////////////////////////////////////////////////
+    // non-converting gathers via vgatherdps/vgatherdpd/vpgatherdd
+    template <class U, class A, int Scale, int N = Vector<U, A>::size(),
+              class = enable_if<(Vector<U, A>::size() >= size())>>
+    Vc_INTRINSIC void gatherImplementation(
+        const Common::GatherArguments<T, Vector<U, A>, Scale> &args)
+    {
+        d.v() = AVX512::gather<sizeof(T) * Scale>(
+            args.address, simd_cast<NativeIndexType>(args.indexes).data());
+    }
+
+    // masked overload: the opmask register is passed directly to the gather instruction
+    template <class U, class A, int Scale, int N = Vector<U, A>::size(),
+              class = enable_if<(Vector<U, A>::size() >= size())>>
+    Vc_INTRINSIC void gatherImplementation(
+        const Common::GatherArguments<T, Vector<U, A>, Scale> &args, MaskArgument k)
+    {
+        d.v() = AVX512::gather<sizeof(T) * Scale>(
+            d.v(), k.data(), args.address,
+            simd_cast<NativeIndexType>(args.indexes).data());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // all remaining converting gathers; fixed_size_simd has no 8-bit entry types,
+    // therefore 8-bit memory types use the generic gather
+    template <class MT, class U, class A, int Scale>
+    Vc_INTRINSIC enable_if<(sizeof(MT) != 1 &&
+                            Traits::is_valid_vector_argument<MT>::value &&
+                            !std::is_same<MT, T>::value &&
+                            Vector<U, A>::size() >= size()),
+                           void>
+    gatherImplementation(const Common::GatherArguments<MT, Vector<U, A>, Scale> &args)
+    {
+        *this = simd_cast<Vector>(fixed_size_simd<MT, Size>(args));
+    }
+
+    // masked overload
+    template <class MT, class U, class A, int Scale>
+    Vc_INTRINSIC enable_if<(sizeof(MT) != 1 &&
+                            Traits::is_valid_vector_argument<MT>::value &&
+                            !std::is_same<MT, T>::value &&
+                            Vector<U, A>::size() >= size()),
+                           void>
+    gatherImplementation(const Common::GatherArguments<MT, Vector<U, A>, Scale> &args,
+                         MaskArgument k)
+    {
+        assign(simd_cast<Vector>(fixed_size_simd<MT, Size>(args, k)), k);
+    }
+#endif  // !MSVC
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    //prefix
+    Vc_ALWAYS_INLINE Vector &operator++() { data() = Detail::add(data(), Detail::one64(T()), T()); return *this; }
+    Vc_ALWAYS_INLINE Vector &operator--() { data() = Detail::sub(data(), Detail::one64(T()), T()); return *this; }
+    //postfix
+    Vc_ALWAYS_INLINE Vector operator++(int) { const Vector r = *this; data() = Detail::add(data(), Detail::one64(T()), T()); return r; }
+    Vc_ALWAYS_INLINE Vector operator--(int) { const Vector r = *this; data() = Detail::sub(data(), Detail::one64(T()), T()); return r; }
+
+private:
+    friend reference;
+    Vc_INTRINSIC static value_type get(const Vector &o, int i) noexcept
+    {
+        return o.d.m(i);
+    }
+    template <typename U>
+    Vc_INTRINSIC static void set(Vector &o, int i, U &&v) noexcept(
+        noexcept(std::declval<value_type &>() = v))
+    {
+        return o.d.set(i, v);
+    }
+
+public:
+    /**
+     * \note the returned object models the concept of a reference and
+     * as such it can exist longer than the data it is referencing.
+     * \note to avoid lifetime issues, we strongly advice not to store
+     * any reference objects.
+     */
+    Vc_ALWAYS_INLINE reference operator[](size_t index) noexcept
+    {
+        static_assert(noexcept(reference{std::declval<Vector &>(), int()}), "");
+        return {*this, int(index)};
+    }
+    Vc_ALWAYS_INLINE value_type operator[](size_t index) const noexcept
+    {
+        return d.m(index);
+    }
+
+    Vc_INTRINSIC_L Vc_PURE_L Vector operator[](Permutation::ReversedTag) const Vc_INTRINSIC_R Vc_PURE_R;
+    Vc_INTRINSIC_L Vc_PURE_L Vector operator[](const IndexType &perm) const Vc_INTRINSIC_R Vc_PURE_R;
+
+    Vc_INTRINSIC Vc_PURE Mask operator!() const
+    {
+        return *this == Zero();
+    }
+    Vc_ALWAYS_INLINE Vector operator~() const
+    {
+#ifndef Vc_ENABLE_FLOAT_BIT_OPERATORS
+        static_assert(std::is_integral<T>::value,
+                      "bit-complement can only be used with Vectors of integral type");
+#endif
+        return Detail::andnot_(data(), Detail::allone<VectorType>());
+    }
+    Vc_ALWAYS_INLINE_L Vc_PURE_L Vector operator-() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
+    Vc_INTRINSIC Vc_PURE Vector operator+() const { return *this; }
+
+    // shifts
+#define Vc_OP_VEC(op)                                                                    \
+    Vc_INTRINSIC Vector &operator op##=(AsArg x);                                        \
+    Vc_INTRINSIC Vc_PURE Vector operator op(AsArg x) const                               \
+    {                                                                                    \
+        static_assert(                                                                   \
+            std::is_integral<T>::value,                                                  \
+            "bitwise-operators can only be used with Vectors of integral type");         \
+    }
+    Vc_ALL_SHIFTS(Vc_OP_VEC);
+#undef Vc_OP_VEC
+
+    Vc_ALWAYS_INLINE_L Vector &operator>>=(int x) Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector &operator<<=(int x) Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector operator>>(int x) const Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE_L Vector operator<<(int x) const Vc_ALWAYS_INLINE_R;
+
+    Vc_DEPRECATED("use isnegative(x) instead") Vc_INTRINSIC Vc_PURE Mask
+        isNegative() const
+    {
+        return Vc::isnegative(*this);
+    }
+
+    Vc_ALWAYS_INLINE void assign( const Vector &v, const Mask &mask ) {
+        data() = Detail::blend(data(), v.data(), mask.data());
+    }
+
+    template <typename V2>
+    Vc_DEPRECATED("Use simd_cast instead of Vector::staticCast") Vc_ALWAYS_INLINE V2
+        staticCast() const
+    {
+        return V2(*this);
+    }
+    template <typename V2>
+    Vc_DEPRECATED("use reinterpret_components_cast instead") Vc_ALWAYS_INLINE V2
+        reinterpretCast() const
+    {
+        return AVX512::avx512_cast<typename V2::VectorType>(data());
+    }
+
+    Vc_ALWAYS_INLINE WriteMaskedVector operator()(const Mask &k)
+    {
+        return {*this, k};
+    }
+
+    Vc_ALWAYS_INLINE VectorType &data() { return d.v(); }
+    Vc_ALWAYS_INLINE const VectorType &data() const { return d.v(); }
+
+    template<int Index>
+    Vc_INTRINSIC_L Vector broadcast() const Vc_INTRINSIC_R;
+
+    Vc_INTRINSIC_L std::pair<Vector, int> minIndex() const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L std::pair<Vector, int> maxIndex() const Vc_INTRINSIC_R;
+
+    Vc_ALWAYS_INLINE EntryType min() const { return Detail::min(data(), T()); }
+    Vc_ALWAYS_INLINE EntryType max() const { return Detail::max(data(), T()); }
+    Vc_ALWAYS_INLINE EntryType product() const { return Detail::mul(data(), T()); }
+    Vc_ALWAYS_INLINE EntryType sum() const { return Detail::add(data(), T()); }
+    Vc_ALWAYS_INLINE_L Vector partialSum() const Vc_ALWAYS_INLINE_R;
+    Vc_ALWAYS_INLINE EntryType min(MaskArgument m) const { return Detail::min(data(), m.data(), T()); }
+    Vc_ALWAYS_INLINE EntryType max(MaskArgument m) const { return Detail::max(data(), m.data(), T()); }
+    Vc_ALWAYS_INLINE EntryType product(MaskArgument m) const { return Detail::mul(data(), m.data(), T()); }
+    Vc_ALWAYS_INLINE EntryType sum(MaskArgument m) const { return Detail::add(data(), m.data(), T()); }
+
+    Vc_INTRINSIC_L Vector shifted(int amount, Vector shiftIn) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vector shifted(int amount) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vector rotated(int amount) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vc_PURE_L Vector reversed() const Vc_INTRINSIC_R Vc_PURE_R;
+    Vc_ALWAYS_INLINE_L Vc_PURE_L Vector sorted() const Vc_ALWAYS_INLINE_R Vc_PURE_R;
+
+    template <typename F> void callWithValuesSorted(F &&f)
+    {
+        EntryType value = d.m(0);
+        f(value);
+        for (size_t i = 1; i < Size; ++i) {
+            if (d.m(i) != value) {
+                value = d.m(i);
+                f(value);
+            }
+        }
+    }
+
+    template <typename F> Vc_INTRINSIC void call(F &&f) const
+    {
+        Common::for_all_vector_entries<Size>([&](size_t i) { f(EntryType(d.m(i))); });
+    }
+
+    template <typename F> Vc_INTRINSIC void call(F &&f, const Mask &mask) const
+    {
+        for (size_t i : where(mask)) {
+            f(EntryType(d.m(i)));
+        }
+    }
+
+    template <typename F> Vc_INTRINSIC Vector apply(F &&f) const
+    {
+        Vector r;
+        Common::for_all_vector_entries<Size>(
+            [&](size_t i) { r.d.set(i, f(EntryType(d.m(i)))); });
+        return r;
+    }
+
+    template <typename F> Vc_INTRINSIC Vector apply(F &&f, const Mask &mask) const
+    {
+        Vector r(*this);
+        for (size_t i : where(mask)) {
+            r.d.set(i, f(EntryType(r.d.m(i))));
+        }
+        return r;
+    }
+
+    template<typename IndexT> Vc_INTRINSIC void fill(EntryType (&f)(IndexT)) {
+        Common::for_all_vector_entries<Size>([&](size_t i) { d.set(i, f(i)); });
+    }
+    Vc_INTRINSIC void fill(EntryType (&f)()) {
+        Common::for_all_vector_entries<Size>([&](size_t i) { d.set(i, f()); });
+    }
+
+    template <typename G> static Vc_INTRINSIC_L Vector generate(G gen) Vc_INTRINSIC_R;
+
+    Vc_DEPRECATED("use copysign(x, y) instead") Vc_INTRINSIC Vector
+        copySign(AsArg x) const
+    {
+        return Vc::copysign(*this, x);
+    }
+
+    Vc_DEPRECATED("use exponent(x) instead") Vc_INTRINSIC Vector exponent() const
+    {
+        Vc::exponent(*this);
+    }
+
+    Vc_INTRINSIC_L Vector interleaveLow(Vector x) const Vc_INTRINSIC_R;
+    Vc_INTRINSIC_L Vector interleaveHigh(Vector x) const Vc_INTRINSIC_R;
+};
+#undef Vc_CURRENT_CLASS_NAME
+template <typename T> constexpr size_t Vector<T, VectorAbi::Avx512>::Size;
+template <typename T> constexpr size_t Vector<T, VectorAbi::Avx512>::MemoryAlignment;
+
+#define Vc_CONDITIONAL_ASSIGN(name_, op_)                                                \
+    template <Operator O, typename T, typename M, typename U>                            \
+    Vc_INTRINSIC enable_if<O == Operator::name_, void> conditional_assign(               \
+        AVX512::Vector<T> &lhs, M &&mask, U &&rhs)                                       \
+    {                                                                                    \
+        lhs(mask) op_ rhs;                                                               \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_CONDITIONAL_ASSIGN(          Assign,  =);
+Vc_CONDITIONAL_ASSIGN(      PlusAssign, +=);
+Vc_CONDITIONAL_ASSIGN(     MinusAssign, -=);
+Vc_CONDITIONAL_ASSIGN(  MultiplyAssign, *=);
+Vc_CONDITIONAL_ASSIGN(    DivideAssign, /=);
+Vc_CONDITIONAL_ASSIGN( RemainderAssign, %=);
+Vc_CONDITIONAL_ASSIGN(       XorAssign, ^=);
+Vc_CONDITIONAL_ASSIGN(       AndAssign, &=);
+Vc_CONDITIONAL_ASSIGN(        OrAssign, |=);
+Vc_CONDITIONAL_ASSIGN( LeftShiftAssign,<<=);
+Vc_CONDITIONAL_ASSIGN(RightShiftAssign,>>=);
+#undef Vc_CONDITIONAL_ASSIGN
+
+#define Vc_CONDITIONAL_ASSIGN(name_, expr_)                                              \
+    template <Operator O, typename T, typename M>                                        \
+    Vc_INTRINSIC enable_if<O == Operator::name_, AVX512::Vector<T>> conditional_assign(  \
+        AVX512::Vector<T> &lhs, M &&mask)                                                \
+    {                                                                                    \
+        return expr_;                                                                    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_CONDITIONAL_ASSIGN(PostIncrement, lhs(mask)++);
+Vc_CONDITIONAL_ASSIGN( PreIncrement, ++lhs(mask));
+Vc_CONDITIONAL_ASSIGN(PostDecrement, lhs(mask)--);
+Vc_CONDITIONAL_ASSIGN( PreDecrement, --lhs(mask));
+#undef Vc_CONDITIONAL_ASSIGN
+
+}  // namespace Vc
+
+#include "vector.tcc"
+#include "simd_cast.h"
+
+#endif // VC_AVX512_VECTOR_H_
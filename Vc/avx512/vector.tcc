@@ -0,0 +1,646 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2009-2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "../common/x86_prefetches.h"
+#include "../common/gatherimplementation.h"
+#include "../common/scatterimplementation.h"
+#include "../common/set.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// compare operators {{{1
+/* The predicates match the ones the AVX implementation uses: == and the ordering
+ * comparisons are false for NaN, != is true for NaN. For integers only the low three
+ * bits of the predicate are used, which map exactly onto _MM_CMPINT_*.
+ */
+template <typename T>
+Vc_INTRINSIC AVX512::Mask<T> operator==(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return cmp<_CMP_EQ_OQ>(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Mask<T> operator!=(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return cmp<_CMP_NEQ_UQ>(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Mask<T> operator< (AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return cmp<_CMP_LT_OQ>(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Mask<T> operator<=(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return cmp<_CMP_LE_OQ>(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Mask<T> operator> (AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return cmp<_CMP_GT_OQ>(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Mask<T> operator>=(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return cmp<_CMP_GE_OQ>(a.data(), b.data(), T());
+}
+
+// bitwise operators {{{1
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator^(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return xor_(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator&(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return and_(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator|(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return or_(a.data(), b.data());
+}
+// }}}1
+// arithmetic operators {{{1
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator+(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return add(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator-(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return sub(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator*(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return mul(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> operator/(AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return div(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value, AVX512::Vector<T>> operator%(
+    AVX512::Vector<T> a, AVX512::Vector<T> b)
+{
+    return a - a / b * b;
+}
+// }}}1
+// lane index helpers {{{1
+Vc_INTRINSIC __m512i lane_indexes(std::integral_constant<std::size_t, 16>)
+{
+    return _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+}
+Vc_INTRINSIC __m512i lane_indexes(std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+}
+Vc_INTRINSIC __m512i reversed_lane_indexes(std::integral_constant<std::size_t, 16>)
+{
+    return _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+}
+Vc_INTRINSIC __m512i reversed_lane_indexes(std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+}
+Vc_INTRINSIC __m512i add_lane_offset(__m512i idx, int amount,
+                                     std::integral_constant<std::size_t, 16>)
+{
+    return _mm512_add_epi32(idx, _mm512_set1_epi32(amount));
+}
+Vc_INTRINSIC __m512i add_lane_offset(__m512i idx, int amount,
+                                     std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_add_epi64(idx, _mm512_set1_epi64(amount));
+}
+Vc_INTRINSIC __mmask16 valid_lanes(__m512i idx, std::integral_constant<std::size_t, 16>)
+{
+    return _mm512_cmplt_epu32_mask(idx, _mm512_set1_epi32(16));
+}
+Vc_INTRINSIC __mmask8 valid_lanes(__m512i idx, std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_cmplt_epu64_mask(idx, _mm512_set1_epi64(8));
+}
+Vc_INTRINSIC __m512  maskz_permutexvar(__mmask16 k, __m512i idx, __m512  a) { return _mm512_maskz_permutexvar_ps(k, idx, a); }
+Vc_INTRINSIC __m512d maskz_permutexvar(__mmask8  k, __m512i idx, __m512d a) { return _mm512_maskz_permutexvar_pd(k, idx, a); }
+Vc_INTRINSIC __m512i maskz_permutexvar(__mmask16 k, __m512i idx, __m512i a) { return _mm512_maskz_permutexvar_epi32(k, idx, a); }
+// }}}1
+}  // namespace Detail
+///////////////////////////////////////////////////////////////////////////////////////////
+// generate {{{1
+template <typename T>
+template <typename G>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::generate(G gen)
+{
+    Vector r;
+    Common::unrolled_loop<std::size_t, 0, Size>(
+        [&](std::size_t i) { r.d.set(i, static_cast<T>(gen(i))); });
+    return r;
+}
+
+// constants {{{1
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(VectorSpecialInitializerZero)
+    : d{}
+{
+}
+
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(VectorSpecialInitializerOne)
+    : d(Detail::one64(T()))
+{
+}
+
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(AVX512::avx512_cast<VectorType>(
+          Detail::lane_indexes(std::integral_constant<std::size_t, Size>())))
+{
+}
+template <>
+Vc_INTRINSIC Vector<float, VectorAbi::Avx512>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm512_cvtepi32_ps(
+          Detail::lane_indexes(std::integral_constant<std::size_t, 16>())))
+{
+}
+template <>
+Vc_INTRINSIC Vector<double, VectorAbi::Avx512>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm512_cvtepi64_pd(
+          Detail::lane_indexes(std::integral_constant<std::size_t, 8>())))
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// load member functions {{{1
+template <typename DstT>
+template <typename SrcT, typename Flags>
+Vc_INTRINSIC typename Vector<DstT, VectorAbi::Avx512>::
+#ifndef Vc_MSVC
+template
+#endif
+load_concept<SrcT, Flags>::type Vector<DstT, VectorAbi::Avx512>::load(const SrcT *mem, Flags flags)
+{
+    Common::handleLoadPrefetches(mem, flags);
+    d.v() = Detail::load<VectorType, DstT>(mem, flags);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// zeroing {{{1
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setZero()
+{
+    data() = Detail::zero<VectorType>();
+}
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setZero(const Mask &k)
+{
+    data() = Detail::blend(data(), Detail::zero<VectorType>(), k.data());
+}
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setZeroInverted(const Mask &k)
+{
+    data() = Detail::blend(Detail::zero<VectorType>(), data(), k.data());
+}
+
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setQnan()
+{
+    data() = Detail::allone<VectorType>();
+}
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setQnan(MaskArgument k)
+{
+    data() = Detail::blend(data(), Detail::allone<VectorType>(), k.data());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// stores {{{1
+namespace Detail
+{
+template <typename T, typename V, typename Flags>
+Vc_INTRINSIC void avx512_store(V v, T *mem, Flags flags, T)
+{
+    store64(v, mem, flags);
+}
+template <typename T, typename U, typename V, typename Flags>
+Vc_INTRINSIC void avx512_store(V v, U *mem, Flags, T)
+{
+    alignas(64) T tmp[sizeof(V) / sizeof(T)];
+    store64(v, tmp, Vc::Aligned);
+    for (std::size_t i = 0; i < sizeof(V) / sizeof(T); ++i) {
+        mem[i] = static_cast<U>(tmp[i]);
+    }
+}
+template <typename T, typename V, typename K>
+Vc_INTRINSIC void avx512_masked_store(V v, T *mem, K k, T)
+{
+    store64(v, mem, k);
+}
+template <typename T, typename U, typename V, typename K>
+Vc_INTRINSIC void avx512_masked_store(V v, U *mem, K k, T)
+{
+    alignas(64) T tmp[sizeof(V) / sizeof(T)];
+    store64(v, tmp, Vc::Aligned);
+    for (std::size_t i = 0; i < sizeof(V) / sizeof(T); ++i) {
+        if (k & (K(1) << i)) {
+            mem[i] = static_cast<U>(tmp[i]);
+        }
+    }
+}
+}  // namespace Detail
+
+template <typename T>
+template <typename U,
+          typename Flags,
+          typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::store(U *mem, Flags flags) const
+{
+    Common::handleStorePrefetches(mem, flags);
+    Detail::avx512_store(data(), mem, flags, T());
+}
+
+template <typename T>
+template <typename U,
+          typename Flags,
+          typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::store(U *mem, Mask mask, Flags flags) const
+{
+    Common::handleStorePrefetches(mem, flags);
+    Detail::avx512_masked_store(data(), mem, mask.data(), T());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// integer ops {{{1
+template <> Vc_ALWAYS_INLINE AVX512::Vector< int> Vector< int, VectorAbi::Avx512>::operator<<(AsArg x) const { return _mm512_sllv_epi32(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX512::Vector<uint> Vector<uint, VectorAbi::Avx512>::operator<<(AsArg x) const { return _mm512_sllv_epi32(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX512::Vector< int> Vector< int, VectorAbi::Avx512>::operator>>(AsArg x) const { return _mm512_srav_epi32(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX512::Vector<uint> Vector<uint, VectorAbi::Avx512>::operator>>(AsArg x) const { return _mm512_srlv_epi32(d.v(), x.d.v()); }
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator<<=(AsArg x)
+{
+    static_assert(std::is_integral<T>::value,
+                  "bitwise-operators can only be used with Vectors of integral type");
+    return *this = *this << x;
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator>>=(AsArg x)
+{
+    static_assert(std::is_integral<T>::value,
+                  "bitwise-operators can only be used with Vectors of integral type");
+    return *this = *this >> x;
+}
+
+template<typename T> Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator>>=(int shift) {
+    d.v() = Detail::shiftRight(d.v(), shift, T());
+    return *this;
+}
+template<typename T> Vc_ALWAYS_INLINE Vc_PURE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator>>(int shift) const {
+    return Detail::shiftRight(d.v(), shift, T());
+}
+template<typename T> Vc_ALWAYS_INLINE AVX512::Vector<T> &Vector<T, VectorAbi::Avx512>::operator<<=(int shift) {
+    d.v() = Detail::shiftLeft(d.v(), shift, T());
+    return *this;
+}
+template<typename T> Vc_ALWAYS_INLINE Vc_PURE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator<<(int shift) const {
+    return Detail::shiftLeft(d.v(), shift, T());
+}
+
+// isnegative {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_m isnegative(AVX512::float_v x)
+{
+    return _mm512_test_epi32_mask(_mm512_castps_si512(x.data()),
+                                  _mm512_set1_epi32(0x80000000u));
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_m isnegative(AVX512::double_v x)
+{
+    return _mm512_test_epi64_mask(_mm512_castpd_si512(x.data()),
+                                  _mm512_set1_epi64(0x8000000000000000ull));
+}
+// gathers {{{1
+template <typename T>
+template <class MT, class IT, int Scale>
+inline void Vector<T, VectorAbi::Avx512>::gatherImplementation(
+    const Common::GatherArguments<MT, IT, Scale> &args)
+{
+    Common::unrolled_loop<std::size_t, 0, Size>([&](std::size_t i) {
+        d.set(i, static_cast<value_type>(args.address[Scale * args.indexes[i]]));
+    });
+}
+
+template <typename T>
+template <class MT, class IT, int Scale>
+inline void Vector<T, VectorAbi::Avx512>::gatherImplementation(
+    const Common::GatherArguments<MT, IT, Scale> &args, MaskArgument mask)
+{
+    const auto *mem = args.address;
+    const auto indexes = Scale * args.indexes;
+    using Selector = std::integral_constant < Common::GatherScatterImplementation,
+#ifdef Vc_USE_SET_GATHERS
+          Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
+#endif
+#ifdef Vc_USE_BSF_GATHERS
+                                            Common::GatherScatterImplementation::BitScanLoop
+#elif defined Vc_USE_POPCNT_BSF_GATHERS
+              Common::GatherScatterImplementation::PopcntSwitch
+#else
+              Common::GatherScatterImplementation::SimpleLoop
+#endif
+                                                > ;
+    Common::executeGather(Selector(), *this, mem, indexes, mask);
+}
+
+// scatters {{{1
+namespace Detail
+{
+/**\internal
+ * The native scatter instructions are used whenever the memory type matches the entry
+ * type and the indexes are a SIMD vector that can be converted to the native index
+ * vector. Otherwise the entries are written one by one.
+ */
+template <typename T, typename MT, typename IT>
+using avx512_native_scatter =
+    std::integral_constant<bool, (std::is_same<T, MT>::value &&
+                                  Traits::is_simd_vector<IT>::value)>;
+
+template <typename V, typename MT, typename IT>
+Vc_INTRINSIC void avx512_scatter(const V &v, MT *mem, const IT &indexes, std::true_type)
+{
+    AVX512::scatter<sizeof(MT)>(
+        mem, simd_cast<typename V::NativeIndexType>(indexes).data(), v.data());
+}
+template <typename V, typename MT, typename IT>
+Vc_INTRINSIC void avx512_scatter(const V &v, MT *mem, const IT &indexes, std::false_type)
+{
+    Common::unrolled_loop<std::size_t, 0, V::Size>(
+        [&](std::size_t i) { mem[indexes[i]] = v[i]; });
+}
+template <typename V, typename MT, typename IT>
+Vc_INTRINSIC void avx512_scatter(const V &v, MT *mem, const IT &indexes,
+                                 typename V::MaskArgument mask, std::true_type)
+{
+    AVX512::scatter<sizeof(MT)>(mem, mask.data(),
+                                simd_cast<typename V::NativeIndexType>(indexes).data(),
+                                v.data());
+}
+template <typename V, typename MT, typename IT>
+Vc_INTRINSIC void avx512_scatter(const V &v, MT *mem, IT &&indexes,
+                                 typename V::MaskArgument mask, std::false_type)
+{
+    using Selector = std::integral_constant < Common::GatherScatterImplementation,
+#ifdef Vc_USE_SET_GATHERS
+          Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
+#endif
+#ifdef Vc_USE_BSF_GATHERS
+                                            Common::GatherScatterImplementation::BitScanLoop
+#elif defined Vc_USE_POPCNT_BSF_GATHERS
+              Common::GatherScatterImplementation::PopcntSwitch
+#else
+              Common::GatherScatterImplementation::SimpleLoop
+#endif
+                                                > ;
+    Common::executeScatter(Selector(), v, mem, std::forward<IT>(indexes), mask);
+}
+}  // namespace Detail
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::scatterImplementation(MT *mem, IT &&indexes) const
+{
+    Detail::avx512_scatter(*this, mem, indexes,
+                           Detail::avx512_native_scatter<T, MT, Traits::decay<IT>>());
+}
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::scatterImplementation(MT *mem, IT &&indexes, MaskArgument mask) const
+{
+    Detail::avx512_scatter(*this, mem, std::forward<IT>(indexes), mask,
+                           Detail::avx512_native_scatter<T, MT, Traits::decay<IT>>());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// operator- {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator-() const
+{
+    return Detail::sub(Detail::zero<VectorType>(), d.v(), T());
+}
+template <>
+Vc_ALWAYS_INLINE Vc_PURE AVX512::Vector<float> Vector<float, VectorAbi::Avx512>::operator-() const
+{
+    return Detail::xor_(d.v(), _mm512_set1_ps(-0.f));
+}
+template <>
+Vc_ALWAYS_INLINE Vc_PURE AVX512::Vector<double> Vector<double, VectorAbi::Avx512>::operator-() const
+{
+    return Detail::xor_(d.v(), _mm512_set1_pd(-0.));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// horizontal ops {{{1
+template <typename T>
+Vc_INTRINSIC std::pair<Vector<T, VectorAbi::Avx512>, int>
+Vector<T, VectorAbi::Avx512>::minIndex() const
+{
+    AVX512::Vector<T> x = min();
+    return std::make_pair(x, (*this == x).firstOne());
+}
+template <typename T>
+Vc_INTRINSIC std::pair<Vector<T, VectorAbi::Avx512>, int>
+Vector<T, VectorAbi::Avx512>::maxIndex() const
+{
+    AVX512::Vector<T> x = max();
+    return std::make_pair(x, (*this == x).firstOne());
+}
+template <typename T>
+Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::partialSum() const
+{
+    //   a    b    c    d    e    f    g    h ...
+    // +      a    b    c    d    e    f    g    -> a ab bc  cd   de    ef     fg      gh
+    // +           a    ab   bc   cd   de   ef   -> a ab abc abcd bcde  cdef   defg    efgh
+    // +                     a    ab   abc  abcd -> a ab abc abcd abcde abcdef abcdefg abcdefgh
+    AVX512::Vector<T> tmp = *this;
+    for (std::size_t i = 1; i < Size; i <<= 1) {
+        tmp += tmp.shifted(-int(i));
+    }
+    return tmp;
+}
+
+// exponent {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_v exponent(AVX512::float_v x)
+{
+    using Detail::operator>=;
+    Vc_ASSERT((x >= x.Zero()).isFull());
+    return _mm512_getexp_ps(x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_v exponent(AVX512::double_v x)
+{
+    using Detail::operator>=;
+    Vc_ASSERT((x >= x.Zero()).isFull());
+    return _mm512_getexp_pd(x.data());
+}
+// }}}1
+// Random {{{1
+/* Reuses the AVX(2) LCG state update twice, so that the sequence stays compatible with
+ * the RandomState layout every other implementation uses.
+ */
+static Vc_ALWAYS_INLINE __m512i _doRandomStep512()
+{
+    const __m256i lo = _doRandomStep();
+    const __m256i hi = _doRandomStep();
+    return AVX512::concat(lo, hi);
+}
+
+template <typename T> Vc_ALWAYS_INLINE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::Random()
+{
+    return {_doRandomStep512()};
+}
+
+template <> Vc_ALWAYS_INLINE AVX512::float_v AVX512::float_v::Random()
+{
+    return _mm512_sub_ps(
+        Detail::or_(_mm512_castsi512_ps(_mm512_srli_epi32(_doRandomStep512(), 2)),
+                    Detail::one64(float())),
+        Detail::one64(float()));
+}
+
+template <> Vc_ALWAYS_INLINE AVX512::double_v AVX512::double_v::Random()
+{
+    return _mm512_sub_pd(
+        Detail::or_(_mm512_castsi512_pd(_mm512_srli_epi64(_doRandomStep512(), 12)),
+                    Detail::one64(double())),
+        Detail::one64(double()));
+}
+// }}}1
+// shifted / rotated {{{1
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::shifted(int amount) const
+{
+    using Sz = std::integral_constant<std::size_t, Size>;
+    const __m512i idx =
+        Detail::add_lane_offset(Detail::lane_indexes(Sz()), amount, Sz());
+    return Detail::maskz_permutexvar(Detail::valid_lanes(idx, Sz()), idx, d.v());
+}
+
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::shifted(int amount,
+                                                                     Vector shiftIn) const
+{
+    using Sz = std::integral_constant<std::size_t, Size>;
+    if (amount >= 0 && amount <= int(Size)) {
+        // index Size + i selects entry i of the second operand
+        return Detail::permutex2var(
+            d.v(), Detail::add_lane_offset(Detail::lane_indexes(Sz()), amount, Sz()),
+            shiftIn.d.v());
+    } else if (amount < 0 && amount >= -int(Size)) {
+        return Detail::permutex2var(
+            shiftIn.d.v(),
+            Detail::add_lane_offset(Detail::lane_indexes(Sz()), int(Size) + amount, Sz()),
+            d.v());
+    }
+    using Detail::operator|;
+    return shifted(amount) | (amount > 0 ?
+                              shiftIn.shifted(amount - Size) :
+                              shiftIn.shifted(Size + amount));
+}
+
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::rotated(int amount) const
+{
+    using Sz = std::integral_constant<std::size_t, Size>;
+    // the permute instructions only use the low log2(Size) bits of each index
+    return Detail::permutexvar(
+        Detail::add_lane_offset(Detail::lane_indexes(Sz()), amount & (int(Size) - 1), Sz()),
+        d.v());
+}
+// sorted {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::sorted()
+    const
+{
+    alignas(64) T tmp[Size];
+    store(tmp, Vc::Aligned);
+    std::sort(tmp, tmp + Size);
+    return Vector(tmp, Vc::Aligned);
+}
+// interleaveLow/-High {{{1
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::interleaveLow(Vector x) const
+{
+    using Sz = std::integral_constant<std::size_t, Size>;
+    // 0, Size, 1, Size + 1, ...
+    const __m512i i = Detail::lane_indexes(Sz());
+    const __m512i idx =
+        Size == 16 ? _mm512_or_si512(_mm512_srli_epi32(i, 1),
+                                     _mm512_slli_epi32(_mm512_and_si512(i, _mm512_set1_epi32(1)), 4))
+                   : _mm512_or_si512(_mm512_srli_epi64(i, 1),
+                                     _mm512_slli_epi64(_mm512_and_si512(i, _mm512_set1_epi64(1)), 3));
+    return Detail::permutex2var(d.v(), idx, x.d.v());
+}
+template <typename T>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::interleaveHigh(Vector x) const
+{
+    return shifted(int(Size) / 2).interleaveLow(x.shifted(int(Size) / 2));
+}
+// permutation via operator[] {{{1
+template <typename T>
+Vc_INTRINSIC Vc_PURE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator[](
+    Permutation::ReversedTag) const
+{
+    return Detail::permutexvar(
+        Detail::reversed_lane_indexes(std::integral_constant<std::size_t, Size>()),
+        d.v());
+}
+template <typename T>
+Vc_INTRINSIC Vc_PURE AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::operator[](
+    const IndexType &perm) const
+{
+    return generate([&](std::size_t i) { return d.m(perm[i]); });
+}
+
+// reversed {{{1
+template <typename T>
+Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::reversed() const
+{
+    return (*this)[Permutation::Reversed];
+}
+
+// broadcast from constexpr index {{{1
+template <typename T>
+template <int Index>
+Vc_INTRINSIC AVX512::Vector<T> Vector<T, VectorAbi::Avx512>::broadcast() const
+{
+    using Sz = std::integral_constant<std::size_t, Size>;
+    return Detail::permutexvar(
+        Detail::add_lane_offset(Detail::zero<__m512i>(), Index, Sz()), d.v());
+}
+// }}}1
+}  // namespace Vc
+
+// vim: foldmethod=marker
@@ -161,6 +161,509 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
     return std::move(f);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::copy_if` algorithm for contiguous ranges of arithmetic types.
+ *
+ * Copies the elements of [\p first, \p last) for which \p pred is \c true to the range
+ * starting at \p d_first, keeping their order, and returns the end of the output range.
+ *
+ * \p pred is called with `Vc::Vector<T>` arguments and must return the corresponding mask
+ * type. The elements past the last full vector are passed in a vector padded with zeros;
+ * the result for the padding entries is ignored. The selected entries of every vector are
+ * packed with Vc::compress and written to the output one full vector at a time.
+ *
+ * \p d_first may be equal to \p first, which filters the range in place. Other overlaps
+ * of the input and output ranges are not allowed.
+ *
+ * \code
+ * float *end = Vc::copy_if(in, in + n, out, [](Vc::float_v x) { return x > 0.f; });
+ * \endcode
+ */
+template <typename T, typename UnaryPredicate>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> copy_if(const T *first,
+                                                                         const T *last,
+                                                                         T *d_first,
+                                                                         UnaryPredicate pred)
+{
+    using V = Vector<T>;
+    constexpr std::size_t N = V::Size;
+    // the output is collected in a buffer of two vectors, so that d_first is only written
+    // with full vectors of selected entries (and the remainder at the end)
+    alignas(V::MemoryAlignment) T buffer[2 * N];
+    std::size_t fill = 0;
+    for (; last - first >= std::ptrdiff_t(N); first += N) {
+        const V x(first, Vc::Unaligned);
+        const auto mask = pred(x);
+        compress(x, mask).store(&buffer[fill], Vc::Unaligned);
+        fill += mask.count();
+        if (fill >= N) {
+            V(&buffer[0], Vc::Aligned).store(d_first, Vc::Unaligned);
+            V(&buffer[N], Vc::Aligned).store(&buffer[0], Vc::Aligned);
+            d_first += N;
+            fill -= N;
+        }
+    }
+    if (first != last) {
+        const std::size_t rest = last - first;
+        const V x = V::generate([&](std::size_t i) { return i < rest ? first[i] : T(); });
+        const auto mask = pred(x) && V(Vc::IndexesFromZero) < V(T(rest));
+        compress(x, mask).store(&buffer[fill], Vc::Unaligned);
+        fill += mask.count();
+    }
+    std::copy_n(&buffer[0], fill, d_first);
+    return d_first + fill;
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt,
+          typename UnaryPredicate>
+inline enable_if<Traits::is_contiguous_iterator<OutputIt>::value,
+                 Detail::enable_if_contiguous_range<It<Ts...>, OutputIt>>
+copy_if(It<Ts...> first, It<Ts...> last, OutputIt d_first, UnaryPredicate pred)
+{
+    if (first == last) {
+        return d_first;
+    }
+    const auto *p = std::addressof(*first);
+    auto *out = std::addressof(*d_first);
+    return d_first + (copy_if(p, p + std::distance(first, last), out, pred) - out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+namespace Detail
+{
+/**\internal
+ * Calls `f(x, k, p)` for a sequence of vectors \c x loaded from \c p that covers
+ * [\p first, \p last). The mask \c k selects the entries of \c x that lie in the range and
+ * have not been passed to \p f before. Only the first and the last vector are loaded from
+ * unaligned addresses; ranges shorter than one vector are padded with zeros. The
+ * iteration stops as soon as \p f returns \c true.
+ */
+template <typename V, typename F>
+inline void for_each_vector(const typename V::EntryType *first,
+                            const typename V::EntryType *last, F &&f)
+{
+    using T = typename V::EntryType;
+    using M = typename V::mask_type;
+    constexpr std::size_t N = V::Size;
+    const std::size_t len = last - first;
+    if (len < N) {
+        if (len > 0) {
+            f(V::generate([&](std::size_t i) { return i < len ? first[i] : T(); }),
+              V(Vc::IndexesFromZero) < V(T(len)), first);
+        }
+        return;
+    }
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(first) / sizeof(T) % N;
+    if (misalignment != 0) {
+        if (f(V(first, Vc::Unaligned), V(Vc::IndexesFromZero) < V(T(N - misalignment)),
+              first)) {
+            return;
+        }
+        first += N - misalignment;
+    }
+    for (; last - first >= std::ptrdiff_t(N); first += N) {
+        if (f(V(first, Vc::Aligned), M(true), first)) {
+            return;
+        }
+    }
+    if (first != last) {
+        const std::size_t rest = last - first;
+        f(V(last - N, Vc::Unaligned), V(Vc::IndexesFromZero) >= V(T(N - rest)), last - N);
+    }
+}
+
+/**\internal
+ * Determines the position of the smallest (\p Max = \c false) or largest (\p Max = \c
+ * true) element of a range that is passed in blocks. The extremum of each block is
+ * computed with vertical min/max operations; only the block that holds the result is
+ * searched again for its position. \p Last selects the last instead of the first
+ * occurrence of the extremum.
+ */
+template <typename V, bool Max, bool Last> class ExtremumTracker
+{
+    using T = typename V::EntryType;
+
+public:
+    void beginBlock(const T *b) { blockExtremum = V(*b); }
+    void update(const V &x, const typename V::mask_type &k)
+    {
+        const V y = iif(k, x, blockExtremum);
+        blockExtremum = Max ? Vc::max(blockExtremum, y) : Vc::min(blockExtremum, y);
+    }
+    void endBlock(const T *b, const T *e)
+    {
+        const T r = Max ? blockExtremum.max() : blockExtremum.min();
+        if (bestBegin == nullptr || (Max ? best < r : r < best) || (Last && r == best)) {
+            best = r;
+            bestBegin = b;
+            bestEnd = e;
+        }
+    }
+    const T *result() const
+    {
+        const T *found = bestBegin;
+        for_each_vector<V>(bestBegin, bestEnd,
+                           [&](const V &x, const typename V::mask_type &k, const T *p) {
+                               const auto mask = x == V(best) && k;
+                               if (any_of(mask)) {
+                                   if (!Last) {
+                                       found = p + mask.firstOne();
+                                       return true;
+                                   }
+                                   for (std::size_t i = V::Size; i > 0; --i) {
+                                       if (mask[i - 1]) {
+                                           found = p + (i - 1);
+                                           break;
+                                       }
+                                   }
+                               }
+                               return false;
+                           });
+        return found;
+    }
+
+private:
+    V blockExtremum;
+    T best = T();
+    const T *bestBegin = nullptr;
+    const T *bestEnd = nullptr;
+};
+
+template <typename A, typename B> struct ExtremumTrackerPair {
+    template <typename T> void beginBlock(const T *p)
+    {
+        a.beginBlock(p);
+        b.beginBlock(p);
+    }
+    template <typename V, typename M> void update(const V &x, const M &k)
+    {
+        a.update(x, k);
+        b.update(x, k);
+    }
+    template <typename T> void endBlock(const T *first, const T *last)
+    {
+        a.endBlock(first, last);
+        b.endBlock(first, last);
+    }
+    A a;
+    B b;
+};
+
+/**\internal
+ * Passes [\p first, \p last) to \p tracker in blocks of 64 vectors that start at aligned
+ * addresses (except for the first).
+ */
+template <typename V, typename Tracker>
+inline void for_each_block(const typename V::EntryType *first,
+                           const typename V::EntryType *last, Tracker &tracker)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t BlockSize = 64 * V::Size;
+    std::size_t blockSize =
+        BlockSize - reinterpret_cast<std::uintptr_t>(first) / sizeof(T) % V::Size;
+    while (first != last) {
+        const T *end = std::size_t(last - first) > blockSize ? first + blockSize : last;
+        tracker.beginBlock(first);
+        for_each_vector<V>(first, end,
+                           [&](const V &x, const typename V::mask_type &k, const T *) {
+                               tracker.update(x, k);
+                               return false;
+                           });
+        tracker.endBlock(first, end);
+        first = end;
+        blockSize = BlockSize;
+    }
+}
+}  // namespace Detail
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find_if` algorithm for contiguous ranges of arithmetic types.
+ *
+ * Returns a pointer to the first element of [\p first, \p last) for which \p pred is \c
+ * true, or \p last if there is no such element. \p pred is called with `Vc::Vector<T>`
+ * arguments and must return the corresponding mask type. It may be called with entries
+ * outside of the range (zeros or neighboring elements); their results are ignored.
+ *
+ * \code
+ * const float *neg = Vc::find_if(data, data + n, [](Vc::float_v x) { return x < 0.f; });
+ * \endcode
+ */
+template <typename T, typename UnaryPredicate>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, const T *> find_if(
+    const T *first, const T *last, UnaryPredicate pred)
+{
+    using V = Vector<T>;
+    const T *found = last;
+    Detail::for_each_vector<V>(first, last,
+                               [&](const V &x, const typename V::mask_type &k, const T *p) {
+                                   const auto mask = pred(x) && k;
+                                   if (any_of(mask)) {
+                                       found = p + mask.firstOne();
+                                       return true;
+                                   }
+                                   return false;
+                               });
+    return found;
+}
+
+template <template <typename...> class It, typename... Ts, typename UnaryPredicate>
+inline Detail::enable_if_contiguous_range<It<Ts...>, It<Ts...>> find_if(
+    It<Ts...> first, It<Ts...> last, UnaryPredicate pred)
+{
+    if (first == last) {
+        return last;
+    }
+    const auto *p = std::addressof(*first);
+    return first + (find_if(p, p + std::distance(first, last), pred) - p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find` algorithm for contiguous ranges of arithmetic types.
+ *
+ * Returns a pointer to the first element of [\p first, \p last) that compares equal to \p
+ * value, or \p last if there is no such element.
+ */
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, const T *> find(
+    const T *first, const T *last, const T &value)
+{
+    const Vector<T> v = value;
+    return find_if(first, last, [&](const Vector<T> &x) { return x == v; });
+}
+
+template <template <typename...> class It, typename... Ts>
+inline Detail::enable_if_contiguous_range<It<Ts...>, It<Ts...>> find(
+    It<Ts...> first, It<Ts...> last,
+    const typename std::iterator_traits<It<Ts...>>::value_type &value)
+{
+    if (first == last) {
+        return last;
+    }
+    const auto *p = std::addressof(*first);
+    return first + (find(p, p + std::distance(first, last), value) - p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count_if` algorithm for contiguous ranges of arithmetic types.
+ *
+ * Returns the number of elements in [\p first, \p last) for which \p pred is \c true. The
+ * requirements on \p pred are the same as for Vc::find_if.
+ */
+template <typename T, typename UnaryPredicate>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, std::ptrdiff_t> count_if(
+    const T *first, const T *last, UnaryPredicate pred)
+{
+    using V = Vector<T>;
+    std::ptrdiff_t n = 0;
+    Detail::for_each_vector<V>(first, last,
+                               [&](const V &x, const typename V::mask_type &k, const T *) {
+                                   n += (pred(x) && k).count();
+                                   return false;
+                               });
+    return n;
+}
+
+template <template <typename...> class It, typename... Ts, typename UnaryPredicate>
+inline Detail::enable_if_contiguous_range<
+    It<Ts...>, typename std::iterator_traits<It<Ts...>>::difference_type>
+count_if(It<Ts...> first, It<Ts...> last, UnaryPredicate pred)
+{
+    if (first == last) {
+        return 0;
+    }
+    const auto *p = std::addressof(*first);
+    return count_if(p, p + std::distance(first, last), pred);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count` algorithm for contiguous ranges of arithmetic types.
+ */
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, std::ptrdiff_t> count(
+    const T *first, const T *last, const T &value)
+{
+    const Vector<T> v = value;
+    return count_if(first, last, [&](const Vector<T> &x) { return x == v; });
+}
+
+template <template <typename...> class It, typename... Ts>
+inline Detail::enable_if_contiguous_range<
+    It<Ts...>, typename std::iterator_traits<It<Ts...>>::difference_type>
+count(It<Ts...> first, It<Ts...> last,
+      const typename std::iterator_traits<It<Ts...>>::value_type &value)
+{
+    if (first == last) {
+        return 0;
+    }
+    const auto *p = std::addressof(*first);
+    return count(p, p + std::distance(first, last), value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::minmax_element` algorithm for contiguous ranges of arithmetic
+ * types.
+ *
+ * Returns pointers to the first smallest and the last largest element of [\p first, \p
+ * last), or `{last, last}` if the range is empty. The range is read once, with only
+ * vertical min/max operations in the main loop. The result is unspecified if the range
+ * contains NaNs.
+ */
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value,
+                 std::pair<const T *, const T *>>
+minmax_element(const T *first, const T *last)
+{
+    using V = Vector<T>;
+    if (first == last) {
+        return {last, last};
+    }
+    Detail::ExtremumTrackerPair<Detail::ExtremumTracker<V, false, false>,
+                                Detail::ExtremumTracker<V, true, true>>
+        trackers;
+    Detail::for_each_block<V>(first, last, trackers);
+    return {trackers.a.result(), trackers.b.result()};
+}
+
+template <template <typename...> class It, typename... Ts>
+inline Detail::enable_if_contiguous_range<It<Ts...>, std::pair<It<Ts...>, It<Ts...>>>
+minmax_element(It<Ts...> first, It<Ts...> last)
+{
+    if (first == last) {
+        return {last, last};
+    }
+    const auto *p = std::addressof(*first);
+    const auto r = minmax_element(p, p + std::distance(first, last));
+    return {first + (r.first - p), first + (r.second - p)};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the index of the first smallest element of [\p first, \p last), or 0 if the
+ * range is empty. The result is unspecified if the range contains NaNs.
+ */
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, std::size_t> argmin(
+    const T *first, const T *last)
+{
+    if (first == last) {
+        return 0;
+    }
+    Detail::ExtremumTracker<Vector<T>, false, false> tracker;
+    Detail::for_each_block<Vector<T>>(first, last, tracker);
+    return tracker.result() - first;
+}
+
+template <typename ContiguousIt>
+inline Detail::enable_if_contiguous_range<ContiguousIt, std::size_t> argmin(
+    ContiguousIt first, ContiguousIt last)
+{
+    if (first == last) {
+        return 0;
+    }
+    const auto *p = std::addressof(*first);
+    return argmin(p, p + std::distance(first, last));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Returns the index of the first largest element of [\p first, \p last), or 0 if the
+ * range is empty. The result is unspecified if the range contains NaNs.
+ */
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, std::size_t> argmax(
+    const T *first, const T *last)
+{
+    if (first == last) {
+        return 0;
+    }
+    Detail::ExtremumTracker<Vector<T>, true, false> tracker;
+    Detail::for_each_block<Vector<T>>(first, last, tracker);
+    return tracker.result() - first;
+}
+
+template <typename ContiguousIt>
+inline Detail::enable_if_contiguous_range<ContiguousIt, std::size_t> argmax(
+    ContiguousIt first, ContiguousIt last)
+{
+    if (first == last) {
+        return 0;
+    }
+    const auto *p = std::addressof(*first);
+    return argmax(p, p + std::distance(first, last));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Batched variant of `std::lower_bound`: Searches the sorted range [\p first, \p last) for
+ * all entries of \p keys at once and returns, for every key, the offset of the first
+ * element that does not compare less than the key (or `last - first` if there is none).
+ *
+ * The search is branch-free: every step halves the remaining range for all keys and
+ * fetches the next pivot of every key with one gather. Thus all keys take the same
+ * `log2(last - first) + 1` steps, which hides most of the memory latency of a scalar
+ * binary search.
+ *
+ * \code
+ * const Vc::float_v t = ...;
+ * const auto idx = Vc::lower_bound(times.data(), times.data() + times.size(), t);
+ * \endcode
+ *
+ * \note The range must be smaller than `std::numeric_limits<int>::max()` elements.
+ */
+template <typename T, typename Abi>
+inline typename Vector<T, Abi>::IndexType lower_bound(const T *first, const T *last,
+                                                      const Vector<T, Abi> &keys)
+{
+    using IT = typename Vector<T, Abi>::IndexType;
+    std::size_t n = last - first;
+    if (n == 0) {
+        return IT(0);
+    }
+    // selects the entries of IT whose bit is set in Mask::toInt() of Vector<T, Abi>
+    const IT laneBits = IT::generate([](int i) { return int(1u << i); });
+    const auto select = [&](unsigned int bits) { return (IT(int(bits)) & laneBits) != 0; };
+    IT base(0);
+    while (n > 1) {
+        const std::size_t half = n / 2;
+        const Vector<T, Abi> pivot(first + half, base);
+        base(select((pivot < keys).toInt())) += int(half);
+        n -= half;
+    }
+    base(select((Vector<T, Abi>(first, base) < keys).toInt())) += 1;
+    return base;
+}
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
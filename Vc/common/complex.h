@@ -0,0 +1,269 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_COMPLEX_H_
+#define VC_COMMON_COMPLEX_H_
+
+#include <complex>
+#include <type_traits>
+#include "../vector.h"
+#include "deinterleave.h"
+#include "interleave.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// complex_v {{{1
+/**
+ * \ingroup Vectors
+ * \headerfile complex.h <Vc/complex>
+ *
+ * A vector of `Size` complex numbers of type `std::complex<T>`, with \p T either `float`
+ * or `double`.
+ *
+ * The real and imaginary parts are stored in two separate vectors (structure of arrays),
+ * so that every complex operation maps to a few vertical SIMD instructions and no
+ * shuffles. The conversion from and to the interleaved layout of `std::complex<T>` arrays
+ * happens only in load() and store(), which use Vc::deinterleave and Vc::interleave.
+ *
+ * \code
+ * std::vector<std::complex<float>> x = ..., y = ...;
+ * for (std::size_t i = 0; i < x.size(); i += Vc::complex_v<float>::Size) {
+ *   Vc::complex_v<float> z(&x[i]);
+ *   z = z * Vc::complex_v<float>(&y[i]) + 1.f;
+ *   z.store(&x[i]);
+ * }
+ * \endcode
+ */
+template <typename T> class complex_v
+{
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                  "complex_v<T> requires T to be float or double");
+
+public:
+    using value_type = std::complex<T>;
+    using vector_type = Vector<T>;
+    using mask_type = typename vector_type::mask_type;
+    static constexpr std::size_t Size = vector_type::Size;
+    static constexpr std::size_t size() { return Size; }
+
+    // constructors {{{2
+    /// Zero-initializes all entries.
+    complex_v() = default;
+    complex_v(const vector_type &re, const vector_type &im) : m_re(re), m_im(im) {}
+    complex_v(const vector_type &re) : m_re(re), m_im(vector_type::Zero()) {}
+    complex_v(T re) : m_re(re), m_im(vector_type::Zero()) {}
+    /// Broadcasts \p z to all entries.
+    complex_v(const std::complex<T> &z) : m_re(z.real()), m_im(z.imag()) {}
+
+    /// Loads \p Size complex numbers from \p mem. \see load
+    template <typename Flags = DefaultLoadTag>
+    explicit complex_v(const std::complex<T> *mem, Flags f = Flags())
+    {
+        load(mem, f);
+    }
+
+    // load / store {{{2
+    /**
+     * Loads \p Size complex numbers from the interleaved array \p mem and splits them
+     * into the real and imaginary vectors.
+     *
+     * \param mem Pointer to `Size` consecutive `std::complex<T>` objects. With
+     *            Vc::Aligned it must be aligned to `vector_type::MemoryAlignment`.
+     * \param f   Vc::Aligned or Vc::Unaligned (the default).
+     */
+    template <typename Flags = DefaultLoadTag>
+    Vc_INTRINSIC void load(const std::complex<T> *mem, Flags f = Flags())
+    {
+        // std::complex<T> is layout-compatible with T[2] ([complex.numbers])
+        Vc::deinterleave(&m_re, &m_im, reinterpret_cast<const T *>(mem), f);
+    }
+
+    /**
+     * Stores the \p Size complex numbers to the interleaved array \p mem.
+     *
+     * \param mem Pointer to storage for `Size` consecutive `std::complex<T>` objects.
+     * \param f   Vc::Aligned or Vc::Unaligned (the default), optionally combined with
+     *            Vc::Streaming.
+     */
+    template <typename Flags = DefaultStoreTag>
+    Vc_INTRINSIC void store(std::complex<T> *mem, Flags f = Flags()) const
+    {
+        T *out = reinterpret_cast<T *>(mem);
+        const std::pair<vector_type, vector_type> tmp = Vc::interleave(m_re, m_im);
+        tmp.first.store(out, f);
+        tmp.second.store(out + Size, f);
+    }
+
+    // element access {{{2
+    const vector_type &real() const { return m_re; }
+    const vector_type &imag() const { return m_im; }
+    void real(const vector_type &re) { m_re = re; }
+    void imag(const vector_type &im) { m_im = im; }
+
+    /// Returns the complex number in lane \p i.
+    std::complex<T> operator[](std::size_t i) const { return {m_re[i], m_im[i]}; }
+
+    // unary operators {{{2
+    complex_v operator+() const { return *this; }
+    complex_v operator-() const { return {-m_re, -m_im}; }
+
+    // addition / subtraction {{{2
+    friend complex_v operator+(const complex_v &a, const complex_v &b)
+    {
+        return {a.m_re + b.m_re, a.m_im + b.m_im};
+    }
+    friend complex_v operator-(const complex_v &a, const complex_v &b)
+    {
+        return {a.m_re - b.m_re, a.m_im - b.m_im};
+    }
+
+    // multiplication {{{2
+    /**
+     * `(a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re)` with two multiplications
+     * and two fused multiply-adds if the target supports FMA.
+     * Infinite results are not recovered from NaN intermediates (as C11 Annex G
+     * requires).
+     */
+    friend complex_v operator*(const complex_v &a, const complex_v &b)
+    {
+        return {Detail::multiply_add(a.m_re, b.m_re, -(a.m_im * b.m_im)),
+                Detail::multiply_add(a.m_re, b.m_im, a.m_im * b.m_re)};
+    }
+    friend complex_v operator*(const complex_v &a, const vector_type &b)
+    {
+        return {a.m_re * b, a.m_im * b};
+    }
+    friend complex_v operator*(const vector_type &a, const complex_v &b) { return b * a; }
+    friend complex_v operator*(const complex_v &a, T b)
+    {
+        return a * vector_type(b);
+    }
+    friend complex_v operator*(T a, const complex_v &b) { return b * vector_type(a); }
+
+    // division {{{2
+    /**
+     * `a * conj(b) / norm(b)`, i.e. one division and no scaling. In contrast to
+     * `std::complex` division the result overflows (or underflows to zero) if
+     * `norm(b)` is not representable in \p T, i.e. for `|b|` outside of roughly
+     * `[sqrt(min), sqrt(max)]`.
+     */
+    friend complex_v operator/(const complex_v &a, const complex_v &b)
+    {
+        const vector_type r = vector_type::One() / norm(b);
+        return {Detail::multiply_add(a.m_re, b.m_re, a.m_im * b.m_im) * r,
+                Detail::multiply_add(a.m_im, b.m_re, -(a.m_re * b.m_im)) * r};
+    }
+    friend complex_v operator/(const complex_v &a, const vector_type &b)
+    {
+        return {a.m_re / b, a.m_im / b};
+    }
+    friend complex_v operator/(const complex_v &a, T b) { return a / vector_type(b); }
+
+    // compound assignment {{{2
+    template <typename U> complex_v &operator+=(const U &x) { return *this = *this + x; }
+    template <typename U> complex_v &operator-=(const U &x) { return *this = *this - x; }
+    template <typename U> complex_v &operator*=(const U &x) { return *this = *this * x; }
+    template <typename U> complex_v &operator/=(const U &x) { return *this = *this / x; }
+
+    // comparison {{{2
+    friend mask_type operator==(const complex_v &a, const complex_v &b)
+    {
+        return a.m_re == b.m_re && a.m_im == b.m_im;
+    }
+    friend mask_type operator!=(const complex_v &a, const complex_v &b)
+    {
+        return a.m_re != b.m_re || a.m_im != b.m_im;
+    }
+
+    // norm / conj {{{2
+    /// Returns the squared magnitude `re² + im²`.
+    friend vector_type norm(const complex_v &z)
+    {
+        return Detail::multiply_add(z.m_re, z.m_re, z.m_im * z.m_im);
+    }
+    friend complex_v conj(const complex_v &z) { return {z.m_re, -z.m_im}; }
+
+    // iif {{{2
+    /// Returns \p a in the lanes where \p k is set and \p b in the remaining lanes.
+    friend complex_v iif(const mask_type &k, const complex_v &a, const complex_v &b)
+    {
+        return {Vc::iif(k, a.m_re, b.m_re), Vc::iif(k, a.m_im, b.m_im)};
+    }
+    // }}}2
+
+private:
+    vector_type m_re;
+    vector_type m_im;
+};
+
+template <typename T> constexpr std::size_t complex_v<T>::Size;
+
+// real / imag {{{1
+template <typename T> Vc_INTRINSIC Vector<T> real(const complex_v<T> &z)
+{
+    return z.real();
+}
+template <typename T> Vc_INTRINSIC Vector<T> imag(const complex_v<T> &z)
+{
+    return z.imag();
+}
+
+// abs {{{1
+/**
+ * Returns the magnitude `sqrt(norm(z))`. In contrast to `std::abs(std::complex)` the
+ * intermediate is not scaled, i.e. it overflows for `|z|` beyond roughly `sqrt(max)` and
+ * loses precision below `sqrt(min)`.
+ */
+template <typename T> Vc_INTRINSIC Vector<T> abs(const complex_v<T> &z)
+{
+    return Vc::sqrt(norm(z));
+}
+
+// arg {{{1
+/// Returns the phase angle `atan2(imag(z), real(z))` in the interval [-π, π].
+template <typename T> Vc_INTRINSIC Vector<T> arg(const complex_v<T> &z)
+{
+    return Vc::atan2(z.imag(), z.real());
+}
+
+// polar {{{1
+/// Returns the complex numbers with magnitudes \p rho and phase angles \p theta.
+template <typename T>
+Vc_INTRINSIC complex_v<T> polar(const Vector<T> &rho, const Vector<T> &theta)
+{
+    Vector<T> s, c;
+    Vc::sincos(theta, &s, &c);
+    return {rho * c, rho * s};
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPLEX_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,183 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_COMPRESS_H_
+#define VC_COMMON_COMPRESS_H_
+
+#include <cstddef>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// has_compress_permutation {{{1
+/**\internal
+ * True if Detail::compress/expand implement the permutation for the vector registers of
+ * \p Abi. Otherwise compress and expand are done entry by entry.
+ */
+template <typename Abi>
+using has_compress_permutation = std::integral_constant<bool,
+#ifdef Vc_IMPL_SSSE3
+                                                        std::is_same<Abi, VectorAbi::Sse>::value ||
+#endif
+#ifdef Vc_IMPL_AVX
+                                                        std::is_same<Abi, VectorAbi::Avx>::value ||
+#endif
+#ifdef Vc_IMPL_AVX512
+                                                        std::is_same<Abi, VectorAbi::Avx512>::value ||
+#endif
+                                                        false>;
+
+// compress_generic / expand_generic {{{1
+template <typename V> inline V compress_generic(const V &v, const typename V::mask_type &mask)
+{
+    using T = typename V::EntryType;
+    T tmp[V::Size] = {};
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        if (mask[i]) {
+            tmp[n++] = v[i];
+        }
+    }
+    return V(&tmp[0], Vc::Unaligned);
+}
+
+template <typename V> inline V expand_generic(const V &v, const typename V::mask_type &mask)
+{
+    using T = typename V::EntryType;
+    T tmp[V::Size] = {};
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        if (mask[i]) {
+            tmp[i] = v[n++];
+        }
+    }
+    return V(&tmp[0], Vc::Unaligned);
+}
+
+// compress_impl / expand_impl {{{1
+template <typename T, typename Abi> using mask_for = typename Vector<T, Abi>::mask_type;
+
+#if defined Vc_IMPL_SSSE3 || defined Vc_IMPL_AVX
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Abi> compress_impl(const Vector<T, Abi> &v,
+                                          const mask_for<T, Abi> &mask, std::true_type)
+{
+    return Detail::compress(v.data(), mask.toInt(), T());
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Abi> expand_impl(const Vector<T, Abi> &v,
+                                        const mask_for<T, Abi> &mask, std::true_type)
+{
+    return Detail::expand(v.data(), mask.toInt(), T());
+}
+#endif
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Abi> compress_impl(const Vector<T, Abi> &v,
+                                          const mask_for<T, Abi> &mask, std::false_type)
+{
+    return compress_generic(v, mask);
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Abi> expand_impl(const Vector<T, Abi> &v,
+                                        const mask_for<T, Abi> &mask, std::false_type)
+{
+    return expand_generic(v, mask);
+}
+}  // namespace Detail
+
+// compress {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Returns a vector with the entries of \p v where \p mask is set, moved to the front in
+ * their original order. The remaining `v.size() - mask.count()` entries are zero.
+ *
+ * \code
+ * v    = [1, 2, 3, 4]
+ * mask = [1, 0, 1, 1]
+ * compress(v, mask) = [1, 3, 4, 0]
+ * \endcode
+ *
+ * SSE and AVX implement this with a single permutation taken from a lookup table indexed
+ * by the mask bits. AVX512 vectors use the compress instructions.
+ *
+ * \see Vector::compressStore, expand
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Abi> compress(const Vector<T, Abi> &v,
+                                     const Detail::mask_for<T, Abi> &mask)
+{
+    return Detail::compress_impl(v, mask, Detail::has_compress_permutation<Abi>());
+}
+
+template <typename T, std::size_t N, typename V, std::size_t M>
+inline SimdArray<T, N, V, M> compress(const SimdArray<T, N, V, M> &v,
+                                      const SimdMaskArray<T, N, V, M> &mask)
+{
+    T tmp[N] = {};
+    v.compressStore(&tmp[0], mask);
+    return SimdArray<T, N, V, M>(&tmp[0], Vc::Unaligned);
+}
+
+// expand {{{1
+/**
+ * \ingroup Utilities
+ *
+ * The inverse of compress: Returns a vector where the entries selected by \p mask hold the
+ * leading entries of \p v in their original order. The remaining entries are zero.
+ *
+ * \code
+ * v    = [1, 2, 3, 4]
+ * mask = [1, 0, 1, 1]
+ * expand(v, mask) = [1, 0, 2, 3]
+ * \endcode
+ *
+ * \see compress
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Abi> expand(const Vector<T, Abi> &v,
+                                   const Detail::mask_for<T, Abi> &mask)
+{
+    return Detail::expand_impl(v, mask, Detail::has_compress_permutation<Abi>());
+}
+
+template <typename T, std::size_t N, typename V, std::size_t M>
+inline SimdArray<T, N, V, M> expand(const SimdArray<T, N, V, M> &v,
+                                    const SimdMaskArray<T, N, V, M> &mask)
+{
+    return Detail::expand_generic(v, mask);
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPRESS_H_
+
+// vim: foldmethod=marker
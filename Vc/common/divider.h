@@ -0,0 +1,195 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_DIVIDER_H_
+#define VC_COMMON_DIVIDER_H_
+
+#include <assert.h>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include "../vector.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// mulhi_vector {{{1
+/**\internal
+ * Returns the upper half of the double-width products of \p a and \p b. The generic
+ * version widens every lane; it is used for Scalar and fixed_size vectors.
+ */
+template <typename V> Vc_INTRINSIC V mulhi_vector(const V &a, const V &b)
+{
+    using T = typename V::EntryType;
+    using W = typename std::conditional<std::is_signed<T>::value, std::int64_t,
+                                        std::uint64_t>::type;
+    return V::generate(
+        [&](std::size_t i) { return T((W(a[i]) * W(b[i])) >> (8 * sizeof(T))); });
+}
+
+template <typename T, typename Abi,
+          typename = enable_if<!std::is_same<Abi, VectorAbi::Scalar>::value &&
+                               !detail::is_fixed_size_abi<Abi>::value>>
+Vc_INTRINSIC Vector<T, Abi> mulhi_vector(const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return mulhi(a.data(), b.data(), T());
+}
+
+// ceil_log2 {{{1
+/**\internal
+ * Returns the smallest \c l with `2^l >= x`.
+ */
+inline int ceil_log2(std::uint64_t x)
+{
+    int l = 0;
+    while ((std::uint64_t(1) << l) < x) {
+        ++l;
+    }
+    return l;
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile divider.h <Vc/Utils>
+ *
+ * Divides integer vectors by a divisor that is fixed for many divisions.
+ *
+ * The integer \c operator/ of the SIMD implementations converts to floating-point,
+ * divides, and converts back. A Divider instead precomputes a multiplier and shift
+ * counts for its divisor once (Granlund and Montgomery, "Division by Invariant Integers
+ * using Multiplication", 1994), so that every division costs one high-half
+ * multiplication, a few shifts, and additions:
+ * \code
+ * const Vc::Divider<uint_v> buckets(nBuckets);
+ * for (auto &x : keys) {
+ *   const uint_v bucket = x % buckets;
+ *   ...
+ * }
+ * \endcode
+ *
+ * The results equal those of the builtin integer division: quotients are rounded toward
+ * zero and the remainder has the sign of the dividend.
+ *
+ * \tparam V An int, uint, short, or ushort vector, or a SimdArray of these.
+ */
+template <typename V> class Divider
+{
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    static_assert(std::is_integral<EntryType>::value &&
+                      (sizeof(EntryType) == 2 || sizeof(EntryType) == 4),
+                  "Divider supports 16- and 32-bit integer entries only");
+    static constexpr int Bits = 8 * sizeof(EntryType);
+
+    V m_multiplier;
+    int m_shift1;  // unsigned: first shift; signed: the only shift
+    int m_shift2;  // unsigned: second shift; signed: unused
+    EntryType m_sign;  // signed: -1 for a negative divisor, 0 otherwise
+    EntryType m_divisor;
+
+    void init(EntryType d, std::false_type)  // unsigned
+    {
+        const int l = Detail::ceil_log2(d);
+        const std::uint64_t m =
+            (std::uint64_t(1) << Bits) * ((std::uint64_t(1) << l) - d) / d + 1;
+        m_multiplier = V(EntryType(m));
+        m_shift1 = l < 1 ? l : 1;
+        m_shift2 = l < 1 ? 0 : l - 1;
+        m_sign = 0;
+    }
+    void init(EntryType d, std::true_type)  // signed
+    {
+        const std::uint64_t ad = d < 0 ? std::uint64_t(-std::int64_t(d)) : d;
+        const int l = std::max(Detail::ceil_log2(ad), 1);
+        const std::int64_t m =
+            1 + std::int64_t((std::uint64_t(1) << (Bits + l - 1)) / ad) -
+            (std::int64_t(1) << Bits);
+        m_multiplier = V(EntryType(m));
+        m_shift1 = l - 1;
+        m_shift2 = 0;
+        m_sign = d < 0 ? EntryType(-1) : EntryType(0);
+    }
+
+    Vc_INTRINSIC V quotient(const V &n, std::false_type) const
+    {
+        const V t = Detail::mulhi_vector(m_multiplier, n);
+        return (t + ((n - t) >> m_shift1)) >> m_shift2;
+    }
+    Vc_INTRINSIC V quotient(const V &n, std::true_type) const
+    {
+        const V q = ((n + Detail::mulhi_vector(m_multiplier, n)) >> m_shift1) -
+                    (n >> (Bits - 1));
+        return (q ^ V(m_sign)) - V(m_sign);
+    }
+
+public:
+    /**
+     * Precomputes the constants for divisions by \p d.
+     *
+     * \param d The divisor. Must not be zero.
+     */
+    explicit Divider(EntryType d) : m_divisor(d)
+    {
+        assert(d != 0);
+        init(d, std::is_signed<EntryType>());
+    }
+
+    /// Returns the divisor.
+    EntryType divisor() const { return m_divisor; }
+
+    /// Returns \p n / divisor(), rounded toward zero.
+    Vc_INTRINSIC V divide(const V &n) const
+    {
+        return quotient(n, std::is_signed<EntryType>());
+    }
+
+    /// Returns \p n % divisor(), which has the sign of \p n.
+    Vc_INTRINSIC V remainder(const V &n) const
+    {
+        return n - divide(n) * V(m_divisor);
+    }
+
+    /// \copydoc divide
+    friend Vc_INTRINSIC V operator/(const V &n, const Divider &d) { return d.divide(n); }
+    /// \copydoc remainder
+    friend Vc_INTRINSIC V operator%(const V &n, const Divider &d)
+    {
+        return d.remainder(n);
+    }
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_DIVIDER_H_
+
+// vim: foldmethod=marker
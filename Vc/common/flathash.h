@@ -0,0 +1,719 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_FLATHASH_H_
+#define VC_COMMON_FLATHASH_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../Allocator"
+#include "../vector.h"
+#include "hash.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// FlatHashValues {{{1
+/**\internal
+ * The mapped values of a flat_hash_map, one per key slot. flat_hash_set stores none.
+ */
+template <typename T> struct FlatHashValues {
+    std::vector<T> data;
+
+    void assign(std::size_t n) { std::vector<T>(n).swap(data); }
+    void moveTo(std::size_t from, FlatHashValues &dst, std::size_t to)
+    {
+        dst.data[to] = std::move(data[from]);
+    }
+    void reset(std::size_t i) { data[i] = T(); }
+    void swap(FlatHashValues &x) { data.swap(x.data); }
+};
+template <> struct FlatHashValues<void> {
+    void assign(std::size_t) {}
+    void moveTo(std::size_t, FlatHashValues &, std::size_t) {}
+    void reset(std::size_t) {}
+    void swap(FlatHashValues &) {}
+};
+
+// FlatHashIterator {{{1
+/**\internal
+ * Makes `it->second` work for iterators that dereference to a pair of references.
+ */
+template <typename R> struct FlatHashArrow {
+    R r;
+    const R *operator->() const { return &r; }
+};
+
+/**\internal
+ * A forward iterator over the occupied slots of \p Table, dereferencing to \p Reference.
+ */
+template <typename Table, typename Reference> class FlatHashIterator
+{
+    template <typename, typename> friend class FlatHashIterator;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<Table>::type::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = Reference;
+    using pointer =
+        typename std::conditional<std::is_reference<Reference>::value,
+                                  typename std::remove_reference<Reference>::type *,
+                                  FlatHashArrow<Reference>>::type;
+
+    FlatHashIterator() = default;
+    FlatHashIterator(Table *table, std::size_t slot) : m_table(table), m_slot(slot) {}
+
+    /// Converts an iterator into a const_iterator.
+    template <typename U, typename R,
+              typename = enable_if<std::is_convertible<U *, Table *>::value>>
+    FlatHashIterator(const FlatHashIterator<U, R> &x)
+        : m_table(x.m_table), m_slot(x.m_slot)
+    {
+    }
+
+    reference operator*() const { return m_table->slotReference(m_slot); }
+    pointer operator->() const { return arrow(**this, std::is_reference<Reference>()); }
+
+    FlatHashIterator &operator++()
+    {
+        m_slot = m_table->nextSlot(m_slot + 1);
+        return *this;
+    }
+    FlatHashIterator operator++(int)
+    {
+        FlatHashIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    friend bool operator==(const FlatHashIterator &a, const FlatHashIterator &b)
+    {
+        return a.m_slot == b.m_slot;
+    }
+    friend bool operator!=(const FlatHashIterator &a, const FlatHashIterator &b)
+    {
+        return a.m_slot != b.m_slot;
+    }
+
+private:
+    static pointer arrow(reference r, std::true_type) { return &r; }
+    static pointer arrow(reference r, std::false_type) { return {r}; }
+
+    Table *m_table = nullptr;
+    std::size_t m_slot = 0;
+};
+
+// FlatHashTable {{{1
+/**\internal
+ * The open-addressing table behind flat_hash_map and flat_hash_set.
+ *
+ * The keys are stored in an aligned array of groups of `Vector<Key>::Size` slots. A key
+ * is placed into the first group with a free slot, starting from its home group (its
+ * hash modulo the number of groups) and continuing with the next groups (linear probing
+ * on groups). Free slots hold the key `numeric_limits<Key>::max()`, which itself is
+ * stored in an extra slot behind the last group. Thus a lookup compares a whole group
+ * with one vector compare and ends at the first group that contains the key or a free
+ * slot.
+ *
+ * erase() shifts keys of later groups back into the freed slot, so that there are no
+ * tombstones: a key never resides behind a group with a free slot in its probe sequence.
+ * The table grows when it would be more than 3/4 full.
+ */
+template <typename Key, typename T> class FlatHashTable
+{
+    static_assert(std::is_integral<Key>::value && sizeof(Key) == 4,
+                  "Vc::flat_hash_map and Vc::flat_hash_set require 32-bit integral keys");
+
+    template <typename, typename> friend class FlatHashIterator;
+
+public:
+    using key_type = Key;
+    using size_type = std::size_t;
+    /// The vector type that holds one group of key slots.
+    using group_type = Vector<Key>;
+    /// The number of key slots compared by one probe.
+    static constexpr std::size_t group_size = group_type::Size;
+
+    ///\name Capacity
+    ///@{
+    /// Returns the number of keys in the container.
+    size_type size() const { return m_size; }
+    /// Returns whether the container holds no keys.
+    bool empty() const { return m_size == 0; }
+    /// Returns the number of key slots.
+    size_type capacity() const { return m_keys.empty() ? 0 : m_keys.size() - 1; }
+
+    /// Makes room for \p n keys without rehashing.
+    void reserve(size_type n)
+    {
+        if (m_keys.empty() || n > maxKeys(capacity())) {
+            rehash(groupsFor(n));
+        }
+    }
+    ///@}
+
+    ///\name Lookup
+    ///@{
+    /// Returns 1 if \p key is in the container, 0 otherwise.
+    size_type count(Key key) const { return findSlot(key) != npos; }
+    /// Returns whether \p key is in the container.
+    bool contains(Key key) const { return findSlot(key) != npos; }
+
+    /**
+     * Looks up all entries of \p keys at once. The home groups of all keys are computed
+     * with vector instructions and the key slots are read with gathers.
+     *
+     * \returns A mask of the lanes whose key is in the container.
+     */
+    template <typename KV, typename = enable_if<Traits::is_simd_vector<KV>::value &&
+                                                std::is_same<typename KV::EntryType,
+                                                             Key>::value>>
+    typename KV::Mask contains(const KV &keys) const
+    {
+        return simd_cast<typename KV::Mask>(findSlots(keys) >= 0);
+    }
+    ///@}
+
+    ///\name Modifiers
+    ///@{
+    /// Removes all keys. The capacity remains unchanged.
+    void clear()
+    {
+        std::fill(m_keys.begin(), m_keys.end(), emptyKey());
+        m_values.assign(m_keys.size());
+        m_size = 0;
+        m_hasEmptyKey = false;
+    }
+
+    /**
+     * Removes \p key from the container.
+     *
+     * Keys of later groups may move into the freed slot, i.e. this invalidates all
+     * iterators.
+     *
+     * \returns The number of removed keys (0 or 1).
+     */
+    size_type erase(Key key)
+    {
+        const std::size_t slot = findSlot(key);
+        if (slot == npos) {
+            return 0;
+        }
+        eraseSlot(slot);
+        return 1;
+    }
+    ///@}
+
+protected:
+    static constexpr std::size_t npos = std::size_t(-1);
+    static constexpr Key emptyKey() { return std::numeric_limits<Key>::max(); }
+
+    /// The smallest number of groups (a power of two) that holds \p n keys.
+    static std::size_t groupsFor(std::size_t n)
+    {
+        std::size_t groups = 1;
+        while (groups * group_size < 16 || maxKeys(groups * group_size) < n) {
+            groups *= 2;
+        }
+        return groups;
+    }
+    static std::size_t maxKeys(std::size_t capacity) { return capacity / 4 * 3; }
+
+    std::size_t home(Key key) const
+    {
+        return murmur3_fmix32(static_cast<unsigned int>(key)) & m_groupMask;
+    }
+
+    /**\internal
+     * Returns the slot of \p key and `true` if \p key is in the table. Otherwise returns
+     * the first free slot in the probe sequence of \p key and `false`.
+     */
+    std::pair<std::size_t, bool> probe(Key key) const { return probe(key, home(key)); }
+    std::pair<std::size_t, bool> probe(Key key, std::size_t homeGroup) const
+    {
+        const group_type k(key);
+        for (std::size_t g = homeGroup;; g = (g + 1) & m_groupMask) {
+            const group_type group(&m_keys[g * group_size], Vc::Aligned);
+            const auto match = group == k;
+            if (any_of(match)) {
+                return {g * group_size + match.firstOne(), true};
+            }
+            const auto free = group == emptyKey();
+            if (any_of(free)) {
+                return {g * group_size + free.firstOne(), false};
+            }
+        }
+    }
+
+    std::size_t findSlot(Key key) const
+    {
+        if (key == emptyKey()) {
+            return m_hasEmptyKey ? capacity() : npos;
+        }
+        if (m_keys.empty()) {
+            return npos;
+        }
+        const auto r = probe(key);
+        return r.second ? r.first : npos;
+    }
+
+    /**\internal
+     * Returns the slots of \p keys, or -1 for the keys that are not in the table. The
+     * home groups of all keys are computed with vector instructions.
+     *
+     * With hardware gathers (AVX2 and AVX-512) all lanes probe their groups in lockstep:
+     * one gather reads the j-th slot of every lane's current group. A lane is done once
+     * its group contained its key or a free slot. Otherwise the lanes probe one after
+     * the other, with one vector compare per group.
+     */
+    template <typename KV> SimdArray<int, KV::Size> findSlots(const KV &keys) const
+    {
+        constexpr std::size_t N = KV::Size;
+        using IV = SimdArray<int, N>;
+        using UV = SimdArray<unsigned int, N>;
+        using KA = SimdArray<Key, N>;
+        using IM = typename IV::Mask;
+
+        const KA k = simd_cast<KA>(keys);
+        IV slots = -1;
+        if (m_hasEmptyKey) {
+            where(simd_cast<IM>(k == emptyKey())) | slots = int(capacity());
+        }
+        if (m_keys.empty()) {
+            return slots;
+        }
+        const UV homes = murmur3_fmix32(simd_cast<UV>(k)) & unsigned(m_groupMask);
+#ifdef Vc_IMPL_AVX2
+        IM pending = simd_cast<IM>(k != emptyKey());
+        const IV slotMask = int(capacity() - 1);
+        IV first = simd_cast<IV>(homes) * int(group_size);
+        while (any_of(pending)) {
+            IM done = slots >= 0;
+            Common::unrolled_loop<int, 0, group_size>([&](int j) {
+                const IV slot = first + j;
+                const KA x(m_keys.data(), slot);
+                where(pending && simd_cast<IM>(x == k)) | slots = slot;
+                done |= simd_cast<IM>(x == emptyKey());
+            });
+            pending = pending && !done;
+            first = (first + int(group_size)) & slotMask;
+        }
+        return slots;
+#else
+        alignas(IV::MemoryAlignment) int r[N];
+        alignas(KA::MemoryAlignment) Key kk[N];
+        alignas(UV::MemoryAlignment) unsigned int hh[N];
+        slots.store(&r[0], Vc::Aligned);
+        k.store(&kk[0], Vc::Aligned);
+        homes.store(&hh[0], Vc::Aligned);
+        for (std::size_t i = 0; i < N; ++i) {
+            if (kk[i] != emptyKey()) {
+                const auto p = probe(kk[i], hh[i]);
+                r[i] = p.second ? int(p.first) : -1;
+            }
+        }
+        return IV(&r[0], Vc::Aligned);
+#endif
+    }
+
+    /**\internal
+     * Returns the slot of \p key and whether it was newly inserted.
+     */
+    std::pair<std::size_t, bool> insertSlot(Key key)
+    {
+        if (m_keys.empty()) {
+            rehash(groupsFor(1));
+        }
+        if (key == emptyKey()) {
+            const bool inserted = !m_hasEmptyKey;
+            m_hasEmptyKey = true;
+            m_size += inserted;
+            return {capacity(), inserted};
+        }
+        auto r = probe(key);
+        if (r.second) {
+            return {r.first, false};
+        }
+        if (m_size - m_hasEmptyKey + 1 > maxKeys(capacity())) {
+            rehash(2 * (m_groupMask + 1));
+            r = probe(key);
+        }
+        m_keys[r.first] = key;
+        ++m_size;
+        return {r.first, true};
+    }
+
+    void eraseSlot(std::size_t slot)
+    {
+        --m_size;
+        if (slot == capacity()) {
+            m_hasEmptyKey = false;
+            m_values.reset(slot);
+            return;
+        }
+        // Move a key of a later group into the hole if the hole lies in the key's probe
+        // sequence, i.e. in [home, group). Keys behind the first group that had a free
+        // slot before cannot be affected.
+        std::size_t hole = slot;
+        for (std::size_t g = (hole / group_size + 1) & m_groupMask;
+             g != hole / group_size; g = (g + 1) & m_groupMask) {
+            const group_type group(&m_keys[g * group_size], Vc::Aligned);
+            const bool full = none_of(group == emptyKey());
+            const std::size_t holeGroup = hole / group_size;
+            for (std::size_t i = g * group_size; i < (g + 1) * group_size; ++i) {
+                const Key key = m_keys[i];
+                if (key == emptyKey()) {
+                    continue;
+                }
+                const std::size_t h = home(key);
+                if (((holeGroup - h) & m_groupMask) < ((g - h) & m_groupMask)) {
+                    m_keys[hole] = key;
+                    m_values.moveTo(i, m_values, hole);
+                    hole = i;
+                    break;
+                }
+            }
+            if (!full) {
+                break;
+            }
+        }
+        m_keys[hole] = emptyKey();
+        m_values.reset(hole);
+    }
+
+    void rehash(std::size_t groups)
+    {
+        std::vector<Key, Vc::Allocator<Key>> keys(groups * group_size + 1, emptyKey());
+        FlatHashValues<T> values;
+        values.assign(keys.size());
+        m_keys.swap(keys);
+        m_values.swap(values);
+        const std::size_t oldCapacity = keys.empty() ? 0 : keys.size() - 1;
+        m_groupMask = groups - 1;
+        for (std::size_t i = 0; i < oldCapacity; ++i) {
+            if (keys[i] != emptyKey()) {
+                const std::size_t slot = probe(keys[i]).first;
+                m_keys[slot] = keys[i];
+                values.moveTo(i, m_values, slot);
+            }
+        }
+        if (m_hasEmptyKey) {
+            values.moveTo(oldCapacity, m_values, capacity());
+        }
+    }
+
+    bool occupied(std::size_t slot) const
+    {
+        return slot < capacity() ? m_keys[slot] != emptyKey() : m_hasEmptyKey;
+    }
+    std::size_t endSlot() const { return m_keys.size(); }
+    std::size_t nextSlot(std::size_t slot) const
+    {
+        while (slot < endSlot() && !occupied(slot)) {
+            ++slot;
+        }
+        return slot;
+    }
+
+    // capacity() + 1 slots: the groups and the slot of emptyKey()
+    std::vector<Key, Vc::Allocator<Key>> m_keys;
+    FlatHashValues<T> m_values;
+    std::size_t m_groupMask = 0;
+    std::size_t m_size = 0;
+    bool m_hasEmptyKey = false;
+};
+template <typename Key, typename T> constexpr std::size_t FlatHashTable<Key, T>::npos;
+template <typename Key, typename T>
+constexpr std::size_t FlatHashTable<Key, T>::group_size;
+}  // namespace Detail
+
+// flat_hash_set {{{1
+/**
+ * \ingroup Containers
+ * \headerfile flathash.h <Vc/flat_hash_set>
+ *
+ * A set of 32-bit integer keys (`int` or `unsigned int`) with open addressing.
+ *
+ * In contrast to `std::unordered_set` the keys are stored in one flat array, which is
+ * probed in groups of `int_v::Size` keys with a single vector compare. There are no nodes
+ * and no pointers to chase, and a batched lookup of a whole vector of keys uses gathers.
+ *
+ * \code
+ * Vc::flat_hash_set<int> seen;
+ * for (int_v keys : ...) {
+ *   const int_m isNew = seen.insert(keys);
+ *   ...
+ * }
+ * \endcode
+ *
+ * Insertion may rehash and erase() may move other keys, both invalidate all iterators.
+ */
+template <typename Key> class flat_hash_set : public Detail::FlatHashTable<Key, void>
+{
+    using Base = Detail::FlatHashTable<Key, void>;
+    template <typename, typename> friend class Detail::FlatHashIterator;
+
+public:
+    using value_type = Key;
+    using typename Base::size_type;
+    using iterator = Detail::FlatHashIterator<const flat_hash_set, const Key &>;
+    using const_iterator = iterator;
+
+    /// Constructs an empty set.
+    flat_hash_set() = default;
+    /// Constructs an empty set with room for \p n keys.
+    explicit flat_hash_set(size_type n) { this->reserve(n); }
+    /// Constructs a set of the keys in \p init.
+    flat_hash_set(std::initializer_list<Key> init)
+    {
+        this->reserve(init.size());
+        for (Key k : init) {
+            insert(k);
+        }
+    }
+
+    ///\name Iterators
+    ///@{
+    const_iterator begin() const { return {this, this->nextSlot(0)}; }
+    const_iterator end() const { return {this, this->endSlot()}; }
+    ///@}
+
+    /// Returns an iterator to \p key or end() if \p key is not in the set.
+    const_iterator find(Key key) const
+    {
+        const std::size_t slot = this->findSlot(key);
+        return slot == Base::npos ? end() : const_iterator{this, slot};
+    }
+
+    /**
+     * Inserts \p key.
+     *
+     * \returns An iterator to \p key and whether it was newly inserted.
+     */
+    std::pair<iterator, bool> insert(Key key)
+    {
+        const auto r = this->insertSlot(key);
+        return {iterator{this, r.first}, r.second};
+    }
+
+    /**
+     * Inserts all entries of \p keys. The keys that are already in the set are found with
+     * one batched lookup, only the remaining lanes are inserted one after the other.
+     *
+     * \returns A mask of the lanes that inserted a new key. Of equal new keys within \p
+     * keys only the first lane is set.
+     */
+    template <typename KV, typename = enable_if<Traits::is_simd_vector<KV>::value &&
+                                                std::is_same<typename KV::EntryType,
+                                                             Key>::value>>
+    typename KV::Mask insert(const KV &keys)
+    {
+        const typename KV::Mask present = this->contains(keys);
+        bool inserted[KV::Size] = {};
+        if (!all_of(present)) {
+            for (std::size_t i = 0; i < KV::Size; ++i) {
+                if (!present[i]) {
+                    inserted[i] = this->insertSlot(keys[i]).second;
+                }
+            }
+        }
+        return typename KV::Mask(&inserted[0]);
+    }
+
+private:
+    const Key &slotReference(std::size_t slot) const { return this->m_keys[slot]; }
+};
+
+// flat_hash_map {{{1
+/**
+ * \ingroup Containers
+ * \headerfile flathash.h <Vc/flat_hash_map>
+ *
+ * A map from 32-bit integer keys (`int` or `unsigned int`) to values of type \p T with
+ * open addressing. The keys are stored and probed like in flat_hash_set; the values are
+ * stored in a separate array with the same slot numbers. \p T must be default
+ * constructible, unused slots hold value-initialized objects.
+ *
+ * Iterators dereference to `std::pair<const Key &, T &>`. Insertion may rehash and
+ * erase() may move other entries, both invalidate all iterators and references.
+ *
+ * For arithmetic \p T, find(keys, values) looks up a whole vector of keys and gathers
+ * the corresponding values.
+ */
+template <typename Key, typename T>
+class flat_hash_map : public Detail::FlatHashTable<Key, T>
+{
+    using Base = Detail::FlatHashTable<Key, T>;
+    template <typename, typename> friend class Detail::FlatHashIterator;
+
+public:
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using typename Base::size_type;
+    using reference = std::pair<const Key &, T &>;
+    using const_reference = std::pair<const Key &, const T &>;
+    using iterator = Detail::FlatHashIterator<flat_hash_map, reference>;
+    using const_iterator = Detail::FlatHashIterator<const flat_hash_map, const_reference>;
+
+    /// Constructs an empty map.
+    flat_hash_map() = default;
+    /// Constructs an empty map with room for \p n entries.
+    explicit flat_hash_map(size_type n) { this->reserve(n); }
+    /// Constructs a map of the entries in \p init.
+    flat_hash_map(std::initializer_list<value_type> init)
+    {
+        this->reserve(init.size());
+        for (const value_type &x : init) {
+            insert(x);
+        }
+    }
+
+    ///\name Iterators
+    ///@{
+    iterator begin() { return {this, this->nextSlot(0)}; }
+    iterator end() { return {this, this->endSlot()}; }
+    const_iterator begin() const { return {this, this->nextSlot(0)}; }
+    const_iterator end() const { return {this, this->endSlot()}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    ///@}
+
+    ///\name Lookup
+    ///@{
+    /// Returns an iterator to the entry of \p key or end() if there is none.
+    iterator find(Key key)
+    {
+        const std::size_t slot = this->findSlot(key);
+        return slot == Base::npos ? end() : iterator{this, slot};
+    }
+    /// \copydoc find
+    const_iterator find(Key key) const
+    {
+        const std::size_t slot = this->findSlot(key);
+        return slot == Base::npos ? end() : const_iterator{this, slot};
+    }
+
+    /// Returns the value of \p key. Throws std::out_of_range if there is none.
+    T &at(Key key)
+    {
+        const std::size_t slot = this->findSlot(key);
+        if (slot == Base::npos) {
+            throw std::out_of_range("Vc::flat_hash_map::at: key not found");
+        }
+        return this->m_values.data[slot];
+    }
+    /// \copydoc at
+    const T &at(Key key) const { return const_cast<flat_hash_map *>(this)->at(key); }
+
+    /**
+     * Looks up all entries of \p keys at once (see flat_hash_set) and gathers the values
+     * of the keys that are found into \p values. The other lanes of \p values are left
+     * unchanged.
+     *
+     * \returns A mask of the lanes whose key is in the map.
+     */
+    template <typename KV, typename TV,
+              typename = enable_if<Traits::is_simd_vector<KV>::value &&
+                                   Traits::is_simd_vector<TV>::value &&
+                                   std::is_same<typename KV::EntryType, Key>::value &&
+                                   std::is_same<typename TV::EntryType, T>::value &&
+                                   KV::Size == TV::Size>>
+    typename KV::Mask find(const KV &keys, TV &values) const
+    {
+        auto slots = this->findSlots(keys);
+        const auto found = slots >= 0;
+        // an unmasked gather (of slot 0 for missing keys) is cheaper than a masked one
+        where(!found) | slots = 0;
+        const TV gathered(this->m_values.data.data(), slots);
+        where(simd_cast<typename TV::Mask>(found)) | values = gathered;
+        return simd_cast<typename KV::Mask>(found);
+    }
+    ///@}
+
+    ///\name Modifiers
+    ///@{
+    /// Returns the value of \p key, inserting a value-initialized one if there is none.
+    T &operator[](Key key) { return this->m_values.data[this->insertSlot(key).first]; }
+
+    /**
+     * Inserts a value constructed from \p args for \p key, unless \p key is already in
+     * the map (then \p args are not used).
+     *
+     * \returns An iterator to the entry of \p key and whether it was newly inserted.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key key, Args &&... args)
+    {
+        const auto r = this->insertSlot(key);
+        if (r.second) {
+            this->m_values.data[r.first] = T(std::forward<Args>(args)...);
+        }
+        return {iterator{this, r.first}, r.second};
+    }
+
+    /// Inserts \p x unless its key is already in the map.
+    std::pair<iterator, bool> insert(const value_type &x)
+    {
+        return try_emplace(x.first, x.second);
+    }
+
+    /// Inserts \p value for \p key or assigns it if \p key is already in the map.
+    template <typename U> std::pair<iterator, bool> insert_or_assign(Key key, U &&value)
+    {
+        const auto r = this->insertSlot(key);
+        this->m_values.data[r.first] = std::forward<U>(value);
+        return {iterator{this, r.first}, r.second};
+    }
+    ///@}
+
+private:
+    reference slotReference(std::size_t slot)
+    {
+        return {this->m_keys[slot], this->m_values.data[slot]};
+    }
+    const_reference slotReference(std::size_t slot) const
+    {
+        return {this->m_keys[slot], this->m_values.data[slot]};
+    }
+};
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_FLATHASH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,490 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FLOAT16_H_
+#define VC_COMMON_FLOAT16_H_
+
+#include <cstdint>
+#include <cstring>
+#if defined Vc_IMPL_F16C || defined __F16C__ || defined Vc_IMPL_AVX512
+#include <immintrin.h>
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// scalar conversions {{{1
+/* All conversions from float round to nearest, ties to even. NaNs stay NaNs (quiet), the
+ * software conversions from half assume that denormals are not flushed to zero.
+ */
+Vc_INTRINSIC std::uint32_t float_bits(float x)
+{
+    std::uint32_t r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+Vc_INTRINSIC float bits_float(std::uint32_t x)
+{
+    float r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+Vc_INTRINSIC float half_to_float(std::uint16_t h)
+{
+    // the exponent rebias via multiplication by 2^112 also normalizes subnormal halves
+    const std::uint32_t em = h & 0x7fffu;
+    const std::uint32_t sign = std::uint32_t(h & 0x8000u) << 16;
+    std::uint32_t r = float_bits(bits_float(em << 13) * bits_float(0x77800000u));
+    if (em >= 0x7c00u) {
+        r |= 0x7f800000u;  // inf or NaN
+    }
+    return bits_float(r | sign);
+}
+
+Vc_INTRINSIC std::uint16_t float_to_half(float x)
+{
+    std::uint32_t u = float_bits(x);
+    const std::uint32_t sign = u & 0x80000000u;
+    u ^= sign;
+    std::uint32_t r;
+    if (u >= 0x47800000u) {  // overflow, inf, or NaN
+        r = u > 0x7f800000u ? 0x7e00u : 0x7c00u;
+    } else if (u < 0x38800000u) {  // subnormal or zero: let the FPU do the rounding
+        r = float_bits(bits_float(u) + bits_float(0x3f000000u)) - 0x3f000000u;
+    } else {
+        const std::uint32_t odd = (u >> 13) & 1u;
+        u += 0xc8000fffu + odd;  // rebias the exponent and round
+        r = u >> 13;
+    }
+    return static_cast<std::uint16_t>(r | (sign >> 16));
+}
+
+Vc_INTRINSIC float bfloat16_to_float(std::uint16_t b)
+{
+    return bits_float(std::uint32_t(b) << 16);
+}
+
+Vc_INTRINSIC std::uint16_t float_to_bfloat16(float x)
+{
+    const std::uint32_t u = float_bits(x);
+    if ((u & 0x7fffffffu) > 0x7f800000u) {
+        return static_cast<std::uint16_t>((u >> 16) | 0x40u);  // quiet NaN
+    }
+    return static_cast<std::uint16_t>((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+}
+
+// SSE2 conversions of four entries {{{1
+#ifdef Vc_IMPL_SSE2
+/* The 16-bit values are passed in the low 64 bits of an __m128i. These implement the
+ * scalar conversions above with 32-bit integer lanes.
+ */
+Vc_INTRINSIC __m128 half_to_float4(__m128i raw)
+{
+    const __m128i h = _mm_unpacklo_epi16(raw, _mm_setzero_si128());
+    const __m128i em = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+    const __m128 f = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(em, 13)),
+                                _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));
+    const __m128i infnan = _mm_and_si128(_mm_cmpgt_epi32(em, _mm_set1_epi32(0x7bff)),
+                                         _mm_set1_epi32(0x7f800000));
+    return _mm_or_ps(f, _mm_castsi128_ps(_mm_or_si128(infnan, sign)));
+}
+
+// packs four 32-bit lanes holding 16-bit values into the low 64 bits
+Vc_INTRINSIC __m128i pack_low16(__m128i x)
+{
+    // sign extension keeps packs_epi32 from saturating
+    x = _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+    return _mm_packs_epi32(x, x);
+}
+
+Vc_INTRINSIC __m128i float_to_half4(__m128 x)
+{
+    __m128i u = _mm_castps_si128(x);
+    const __m128i sign = _mm_and_si128(u, _mm_set1_epi32(0x80000000u));
+    u = _mm_xor_si128(u, sign);
+    const __m128i overflow = _mm_cmpgt_epi32(u, _mm_set1_epi32(0x477fffff));
+    const __m128i nan = _mm_cmpgt_epi32(u, _mm_set1_epi32(0x7f800000));
+    const __m128i subnormal = _mm_cmplt_epi32(u, _mm_set1_epi32(0x38800000));
+    const __m128i special =
+        _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(nan, _mm_set1_epi32(0x0200)));
+    const __m128i denorm = _mm_sub_epi32(
+        _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u),
+                                    _mm_castsi128_ps(_mm_set1_epi32(0x3f000000)))),
+        _mm_set1_epi32(0x3f000000));
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+    const __m128i normal = _mm_srli_epi32(
+        _mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(0xc8000fffu)), odd), 13);
+    __m128i r = _mm_or_si128(_mm_and_si128(subnormal, denorm),
+                             _mm_andnot_si128(subnormal, normal));
+    r = _mm_or_si128(_mm_and_si128(overflow, special), _mm_andnot_si128(overflow, r));
+    return pack_low16(_mm_or_si128(r, _mm_srli_epi32(sign, 16)));
+}
+
+Vc_INTRINSIC __m128 bfloat16_to_float4(__m128i raw)
+{
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), raw));
+}
+
+Vc_INTRINSIC __m128i float_to_bfloat16_4(__m128 x)
+{
+    const __m128i u = _mm_castps_si128(x);
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1));
+    const __m128i rounded = _mm_add_epi32(u, _mm_add_epi32(_mm_set1_epi32(0x7fff), odd));
+    const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(x, x));
+    const __m128i quiet = _mm_or_si128(u, _mm_set1_epi32(0x00400000));
+    const __m128i r =
+        _mm_or_si128(_mm_and_si128(nan, quiet), _mm_andnot_si128(nan, rounded));
+    return _mm_packs_epi32(_mm_srai_epi32(r, 16), _mm_srai_epi32(r, 16));
+}
+#endif  // Vc_IMPL_SSE2
+
+// Float16Conversion {{{1
+/* Float16Conversion<T>::load converts float_v::Size entries of type T to a float_v,
+ * Float16Conversion<T>::store converts a float_v back, rounding to nearest.
+ */
+template <typename T> struct Float16Conversion;
+
+#if defined Vc_IMPL_AVX512
+#define Vc_FLOAT16_CONVERSION(T_, load_, store_)                                         \
+    template <> struct Float16Conversion<T_> {                                           \
+        static Vc_INTRINSIC float_v load(const T_ *mem)                                  \
+        {                                                                                \
+            const __m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)); \
+            return load_;                                                                \
+        }                                                                                \
+        static Vc_INTRINSIC void store(const float_v &x, T_ *mem)                        \
+        {                                                                                \
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(mem), store_);               \
+        }                                                                                \
+    }
+#elif defined Vc_IMPL_AVX
+/* The SSE2 kernels work on four entries, their results are concatenated. */
+#define Vc_FLOAT16_CONVERSION(T_, load_, store_)                                         \
+    template <> struct Float16Conversion<T_> {                                           \
+        static Vc_INTRINSIC float_v load(const T_ *mem)                                  \
+        {                                                                                \
+            const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)); \
+            return load_;                                                                \
+        }                                                                                \
+        static Vc_INTRINSIC void store(const float_v &x, T_ *mem)                        \
+        {                                                                                \
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), store_);                  \
+        }                                                                                \
+    }
+#elif defined Vc_IMPL_SSE2
+#define Vc_FLOAT16_CONVERSION(T_, load_, store_)                                         \
+    template <> struct Float16Conversion<T_> {                                           \
+        static Vc_INTRINSIC float_v load(const T_ *mem)                                  \
+        {                                                                                \
+            const __m128i raw = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)); \
+            return load_;                                                                \
+        }                                                                                \
+        static Vc_INTRINSIC void store(const float_v &x, T_ *mem)                        \
+        {                                                                                \
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), store_);                  \
+        }                                                                                \
+    }
+#else
+#define Vc_FLOAT16_CONVERSION(T_, load_, store_)                                         \
+    template <> struct Float16Conversion<T_> {                                           \
+        static Vc_INTRINSIC float_v load(const T_ *mem)                                  \
+        {                                                                                \
+            return float_v(float(*mem));                                                 \
+        }                                                                                \
+        static Vc_INTRINSIC void store(const float_v &x, T_ *mem) { *mem = T_(x[0]); }   \
+    }
+#endif
+// }}}1
+}  // namespace Detail
+
+// half and bfloat16 {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile float16.h <Vc/vector.h>
+ *
+ * An IEEE 754 binary16 value. This is a storage type: it only converts from and to
+ * float (rounding to nearest, ties to even) and provides no arithmetic.
+ */
+class half
+{
+public:
+    half() = default;
+    explicit Vc_INTRINSIC half(float x) : m_bits(Detail::float_to_half(x)) {}
+    explicit Vc_INTRINSIC operator float() const { return Detail::half_to_float(m_bits); }
+
+    /// Returns the half with the bit pattern \p bits.
+    static Vc_INTRINSIC half fromBits(std::uint16_t bits)
+    {
+        half r;
+        r.m_bits = bits;
+        return r;
+    }
+    /// Returns the bit pattern.
+    Vc_INTRINSIC std::uint16_t bits() const { return m_bits; }
+
+private:
+    std::uint16_t m_bits;
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile float16.h <Vc/vector.h>
+ *
+ * A bfloat16 value, i.e. the upper 16 bits of a float. This is a storage type: it only
+ * converts from and to float (rounding to nearest, ties to even) and provides no
+ * arithmetic.
+ */
+class bfloat16
+{
+public:
+    bfloat16() = default;
+    explicit Vc_INTRINSIC bfloat16(float x) : m_bits(Detail::float_to_bfloat16(x)) {}
+    explicit Vc_INTRINSIC operator float() const
+    {
+        return Detail::bfloat16_to_float(m_bits);
+    }
+
+    /// Returns the bfloat16 with the bit pattern \p bits.
+    static Vc_INTRINSIC bfloat16 fromBits(std::uint16_t bits)
+    {
+        bfloat16 r;
+        r.m_bits = bits;
+        return r;
+    }
+    /// Returns the bit pattern.
+    Vc_INTRINSIC std::uint16_t bits() const { return m_bits; }
+
+private:
+    std::uint16_t m_bits;
+};
+
+namespace Detail
+{
+// Float16Conversion specializations {{{1
+#if defined Vc_IMPL_AVX512
+Vc_FLOAT16_CONVERSION(half, float_v(_mm512_cvtph_ps(raw)),
+                      _mm512_cvtps_ph(x.data(), _MM_FROUND_TO_NEAREST_INT));
+Vc_FLOAT16_CONVERSION(
+    bfloat16, float_v(_mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(raw), 16))),
+    _mm512_cvtepi32_epi16(_mm512_srli_epi32(
+        _mm512_mask_or_epi32(
+            _mm512_add_epi32(
+                _mm512_castps_si512(x.data()),
+                _mm512_add_epi32(_mm512_set1_epi32(0x7fff),
+                                 _mm512_and_si512(
+                                     _mm512_srli_epi32(_mm512_castps_si512(x.data()), 16),
+                                     _mm512_set1_epi32(1)))),
+            _mm512_cmp_ps_mask(x.data(), x.data(), _CMP_UNORD_Q),
+            _mm512_castps_si512(x.data()), _mm512_set1_epi32(0x00400000)),
+        16)));
+#elif defined Vc_IMPL_AVX
+#if defined Vc_IMPL_F16C || defined __F16C__
+Vc_FLOAT16_CONVERSION(half, float_v(_mm256_cvtph_ps(raw)),
+                      _mm256_cvtps_ph(x.data(), _MM_FROUND_TO_NEAREST_INT));
+#else
+Vc_FLOAT16_CONVERSION(half,
+                      float_v(AVX::concat(half_to_float4(raw),
+                                          half_to_float4(_mm_unpackhi_epi64(raw, raw)))),
+                      _mm_unpacklo_epi64(float_to_half4(AVX::lo128(x.data())),
+                                         float_to_half4(AVX::hi128(x.data()))));
+#endif
+Vc_FLOAT16_CONVERSION(bfloat16,
+                      float_v(AVX::concat(bfloat16_to_float4(raw),
+                                          bfloat16_to_float4(_mm_unpackhi_epi64(raw, raw)))),
+                      _mm_unpacklo_epi64(float_to_bfloat16_4(AVX::lo128(x.data())),
+                                         float_to_bfloat16_4(AVX::hi128(x.data()))));
+#elif defined Vc_IMPL_SSE2
+#if defined Vc_IMPL_F16C || defined __F16C__
+Vc_FLOAT16_CONVERSION(half, float_v(_mm_cvtph_ps(raw)),
+                      _mm_cvtps_ph(x.data(), _MM_FROUND_TO_NEAREST_INT));
+#else
+Vc_FLOAT16_CONVERSION(half, float_v(half_to_float4(raw)), float_to_half4(x.data()));
+#endif
+Vc_FLOAT16_CONVERSION(bfloat16, float_v(bfloat16_to_float4(raw)),
+                      float_to_bfloat16_4(x.data()));
+#else
+Vc_FLOAT16_CONVERSION(half, , );
+Vc_FLOAT16_CONVERSION(bfloat16, , );
+#endif
+#undef Vc_FLOAT16_CONVERSION
+}  // namespace Detail
+
+// Float16Vector {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile float16.h <Vc/vector.h>
+ *
+ * A vector of float_v::Size entries that is stored in memory as \p T (Vc::half or
+ * Vc::bfloat16). Loads convert to float (via vcvtph2ps if F16C is available), all
+ * arithmetic is done in float_v, and stores round to \p T. Thus, bandwidth-bound code
+ * moves half the bytes of float_v.
+ *
+ * Use the aliases Vc::half_v and Vc::bfloat16_v. The type implicitly converts from and to
+ * float_v and works with Vc::Memory and Vc::simd_cast:
+ * \code
+ * Vc::Memory<Vc::half_v, 1024> data;
+ * for (std::size_t i = 0; i < data.vectorsCount(); ++i) {
+ *     data.vector(i) = Vc::sqrt(Vc::float_v(data.vector(i)));
+ * }
+ * \endcode
+ *
+ * \note The load/store flags are accepted for compatibility with Vc::Memory. The 16-bit
+ * data is always accessed with unaligned moves.
+ */
+template <typename T> class Float16Vector
+{
+    static_assert(std::is_same<T, half>::value || std::is_same<T, bfloat16>::value,
+                  "Float16Vector<T> requires T to be Vc::half or Vc::bfloat16");
+
+public:
+    using EntryType = T;
+    using value_type = T;
+    using VectorEntryType = T;
+    using FloatVector = float_v;
+    using Mask = float_v::Mask;
+    using MaskType = Mask;
+    using mask_type = Mask;
+    using MaskArgument = const Mask &;
+    using IndexType = float_v::IndexType;
+    using AsArg = const Float16Vector &;
+
+    static constexpr std::size_t Size = float_v::Size;
+    static constexpr std::size_t size() { return Size; }
+    static constexpr std::size_t MemoryAlignment = Size * sizeof(T);
+
+    Float16Vector() = default;
+    Vc_INTRINSIC Float16Vector(const float_v &x) : d(x) {}
+    explicit Vc_INTRINSIC Float16Vector(VectorSpecialInitializerZero) : d(Vc::Zero) {}
+    explicit Vc_INTRINSIC Float16Vector(VectorSpecialInitializerOne) : d(Vc::One) {}
+
+    /// Loads and converts float_v::Size entries from \p mem.
+    template <typename Flags = DefaultLoadTag>
+    explicit Vc_INTRINSIC Float16Vector(const T *mem, Flags = Flags())
+        : d(Detail::Float16Conversion<T>::load(mem))
+    {
+    }
+    template <typename Flags = DefaultLoadTag>
+    Vc_INTRINSIC void load(const T *mem, Flags = Flags())
+    {
+        d = Detail::Float16Conversion<T>::load(mem);
+    }
+
+    /// Rounds and stores float_v::Size entries to \p mem.
+    template <typename Flags = DefaultStoreTag>
+    Vc_INTRINSIC void store(T *mem, Flags = Flags()) const
+    {
+        Detail::Float16Conversion<T>::store(d, mem);
+    }
+    /// Rounds and stores the entries selected by \p k to \p mem.
+    template <typename Flags = DefaultStoreTag>
+    Vc_INTRINSIC void store(T *mem, MaskArgument k, Flags = Flags()) const
+    {
+        T tmp[Size];
+        Detail::Float16Conversion<T>::store(d, tmp);
+        for (std::size_t i = 0; i < Size; ++i) {
+            if (k[i]) {
+                mem[i] = tmp[i];
+            }
+        }
+    }
+
+    static Vc_INTRINSIC Float16Vector Zero() { return float_v::Zero(); }
+    static Vc_INTRINSIC Float16Vector One() { return float_v::One(); }
+
+    /// Returns the float values (not rounded to \p T).
+    Vc_INTRINSIC operator float_v() const { return d; }
+    Vc_INTRINSIC float_v value() const { return d; }
+
+    /// Returns entry \p i rounded to \p T.
+    Vc_INTRINSIC T operator[](std::size_t i) const { return T(d[i]); }
+
+#define Vc_OP(op)                                                                        \
+    friend Vc_INTRINSIC float_v operator op(AsArg a, AsArg b) { return a.d op b.d; }     \
+    friend Vc_INTRINSIC float_v operator op(AsArg a, float b) { return a.d op b; }       \
+    friend Vc_INTRINSIC float_v operator op(float a, AsArg b) { return a op b.d; }       \
+    Vc_INTRINSIC Float16Vector &operator op##=(AsArg x)                                  \
+    {                                                                                    \
+        d op##= x.d;                                                                     \
+        return *this;                                                                    \
+    }
+    Vc_OP(+) Vc_OP(-) Vc_OP(*) Vc_OP(/)
+#undef Vc_OP
+#define Vc_OP(op)                                                                        \
+    friend Vc_INTRINSIC Mask operator op(AsArg a, AsArg b) { return a.d op b.d; }
+    Vc_ALL_COMPARES(Vc_OP);
+#undef Vc_OP
+    Vc_INTRINSIC float_v operator-() const { return -d; }
+
+private:
+    float_v d;
+};
+template <typename T> constexpr std::size_t Float16Vector<T>::Size;
+template <typename T> constexpr std::size_t Float16Vector<T>::MemoryAlignment;
+
+/// A vector of Vc::half stored as IEEE binary16.
+using half_v = Float16Vector<half>;
+/// A vector of Vc::bfloat16.
+using bfloat16_v = Float16Vector<bfloat16>;
+
+// simd_cast {{{1
+template <typename T> struct is_float16_vector : public std::false_type {};
+template <typename T> struct is_float16_vector<Float16Vector<T>> : public std::true_type {};
+
+/// Converts a half_v or bfloat16_v to the Vc vector type \p To.
+template <typename To, typename T>
+Vc_INTRINSIC enable_if<!is_float16_vector<To>::value, To> simd_cast(
+    const Float16Vector<T> &x)
+{
+    return simd_cast<To>(float_v(x));
+}
+
+/// Converts the Vc vectors \p x... to the half_v or bfloat16_v type \p To.
+template <typename To, typename From, typename... Froms>
+Vc_INTRINSIC enable_if<is_float16_vector<To>::value && Traits::is_simd_vector<From>::value,
+                       To>
+simd_cast(const From &x, const Froms &... xs)
+{
+    return To(simd_cast<float_v>(x, xs...));
+}
+
+/// Converts between half_v and bfloat16_v.
+template <typename To, typename T>
+Vc_INTRINSIC enable_if<is_float16_vector<To>::value, To> simd_cast(
+    const Float16Vector<T> &x)
+{
+    return To(float_v(x));
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_FLOAT16_H_
+
+// vim: foldmethod=marker
@@ -28,6 +28,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_GATHERIMPLEMENTATION_H_
 #define VC_COMMON_GATHERIMPLEMENTATION_H_
 
+#ifdef Vc_USE_CALIBRATED_GATHERS
+#include <atomic>
+#include <chrono>
+#include <vector>
+#endif
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -39,7 +44,8 @@ enum class GatherScatterImplementation : int {
     SimpleLoop,
     SetIndexZero,
     BitScanLoop,
-    PopcntSwitch
+    PopcntSwitch,
+    Hardware  ///< the gather instructions of AVX2 (only chosen via calibration)
 };
 
 using SimpleLoopT   = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::SimpleLoop>;
@@ -312,7 +318,136 @@ Vc_ALWAYS_INLINE void executeGather(PopcntSwitchT,
     }
 }
 
+// runtime strategy selection {{{1
+/**\internal
+ * Dispatches to one of the software gather strategies at runtime. The strategies that
+ * are not usable for every \p V (SetIndexZero, PopcntSwitch, Hardware) fall back to
+ * SimpleLoop.
+ */
+template <typename V, typename MT, typename IT>
+Vc_ALWAYS_INLINE void executeGather(GatherScatterImplementation impl, V &v, const MT *mem,
+                                    const IT &indexes, typename V::MaskArgument mask)
+{
+    if (impl == GatherScatterImplementation::BitScanLoop) {
+        executeGather(BitScanLoopT(), v, mem, indexes, mask);
+    } else {
+        executeGather(SimpleLoopT(), v, mem, indexes, mask);
+    }
+}
+
+#ifdef Vc_USE_CALIBRATED_GATHERS
+/**\internal
+ * The strategy chosen by calibrateGather<V>(), or -1 if \p V was not calibrated yet.
+ */
+template <typename V> std::atomic<int> &gatherCalibrationCache()
+{
+    static std::atomic<int> cache(-1);
+    return cache;
+}
+
+template <typename V> GatherScatterImplementation calibrateGather();
+
+/**
+ * Returns the gather strategy for \p V as determined by calibrateGather<V>(). The first
+ * call runs the calibration, all later calls return the cached choice.
+ *
+ * The calibration is only available if `Vc_USE_CALIBRATED_GATHERS` is defined. Then the
+ * gathers into float, double, int, and uint vectors that would use the AVX2 gather
+ * instructions consult this function first. Otherwise the gather instructions are used
+ * unconditionally when compiling for AVX2.
+ */
+template <typename V>
+Vc_ALWAYS_INLINE GatherScatterImplementation calibratedGatherImplementation()
+{
+    const int cached = gatherCalibrationCache<V>().load(std::memory_order_relaxed);
+    if (Vc_IS_UNLIKELY(cached < 0)) {
+        return calibrateGather<V>();
+    }
+    return static_cast<GatherScatterImplementation>(cached);
+}
+
+/**
+ * Measures masked gathers into \p V from an L1-resident table with random indexes and
+ * random masks for the Hardware, BitScanLoop, and SimpleLoop strategies on the running
+ * CPU. The fastest strategy is cached for calibratedGatherImplementation<V>() and
+ * returned.
+ *
+ * The calibration takes well below a millisecond. Call it at program start to keep it out
+ * of the first gather. Calling it again repeats the measurement.
+ */
+template <typename V> GatherScatterImplementation calibrateGather()
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    constexpr std::size_t TableSize = 1024;
+    constexpr std::size_t Gathers = 512;
+    constexpr int Rounds = 3;
+    const GatherScatterImplementation candidates[] = {
+        GatherScatterImplementation::Hardware, GatherScatterImplementation::BitScanLoop,
+        GatherScatterImplementation::SimpleLoop};
+
+    // the random sequences are fixed (xorshift32) so that every call measures the same
+    std::vector<T> table(TableSize);
+    std::vector<int> indexes(Gathers * V::Size);
+    std::vector<T> selection(Gathers * V::Size);
+    unsigned int state = 2463534242u;
+    const auto next = [&]() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    };
+    for (std::size_t i = 0; i < TableSize; ++i) {
+        table[i] = static_cast<T>(i & 0x7f);
+    }
+    for (std::size_t i = 0; i < Gathers * V::Size; ++i) {
+        indexes[i] = static_cast<int>(next() % TableSize);
+        selection[i] = static_cast<T>(next() & 1);
+    }
+
+    auto &cache = gatherCalibrationCache<V>();
+    V sum = V::Zero();
+    std::chrono::steady_clock::duration best[3] = {
+        std::chrono::steady_clock::duration::max(),
+        std::chrono::steady_clock::duration::max(),
+        std::chrono::steady_clock::duration::max()};
+    for (int round = 0; round < Rounds; ++round) {
+        for (int c = 0; c < 3; ++c) {
+            // the gathers below read the strategy from the cache
+            cache.store(static_cast<int>(candidates[c]), std::memory_order_relaxed);
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < Gathers; ++i) {
+                const IT idx(&indexes[i * V::Size], Vc::Unaligned);
+                const auto mask = V(&selection[i * V::Size], Vc::Unaligned) > V::Zero();
+                V v = V::Zero();
+                v.gather(table.data(), idx, mask);
+                sum += v;
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed < best[c]) {
+                best[c] = elapsed;
+            }
+        }
+    }
+    // keep the gathers from being optimized away
+    volatile T sink = sum[0];
+    static_cast<void>(sink);
+
+    int winner = 0;
+    for (int c = 1; c < 3; ++c) {
+        if (best[c] < best[winner]) {
+            winner = c;
+        }
+    }
+    cache.store(static_cast<int>(candidates[winner]), std::memory_order_relaxed);
+    return candidates[winner];
+}
+#endif  // Vc_USE_CALIBRATED_GATHERS
+// }}}1
+
 }  // namespace Common
 }  // namespace Vc
 
 #endif // VC_COMMON_GATHERIMPLEMENTATION_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,365 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_GEMM_H_
+#define VC_COMMON_GEMM_H_
+
+#include <algorithm>
+#include <vector>
+#include "../Allocator"
+#include "memory.h"
+#if defined __x86_64__ || defined __amd64__ || defined __amd64 || defined __x86_64 ||    \
+    defined _M_AMD64 || defined __i386__
+#include "../cpuid.h"
+#define Vc_GEMM_USE_CPUID 1
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// GemmBlocking {{{1
+/**\internal
+ * Block sizes of the gemm loop nest. A \c kc × \c NR sliver of B stays in the L1 cache
+ * while the micro kernel runs over an \c mc × \c kc block of A, which stays in L2.
+ */
+struct GemmBlocking {
+    std::size_t mc, kc, nc;
+};
+
+template <typename T, std::size_t MR, std::size_t NR> inline GemmBlocking gemm_blocking()
+{
+    static const GemmBlocking blocking = [] {
+        std::size_t l1 = 0, l2 = 0, l3 = 0;
+#ifdef Vc_GEMM_USE_CPUID
+        CpuId::init();
+        l1 = CpuId::L1Data();
+        l2 = CpuId::L2Data();
+        l3 = CpuId::L3Data();
+#endif
+        l1 = l1 == 0 ? 32 * 1024 : l1;
+        l2 = l2 == 0 ? 256 * 1024 : l2;
+        l3 = l3 == 0 ? 2 * 1024 * 1024 : l3;
+        const auto clamp = [](std::size_t x, std::size_t lo, std::size_t hi) {
+            return std::min(std::max(x, lo), hi);
+        };
+        GemmBlocking b;
+        // half of L1 for the B sliver, the rest for the A sliver and C
+        b.kc = clamp(l1 / 2 / (NR * sizeof(T)), 16, 1024);
+        // half of L2 for the packed A block
+        b.mc = clamp(l2 / 2 / (b.kc * sizeof(T)), MR, 2048) / MR * MR;
+        // the packed B panel should not use more than half of L3
+        b.nc = clamp(l3 / 2 / (b.kc * sizeof(T)), NR, 8192) / NR * NR;
+        return b;
+    }();
+    return blocking;
+}
+
+// gemm_pack_a {{{1
+/**\internal
+ * Copies the \p mc × \p kc block of A at \p a to \p packed as consecutive slivers of
+ * \p MR rows, stored column by column. Rows past \p mc are filled with zeros.
+ */
+template <std::size_t MR, typename T>
+inline void gemm_pack_a(std::size_t mc, std::size_t kc, const T *a, std::size_t lda,
+                        T *packed)
+{
+    for (std::size_t i = 0; i < mc; i += MR) {
+        const std::size_t rows = std::min(MR, mc - i);
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t r = 0; r < rows; ++r) {
+                packed[r] = a[(i + r) * lda + p];
+            }
+            for (std::size_t r = rows; r < MR; ++r) {
+                packed[r] = T();
+            }
+            packed += MR;
+        }
+    }
+}
+
+// gemm_pack_b {{{1
+/**\internal
+ * Copies the \p kc × \p nc panel of B at \p b to \p packed as consecutive slivers of
+ * `2 * V::Size` columns, stored row by row. Columns past \p nc are filled with zeros.
+ */
+template <typename V>
+inline void gemm_pack_b(std::size_t kc, std::size_t nc, const typename V::EntryType *b,
+                        std::size_t ldb, typename V::EntryType *packed)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t NR = 2 * V::Size;
+    for (std::size_t j = 0; j < nc; j += NR) {
+        const std::size_t cols = std::min(NR, nc - j);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const T *row = b + p * ldb + j;
+            if (cols == NR) {
+                V(row, Vc::Unaligned).store(packed, Vc::Aligned);
+                V(row + V::Size, Vc::Unaligned).store(packed + V::Size, Vc::Aligned);
+            } else {
+                for (std::size_t c = 0; c < cols; ++c) {
+                    packed[c] = row[c];
+                }
+                for (std::size_t c = cols; c < NR; ++c) {
+                    packed[c] = T();
+                }
+            }
+            packed += NR;
+        }
+    }
+}
+
+// gemm_micro_kernel {{{1
+/**\internal
+ * Adds `alpha * A * B` to the \p mr × \p nr tile of C at \p c, where A and B are packed
+ * slivers of depth \p kc. The full \p MR × `2 * V::Size` tile is accumulated in
+ * registers.
+ */
+template <typename V, std::size_t MR>
+Vc_ALWAYS_INLINE void gemm_micro_kernel(std::size_t kc, const typename V::EntryType *a,
+                                        const typename V::EntryType *b,
+                                        typename V::EntryType alpha,
+                                        typename V::EntryType *c, std::size_t ldc,
+                                        std::size_t mr, std::size_t nr)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = V::Size;
+    V acc0[MR], acc1[MR];
+    Common::unrolled_loop<std::size_t, 0, MR>([&](std::size_t r) {
+        acc0[r] = V::Zero();
+        acc1[r] = V::Zero();
+    });
+    for (std::size_t p = 0; p < kc; ++p) {
+        const V b0(b, Vc::Aligned);
+        const V b1(b + N, Vc::Aligned);
+        Common::unrolled_loop<std::size_t, 0, MR>([&](std::size_t r) {
+            const V ar = a[r];
+            acc0[r] = multiply_add(ar, b0, acc0[r]);
+            acc1[r] = multiply_add(ar, b1, acc1[r]);
+        });
+        a += MR;
+        b += 2 * N;
+    }
+    const V alpha_v = alpha;
+    if (mr == MR && nr == 2 * N) {
+        Common::unrolled_loop<std::size_t, 0, MR>([&](std::size_t r) {
+            T *row = c + r * ldc;
+            multiply_add(alpha_v, acc0[r], V(row, Vc::Unaligned))
+                .store(row, Vc::Unaligned);
+            multiply_add(alpha_v, acc1[r], V(row + N, Vc::Unaligned))
+                .store(row + N, Vc::Unaligned);
+        });
+    } else {
+        alignas(V::MemoryAlignment) T tile[MR][2 * N];
+        Common::unrolled_loop<std::size_t, 0, MR>([&](std::size_t r) {
+            (alpha_v * acc0[r]).store(&tile[r][0], Vc::Aligned);
+            (alpha_v * acc1[r]).store(&tile[r][N], Vc::Aligned);
+        });
+        for (std::size_t r = 0; r < mr; ++r) {
+            for (std::size_t j = 0; j < nr; ++j) {
+                c[r * ldc + j] += tile[r][j];
+            }
+        }
+    }
+}
+
+// gemm_scale {{{1
+/**\internal
+ * Multiplies the \p m × \p n matrix C by \p beta. For \p beta = 0, C is overwritten with
+ * zeros, so that NaNs and infinities in the previous contents do not propagate.
+ */
+template <typename T>
+inline void gemm_scale(std::size_t m, std::size_t n, T beta, T *c, std::size_t ldc)
+{
+    if (beta == T(1)) {
+        return;
+    }
+    for (std::size_t i = 0; i < m; ++i) {
+        T *row = c + i * ldc;
+        if (beta == T()) {
+            std::fill_n(row, n, T());
+        } else {
+            for (std::size_t j = 0; j < n; ++j) {
+                row[j] *= beta;
+            }
+        }
+    }
+}
+}  // namespace Detail
+
+// gemm {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Computes `C = alpha * A * B + beta * C` for row-major matrices of \c float or
+ * \c double, where A is \p m × \p k, B is \p k × \p n, and C is \p m × \p n.
+ * \p lda, \p ldb, and \p ldc are the distances between consecutive rows (in elements)
+ * and need not be a multiple of the vector size.
+ *
+ * The implementation follows the usual packed, register-blocked scheme: panels of B and
+ * blocks of A are copied into contiguous buffers and a micro kernel keeps a 6 ×
+ * `2 * Vector<T>::Size` tile of C in registers, using fused multiply-add instructions
+ * where the target supports them. The L1 and L2 block sizes are derived from
+ * CpuId::L1Data() and CpuId::L2Data().
+ *
+ * \note C must not overlap A or B.
+ */
+template <typename T>
+inline enable_if<std::is_floating_point<T>::value, void> gemm(
+    std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a, std::size_t lda,
+    const T *b, std::size_t ldb, T beta, T *c, std::size_t ldc)
+{
+    using V = Vector<T>;
+    constexpr std::size_t MR = 6;
+    constexpr std::size_t NR = 2 * V::Size;
+    Detail::gemm_scale(m, n, beta, c, ldc);
+    if (m == 0 || n == 0 || k == 0 || alpha == T()) {
+        return;
+    }
+    const Detail::GemmBlocking blocking = Detail::gemm_blocking<T, MR, NR>();
+    const std::size_t kc_max = std::min(blocking.kc, k);
+    const std::size_t mc_max = std::min(blocking.mc, (m + MR - 1) / MR * MR);
+    const std::size_t nc_max = std::min(blocking.nc, (n + NR - 1) / NR * NR);
+    std::vector<T, Vc::Allocator<T>> packedA(mc_max * kc_max);
+    std::vector<T, Vc::Allocator<T>> packedB(kc_max * nc_max);
+
+    for (std::size_t jc = 0; jc < n; jc += nc_max) {
+        const std::size_t nc = std::min(nc_max, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += kc_max) {
+            const std::size_t kc = std::min(kc_max, k - pc);
+            Detail::gemm_pack_b<V>(kc, nc, b + pc * ldb + jc, ldb, packedB.data());
+            for (std::size_t ic = 0; ic < m; ic += mc_max) {
+                const std::size_t mc = std::min(mc_max, m - ic);
+                Detail::gemm_pack_a<MR>(mc, kc, a + ic * lda + pc, lda, packedA.data());
+                for (std::size_t jr = 0; jr < nc; jr += NR) {
+                    for (std::size_t ir = 0; ir < mc; ir += MR) {
+                        Detail::gemm_micro_kernel<V, MR>(
+                            kc, packedA.data() + ir * kc, packedB.data() + jr * kc, alpha,
+                            c + (ic + ir) * ldc + jc + jr, ldc, std::min(MR, mc - ir),
+                            std::min(NR, nc - jr));
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Computes `c = alpha * a * b + beta * c` for two-dimensional Vc::Memory objects.
+ *
+ * The row distances are taken from the padding of the Memory objects.
+ */
+template <typename V, std::size_t M, std::size_t K, std::size_t N, bool PA, bool PB,
+          bool PC>
+inline void gemm(const Memory<V, M, K, PA> &a, const Memory<V, K, N, PB> &b,
+                 Memory<V, M, N, PC> &c, typename V::EntryType alpha = 1,
+                 typename V::EntryType beta = 0)
+{
+    gemm(M, N, K, alpha, &a[0][0], a.vectorsCount() / M * V::Size, &b[0][0],
+         b.vectorsCount() / K * V::Size, beta, &c[0][0], c.vectorsCount() / M * V::Size);
+}
+
+// gemv {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Computes `y = alpha * A * x + beta * y` for a row-major \p m × \p n matrix A of
+ * \c float or \c double with row distance \p lda.
+ *
+ * Four rows of A are processed at once, so that every vector loaded from \p x is used
+ * four times. The dot products are accumulated vertically and reduced once per row.
+ */
+template <typename T>
+inline enable_if<std::is_floating_point<T>::value, void> gemv(
+    std::size_t m, std::size_t n, T alpha, const T *a, std::size_t lda, const T *x,
+    T beta, T *y)
+{
+    using V = Vector<T>;
+    constexpr std::size_t Rows = 4;
+    const std::size_t nv = n / V::Size * V::Size;
+    const auto finish = [&](std::size_t i, T dot) {
+        y[i] = alpha * dot + (beta == T() ? T() : beta * y[i]);
+    };
+    std::size_t i = 0;
+    for (; i + Rows <= m; i += Rows) {
+        V acc[Rows];
+        Common::unrolled_loop<std::size_t, 0, Rows>(
+            [&](std::size_t r) { acc[r] = V::Zero(); });
+        for (std::size_t j = 0; j < nv; j += V::Size) {
+            const V xj(x + j, Vc::Unaligned);
+            Common::unrolled_loop<std::size_t, 0, Rows>([&](std::size_t r) {
+                acc[r] = Detail::multiply_add(V(a + (i + r) * lda + j, Vc::Unaligned), xj,
+                                              acc[r]);
+            });
+        }
+        for (std::size_t r = 0; r < Rows; ++r) {
+            T dot = acc[r].sum();
+            for (std::size_t j = nv; j < n; ++j) {
+                dot += a[(i + r) * lda + j] * x[j];
+            }
+            finish(i + r, dot);
+        }
+    }
+    for (; i < m; ++i) {
+        V acc = V::Zero();
+        for (std::size_t j = 0; j < nv; j += V::Size) {
+            acc = Detail::multiply_add(V(a + i * lda + j, Vc::Unaligned),
+                                       V(x + j, Vc::Unaligned), acc);
+        }
+        T dot = acc.sum();
+        for (std::size_t j = nv; j < n; ++j) {
+            dot += a[i * lda + j] * x[j];
+        }
+        finish(i, dot);
+    }
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Computes `y = alpha * a * x + beta * y` for a two-dimensional Vc::Memory object \p a
+ * and one-dimensional Vc::Memory objects \p x and \p y.
+ */
+template <typename V, std::size_t M, std::size_t N, bool PA, bool PX, bool PY>
+inline void gemv(const Memory<V, M, N, PA> &a, const Memory<V, N, 0, PX> &x,
+                 Memory<V, M, 0, PY> &y, typename V::EntryType alpha = 1,
+                 typename V::EntryType beta = 0)
+{
+    gemv(M, N, alpha, &a[0][0], a.vectorsCount() / M * V::Size, &x[0], beta, &y[0]);
+}
+//}}}1
+}  // namespace Vc
+
+#undef Vc_GEMM_USE_CPUID
+
+#endif  // VC_COMMON_GEMM_H_
+
+// vim: foldmethod=marker
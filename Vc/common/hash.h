@@ -0,0 +1,215 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_HASH_H_
+#define VC_COMMON_HASH_H_
+
+#include <type_traits>
+#include "../vector.h"
+#include "streaming.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// is_uint32_argument {{{1
+/**\internal
+ * Whether \p U is `unsigned int` or a SIMD vector of `unsigned int`. The hash functions
+ * are written once for both, so that the vectorized and the scalar results agree bit for
+ * bit.
+ */
+template <typename U>
+using is_uint32_argument = std::is_same<Traits::entry_type_of<U>, unsigned int>;
+
+// rotl32 {{{1
+template <int K, typename U> Vc_INTRINSIC U rotl32(const U &x)
+{
+    return (x << K) | (x >> (32 - K));
+}
+}  // namespace Detail
+
+// murmur3_fmix32 {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/algorithm>
+ *
+ * The finalizer (`fmix32`) of MurmurHash3: a bijective mix of all bits of \p h, which is
+ * commonly used as a fast hash of 32-bit integers.
+ *
+ * murmur3_fmix32, murmur3_32, xxhash32, and multiply_shift accept `unsigned int`,
+ * `Vc::uint_v`, and `Vc::SimdArray<unsigned int, N>` and return the same type. Every lane of a vector
+ * yields exactly the result of the scalar function.
+ */
+template <typename U, typename = enable_if<Detail::is_uint32_argument<U>::value>>
+Vc_INTRINSIC U murmur3_fmix32(U h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// murmur3_32 {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/algorithm>
+ *
+ * MurmurHash3_x86_32 of the four (little-endian) bytes of \p key with the given \p seed,
+ * i.e. the hash of a single block followed by the finalizer.
+ */
+template <typename U, typename = enable_if<Detail::is_uint32_argument<U>::value>>
+Vc_INTRINSIC U murmur3_32(U key, unsigned int seed = 0)
+{
+    U k = key * 0xcc9e2d51u;
+    k = Detail::rotl32<15>(k);
+    k *= 0x1b873593u;
+    U h = k ^ seed;
+    h = Detail::rotl32<13>(h);
+    h = h * 5u + 0xe6546b64u;
+    h ^= 4u;  // the length in bytes
+    return murmur3_fmix32(h);
+}
+
+// xxhash32 {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/algorithm>
+ *
+ * XXH32 of the four (little-endian) bytes of \p key with the given \p seed.
+ */
+template <typename U, typename = enable_if<Detail::is_uint32_argument<U>::value>>
+Vc_INTRINSIC U xxhash32(U key, unsigned int seed = 0)
+{
+    constexpr unsigned int Prime2 = 0x85ebca77u;
+    constexpr unsigned int Prime3 = 0xc2b2ae3du;
+    constexpr unsigned int Prime4 = 0x27d4eb2fu;
+    constexpr unsigned int Prime5 = 0x165667b1u;
+    U h = key * Prime3 + (seed + Prime5 + 4u);
+    h = Detail::rotl32<17>(h) * Prime4;
+    h ^= h >> 15;
+    h *= Prime2;
+    h ^= h >> 13;
+    h *= Prime3;
+    h ^= h >> 16;
+    return h;
+}
+
+// multiply_shift {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/algorithm>
+ *
+ * Multiplicative hashing of Dietzfelbinger et al.: the upper \p bits bits of the 32-bit
+ * product `multiplier * key`, i.e. a hash in [0, 2^bits). \p multiplier should be a
+ * random odd number; \p bits must be in [1, 32].
+ */
+template <typename U, typename = enable_if<Detail::is_uint32_argument<U>::value>>
+Vc_INTRINSIC U multiply_shift(U key, unsigned int multiplier, int bits)
+{
+    return (key * multiplier) >> (32 - bits);
+}
+
+// hash function objects {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/algorithm>
+ *
+ * Function objects for the hash functions above, e.g. for Vc::hash. They can be called
+ * with scalars and vectors alike.
+ */
+struct Murmur3Finalizer {
+    template <typename U> Vc_INTRINSIC U operator()(const U &x) const
+    {
+        return murmur3_fmix32(x);
+    }
+};
+///\copydoc Murmur3Finalizer
+struct Murmur3Hash {
+    explicit Murmur3Hash(unsigned int s = 0) : seed(s) {}
+    unsigned int seed;
+    template <typename U> Vc_INTRINSIC U operator()(const U &x) const
+    {
+        return murmur3_32(x, seed);
+    }
+};
+///\copydoc Murmur3Finalizer
+struct XXHash32 {
+    explicit XXHash32(unsigned int s = 0) : seed(s) {}
+    unsigned int seed;
+    template <typename U> Vc_INTRINSIC U operator()(const U &x) const
+    {
+        return xxhash32(x, seed);
+    }
+};
+///\copydoc Murmur3Finalizer
+struct MultiplyShiftHash {
+    MultiplyShiftHash(unsigned int m, int b) : multiplier(m), bits(b) {}
+    unsigned int multiplier;
+    int bits;
+    template <typename U> Vc_INTRINSIC U operator()(const U &x) const
+    {
+        return multiply_shift(x, multiplier, bits);
+    }
+};
+
+// hash {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile hash.h <Vc/algorithm>
+ *
+ * Writes `hasher(x)` for all keys \c x of the contiguous range [\p first, \p last) of
+ * `unsigned int` to the range starting at \p d_first and returns the end of the output
+ * range. This is Vc::transform with one of the hash function objects (or any other
+ * function object that maps `Vc::uint_v` to `Vc::uint_v`), i.e. large arrays are written
+ * with non-temporal stores.
+ *
+ * \code
+ * std::vector<unsigned int> keys = ..., shards(keys.size());
+ * // 64 shards
+ * Vc::hash(keys.begin(), keys.end(), shards.begin(),
+ *          Vc::MultiplyShiftHash(0x9e3779b1u, 6));
+ * \endcode
+ */
+template <typename ContiguousIt, typename OutputIt, typename Hasher>
+inline enable_if<
+    std::is_same<typename std::iterator_traits<ContiguousIt>::value_type,
+                 unsigned int>::value,
+    OutputIt>
+hash(ContiguousIt first, ContiguousIt last, OutputIt d_first, Hasher hasher)
+{
+    return Vc::transform(first, last, d_first, hasher);
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_HASH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,347 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_HISTOGRAM_H_
+#define VC_COMMON_HISTOGRAM_H_
+
+#include <assert.h>
+#include <climits>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../vector.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// rotations {{{1
+/**\internal
+ * Yields \p x rotated by a given amount, either in registers or, if \p Buffered, via a
+ * copy of \p x that is stored twice in a row, so that every rotation is a single
+ * unaligned load. The latter is cheaper for vectors that span several registers, e.g. the
+ * int indexes of a short_v.
+ */
+template <typename V, bool Buffered> struct rotations {
+    const V &x;
+    Vc_INTRINSIC V operator()(int amount) const { return x.rotated(amount); }
+};
+template <typename V> struct rotations<V, true> {
+    using T = typename V::EntryType;
+    alignas(V::MemoryAlignment) T buffer[2 * V::Size];
+    Vc_INTRINSIC rotations(const V &x)
+    {
+        x.store(&buffer[0], Vc::Aligned);
+        x.store(&buffer[V::Size], Vc::Unaligned);
+    }
+    Vc_INTRINSIC V operator()(int amount) const
+    {
+        return V(&buffer[amount], Vc::Unaligned);
+    }
+};
+
+// sum_equal_indexes {{{1
+/**\internal
+ * Resolves the lane conflicts of a scatter-add: every \p active lane of \p values
+ * becomes the sum of the values of all active lanes with an equal index. A scatter of
+ * the updated memory then writes the same (complete) result for all these lanes, no
+ * matter which of them writes last.
+ *
+ * Every lane is compared against the lanes at distance 1 to Size - 1 via rotated copies.
+ * Matches with inactive lanes are only masked off if there are any inactive lanes.
+ */
+template <bool AllActive, typename IT, typename V>
+Vc_INTRINSIC void sum_equal_indexes(const IT &indexes, V &values,
+                                    const typename IT::Mask &active)
+{
+    using IMask = typename IT::Mask;
+    constexpr bool Buffered = IT::Size > Vector<typename IT::EntryType>::Size;
+    const IT activeLanes = iif(active, IT(1), IT(0));
+    const rotations<IT, Buffered> rotatedIndexes{indexes};
+    const rotations<IT, Buffered> rotatedActive{activeLanes};
+    const V v = values;
+    // unrolled, so that every rotated() sees a constant amount
+    Common::unrolled_loop<int, 1, IT::Size>([&](int k) {
+        IMask equal = indexes == rotatedIndexes(k);
+        if (!AllActive) {
+            equal = equal && rotatedActive(k) != 0;
+        }
+        where(simd_cast<typename V::Mask>(equal)) | values += v.rotated(k);
+    });
+}
+
+// scatter_add_active {{{1
+template <typename T, typename IT, typename V>
+Vc_INTRINSIC void scatter_add_active(T *mem, const IT &indexes, V values,
+                                     const typename IT::Mask &active)
+{
+    static_assert(IT::Size == V::Size,
+                  "scatter_add requires as many indexes as values");
+    if (all_of(active)) {
+        sum_equal_indexes<true>(indexes, values, active);
+        V sum(mem, indexes);
+        sum += values;
+        sum.scatter(mem, indexes);
+    } else {
+        sum_equal_indexes<false>(indexes, values, active);
+        const auto mask = simd_cast<typename V::Mask>(active);
+        V sum = V::Zero();
+        sum.gather(mem, indexes, mask);
+        sum += values;
+        sum.scatter(mem, indexes, mask);
+    }
+}
+
+// histogram helpers {{{1
+template <typename It>
+using histogram_index_type = typename std::decay<decltype(*std::declval<It>())>::type;
+
+/**\internal
+ * The lanes of \p idx that hold a valid bin index, i.e. one in [0, \p binCount).
+ */
+template <typename IV>
+Vc_INTRINSIC typename IV::Mask valid_bins(const IV &idx, std::size_t binCount)
+{
+    using T = typename IV::EntryType;
+    if (binCount > std::size_t(std::numeric_limits<T>::max())) {
+        return idx >= T(0);
+    }
+    return idx >= T(0) && idx < T(binCount);
+}
+
+template <typename T> Vc_INTRINSIC bool valid_bin(T x, std::size_t binCount)
+{
+    return !(x < T(0)) && std::size_t(x) < binCount;
+}
+
+/**\internal
+ * The index vector type the histogram algorithms work with. 8- and 64-bit indexes are
+ * converted to int, because the conflict detection and the gathers and scatters need
+ * masks and vectors of int size.
+ */
+template <typename T>
+using histogram_index_vector =
+    typename std::conditional<sizeof(T) == 2 || sizeof(T) == 4, Vector<T>,
+                              SimdArray<int, Vector<T>::Size>>::type;
+
+/**\internal
+ * Loads the bin indexes at \p in as \p IV. If \p IV converts the indexes to int, the
+ * lanes outside of [0, \p binCount) are set to -1 first, so that they stay invalid.
+ */
+template <typename IV, typename T>
+Vc_INTRINSIC enable_if<std::is_same<IV, Vector<T>>::value, IV> load_bins(const T *in,
+                                                                         std::size_t)
+{
+    return IV(in, Vc::Unaligned);
+}
+template <typename IV, typename T>
+Vc_INTRINSIC enable_if<!std::is_same<IV, Vector<T>>::value, IV> load_bins(
+    const T *in, std::size_t binCount)
+{
+    const Vector<T> idx(in, Vc::Unaligned);
+    return simd_cast<IV>(iif(valid_bins(idx, binCount), idx, Vector<T>(T(-1))));
+}
+
+template <typename IV, typename T, typename CountT>
+void histogram_conflict_detection(const T *in, std::size_t n, CountT *bins,
+                                  std::size_t binCount)
+{
+    using CV = SimdArray<CountT, IV::Size>;
+    std::size_t i = 0;
+    for (; i + IV::Size <= n; i += IV::Size) {
+        const IV idx = load_bins<IV>(in + i, binCount);
+        scatter_add_active(bins, idx, CV(CountT(1)), valid_bins(idx, binCount));
+    }
+    for (; i < n; ++i) {
+        if (valid_bin(in[i], binCount)) {
+            ++bins[in[i]];
+        }
+    }
+}
+
+template <typename IV, typename T, typename CountT>
+void histogram_replicated(const T *in, std::size_t n, CountT *bins, std::size_t binCount)
+{
+    constexpr int S = IV::Size;
+    using CV = SimdArray<CountT, S>;
+    using RI = SimdArray<int, S>;
+    assert(binCount <= std::size_t(INT_MAX / S));
+    // one sub-histogram per lane, interleaved: sub[bin * S + lane]
+    std::vector<CountT> sub(binCount * S, CountT(0));
+    const RI lane = RI::IndexesFromZero();
+    std::size_t i = 0;
+    for (; i + S <= n; i += S) {
+        const IV idx = load_bins<IV>(in + i, binCount);
+        const auto valid = valid_bins(idx, binCount);
+        const RI slot = simd_cast<RI>(idx) * S + lane;
+        if (all_of(valid)) {
+            CV c(sub.data(), slot);
+            c += CountT(1);
+            c.scatter(sub.data(), slot);
+        } else {
+            const auto mask = simd_cast<typename CV::Mask>(valid);
+            CV c = CV::Zero();
+            c.gather(sub.data(), slot, mask);
+            c += CountT(1);
+            c.scatter(sub.data(), slot, mask);
+        }
+    }
+    for (; i < n; ++i) {
+        if (valid_bin(in[i], binCount)) {
+            ++sub[std::size_t(in[i]) * S];
+        }
+    }
+    for (std::size_t b = 0; b < binCount; ++b) {
+        bins[b] += CV(sub.data() + b * S, Vc::Unaligned).sum();
+    }
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \name Scatter-add and histograms
+ */
+//@{
+// scatter_add {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/algorithm>
+ *
+ * Adds the entries of \p values to the memory at \p mem: `mem[indexes[i]] += values[i]`
+ * for every \p i where \p mask is set.
+ *
+ * In contrast to a gather, add, and scatter sequence, the result is correct if several
+ * lanes use the same index: these lanes are combined before the scatter. The order of
+ * the additions is unspecified, which matters for the rounding of floating-point sums.
+ *
+ * \param mem The base address of the scatter.
+ * \param indexes A Vc::Vector or Vc::SimdArray of indexes with as many entries as
+ *                \p values, e.g. a `typename V::IndexType`.
+ * \param values The values to add.
+ * \param mask The lanes to add. Indexes of the other lanes are never dereferenced.
+ */
+template <typename T, typename IT, typename V>
+Vc_INTRINSIC
+    enable_if<Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value, void>
+scatter_add(T *mem, const IT &indexes, const V &values, const typename V::Mask &mask)
+{
+    Detail::scatter_add_active(mem, indexes, values, simd_cast<typename IT::Mask>(mask));
+}
+
+/// \copydoc scatter_add
+template <typename T, typename IT, typename V>
+Vc_INTRINSIC
+    enable_if<Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value, void>
+scatter_add(T *mem, const IT &indexes, const V &values)
+{
+    Detail::scatter_add_active(mem, indexes, values, typename IT::Mask(true));
+}
+
+// histogram {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Selects how histogram() resolves lane conflicts.
+ */
+enum class HistogramMode {
+    /**
+     * Combines lanes with equal bins before every scatter (see scatter_add). Needs no
+     * extra memory and suits many bins with few collisions.
+     */
+    ConflictDetection,
+    /**
+     * Counts every lane in a private copy of the bins, such that no two lanes ever write
+     * to the same counter, and adds the copies up at the end. Needs `V::Size` times the
+     * memory of the bins and suits few bins with many collisions.
+     */
+    Replicated
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/algorithm>
+ *
+ * Counts the occurrences of the bin indexes in [\p first, \p last): `++bins[x]` for every
+ * \p x in the range. Values outside [0, \p binCount) are ignored. The counts are added to
+ * the existing contents of \p bins.
+ *
+ * \param first, last A contiguous range of integers of a type that Vc::Vector supports.
+ * \param bins The counters.
+ * \param binCount The number of counters at \p bins.
+ * \param mode See HistogramMode.
+ */
+template <typename ContiguousIt, typename CountT>
+inline enable_if<std::is_integral<Detail::histogram_index_type<ContiguousIt>>::value &&
+                     Traits::is_valid_vector_argument<
+                         Detail::histogram_index_type<ContiguousIt>>::value,
+                 void>
+histogram(ContiguousIt first, ContiguousIt last, CountT *bins, std::size_t binCount,
+          HistogramMode mode = HistogramMode::ConflictDetection)
+{
+    using T = Detail::histogram_index_type<ContiguousIt>;
+    using IV = Detail::histogram_index_vector<T>;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0 || binCount == 0) {
+        return;
+    }
+    // 64-bit indexes are narrowed to int
+    assert(sizeof(T) < 8 || binCount <= std::size_t(INT_MAX));
+    if (mode == HistogramMode::Replicated) {
+        Detail::histogram_replicated<IV>(std::addressof(*first), n, bins, binCount);
+    } else {
+        Detail::histogram_conflict_detection<IV>(std::addressof(*first), n, bins,
+                                                 binCount);
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile histogram.h <Vc/algorithm>
+ *
+ * Overload of the above for a contiguous \p range and a contiguous container of \p bins
+ * (e.g. `std::vector<unsigned>`), which determines the number of bins.
+ */
+template <typename Range, typename Bins>
+inline auto histogram(const Range &range, Bins &bins,
+                      HistogramMode mode = HistogramMode::ConflictDetection)
+    -> decltype(histogram(std::begin(range), std::end(range), bins.data(), bins.size(),
+                          mode))
+{
+    return histogram(std::begin(range), std::end(range), bins.data(), bins.size(), mode);
+}
+//}}}1
+//@}
+}  // namespace Vc
+
+#endif  // VC_COMMON_HISTOGRAM_H_
+
+// vim: foldmethod=marker
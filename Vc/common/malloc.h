@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cstdlib>
 #endif
 
+#include "pageplacement.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -81,6 +82,24 @@ template <Vc::MallocAlignment A> Vc_ALWAYS_INLINE void *malloc(size_t n)
     case Vc::AlignOnPage:
         // TODO: hardcoding 4096 is not such a great idea
         return aligned_malloc<4096>(n);
+    case Vc::AlignOnHugePage:
+    case Vc::AlignOnHugePageInterleaved: {
+        void *p = aligned_malloc<HugePageSize>(n);
+        if (p) {
+            advise_huge_pages(p, nextMultipleOf<HugePageSize>(n));
+            if (A == Vc::AlignOnHugePageInterleaved) {
+                interleave_pages(p, nextMultipleOf<HugePageSize>(n));
+            }
+        }
+        return p;
+    }
+    case Vc::AlignOnPageInterleaved: {
+        void *p = aligned_malloc<SmallPageSize>(n);
+        if (p) {
+            interleave_pages(p, nextMultipleOf<SmallPageSize>(n));
+        }
+        return p;
+    }
     }
     return nullptr;
 }
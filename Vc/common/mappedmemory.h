@@ -0,0 +1,516 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_MAPPEDMEMORY_H_
+#define VC_COMMON_MAPPEDMEMORY_H_
+
+#include "memorybase.h"
+#include <assert.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#if defined __unix__ || defined __APPLE__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define Vc_HAVE_MAPPED_MEMORY 1
+#endif
+#include "memoryfwd.h"
+#include "macros.h"
+
+#ifdef Vc_HAVE_MAPPED_MEMORY
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * Selects how MappedMemory opens its file.
+ *
+ * \ingroup Containers
+ */
+enum class MappedMemoryMode {
+    /**
+     * Maps an existing file copy-on-write. Stores to the memory are private to the
+     * process and never reach the file. The file cannot grow.
+     */
+    Read,
+    /**
+     * Maps an existing file (or creates an empty one) shared. Stores reach the file and
+     * all other processes that map it; append() and resize() grow the file.
+     */
+    ReadWrite,
+    /**
+     * Like ReadWrite, but discards the previous contents of the file.
+     */
+    Create
+};
+
+namespace Detail
+{
+/**\internal
+ * The header at the start of every MappedMemory file. Its size is the largest memory
+ * alignment of any Vc vector type, so that the entries start aligned in a page-aligned
+ * mapping.
+ */
+struct MappedMemoryHeader {
+    static constexpr std::size_t Size = 64;
+    static constexpr std::uint32_t CurrentVersion = 1;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::uint32_t entrySize;
+    std::uint32_t entryKind;  // 0: floating-point, 1: signed, 2: unsigned
+    std::uint64_t entriesCount;
+    char reserved[Size - 32];
+
+    static constexpr const char *magicString() { return "VcMemory"; }
+
+    template <typename T> static constexpr std::uint32_t kindOf()
+    {
+        return std::is_floating_point<T>::value ? 0 : std::is_signed<T>::value ? 1 : 2;
+    }
+
+    template <typename T> void init()
+    {
+        std::memset(this, 0, sizeof(MappedMemoryHeader));
+        std::memcpy(magic, magicString(), sizeof(magic));
+        version = CurrentVersion;
+        headerSize = Size;
+        entrySize = sizeof(T);
+        entryKind = kindOf<T>();
+    }
+
+    // A file written on a machine with different byte order fails the version check.
+    template <typename T> bool matches() const
+    {
+        return 0 == std::memcmp(magic, magicString(), sizeof(magic)) &&
+               version == CurrentVersion && headerSize == Size &&
+               entrySize == sizeof(T) && entryKind == kindOf<T>();
+    }
+};
+static_assert(sizeof(MappedMemoryHeader) == MappedMemoryHeader::Size,
+              "MappedMemoryHeader must not contain padding");
+}  // namespace Detail
+
+/**
+ * A one-dimensional array of \p V::EntryType values that lives in a memory-mapped file.
+ *
+ * MappedMemory offers the same interface as the dynamically sized Memory<V> (vector(i),
+ * vectorsCount(), firstVector(), lastVector(), the vector iterators, and the
+ * MemoryExpression assignments), but the entries are never copied into process memory:
+ * the kernel pages them in on first access, and all processes that map the same file
+ * share the page cache.
+ *
+ * The file starts with a 64-byte header that records the entry type and the number of
+ * entries. It is followed by the entries, zero-padded to a multiple of 64 bytes and of
+ * \p V::Size entries. Therefore the entries are aligned and padded for fully vectorized
+ * access with any Vc implementation, independent of the one that wrote the file.
+ *
+ * \code
+ * {
+ *   Vc::MappedMemory<float_v> out("data.vcm", Vc::MappedMemoryMode::Create);
+ *   out.append(values.data(), values.size());
+ * }
+ * Vc::MappedMemory<float_v> in("data.vcm");
+ * float_v sum = float_v::Zero();
+ * for (size_t i = 0; i < in.vectorsCount(); ++i) {
+ *   sum += in.vector(i);
+ * }
+ * \endcode
+ *
+ * \note Functions that grow the file (append(), resize(), reserve()) may move the mapping
+ * and thus invalidate pointers, references, and iterators into the memory.
+ *
+ * \note Only available on POSIX systems (\c Vc_HAVE_MAPPED_MEMORY is defined).
+ *
+ * \param V The vector type you want to operate on. (e.g. float_v or uint_v)
+ *
+ * \ingroup Containers
+ * \headerfile mappedmemory.h <Vc/Memory>
+ */
+template <typename V>
+class MappedMemory : public MemoryBase<V, MappedMemory<V>, 1, void>
+{
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    typedef Detail::MappedMemoryHeader Header;
+    typedef MemoryBase<V, MappedMemory<V>, 1, void> Base;
+    friend class MemoryBase<V, MappedMemory<V>, 1, void>;
+    friend class MemoryDimensionBase<V, MappedMemory<V>, 1, void>;
+    static_assert(V::MemoryAlignment <= Header::Size,
+                  "the file header does not keep the entries aligned for V");
+
+    int m_fd = -1;
+    MappedMemoryMode m_mode = MappedMemoryMode::Read;
+    Header *m_header = nullptr;
+    EntryType *m_mem = nullptr;
+    std::size_t m_capacity = 0;  // in entries
+    std::size_t m_entriesCount = 0;
+    std::size_t m_vectorsCount = 0;
+
+    static std::size_t paddedEntriesCount(std::size_t n)
+    {
+        constexpr std::size_t Unit = Header::Size / sizeof(EntryType);
+        n = (n + V::Size - 1) / V::Size * V::Size;
+        return Unit == 0 ? n : (n + Unit - 1) / Unit * Unit;
+    }
+    static std::size_t mappingSize(std::size_t capacity)
+    {
+        return Header::Size + capacity * sizeof(EntryType);
+    }
+
+    [[noreturn]] static void fail(const char *what, const char *path = nullptr)
+    {
+        std::string msg = std::string("Vc::MappedMemory: ") + what;
+        if (path) {
+            msg = msg + ' ' + path;
+        }
+        throw std::system_error(errno, std::generic_category(), msg);
+    }
+
+    void map(std::size_t capacity, const char *path)
+    {
+        const bool shared = m_mode != MappedMemoryMode::Read;
+        void *p = mmap(nullptr, mappingSize(capacity), PROT_READ | PROT_WRITE,
+                       shared ? MAP_SHARED : MAP_PRIVATE, m_fd, 0);
+        if (p == MAP_FAILED) {
+            fail("cannot map", path);
+        }
+        m_header = static_cast<Header *>(p);
+        m_mem = reinterpret_cast<EntryType *>(static_cast<char *>(p) + Header::Size);
+        m_capacity = capacity;
+    }
+
+    void setEntriesCount(std::size_t n)
+    {
+        m_entriesCount = n;
+        m_vectorsCount = (n + V::Size - 1) / V::Size;
+        m_header->entriesCount = n;
+    }
+
+    void release()
+    {
+        if (m_header) {
+            munmap(m_header, mappingSize(m_capacity));
+        }
+        if (m_fd >= 0) {
+            // drop the spare capacity reserved by append/reserve
+            if (0 != ftruncate(m_fd, mappingSize(paddedEntriesCount(m_entriesCount)))) {
+                // the file keeps its zero-filled capacity, which readers ignore
+            }
+            ::close(m_fd);
+        }
+        m_fd = -1;
+        m_header = nullptr;
+        m_mem = nullptr;
+        m_capacity = m_entriesCount = m_vectorsCount = 0;
+    }
+
+public:
+    using Base::vector;
+
+    /**
+     * Maps the file at \p path.
+     *
+     * \param path The file to map.
+     * \param mode See MappedMemoryMode.
+     *
+     * \throws std::system_error if the file cannot be opened, resized, or mapped.
+     * \throws std::runtime_error if the file is not a MappedMemory file with entries of
+     *         type \p V::EntryType.
+     */
+    explicit MappedMemory(const char *path,
+                          MappedMemoryMode mode = MappedMemoryMode::Read)
+        : m_mode(mode)
+    {
+        const int flags = mode == MappedMemoryMode::Read
+                              ? O_RDONLY
+                              : mode == MappedMemoryMode::Create
+                                    ? O_RDWR | O_CREAT | O_TRUNC
+                                    : O_RDWR | O_CREAT;
+        m_fd = ::open(path, flags | O_CLOEXEC, 0666);
+        if (m_fd < 0) {
+            fail("cannot open", path);
+        }
+        struct stat st;
+        if (0 != fstat(m_fd, &st)) {
+            const int err = errno;
+            ::close(m_fd);
+            errno = err;
+            fail("cannot stat", path);
+        }
+        const std::size_t fileSize = st.st_size;
+        if (fileSize == 0 && mode != MappedMemoryMode::Read) {
+            if (0 != ftruncate(m_fd, Header::Size)) {
+                const int err = errno;
+                ::close(m_fd);
+                errno = err;
+                fail("cannot resize", path);
+            }
+            map(0, path);
+            m_header->template init<EntryType>();
+        } else {
+            if (fileSize < Header::Size) {
+                ::close(m_fd);
+                throw std::runtime_error(std::string("Vc::MappedMemory: ") + path +
+                                         " is not a Vc::MappedMemory file");
+            }
+            try {
+                map((fileSize - Header::Size) / sizeof(EntryType), path);
+            } catch (...) {
+                ::close(m_fd);
+                throw;
+            }
+            const Header &h = *m_header;
+            if (!h.template matches<EntryType>() ||
+                paddedEntriesCount(h.entriesCount) > m_capacity) {
+                munmap(m_header, mappingSize(m_capacity));
+                ::close(m_fd);
+                throw std::runtime_error(std::string("Vc::MappedMemory: ") + path +
+                                         " does not hold padded entries of this type");
+            }
+            m_entriesCount = h.entriesCount;
+            m_vectorsCount = (m_entriesCount + V::Size - 1) / V::Size;
+        }
+        if (mode == MappedMemoryMode::Read) {
+            // the private mapping stays valid without the descriptor
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    /// \copydoc MappedMemory(const char *, MappedMemoryMode)
+    explicit MappedMemory(const std::string &path,
+                          MappedMemoryMode mode = MappedMemoryMode::Read)
+        : MappedMemory(path.c_str(), mode)
+    {
+    }
+
+    MappedMemory(const MappedMemory &) = delete;
+    MappedMemory &operator=(const MappedMemory &) = delete;
+
+    /**
+     * Takes over the mapping of \p rhs, which is left empty.
+     */
+    MappedMemory(MappedMemory &&rhs) noexcept { swap(rhs); }
+
+    /**
+     * Unmaps the current file and takes over the mapping of \p rhs.
+     */
+    MappedMemory &operator=(MappedMemory &&rhs) noexcept
+    {
+        release();
+        swap(rhs);
+        return *this;
+    }
+
+    /**
+     * Unmaps the file. In the writable modes the file is shrunk to the padded entries.
+     */
+    ~MappedMemory() { release(); }
+
+    /**
+     * Swap the mappings of two MappedMemory objects.
+     */
+    void swap(MappedMemory &rhs) noexcept
+    {
+        std::swap(m_fd, rhs.m_fd);
+        std::swap(m_mode, rhs.m_mode);
+        std::swap(m_header, rhs.m_header);
+        std::swap(m_mem, rhs.m_mem);
+        std::swap(m_capacity, rhs.m_capacity);
+        std::swap(m_entriesCount, rhs.m_entriesCount);
+        std::swap(m_vectorsCount, rhs.m_vectorsCount);
+    }
+
+    /**
+     * \return the mode the file was opened with.
+     */
+    MappedMemoryMode mode() const { return m_mode; }
+
+    /**
+     * \return the number of scalar entries in the whole array.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE size_t entriesCount() const { return m_entriesCount; }
+
+    /**
+     * \return the number of vectors in the whole array.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE size_t vectorsCount() const { return m_vectorsCount; }
+
+    /**
+     * \return the number of entries the file can hold without growing.
+     */
+    size_t capacity() const { return m_capacity; }
+
+    /**
+     * Grows the file such that it can hold \p n entries (plus padding) without remapping.
+     *
+     * \note Requires a writable mode.
+     */
+    void reserve(size_t n)
+    {
+        assert(m_mode != MappedMemoryMode::Read);
+        n = paddedEntriesCount(n);
+        if (n <= m_capacity) {
+            return;
+        }
+        if (0 != ftruncate(m_fd, mappingSize(n))) {
+            fail("cannot resize file");
+        }
+#if defined __linux__ && defined MREMAP_MAYMOVE
+        void *p =
+            mremap(m_header, mappingSize(m_capacity), mappingSize(n), MREMAP_MAYMOVE);
+        if (p == MAP_FAILED) {
+            fail("cannot remap file");
+        }
+        m_header = static_cast<Header *>(p);
+        m_mem = reinterpret_cast<EntryType *>(static_cast<char *>(p) + Header::Size);
+        m_capacity = n;
+#else
+        munmap(m_header, mappingSize(m_capacity));
+        m_header = nullptr;
+        map(n, nullptr);
+#endif
+    }
+
+    /**
+     * Sets the number of entries to \p n. New entries are zero, and entries that are
+     * dropped are zeroed, so that the padding is always zero.
+     *
+     * \note Requires a writable mode.
+     */
+    void resize(size_t n)
+    {
+        if (n > m_entriesCount) {
+            // the padding is zero, so only the file needs to grow
+            grow(n);
+        } else {
+            std::memset(m_mem + n, 0, (m_entriesCount - n) * sizeof(EntryType));
+        }
+        setEntriesCount(n);
+    }
+
+    /**
+     * Appends the \p n values at \p data to the end of the array.
+     *
+     * \note Requires a writable mode.
+     */
+    void append(const EntryType *data, size_t n)
+    {
+        const size_t offset = m_entriesCount;
+        grow(offset + n);
+        std::memcpy(m_mem + offset, data, n * sizeof(EntryType));
+        setEntriesCount(offset + n);
+    }
+
+    /**
+     * Appends the \p V::Size entries of \p v to the end of the array.
+     *
+     * \note Requires a writable mode.
+     */
+    void append(const V &v)
+    {
+        const size_t offset = m_entriesCount;
+        grow(offset + V::Size);
+        v.store(m_mem + offset, Vc::Unaligned);
+        setEntriesCount(offset + V::Size);
+    }
+
+    /**
+     * Appends the single value \p x to the end of the array.
+     *
+     * \note Requires a writable mode.
+     */
+    void append(EntryType x) { append(&x, 1); }
+
+    /**
+     * Writes all modified pages of a shared mapping back to the file and waits for the
+     * writes to complete.
+     */
+    void flush()
+    {
+        if (m_mode != MappedMemoryMode::Read &&
+            0 != msync(m_header, mappingSize(m_capacity), MS_SYNC)) {
+            fail("cannot sync file");
+        }
+    }
+
+    /**
+     * Overwrite all entries with the values stored in \p rhs.
+     *
+     * \note this function requires the vectorsCount() of both objects to be equal.
+     */
+    template <typename Parent, typename RM>
+    Vc_ALWAYS_INLINE MappedMemory &operator=(const MemoryBase<V, Parent, 1, RM> &rhs)
+    {
+        assert(vectorsCount() == rhs.vectorsCount());
+        Detail::copyVectors(*this, rhs);
+        return *this;
+    }
+
+    /**
+     * Evaluates the MemoryExpression \p e in a single pass and assigns the result.
+     */
+    template <typename E, typename = enable_if<is_memory_expression<E>::value>>
+    Vc_ALWAYS_INLINE MappedMemory &operator=(const E &e)
+    {
+        Base::operator=(e);
+        return *this;
+    }
+
+private:
+    // Grows geometrically, so that appending one value at a time stays amortized O(1).
+    void grow(size_t n)
+    {
+        if (paddedEntriesCount(n) > m_capacity) {
+            reserve(std::max(n, 2 * m_capacity));
+        }
+    }
+};
+}  // namespace Common
+
+using Common::MappedMemory;
+using Common::MappedMemoryMode;
+}  // namespace Vc
+#endif  // Vc_HAVE_MAPPED_MEMORY
+
+#endif  // VC_COMMON_MAPPEDMEMORY_H_
+
+// vim: foldmethod=marker
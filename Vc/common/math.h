@@ -49,6 +49,23 @@ template <class T, size_t N> SimdArray<int, N> fpclassify(const SimdArray<T, N>
     return SimdArray<int, N>([&](std::size_t i) { return std::fpclassify(x[i]); });
 }
 
+namespace Detail
+{
+/**\internal
+ * Returns `a * b + c`, using a fused multiply-add instruction if the target has one.
+ * Without hardware support Vc::fma is emulated, which is too slow for the inner loops
+ * of gemm and the complex_v multiplication.
+ */
+template <typename V> Vc_INTRINSIC V multiply_add(const V &a, const V &b, const V &c)
+{
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    return Vc::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+}  // namespace Detail
+
 #ifdef Vc_IMPL_SSE
 // for SSE, AVX, and AVX2
 #include "logarithm.h"
@@ -135,6 +152,9 @@ inline SSE::double_v exp(SSE::double_v::AsArg _x) {
     }
 
 #endif
+
+// for all implementations
+#include "transcendental.h"
 }  // namespace Vc
 
 #undef Vc_COMMON_MATH_H_INTERNAL
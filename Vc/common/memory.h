@@ -176,6 +176,15 @@ private:
                 }
                 return *this;
             }
+            /**
+             * Evaluates the MemoryExpression \p e in a single pass and assigns the result.
+             */
+            template <typename E, typename = enable_if<is_memory_expression<E>::value>>
+            Vc_ALWAYS_INLINE Memory &operator=(const E &e)
+            {
+                Base::operator=(e);
+                return *this;
+            }
 };
 
     /**
@@ -348,6 +357,16 @@ class Memory<V, Size, 0u, InitPadding> :
                 }
                 return *this;
             }
+
+            /**
+             * Evaluates the MemoryExpression \p e in a single pass and assigns the result.
+             */
+            template <typename E, typename = enable_if<is_memory_expression<E>::value>>
+            Vc_ALWAYS_INLINE Memory &operator=(const E &e)
+            {
+                Base::operator=(e);
+                return *this;
+            }
     };
 
     /**
@@ -524,6 +543,15 @@ class Memory<V, Size, 0u, InitPadding> :
             std::memcpy(m_mem, rhs, entriesCount() * sizeof(EntryType));
             return *this;
         }
+        /**
+         * Evaluates the MemoryExpression \p e in a single pass and assigns the result.
+         */
+        template <typename E, typename = enable_if<is_memory_expression<E>::value>>
+        Vc_ALWAYS_INLINE Memory &operator=(const E &e)
+        {
+            Base::operator=(e);
+            return *this;
+        }
 };
 
 /**
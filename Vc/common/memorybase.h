@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assert.h>
 #include <type_traits>
 #include <iterator>
+#include "memoryexpression.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -606,13 +607,47 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
         /**
          * Assign a value to all vectors in the array.
          */
-        template<typename U>
-        Vc_ALWAYS_INLINE Parent &operator=(U &&x) {
+        template <typename U>
+        Vc_ALWAYS_INLINE enable_if<
+            !is_memory_expression<typename std::decay<U>::type>::value, Parent &>
+        operator=(U &&x)
+        {
             for (size_t i = 0; i < vectorsCount(); ++i) {
                 vector(i) = std::forward<U>(x);
             }
+            return static_cast<Parent &>(*this);
         }
 
+        /**
+         * Evaluates the MemoryExpression \p e in a single pass over the vectors and
+         * assigns the result.
+         */
+        template <typename E>
+        Vc_ALWAYS_INLINE enable_if<is_memory_expression<E>::value, Parent &> operator=(
+            const E &e)
+        {
+            assignMemoryExpression(*this, e, MemoryExpressionAssign());
+            return static_cast<Parent &>(*this);
+        }
+
+#define Vc_MEMORY_EXPRESSION_COMPOUND_ASSIGN(op_, name_)                                 \
+    template <typename E>                                                                \
+    Vc_ALWAYS_INLINE enable_if<is_memory_expression<E>::value, Parent &> operator op_##=( \
+        const E &e)                                                                      \
+    {                                                                                    \
+        assignMemoryExpression(*this, e, MemoryExpression##name_##Assign());             \
+        return static_cast<Parent &>(*this);                                             \
+    }
+        /**
+         * Evaluates the MemoryExpression \p e in a single pass over the vectors and
+         * combines the result with the current values.
+         */
+        Vc_MEMORY_EXPRESSION_COMPOUND_ASSIGN(+, Plus)
+        Vc_MEMORY_EXPRESSION_COMPOUND_ASSIGN(-, Minus)
+        Vc_MEMORY_EXPRESSION_COMPOUND_ASSIGN(*, Multiplies)
+        Vc_MEMORY_EXPRESSION_COMPOUND_ASSIGN(/, Divides)
+#undef Vc_MEMORY_EXPRESSION_COMPOUND_ASSIGN
+
         /**
          * (Inefficient) shorthand to add up two arrays.
          */
@@ -0,0 +1,462 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_MEMORYEXPRESSION_H_
+#define VC_COMMON_MEMORYEXPRESSION_H_
+
+#include <assert.h>
+#include <tuple>
+#include <type_traits>
+#include "indexsequence.h"
+#include "memoryfwd.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// is_memory / memory_vector_type {{{1
+template <typename V, typename P, int D, typename RM>
+std::true_type is_memory_impl(const MemoryBase<V, P, D, RM> *);
+std::false_type is_memory_impl(...);
+template <typename T>
+struct is_memory
+    : public decltype(is_memory_impl(std::declval<typename std::decay<T>::type *>())) {
+};
+
+template <typename V, typename P, int D, typename RM>
+V memory_vector_type_impl(const MemoryBase<V, P, D, RM> *);
+
+/**\internal
+ * True for the types that can appear as operands of a Memory expression, as long as at
+ * least one operand is a Memory object or a Memory expression.
+ */
+template <typename T>
+struct is_memory_operand
+    : public std::integral_constant<bool, is_memory<T>::value ||
+                                              is_memory_expression<T>::value ||
+                                              std::is_arithmetic<T>::value> {
+};
+template <typename T>
+struct is_memory_or_expression
+    : public std::integral_constant<bool, is_memory<T>::value ||
+                                              is_memory_expression<T>::value> {
+};
+
+// MemoryScalarOperand / MemoryReferenceOperand {{{1
+/**\internal
+ * A scalar operand of a Memory expression, broadcast to all entries.
+ */
+template <typename V> class MemoryScalarOperand
+{
+public:
+    using result_type = V;
+    explicit MemoryScalarOperand(typename V::EntryType x) : value(x) {}
+    Vc_INTRINSIC V operator()(std::size_t) const { return value; }
+    bool hasVectorsCount(std::size_t) const { return true; }
+
+private:
+    V value;
+};
+
+/**\internal
+ * A Memory operand of a Memory expression. Only a pointer to the object is stored, thus
+ * the expression must not outlive it.
+ */
+template <typename V, typename M> class MemoryReferenceOperand
+{
+public:
+    using result_type = V;
+    explicit MemoryReferenceOperand(const M &m) : mem(&m) {}
+    Vc_INTRINSIC V operator()(std::size_t i) const { return mem->vector(i); }
+    bool hasVectorsCount(std::size_t n) const { return mem->vectorsCount() == n; }
+
+private:
+    const M *mem;
+};
+
+// MemoryExpression {{{1
+/**
+ * \ingroup Containers
+ * \headerfile memory.h <Vc/Memory>
+ *
+ * A lazily evaluated expression of Vc::Memory objects, scalars, and other expressions.
+ *
+ * Arithmetic, comparison, and bitwise operators as well as sqrt, exp, where, and friends
+ * return MemoryExpression objects if one of their operands is a Memory object or a
+ * MemoryExpression. No computation happens until the expression is assigned to a Memory
+ * object. The assignment then evaluates the complete expression in a single loop over the
+ * vectors, so that all intermediate results stay in registers:
+ *
+ * \code
+ * Vc::Memory<float_v, 1000> a, b, c, d;
+ * a = b * c + d;                        // one pass over b, c, and d
+ * a += Vc::where(b > 0.f, Vc::sqrt(b), 0.f);
+ * \endcode
+ *
+ * All Memory operands must have the same vectorsCount() as the destination. The
+ * destination may also appear as an operand, since every entry is only read before it
+ * is written.
+ * Like the other whole-array operations of Memory, the expression is evaluated for the
+ * padding entries, too. Those are zero-initialized, which matters for integer division.
+ *
+ * \note Comparing two Memory objects directly (e.g. `a < b`) still calls the eager
+ * MemoryBase operators that return \c bool. Compare a Memory object with an expression or
+ * a scalar instead (e.g. `a - b < 0`).
+ */
+template <typename V, typename F, typename... Operands> class MemoryExpression
+{
+public:
+    using vector_type = V;
+    using result_type = decltype(
+        std::declval<const F &>()(std::declval<typename Operands::result_type>()...));
+
+    MemoryExpression(F f, const Operands &... ops) : fun(f), operands(ops...) {}
+
+    /**
+     * Returns the result of the expression for the \p i-th vector of the Memory operands.
+     */
+    Vc_INTRINSIC result_type operator()(std::size_t i) const
+    {
+        return eval(i, make_index_sequence<sizeof...(Operands)>());
+    }
+
+    /**
+     * Returns whether all Memory operands have \p n vectors.
+     */
+    bool hasVectorsCount(std::size_t n) const
+    {
+        return hasVectorsCountImpl(n, make_index_sequence<sizeof...(Operands)>());
+    }
+
+private:
+    template <std::size_t... Is>
+    Vc_INTRINSIC result_type eval(std::size_t i, index_sequence<Is...>) const
+    {
+        return fun(std::get<Is>(operands)(i)...);
+    }
+    template <std::size_t... Is>
+    bool hasVectorsCountImpl(std::size_t n, index_sequence<Is...>) const
+    {
+        const bool r[] = {true, std::get<Is>(operands).hasVectorsCount(n)...};
+        for (bool b : r) {
+            if (!b) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    F fun;
+    std::tuple<Operands...> operands;
+};
+
+// as_memory_operand {{{1
+/**\internal
+ * Converts an operand of a Memory expression to its node type.
+ */
+template <typename V, typename T, typename = void> struct as_memory_operand {
+    using type = MemoryScalarOperand<V>;
+    static type convert(const T &x) { return type(x); }
+};
+template <typename V, typename T>
+struct as_memory_operand<V, T, enable_if<is_memory_expression<T>::value, void>> {
+    using type = T;
+    static const T &convert(const T &x) { return x; }
+};
+template <typename V, typename T>
+struct as_memory_operand<V, T, enable_if<is_memory<T>::value, void>> {
+    using type = MemoryReferenceOperand<V, T>;
+    static type convert(const T &x) { return type(x); }
+};
+
+/**\internal
+ * The vector type of the first Memory object or expression in \p Ts.
+ */
+template <typename T, typename = void> struct memory_vector_type_of {
+};
+template <typename T>
+struct memory_vector_type_of<T, enable_if<is_memory<T>::value, void>> {
+    using type = decltype(memory_vector_type_impl(std::declval<T *>()));
+};
+template <typename T>
+struct memory_vector_type_of<T, enable_if<is_memory_expression<T>::value, void>> {
+    using type = typename T::vector_type;
+};
+template <typename T0, typename... Ts>
+struct memory_vector_type
+    : public std::conditional<is_memory_or_expression<T0>::value,
+                              memory_vector_type_of<T0>,
+                              memory_vector_type<Ts...>>::type {
+};
+template <typename T0>
+struct memory_vector_type<T0> : public memory_vector_type_of<T0> {
+};
+
+template <typename... Ts> struct all_memory_operands;
+template <> struct all_memory_operands<> : public std::true_type {
+};
+template <typename T0, typename... Ts>
+struct all_memory_operands<T0, Ts...>
+    : public std::integral_constant<bool, is_memory_operand<T0>::value &&
+                                              all_memory_operands<Ts...>::value> {
+};
+template <typename... Ts> struct any_memory_or_expression;
+template <> struct any_memory_or_expression<> : public std::false_type {
+};
+template <typename T0, typename... Ts>
+struct any_memory_or_expression<T0, Ts...>
+    : public std::integral_constant<bool, is_memory_or_expression<T0>::value ||
+                                              any_memory_or_expression<Ts...>::value> {
+};
+
+/**\internal
+ * The type of the MemoryExpression that applies \p F to \p Ts, or SFINAE if \p Ts are
+ * not valid operands.
+ */
+template <typename F, typename... Ts>
+using memory_expression_t = enable_if<
+    all_memory_operands<Ts...>::value && any_memory_or_expression<Ts...>::value,
+    MemoryExpression<typename memory_vector_type<Ts...>::type, F,
+                     typename as_memory_operand<typename memory_vector_type<Ts...>::type,
+                                                Ts>::type...>>;
+
+template <typename F, typename... Ts>
+Vc_INTRINSIC memory_expression_t<F, Ts...> make_memory_expression(const Ts &... xs)
+{
+    using V = typename memory_vector_type<Ts...>::type;
+    return {F(), as_memory_operand<V, Ts>::convert(xs)...};
+}
+
+// operators {{{1
+#define Vc_MEMORY_EXPRESSION_OPERATOR(op_, name_)                                        \
+    struct MemoryExpression##name_ {                                                     \
+        template <typename A, typename B>                                                \
+        Vc_INTRINSIC auto operator()(const A &a, const B &b) const -> decltype(a op_ b)  \
+        {                                                                                \
+            return a op_ b;                                                              \
+        }                                                                                \
+    };                                                                                   \
+    template <typename L, typename R>                                                    \
+    Vc_INTRINSIC memory_expression_t<MemoryExpression##name_, L, R> operator op_(        \
+        const L &l, const R &r)                                                          \
+    {                                                                                    \
+        return make_memory_expression<MemoryExpression##name_>(l, r);                    \
+    }
+Vc_MEMORY_EXPRESSION_OPERATOR(+, Plus);
+Vc_MEMORY_EXPRESSION_OPERATOR(-, Minus);
+Vc_MEMORY_EXPRESSION_OPERATOR(*, Multiplies);
+Vc_MEMORY_EXPRESSION_OPERATOR(/, Divides);
+Vc_MEMORY_EXPRESSION_OPERATOR(%, Modulus);
+Vc_MEMORY_EXPRESSION_OPERATOR(&, BitAnd);
+Vc_MEMORY_EXPRESSION_OPERATOR(|, BitOr);
+Vc_MEMORY_EXPRESSION_OPERATOR(^, BitXor);
+Vc_MEMORY_EXPRESSION_OPERATOR(&&, LogicalAnd);
+Vc_MEMORY_EXPRESSION_OPERATOR(||, LogicalOr);
+#undef Vc_MEMORY_EXPRESSION_OPERATOR
+
+// The comparison of two Memory objects is already defined by MemoryBase (returning bool).
+#define Vc_MEMORY_EXPRESSION_COMPARE(op_, name_)                                         \
+    struct MemoryExpression##name_ {                                                     \
+        template <typename A, typename B>                                                \
+        Vc_INTRINSIC auto operator()(const A &a, const B &b) const -> decltype(a op_ b)  \
+        {                                                                                \
+            return a op_ b;                                                              \
+        }                                                                                \
+    };                                                                                   \
+    template <typename L, typename R>                                                    \
+    Vc_INTRINSIC enable_if<!(is_memory<L>::value && is_memory<R>::value),                \
+                           memory_expression_t<MemoryExpression##name_, L, R>>           \
+    operator op_(const L &l, const R &r)                                                 \
+    {                                                                                    \
+        return make_memory_expression<MemoryExpression##name_>(l, r);                    \
+    }
+Vc_MEMORY_EXPRESSION_COMPARE(==, Equal);
+Vc_MEMORY_EXPRESSION_COMPARE(!=, NotEqual);
+Vc_MEMORY_EXPRESSION_COMPARE(<, Less);
+Vc_MEMORY_EXPRESSION_COMPARE(<=, LessEqual);
+Vc_MEMORY_EXPRESSION_COMPARE(>, Greater);
+Vc_MEMORY_EXPRESSION_COMPARE(>=, GreaterEqual);
+#undef Vc_MEMORY_EXPRESSION_COMPARE
+
+struct MemoryExpressionNegate {
+    template <typename A> Vc_INTRINSIC A operator()(const A &a) const { return -a; }
+};
+template <typename E>
+Vc_INTRINSIC memory_expression_t<MemoryExpressionNegate, E> operator-(const E &e)
+{
+    return make_memory_expression<MemoryExpressionNegate>(e);
+}
+
+// assignMemoryExpression {{{1
+struct MemoryExpressionAssign {
+    template <typename R, typename V>
+    Vc_INTRINSIC void operator()(R &&dst, const V &x) const
+    {
+        dst = x;
+    }
+};
+#define Vc_MEMORY_EXPRESSION_ASSIGN(op_, name_)                                          \
+    struct MemoryExpression##name_##Assign {                                             \
+        template <typename R, typename V>                                                \
+        Vc_INTRINSIC void operator()(R &&dst, const V &x) const                          \
+        {                                                                                \
+            dst op_##= x;                                                                \
+        }                                                                                \
+    };
+Vc_MEMORY_EXPRESSION_ASSIGN(+, Plus);
+Vc_MEMORY_EXPRESSION_ASSIGN(-, Minus);
+Vc_MEMORY_EXPRESSION_ASSIGN(*, Multiplies);
+Vc_MEMORY_EXPRESSION_ASSIGN(/, Divides);
+#undef Vc_MEMORY_EXPRESSION_ASSIGN
+
+/**\internal
+ * Evaluates \p e for all vectors of \p dst and combines the results with \p dst via \p
+ * op. The loop is unrolled by four, so that four independent evaluations of the
+ * expression can be interleaved.
+ */
+template <typename Op, typename V, typename Parent, int Dimension, typename RowMemory,
+          typename E>
+inline void assignMemoryExpression(MemoryBase<V, Parent, Dimension, RowMemory> &dst,
+                                   const E &e, Op op)
+{
+    const std::size_t n = dst.vectorsCount();
+    assert(e.hasVectorsCount(n));
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const V r0 = e(i + 0);
+        const V r1 = e(i + 1);
+        const V r2 = e(i + 2);
+        const V r3 = e(i + 3);
+        op(dst.vector(i + 0), r0);
+        op(dst.vector(i + 1), r1);
+        op(dst.vector(i + 2), r2);
+        op(dst.vector(i + 3), r3);
+    }
+    for (; i < n; ++i) {
+        op(dst.vector(i), V(e(i)));
+    }
+}
+}  // namespace Common
+
+using Common::MemoryExpression;
+
+// math functions {{{1
+// The functions are declared in namespace Vc, next to their Vector overloads, rather than
+// in Common, where they would hide the scalar overloads from unqualified lookup.
+#define Vc_MEMORY_EXPRESSION_FUNCTION(name_)                                             \
+    namespace Common                                                                     \
+    {                                                                                    \
+    struct MemoryExpression_##name_ {                                                    \
+        template <typename A>                                                            \
+        Vc_INTRINSIC auto operator()(const A &a) const -> decltype(Vc::name_(a))         \
+        {                                                                                \
+            return Vc::name_(a);                                                         \
+        }                                                                                \
+    };                                                                                   \
+    }                                                                                    \
+    template <typename E>                                                                \
+    Vc_INTRINSIC enable_if<Common::is_memory_or_expression<E>::value,                   \
+                           Common::memory_expression_t<Common::MemoryExpression_##name_, \
+                                                       E>>                               \
+    name_(const E &e)                                                                    \
+    {                                                                                    \
+        return Common::make_memory_expression<Common::MemoryExpression_##name_>(e);      \
+    }
+Vc_MEMORY_EXPRESSION_FUNCTION(sqrt);
+Vc_MEMORY_EXPRESSION_FUNCTION(rsqrt);
+Vc_MEMORY_EXPRESSION_FUNCTION(reciprocal);
+Vc_MEMORY_EXPRESSION_FUNCTION(abs);
+Vc_MEMORY_EXPRESSION_FUNCTION(exp);
+Vc_MEMORY_EXPRESSION_FUNCTION(log);
+Vc_MEMORY_EXPRESSION_FUNCTION(log2);
+Vc_MEMORY_EXPRESSION_FUNCTION(log10);
+Vc_MEMORY_EXPRESSION_FUNCTION(sin);
+Vc_MEMORY_EXPRESSION_FUNCTION(cos);
+Vc_MEMORY_EXPRESSION_FUNCTION(floor);
+Vc_MEMORY_EXPRESSION_FUNCTION(ceil);
+Vc_MEMORY_EXPRESSION_FUNCTION(round);
+#undef Vc_MEMORY_EXPRESSION_FUNCTION
+
+#define Vc_MEMORY_EXPRESSION_FUNCTION2(name_)                                            \
+    namespace Common                                                                     \
+    {                                                                                    \
+    struct MemoryExpression_##name_ {                                                    \
+        template <typename A, typename B>                                                \
+        Vc_INTRINSIC auto operator()(const A &a, const B &b) const                       \
+            -> decltype(Vc::name_(a, b))                                                 \
+        {                                                                                \
+            return Vc::name_(a, b);                                                      \
+        }                                                                                \
+    };                                                                                   \
+    }                                                                                    \
+    template <typename L, typename R>                                                    \
+    Vc_INTRINSIC Common::memory_expression_t<Common::MemoryExpression_##name_, L, R>     \
+    name_(const L &l, const R &r)                                                        \
+    {                                                                                    \
+        return Common::make_memory_expression<Common::MemoryExpression_##name_>(l, r);   \
+    }
+Vc_MEMORY_EXPRESSION_FUNCTION2(min);
+Vc_MEMORY_EXPRESSION_FUNCTION2(max);
+#undef Vc_MEMORY_EXPRESSION_FUNCTION2
+
+// where {{{1
+namespace Common
+{
+struct MemoryExpressionWhere {
+    template <typename M, typename A>
+    Vc_INTRINSIC A operator()(const M &mask, const A &a, const A &b) const
+    {
+        return iif(mask, a, b);
+    }
+};
+}  // namespace Common
+
+/**
+ * \ingroup Containers
+ * \headerfile memory.h <Vc/Memory>
+ *
+ * Returns a Memory expression that selects the entries of \p a where \p condition is
+ * \c true and the entries of \p b otherwise. \p condition must be a Memory expression
+ * with a mask result, such as a comparison. \p a and \p b may be Memory objects,
+ * expressions, or scalars.
+ */
+template <typename C, typename A, typename B>
+Vc_INTRINSIC
+    enable_if<Common::is_memory_expression<C>::value,
+              Common::memory_expression_t<Common::MemoryExpressionWhere, C, A, B>>
+    where(const C &condition, const A &a, const B &b)
+{
+    return Common::make_memory_expression<Common::MemoryExpressionWhere>(condition, a, b);
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_MEMORYEXPRESSION_H_
+
+// vim: foldmethod=marker
@@ -28,6 +28,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_MEMORYFWD_H_
 #define VC_COMMON_MEMORYFWD_H_
 
+#include <type_traits>
+
 namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
@@ -38,6 +40,14 @@ class Memory;
 
 template <typename V, typename Parent, int Dimension, typename RowMemory>
 class MemoryBase;
+
+template <typename V, typename F, typename... Operands> class MemoryExpression;
+
+template <typename T> struct is_memory_expression : public std::false_type {
+};
+template <typename V, typename F, typename... Operands>
+struct is_memory_expression<MemoryExpression<V, F, Operands...>> : public std::true_type {
+};
 }  // namespace Common
 
 using Common::Memory;
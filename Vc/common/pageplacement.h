@@ -0,0 +1,232 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_PAGEPLACEMENT_H_
+#define VC_COMMON_PAGEPLACEMENT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#if defined __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined _WIN32 || defined _WIN64
+#include <malloc.h>
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**\internal
+ * The page sizes the allocation functions assume. 4 KiB is the minimum page size on x86
+ * and 2 MiB the size of the huge pages that Linux uses for transparent huge pages.
+ */
+constexpr std::size_t SmallPageSize = 4096;
+constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+// The functions below are hints to the operating system. They are no-ops where the
+// system does not support them or refuses the request, e.g. on a kernel without NUMA
+// support or in a container that forbids mbind. The ranges must consist of whole pages.
+
+/**\internal
+ * Asks the kernel to back [\p p, \p p + \p bytes) with transparent huge pages.
+ */
+inline void advise_huge_pages(void *p, std::size_t bytes)
+{
+#if defined __linux__ && defined MADV_HUGEPAGE
+    madvise(p, bytes, MADV_HUGEPAGE);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+#if defined __linux__ && defined SYS_mbind && defined SYS_get_mempolicy
+/**\internal
+ * A NUMA node mask as expected by the mbind and get_mempolicy system calls. The constants
+ * are those of <numaif.h>, which is only available with libnuma.
+ */
+struct NumaNodeMask {
+    static constexpr int Interleave = 3;     // MPOL_INTERLEAVE
+    static constexpr int Preferred = 1;      // MPOL_PREFERRED
+    static constexpr int MemsAllowed = 1 << 2;  // MPOL_F_MEMS_ALLOWED
+    static constexpr std::size_t Bits = 1024;
+    static constexpr std::size_t WordBits = 8 * sizeof(unsigned long);
+
+    unsigned long bits[Bits / WordBits] = {};
+
+    void set(unsigned node)
+    {
+        if (node < Bits) {
+            bits[node / WordBits] |= 1ul << (node % WordBits);
+        }
+    }
+
+    // the kernel ignores the last bit of the mask passed to mbind
+    void bind(void *p, std::size_t bytes, int mode) const
+    {
+        syscall(SYS_mbind, p, bytes, mode, bits, Bits + 1, 0u);
+    }
+};
+#endif
+
+/**\internal
+ * Distributes the pages of [\p p, \p p + \p bytes) round-robin over all NUMA nodes the
+ * process may allocate from. Pages that were touched before are not moved.
+ */
+inline void interleave_pages(void *p, std::size_t bytes)
+{
+#if defined __linux__ && defined SYS_mbind && defined SYS_get_mempolicy
+    NumaNodeMask allowed;
+    int mode = 0;
+    if (0 == syscall(SYS_get_mempolicy, &mode, allowed.bits, NumaNodeMask::Bits, nullptr,
+                     NumaNodeMask::MemsAllowed)) {
+        allowed.bind(p, bytes, NumaNodeMask::Interleave);
+    }
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+/**\internal
+ * Places the pages of [\p p, \p p + \p bytes) on the NUMA node of the calling thread (if
+ * it has free memory), independent of the thread that touches them first.
+ */
+inline void bind_pages_to_current_node(void *p, std::size_t bytes)
+{
+#if defined __linux__ && defined SYS_mbind && defined SYS_getcpu
+    unsigned cpu = 0, node = 0;
+    if (0 == syscall(SYS_getcpu, &cpu, &node, nullptr)) {
+        NumaNodeMask mask;
+        mask.set(node);
+        mask.bind(p, bytes, NumaNodeMask::Preferred);
+    }
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+/**\internal
+ * Returns \p bytes rounded up to whole pages of \p pageSize.
+ */
+constexpr std::size_t page_rounded(std::size_t bytes, std::size_t pageSize)
+{
+    return (bytes + pageSize - 1) / pageSize * pageSize;
+}
+
+/**\internal
+ * Allocates \p bytes (a multiple of SmallPageSize) of page-aligned memory directly from
+ * the operating system, without touching it. Returns \c nullptr on failure.
+ *
+ * If \p huge is \c true, \p bytes must be a multiple of HugePageSize and the memory is
+ * aligned to HugePageSize. With \p explicitHuge the memory is taken from the pool of
+ * preallocated huge pages (`MAP_HUGETLB`); if the pool is exhausted, transparent huge
+ * pages are requested instead.
+ *
+ * Release the memory with release_pages, passing the same size.
+ */
+inline void *map_pages(std::size_t bytes, bool huge, bool explicitHuge)
+{
+#if defined __linux__
+    constexpr int Protection = PROT_READ | PROT_WRITE;
+    constexpr int Flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_HUGETLB
+    if (huge && explicitHuge) {
+#ifdef MAP_HUGE_2MB
+        constexpr int HugeFlags = MAP_HUGETLB | MAP_HUGE_2MB;
+#else
+        constexpr int HugeFlags = MAP_HUGETLB;
+#endif
+        void *p = mmap(nullptr, bytes, Protection, Flags | HugeFlags, -1, 0);
+        if (p != MAP_FAILED) {
+            return p;
+        }
+    }
+#endif
+    if (!huge) {
+        void *p = mmap(nullptr, bytes, Protection, Flags, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+    // map one huge page more than requested and unmap the unaligned ends
+    char *p = static_cast<char *>(
+        mmap(nullptr, bytes + HugePageSize, Protection, Flags, -1, 0));
+    if (p == MAP_FAILED) {
+        return nullptr;
+    }
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(p) % HugePageSize;
+    const std::size_t head = (HugePageSize - misalignment) % HugePageSize;
+    if (head > 0) {
+        munmap(p, head);
+    }
+    munmap(p + head + bytes, HugePageSize - head);
+    advise_huge_pages(p + head, bytes);
+    return p + head;
+#else
+    (void)explicitHuge;
+    const std::size_t alignment = huge ? HugePageSize : SmallPageSize;
+#if defined _WIN32 || defined _WIN64
+#ifdef __GNUC__
+    return __mingw_aligned_malloc(bytes, alignment);
+#else
+    return _aligned_malloc(bytes, alignment);
+#endif
+#else
+    void *p = nullptr;
+    return 0 == posix_memalign(&p, alignment, bytes) ? p : nullptr;
+#endif
+#endif
+}
+
+/**\internal
+ * Releases memory allocated with map_pages.
+ */
+inline void release_pages(void *p, std::size_t bytes)
+{
+#if defined __linux__
+    munmap(p, bytes);
+#elif defined _WIN32 || defined _WIN64
+    (void)bytes;
+#ifdef __GNUC__
+    __mingw_aligned_free(p);
+#else
+    _aligned_free(p);
+#endif
+#else
+    (void)bytes;
+    std::free(p);
+#endif
+}
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_PAGEPLACEMENT_H_
@@ -0,0 +1,187 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_PARALLEL_ALGORITHMS_H_
+#define VC_COMMON_PARALLEL_ALGORITHMS_H_
+
+#include <cstdint>
+#include <iterator>
+#include "algorithms.h"
+#include "threadpool.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * Tag type selecting the multi-threaded overloads of the algorithms.
+ *
+ * \see Parallel
+ */
+struct ParallelTag {
+    constexpr ParallelTag(unsigned int threads = 0) : maxThreads(threads) {}
+    /// Returns a tag that limits the number of threads to \p threads.
+    constexpr ParallelTag operator()(unsigned int threads) const { return {threads}; }
+
+    /// The maximum number of threads to use. 0 uses all threads of the pool.
+    unsigned int maxThreads;
+};
+
+/**
+ * \ingroup Utilities
+ * Use this object as first argument to Vc::simd_for_each and Vc::simd_for_each_n to
+ * distribute the work over the threads of Vc's thread pool. `Vc::Parallel(n)` limits the
+ * algorithm to \p n threads.
+ */
+constexpr ParallelTag Parallel;
+
+namespace Detail
+{
+///\internal calls \p f for every V in [first, last); the distance must be a multiple of V::Size
+template <typename V, typename It, typename F>
+Vc_INTRINSIC void simd_for_each_apply(It first, It last, F &f, std::true_type)
+{
+    for (; first < last; first += V::Size) {
+        V tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        f(tmp);
+    }
+}
+template <typename V, typename It, typename F>
+Vc_INTRINSIC void simd_for_each_apply(It first, It last, F &f, std::false_type)
+{
+    for (; first < last; first += V::Size) {
+        V tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        f(tmp);
+        store_interleaved(tmp, std::addressof(*first));
+    }
+}
+template <typename V, typename It, typename F>
+Vc_INTRINSIC void simd_for_each_apply(It first, It last, F &f)
+{
+    simd_for_each_apply<V>(
+        first, last, f,
+        std::integral_constant<
+            bool, Traits::is_functor_argument_immutable<F, V>::value>());
+}
+
+constexpr std::size_t gcd(std::size_t a, std::size_t b) { return b == 0 ? a : gcd(b, a % b); }
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile parallel_algorithms.h <Vc/algorithm>
+ *
+ * Multi-threaded variant of Vc::simd_for_each.
+ *
+ * The range is split into chunks of whole vectors that start on cache line boundaries.
+ * The chunks are processed by the threads of `Vc::Common::ThreadPool::global()` with
+ * work stealing. Only the elements before the first cache line boundary and the elements
+ * after the last whole vector are processed with `simdize<T, 1>`, by the calling thread.
+ *
+ * \p f is called concurrently from several threads and therefore must be safe to call
+ * concurrently. Unlike the serial overload, the function object is not returned.
+ *
+ * \code
+ * Vc::simd_for_each(Vc::Parallel, data.begin(), data.end(), [&](auto &v) { v *= factor; });
+ * \endcode
+ */
+template <typename RandomIt, typename UnaryFunction,
+          typename ValueType = typename std::iterator_traits<RandomIt>::value_type>
+inline void simd_for_each(ParallelTag policy, RandomIt first, RandomIt last,
+                          UnaryFunction f)
+{
+    static_assert(
+        std::is_base_of<std::random_access_iterator_tag,
+                        typename std::iterator_traits<RandomIt>::iterator_category>::value,
+        "The parallel simd_for_each requires random access iterators.");
+    using V = simdize<ValueType>;
+    using V1 = simdize<ValueType, 1>;
+    // chunks start on a cache line boundary and contain whole vectors
+    constexpr std::size_t CacheLine = 64;
+    constexpr std::size_t LineElements =
+        CacheLine % sizeof(ValueType) == 0 ? CacheLine / sizeof(ValueType) : 1;
+    constexpr std::size_t Granularity =
+        V::Size / Detail::gcd(V::Size, LineElements) * LineElements;
+    // the smallest chunk worth handing to another thread
+    constexpr std::size_t MinChunk =
+        (16384 / sizeof(ValueType) + Granularity - 1) / Granularity * Granularity;
+
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return;
+    }
+
+    // scalar prologue up to the first cache line boundary
+    std::size_t prologue = 0;
+    if (LineElements > 1) {
+        const auto addr = reinterpret_cast<std::uintptr_t>(std::addressof(*first));
+        if (addr % sizeof(ValueType) == 0) {
+            prologue = (CacheLine - addr % CacheLine) % CacheLine / sizeof(ValueType);
+        }
+    }
+    prologue = std::min(prologue, n);
+    const std::size_t body = (n - prologue) / V::Size * V::Size;
+    const RandomIt bodyFirst = first + prologue;
+    const RandomIt bodyLast = bodyFirst + body;
+
+    Detail::simd_for_each_apply<V1>(first, bodyFirst, f);
+
+    auto &pool = Common::ThreadPool::global();
+    const std::size_t threads =
+        policy.maxThreads == 0 ? pool.size() : std::min(policy.maxThreads, pool.size());
+    std::size_t chunk = (body / (8 * threads) + Granularity - 1) / Granularity * Granularity;
+    chunk = std::max(chunk, MinChunk);
+    const std::size_t nChunks = (body + chunk - 1) / chunk;
+    pool.parallel_for(nChunks,
+                      [&](std::size_t i) {
+                          const RandomIt b = bodyFirst + i * chunk;
+                          const RandomIt e = i + 1 == nChunks ? bodyLast : b + chunk;
+                          Detail::simd_for_each_apply<V>(b, e, f);
+                      },
+                      unsigned(threads));
+
+    Detail::simd_for_each_apply<V1>(bodyLast, last, f);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile parallel_algorithms.h <Vc/algorithm>
+ *
+ * Multi-threaded variant of Vc::simd_for_each_n. See the parallel Vc::simd_for_each for
+ * details.
+ */
+template <typename RandomIt, typename UnaryFunction>
+inline void simd_for_each_n(ParallelTag policy, RandomIt first, std::size_t count,
+                            UnaryFunction f)
+{
+    simd_for_each(policy, first, first + count, std::move(f));
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_PARALLEL_ALGORITHMS_H_
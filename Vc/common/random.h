@@ -0,0 +1,480 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_RANDOM_H_
+#define VC_COMMON_RANDOM_H_
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "../vector.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// splitmix64 {{{1
+///\internal the generator recommended for seeding the xoshiro family
+inline std::uint64_t splitmix64(std::uint64_t &x)
+{
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// rotl {{{1
+template <int N>
+Vc_INTRINSIC fixed_size_simd<unsigned int, N> rotl(const fixed_size_simd<unsigned int, N> &x,
+                                                   int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+// mulhilo {{{1
+/**\internal
+ * Calculates the full 64-bit product of \p a and the constant \p m. The upper 32 bits are
+ * returned in \p hi and the lower 32 bits in \p lo.
+ */
+template <int N>
+Vc_INTRINSIC void mulhilo(const fixed_size_simd<unsigned int, N> &a, unsigned int m,
+                          fixed_size_simd<unsigned int, N> &hi,
+                          fixed_size_simd<unsigned int, N> &lo)
+{
+    using U = fixed_size_simd<unsigned int, N>;
+    const U al = a & 0xffffu;
+    const U ah = a >> 16;
+    const unsigned int ml = m & 0xffffu;
+    const unsigned int mh = m >> 16;
+    const U t = al * ml;
+    const U u = ah * ml + (t >> 16);
+    const U w = al * mh + (u & 0xffffu);
+    hi = ah * mh + (u >> 16) + (w >> 16);
+    lo = a * m;
+}
+
+template <int N>
+Vc_INTRINSIC fixed_size_simd<unsigned int, N> mulhi(const fixed_size_simd<unsigned int, N> &a,
+                                                    unsigned int m)
+{
+    fixed_size_simd<unsigned int, N> hi, lo;
+    mulhilo(a, m, hi, lo);
+    return hi;
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \name Random Number Generation
+ */
+//@{
+// Xoshiro128PlusPlus {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random.h <Vc/random>
+ *
+ * \p N independent xoshiro128++ generators (Blackman & Vigna), one per vector lane.
+ *
+ * The generator has 128 bits of state per lane and a period of \f$2^{128}-1\f$. Lane \c i
+ * starts \f$i\cdot2^{64}\f$ steps after lane 0, so the lanes never overlap.
+ *
+ * \tparam N The number of 32-bit outputs per call.
+ */
+template <int N> class Xoshiro128PlusPlus
+{
+public:
+    /// The type returned from operator().
+    using result_type = fixed_size_simd<unsigned int, N>;
+
+    /// Seeds the generator with \p s. See seed().
+    explicit Xoshiro128PlusPlus(std::uint64_t s = 0) { seed(s); }
+
+    /**
+     * Initializes lane 0 from \p s via splitmix64 and derives the remaining lanes from
+     * lane 0 with the jump polynomial.
+     */
+    void seed(std::uint64_t s)
+    {
+        const std::uint64_t a = Detail::splitmix64(s);
+        const std::uint64_t b = Detail::splitmix64(s);
+        m_s[0] = static_cast<unsigned int>(a);
+        m_s[1] = static_cast<unsigned int>(a >> 32);
+        m_s[2] = static_cast<unsigned int>(b);
+        m_s[3] = static_cast<unsigned int>(b >> 32);
+        const result_type lane = result_type([](int i) { return i; });
+        for (int i = 1; i < N; ++i) {
+            result_type s0 = m_s[0], s1 = m_s[1], s2 = m_s[2], s3 = m_s[3];
+            jumpOnce();
+            const auto keep = lane < unsigned(i);
+            m_s[0] = iif(keep, s0, m_s[0]);
+            m_s[1] = iif(keep, s1, m_s[1]);
+            m_s[2] = iif(keep, s2, m_s[2]);
+            m_s[3] = iif(keep, s3, m_s[3]);
+        }
+    }
+
+    /// Returns the next 32 random bits of every lane.
+    Vc_INTRINSIC result_type operator()()
+    {
+        const result_type result = Detail::rotl(m_s[0] + m_s[3], 7) + m_s[0];
+        const result_type t = m_s[1] << 9;
+        m_s[2] ^= m_s[0];
+        m_s[3] ^= m_s[1];
+        m_s[1] ^= m_s[2];
+        m_s[0] ^= m_s[3];
+        m_s[2] ^= t;
+        m_s[3] = Detail::rotl(m_s[3], 11);
+        return result;
+    }
+
+    /**
+     * Advances every lane by \f$N\cdot2^{64}\f$ steps. Thus, starting from one seed,
+     * every call to jump() produces a generator whose lanes do not overlap with any
+     * lane of the previous generators. Use it to hand one generator to every thread.
+     */
+    void jump()
+    {
+        for (int i = 0; i < N; ++i) {
+            jumpOnce();
+        }
+    }
+
+private:
+    // advances every lane by 2^64 steps
+    void jumpOnce()
+    {
+        constexpr unsigned int JumpPolynomial[4] = {0x8764000b, 0xf542d2d3, 0x6fa035c3,
+                                                    0x77f2db5b};
+        result_type s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (unsigned int word : JumpPolynomial) {
+            for (int b = 0; b < 32; ++b) {
+                if (word & (1u << b)) {
+                    s0 ^= m_s[0];
+                    s1 ^= m_s[1];
+                    s2 ^= m_s[2];
+                    s3 ^= m_s[3];
+                }
+                operator()();
+            }
+        }
+        m_s[0] = s0;
+        m_s[1] = s1;
+        m_s[2] = s2;
+        m_s[3] = s3;
+    }
+
+    result_type m_s[4];
+};
+
+// Philox4x32 {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random.h <Vc/random>
+ *
+ * \p N independent Philox4x32-10 generators (Salmon et al., "Parallel random numbers:
+ * as easy as 1, 2, 3"), one per vector lane.
+ *
+ * Philox is counter based: the output is a bijection of a 128-bit counter under a 64-bit
+ * key (the seed). Every block of four outputs per lane uses a new counter. Lane \c i
+ * uses the counters \f$i, i + N, i + 2N, \ldots\f$ of the current stream. It is slower
+ * than Xoshiro128PlusPlus but has no state to derive and passes BigCrush with large
+ * margins.
+ *
+ * \tparam N The number of 32-bit outputs per call.
+ */
+template <int N> class Philox4x32
+{
+public:
+    /// The type returned from operator().
+    using result_type = fixed_size_simd<unsigned int, N>;
+
+    /// Seeds the generator with \p s. See seed().
+    explicit Philox4x32(std::uint64_t s = 0) { seed(s); }
+
+    /// Uses \p s as key and starts at the beginning of stream 0.
+    void seed(std::uint64_t s)
+    {
+        m_key[0] = static_cast<unsigned int>(s);
+        m_key[1] = static_cast<unsigned int>(s >> 32);
+        m_stream = 0;
+        restart();
+    }
+
+    /// Returns the next 32 random bits of every lane.
+    Vc_INTRINSIC result_type operator()()
+    {
+        if (m_index == 4) {
+            generateBlock();
+        }
+        return m_block[m_index++];
+    }
+
+    /**
+     * Switches to the beginning of the next stream. The \f$2^{64}\f$ streams use disjoint
+     * counters and thus never overlap. Use it to hand one generator to every thread.
+     */
+    void jump()
+    {
+        ++m_stream;
+        restart();
+    }
+
+    /// Returns the 128-bit output of Philox4x32-10 for the given \p counter and \p key.
+    static void block(result_type counter[4], const unsigned int key[2])
+    {
+        unsigned int k0 = key[0], k1 = key[1];
+        for (int round = 0; round < 10; ++round) {
+            result_type hi0, lo0, hi1, lo1;
+            Detail::mulhilo(counter[0], 0xd2511f53u, hi0, lo0);
+            Detail::mulhilo(counter[2], 0xcd9e8d57u, hi1, lo1);
+            counter[0] = hi1 ^ counter[1] ^ k0;
+            counter[1] = lo1;
+            counter[2] = hi0 ^ counter[3] ^ k1;
+            counter[3] = lo0;
+            k0 += 0x9e3779b9u;
+            k1 += 0xbb67ae85u;
+        }
+    }
+
+private:
+    void restart()
+    {
+        m_counter[0] = result_type([](int i) { return i; });
+        m_counter[1] = 0;
+        m_counter[2] = static_cast<unsigned int>(m_stream);
+        m_counter[3] = static_cast<unsigned int>(m_stream >> 32);
+        m_index = 4;
+    }
+
+    void generateBlock()
+    {
+        for (int i = 0; i < 4; ++i) {
+            m_block[i] = m_counter[i];
+        }
+        block(m_block, m_key);
+        m_counter[0] += unsigned(N);
+        m_counter[1] = iif(m_counter[0] < unsigned(N), m_counter[1] + 1u, m_counter[1]);
+        m_index = 0;
+    }
+
+    result_type m_counter[4];
+    result_type m_block[4];
+    unsigned int m_key[2];
+    std::uint64_t m_stream;
+    int m_index;
+};
+
+// RandomEngine {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random.h <Vc/random>
+ *
+ * A random number engine producing one vector of random bits per call, for use with
+ * UniformDistribution and NormalDistribution.
+ *
+ * In contrast to Vector::Random() the engine owns its state. Thus every thread can use
+ * its own engine without synchronization, and the sequence is reproducible from the
+ * seed:
+ * \code
+ * Vc::RandomEngine<Vc::float_v> engine(seed);
+ * for (int t = 0; t < threadId; ++t) {
+ *   engine.jump();  // independent stream per thread
+ * }
+ * Vc::UniformDistribution<Vc::float_v> uniform;
+ * Vc::float_v x = uniform(engine);  // in [0, 1)
+ * \endcode
+ *
+ * \tparam V The vector type that the distributions should produce. The engine produces
+ *           V::Size lanes of 32 random bits per call.
+ * \tparam Generator Xoshiro128PlusPlus (default, fastest) or Philox4x32.
+ */
+template <typename V, template <int> class Generator = Xoshiro128PlusPlus>
+class RandomEngine : public Generator<int(V::Size)>
+{
+    using Base = Generator<int(V::Size)>;
+
+public:
+    /// The vector type the engine is intended for.
+    using value_type = V;
+    using typename Base::result_type;
+
+    /// Constructs the engine from the given seed.
+    explicit RandomEngine(std::uint64_t seed = 0) : Base(seed) {}
+};
+
+namespace Detail
+{
+// uniform01 {{{1
+template <typename V, typename E>
+Vc_INTRINSIC V uniform01(E &engine, float)
+{
+    using I = fixed_size_simd<int, V::Size>;
+    return simd_cast<V>(simd_cast<I>(engine() >> 8)) * V(1.f / 16777216.f);
+}
+template <typename V, typename E>
+Vc_INTRINSIC V uniform01(E &engine, double)
+{
+    using I = fixed_size_simd<int, V::Size>;
+    const V hi = simd_cast<V>(simd_cast<I>(engine() >> 5));
+    const V lo = simd_cast<V>(simd_cast<I>(engine() >> 6));
+    return (hi * V(67108864.) + lo) * V(1. / 9007199254740992.);
+}
+//}}}1
+}  // namespace Detail
+
+// UniformDistribution {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random.h <Vc/random>
+ *
+ * Produces vectors of uniformly distributed values.
+ *
+ * For floating-point \p V the values are in \f$[a, b)\f$, with 24 (float) or 53
+ * (double) random bits. For integral \p V the values are in \f$[a, b]\f$. The range is
+ * mapped with a multiply-shift instead of rejection sampling, which biases the result
+ * by less than \f$(b - a + 1)\cdot2^{-32}\f$.
+ */
+template <typename V> class UniformDistribution
+{
+    using T = typename V::EntryType;
+
+public:
+    using result_type = V;
+
+    /// Defaults to [0, 1) for floating-point and to the full range for integral types.
+    UniformDistribution()
+        : UniformDistribution(std::is_floating_point<T>::value
+                                  ? T(0)
+                                  : std::numeric_limits<T>::min(),
+                              std::is_floating_point<T>::value
+                                  ? T(1)
+                                  : std::numeric_limits<T>::max())
+    {
+    }
+    UniformDistribution(T a, T b) : m_a(a), m_b(b) {}
+
+    T a() const { return m_a; }
+    T b() const { return m_b; }
+
+    /// Returns the next vector of random values.
+    template <typename Engine> Vc_INTRINSIC V operator()(Engine &engine) const
+    {
+        return generate(engine, std::is_floating_point<T>(),
+                        std::integral_constant<bool, (sizeof(T) < 4)>());
+    }
+
+private:
+    template <typename Engine, typename Small>
+    Vc_INTRINSIC V generate(Engine &engine, std::true_type, Small) const
+    {
+        return V(m_a) + V(m_b - m_a) * Detail::uniform01<V>(engine, T());
+    }
+    // 32-bit integers
+    template <typename Engine>
+    Vc_INTRINSIC V generate(Engine &engine, std::false_type, std::false_type) const
+    {
+        using U = fixed_size_simd<unsigned int, V::Size>;
+        const unsigned int range = static_cast<unsigned int>(m_b) - static_cast<unsigned int>(m_a) + 1u;
+        const U bits = engine();
+        const U offset = range == 0 ? bits : Detail::mulhi(bits, range);
+        return simd_cast<V>(offset + static_cast<unsigned int>(m_a));
+    }
+    // 16-bit integers
+    template <typename Engine>
+    Vc_INTRINSIC V generate(Engine &engine, std::false_type, std::true_type) const
+    {
+        using I = fixed_size_simd<int, V::Size>;
+        const unsigned int range = unsigned(int(m_b) - int(m_a) + 1);
+        const I offset = simd_cast<I>(Detail::mulhi(engine(), range));
+        return simd_cast<V>(offset + int(m_a));
+    }
+
+    T m_a, m_b;
+};
+
+// NormalDistribution {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile random.h <Vc/random>
+ *
+ * Produces vectors of normally distributed floating-point values.
+ *
+ * The implementation uses the Box-Muller transform. Every transform yields two vectors;
+ * the second one is returned from the next call.
+ */
+template <typename V> class NormalDistribution
+{
+    using T = typename V::EntryType;
+    static_assert(std::is_floating_point<T>::value,
+                  "NormalDistribution requires a floating-point vector type");
+
+public:
+    using result_type = V;
+
+    /// Constructs the distribution with mean \p mean and standard deviation \p stddev.
+    explicit NormalDistribution(T mean = 0, T stddev = 1) : m_mean(mean), m_stddev(stddev)
+    {
+    }
+
+    T mean() const { return m_mean; }
+    T stddev() const { return m_stddev; }
+
+    /// Discards the cached second vector of the last transform.
+    void reset() { m_hasCached = false; }
+
+    /// Returns the next vector of random values.
+    template <typename Engine> V operator()(Engine &engine)
+    {
+        if (m_hasCached) {
+            m_hasCached = false;
+            return m_cached;
+        }
+        // 1 - u is in (0, 1], thus the log is finite
+        const V u1 = V(1) - Detail::uniform01<V>(engine, T());
+        const V u2 = Detail::uniform01<V>(engine, T());
+        const V r = Vc::sqrt(V(-2) * Vc::log(u1)) * m_stddev;
+        V s, c;
+        Vc::sincos(u2 * V(T(6.283185307179586476925286766559)), &s, &c);
+        m_cached = r * s + m_mean;
+        m_hasCached = true;
+        return r * c + m_mean;
+    }
+
+private:
+    V m_cached;
+    T m_mean, m_stddev;
+    bool m_hasCached = false;
+};
+//}}}1
+//@}
+}  // namespace Vc
+
+#endif  // VC_COMMON_RANDOM_H_
+
+// vim: foldmethod=marker
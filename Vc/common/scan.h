@@ -0,0 +1,518 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_SCAN_H_
+#define VC_COMMON_SCAN_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "../vector.h"
+#include "parallel_algorithms.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ *
+ * Function object returning the smaller of its arguments. It accepts scalars and
+ * Vc::Vector objects and can thus be passed to the vectorized algorithms, e.g.
+ * `Vc::inclusive_scan(first, last, out, Vc::Minimum())` for a running minimum.
+ */
+struct Minimum {
+    template <typename T>
+    Vc_INTRINSIC enable_if<std::is_arithmetic<T>::value, T> operator()(T a, T b) const
+    {
+        return b < a ? b : a;
+    }
+    template <typename T, typename Abi>
+    Vc_INTRINSIC Vector<T, Abi> operator()(const Vector<T, Abi> &a,
+                                           const Vector<T, Abi> &b) const
+    {
+        return Vc::min(a, b);
+    }
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * Function object returning the larger of its arguments. It accepts scalars and
+ * Vc::Vector objects, see Minimum.
+ */
+struct Maximum {
+    template <typename T>
+    Vc_INTRINSIC enable_if<std::is_arithmetic<T>::value, T> operator()(T a, T b) const
+    {
+        return a < b ? b : a;
+    }
+    template <typename T, typename Abi>
+    Vc_INTRINSIC Vector<T, Abi> operator()(const Vector<T, Abi> &a,
+                                           const Vector<T, Abi> &b) const
+    {
+        return Vc::max(a, b);
+    }
+};
+
+namespace Detail
+{
+// scan operations {{{1
+struct ScanPlus {
+    template <typename A> Vc_INTRINSIC A operator()(const A &a, const A &b) const
+    {
+        return a + b;
+    }
+};
+struct ScanMultiplies {
+    template <typename A> Vc_INTRINSIC A operator()(const A &a, const A &b) const
+    {
+        return a * b;
+    }
+};
+
+/**\internal
+ * Replaces the standard function objects, which only accept scalars, with equivalents
+ * that also accept vectors. All other operations are passed through unchanged, including
+ * their state.
+ */
+template <typename Op> Vc_INTRINSIC Op scan_operation(Op op) { return op; }
+template <typename T> Vc_INTRINSIC ScanPlus scan_operation(std::plus<T>) { return {}; }
+template <typename T> Vc_INTRINSIC ScanMultiplies scan_operation(std::multiplies<T>)
+{
+    return {};
+}
+
+template <typename It>
+using contiguous_value_type = typename std::decay<decltype(*std::declval<It>())>::type;
+
+template <typename It, typename OutputIt>
+using enable_if_scannable =
+    enable_if<Traits::is_contiguous_iterator<OutputIt>::value,
+              enable_if_contiguous_range<It, OutputIt>>;
+
+// scan_vector {{{1
+/**\internal
+ * The inclusive scan of the entries of \p x. Sums use Vector::partialSum, other
+ * operations combine \p x with shifted copies of itself in log2(V::Size) steps, keeping
+ * the entries that have no predecessor at the respective distance.
+ */
+template <typename V> Vc_INTRINSIC V scan_vector(const V &x, ScanPlus)
+{
+    return x.partialSum();
+}
+template <typename V, typename Op> Vc_INTRINSIC V scan_vector(V x, Op op)
+{
+    using T = typename V::EntryType;
+    const V lane(Vc::IndexesFromZero);
+    for (std::size_t k = 1; k < V::Size; k <<= 1) {
+        x = iif(lane >= V(T(k)), V(op(x.shifted(-int(k)), x)), x);
+    }
+    return x;
+}
+
+// scan_range {{{1
+/**\internal
+ * Writes the scan of the \p n values at \p first, starting from \p carry, to \p out. The
+ * inclusive scan stores `carry op first[0] op ... op first[i]` to `out[i]`, the exclusive
+ * scan stores `carry op first[0] op ... op first[i - 1]`. \p out may be equal to \p
+ * first. Returns the combination of \p carry with all \p n values.
+ */
+template <typename V, typename Op>
+inline typename V::EntryType scan_range(const typename V::EntryType *first, std::size_t n,
+                                        typename V::EntryType *out, Op op,
+                                        typename V::EntryType carry, bool exclusive)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = V::Size;
+    std::size_t i = 0;
+    if (n >= N) {
+        const V lane(Vc::IndexesFromZero);
+        V c = carry;
+        for (; i + N <= n; i += N) {
+            const V s = op(c, scan_vector(V(first + i, Vc::Unaligned), op));
+            if (exclusive) {
+                iif(lane == V::Zero(), c, s.shifted(-1)).store(out + i, Vc::Unaligned);
+            } else {
+                s.store(out + i, Vc::Unaligned);
+            }
+            c = s[N - 1];
+        }
+        carry = c[0];
+    }
+    for (; i < n; ++i) {
+        const T x = first[i];
+        const T next = op(carry, x);
+        out[i] = exclusive ? carry : next;
+        carry = next;
+    }
+    return carry;
+}
+
+/**\internal
+ * Combines the \p n > 0 values at \p first with \p op. The vectors are accumulated
+ * vertically, which reorders the operands and therefore requires \p op to be commutative.
+ */
+template <typename V, typename Op>
+inline typename V::EntryType reduce_range(const typename V::EntryType *first,
+                                          std::size_t n, Op op)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = V::Size;
+    T r = first[0];
+    std::size_t i = 1;
+    if (n >= N) {
+        V acc(first, Vc::Unaligned);
+        for (i = N; i + N <= n; i += N) {
+            acc = op(acc, V(first + i, Vc::Unaligned));
+        }
+        r = acc[0];
+        for (std::size_t j = 1; j < N; ++j) {
+            r = op(r, T(acc[j]));
+        }
+    }
+    for (; i < n; ++i) {
+        r = op(r, first[i]);
+    }
+    return r;
+}
+
+// parallel_scan_range {{{1
+/**\internal
+ * The multi-threaded variant of scan_range. The range is split into chunks. The first
+ * pass reduces every chunk but the last in parallel, a serial scan over the chunk results
+ * yields the carry of every chunk, and the second pass scans the chunks in parallel,
+ * starting from their carry. Small ranges are scanned serially.
+ */
+template <typename V, typename Op>
+inline void parallel_scan_range(ParallelTag policy, const typename V::EntryType *first,
+                                std::size_t n, typename V::EntryType *out, Op op,
+                                typename V::EntryType carry, bool exclusive)
+{
+    using T = typename V::EntryType;
+    // the smallest chunk worth handing to another thread; the range is read twice
+    constexpr std::size_t MinChunk =
+        (262144 / sizeof(T) + V::Size - 1) / V::Size * V::Size;
+
+    auto &pool = Common::ThreadPool::global();
+    const std::size_t threads =
+        policy.maxThreads == 0 ? pool.size() : std::min(policy.maxThreads, pool.size());
+    if (threads <= 1 || n < 2 * MinChunk) {
+        scan_range<V>(first, n, out, op, carry, exclusive);
+        return;
+    }
+    std::size_t chunk = (n / (4 * threads) + V::Size - 1) / V::Size * V::Size;
+    chunk = std::max(chunk, MinChunk);
+    const std::size_t nChunks = (n + chunk - 1) / chunk;
+
+    std::vector<T> carries(nChunks);
+    pool.parallel_for(nChunks - 1,
+                      [&](std::size_t i) {
+                          carries[i + 1] = reduce_range<V>(first + i * chunk, chunk, op);
+                      },
+                      unsigned(threads));
+    carries[0] = carry;
+    for (std::size_t i = 1; i < nChunks; ++i) {
+        carries[i] = op(carries[i - 1], carries[i]);
+    }
+    pool.parallel_for(nChunks,
+                      [&](std::size_t i) {
+                          const std::size_t offset = i * chunk;
+                          scan_range<V>(first + offset, std::min(chunk, n - offset),
+                                        out + offset, op, carries[i], exclusive);
+                      },
+                      unsigned(threads));
+}
+
+// scan {{{1
+template <typename ContiguousIt, typename OutputIt, typename Op>
+inline OutputIt inclusive_scan(ContiguousIt first, ContiguousIt last, OutputIt d_first,
+                               Op op)
+{
+    using T = contiguous_value_type<ContiguousIt>;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return d_first;
+    }
+    const T *in = std::addressof(*first);
+    T *out = std::addressof(*d_first);
+    out[0] = in[0];
+    scan_range<Vector<T>>(in + 1, n - 1, out + 1, op, in[0], false);
+    return d_first + n;
+}
+
+template <typename ContiguousIt, typename OutputIt, typename Op, typename T>
+inline OutputIt scan(ContiguousIt first, ContiguousIt last, OutputIt d_first, Op op,
+                     T init, bool exclusive)
+{
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return d_first;
+    }
+    scan_range<Vector<T>>(std::addressof(*first), n, std::addressof(*d_first), op, init,
+                          exclusive);
+    return d_first + n;
+}
+
+template <typename ContiguousIt, typename OutputIt, typename Op>
+inline OutputIt inclusive_scan(ParallelTag policy, ContiguousIt first, ContiguousIt last,
+                               OutputIt d_first, Op op)
+{
+    using T = contiguous_value_type<ContiguousIt>;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return d_first;
+    }
+    const T *in = std::addressof(*first);
+    T *out = std::addressof(*d_first);
+    const T carry = in[0];
+    out[0] = carry;
+    parallel_scan_range<Vector<T>>(policy, in + 1, n - 1, out + 1, op, carry, false);
+    return d_first + n;
+}
+
+template <typename ContiguousIt, typename OutputIt, typename Op, typename T>
+inline OutputIt scan(ParallelTag policy, ContiguousIt first, ContiguousIt last,
+                     OutputIt d_first, Op op, T init, bool exclusive)
+{
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return d_first;
+    }
+    parallel_scan_range<Vector<T>>(policy, std::addressof(*first), n,
+                                   std::addressof(*d_first), op, init, exclusive);
+    return d_first + n;
+}
+//}}}1
+}  // namespace Detail
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Vc variant of the `std::inclusive_scan` algorithm for contiguous ranges of arithmetic
+ * types.
+ *
+ * Writes `first[0] op first[1] op ... op first[i]` to `d_first[i]` and returns the end
+ * of the output range. Every vector of input is scanned in registers (with
+ * Vector::partialSum for sums) and then combined with the carry of the preceding
+ * vectors, so that the range is traversed only once.
+ *
+ * \p op must be associative and callable with two \c T as well as with two
+ * `Vc::Vector<T>` arguments. `std::plus<T>` (the default) and `std::multiplies<T>` are
+ * replaced with vectorizable equivalents; use Vc::Minimum or Vc::Maximum for running
+ * extrema.
+ *
+ * \p d_first may be equal to \p first, which scans the range in place. Other overlaps of
+ * the input and output ranges are not allowed.
+ *
+ * \code
+ * Vc::inclusive_scan(counts.begin(), counts.end(), offsets.begin());
+ * \endcode
+ */
+template <typename T, typename BinaryOperation>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> inclusive_scan(
+    const T *first, const T *last, T *d_first, BinaryOperation op)
+{
+    return Detail::inclusive_scan(first, last, d_first, Detail::scan_operation(op));
+}
+
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> inclusive_scan(
+    const T *first, const T *last, T *d_first)
+{
+    return Detail::inclusive_scan(first, last, d_first, Detail::ScanPlus());
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt,
+          typename BinaryOperation>
+inline Detail::enable_if_scannable<It<Ts...>, OutputIt> inclusive_scan(
+    It<Ts...> first, It<Ts...> last, OutputIt d_first, BinaryOperation op)
+{
+    return Detail::inclusive_scan(first, last, d_first, Detail::scan_operation(op));
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt>
+inline Detail::enable_if_scannable<It<Ts...>, OutputIt> inclusive_scan(It<Ts...> first,
+                                                                      It<Ts...> last,
+                                                                      OutputIt d_first)
+{
+    return Detail::inclusive_scan(first, last, d_first, Detail::ScanPlus());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Inclusive scan starting from \p init: writes `init op first[0] op ... op first[i]` to
+ * `d_first[i]`.
+ */
+template <typename T, typename BinaryOperation>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> inclusive_scan(
+    const T *first, const T *last, T *d_first, BinaryOperation op,
+    Detail::contiguous_value_type<const T *> init)
+{
+    return Detail::scan(first, last, d_first, Detail::scan_operation(op), init, false);
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt,
+          typename BinaryOperation>
+inline Detail::enable_if_scannable<It<Ts...>, OutputIt> inclusive_scan(
+    It<Ts...> first, It<Ts...> last, OutputIt d_first, BinaryOperation op,
+    Detail::contiguous_value_type<It<Ts...>> init)
+{
+    return Detail::scan(first, last, d_first, Detail::scan_operation(op), init, false);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Vc variant of the `std::exclusive_scan` algorithm for contiguous ranges of arithmetic
+ * types.
+ *
+ * Writes `init op first[0] op ... op first[i - 1]` to `d_first[i]` (thus `d_first[0] ==
+ * init`) and returns the end of the output range. See Vc::inclusive_scan for the
+ * requirements on \p op and the ranges.
+ *
+ * \code
+ * // CSR row offsets from the number of non-zeros per row
+ * Vc::exclusive_scan(nnz.begin(), nnz.end(), rowOffsets.begin(), 0);
+ * \endcode
+ */
+template <typename T, typename BinaryOperation>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> exclusive_scan(
+    const T *first, const T *last, T *d_first,
+    Detail::contiguous_value_type<const T *> init, BinaryOperation op)
+{
+    return Detail::scan(first, last, d_first, Detail::scan_operation(op), init, true);
+}
+
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> exclusive_scan(
+    const T *first, const T *last, T *d_first,
+    Detail::contiguous_value_type<const T *> init)
+{
+    return Detail::scan(first, last, d_first, Detail::ScanPlus(), init, true);
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt,
+          typename BinaryOperation>
+inline Detail::enable_if_scannable<It<Ts...>, OutputIt> exclusive_scan(
+    It<Ts...> first, It<Ts...> last, OutputIt d_first,
+    Detail::contiguous_value_type<It<Ts...>> init, BinaryOperation op)
+{
+    return Detail::scan(first, last, d_first, Detail::scan_operation(op), init, true);
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt>
+inline Detail::enable_if_scannable<It<Ts...>, OutputIt> exclusive_scan(
+    It<Ts...> first, It<Ts...> last, OutputIt d_first,
+    Detail::contiguous_value_type<It<Ts...>> init)
+{
+    return Detail::scan(first, last, d_first, Detail::ScanPlus(), init, true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Multi-threaded variant of Vc::inclusive_scan.
+ *
+ * The range is split into chunks for the threads of `Vc::Common::ThreadPool::global()`.
+ * A first pass reduces the chunks in parallel and a second pass scans them in parallel,
+ * each starting from the combination of all preceding chunks. The input is therefore
+ * read twice; ranges smaller than a few hundred KiB are scanned serially.
+ *
+ * In addition to the requirements of the serial overload, \p op must be commutative,
+ * because the reduction of a chunk combines its vectors vertically. All operations
+ * supported by default (sums, products, Vc::Minimum, Vc::Maximum) are commutative. For
+ * floating-point sums, the result may differ from the serial scan by rounding.
+ *
+ * \code
+ * Vc::inclusive_scan(Vc::Parallel, data.begin(), data.end(), data.begin());
+ * \endcode
+ */
+template <typename ContiguousIt, typename OutputIt, typename BinaryOperation>
+inline Detail::enable_if_scannable<ContiguousIt, OutputIt> inclusive_scan(
+    ParallelTag policy, ContiguousIt first, ContiguousIt last, OutputIt d_first,
+    BinaryOperation op)
+{
+    return Detail::inclusive_scan(policy, first, last, d_first,
+                                  Detail::scan_operation(op));
+}
+
+template <typename ContiguousIt, typename OutputIt>
+inline Detail::enable_if_scannable<ContiguousIt, OutputIt> inclusive_scan(
+    ParallelTag policy, ContiguousIt first, ContiguousIt last, OutputIt d_first)
+{
+    return Detail::inclusive_scan(policy, first, last, d_first, Detail::ScanPlus());
+}
+
+template <typename ContiguousIt, typename OutputIt, typename BinaryOperation>
+inline Detail::enable_if_scannable<ContiguousIt, OutputIt> inclusive_scan(
+    ParallelTag policy, ContiguousIt first, ContiguousIt last, OutputIt d_first,
+    BinaryOperation op, Detail::contiguous_value_type<ContiguousIt> init)
+{
+    return Detail::scan(policy, first, last, d_first, Detail::scan_operation(op), init,
+                        false);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Multi-threaded variant of Vc::exclusive_scan. See the parallel Vc::inclusive_scan for
+ * details.
+ */
+template <typename ContiguousIt, typename OutputIt, typename BinaryOperation>
+inline Detail::enable_if_scannable<ContiguousIt, OutputIt> exclusive_scan(
+    ParallelTag policy, ContiguousIt first, ContiguousIt last, OutputIt d_first,
+    Detail::contiguous_value_type<ContiguousIt> init, BinaryOperation op)
+{
+    return Detail::scan(policy, first, last, d_first, Detail::scan_operation(op), init,
+                        true);
+}
+
+template <typename ContiguousIt, typename OutputIt>
+inline Detail::enable_if_scannable<ContiguousIt, OutputIt> exclusive_scan(
+    ParallelTag policy, ContiguousIt first, ContiguousIt last, OutputIt d_first,
+    Detail::contiguous_value_type<ContiguousIt> init)
+{
+    return Detail::scan(policy, first, last, d_first, Detail::ScanPlus(), init, true);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SCAN_H_
+
+// vim: foldmethod=marker
@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //#include "../IO"
 
 #include <array>
+#include <limits>
 
 #include "writemaskedvector.h"
 #include "simdarrayhelper.h"
@@ -68,6 +69,9 @@ struct select_best_vector_type_impl<N, T, Candidates...> {
 };
 template <class T, std::size_t N>
 struct select_best_vector_type : select_best_vector_type_impl<N,
+#ifdef Vc_IMPL_AVX512
+                                                              Vc::Vector<T, VectorAbi::Avx512Abi<T>>,
+#endif
 #ifdef Vc_IMPL_AVX2
                                                               Vc::AVX2::Vector<T>,
 #elif defined Vc_IMPL_AVX
@@ -115,12 +119,13 @@ template <typename T, std::size_t N, typename VectorType_>
 class SimdArray<T, N, VectorType_, N>
 {
     static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value ||
+                      std::is_same<T, llong>::value || std::is_same<T, ullong>::value ||
                       std::is_same<T, int32_t>::value ||
                       std::is_same<T, uint32_t>::value ||
                       std::is_same<T, int16_t>::value ||
                       std::is_same<T, uint16_t>::value,
-                  "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, "
-                  "int16_t, uint16_t }");
+                  "SimdArray<T, N> may only be used with T = { double, float, llong, ullong, "
+                  "int32_t, uint32_t, int16_t, uint16_t }");
     static_assert(
         std::is_same<VectorType_,
                      typename Common::select_best_vector_type<T, N>::type>::value &&
@@ -472,6 +477,12 @@ public:
         return {private_init, data.reversed()};
     }
 
+    ///\copydoc Vector::compressStore
+    Vc_INTRINSIC std::size_t compressStore(value_type *mem, const mask_type &k) const
+    {
+        return data.compressStore(mem, internal_data(k));
+    }
+
     Vc_INTRINSIC fixed_size_simd<T, N> sorted() const
     {
         return {private_init, data.sorted()};
@@ -616,10 +627,12 @@ template <typename T, size_t N, typename V, size_t Wt> class SimdArray
 {
     static_assert(std::is_same<T,   double>::value ||
                   std::is_same<T,    float>::value ||
+                  std::is_same<T,    llong>::value ||
+                  std::is_same<T,   ullong>::value ||
                   std::is_same<T,  int32_t>::value ||
                   std::is_same<T, uint32_t>::value ||
                   std::is_same<T,  int16_t>::value ||
-                  std::is_same<T, uint16_t>::value, "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, int16_t, uint16_t }");
+                  std::is_same<T, uint16_t>::value, "SimdArray<T, N> may only be used with T = { double, float, llong, ullong, int32_t, uint32_t, int16_t, uint16_t }");
     static_assert(
         std::is_same<V, typename Common::select_best_vector_type<T, N>::type>::value &&
             V::size() == Wt,
@@ -1334,6 +1347,13 @@ private:
     }
 
 public:
+    ///\copydoc Vector::compressStore
+    inline std::size_t compressStore(value_type *mem, const mask_type &k) const //{{{2
+    {
+        const std::size_t n = data0.compressStore(mem, internal_data0(k));
+        return n + data1.compressStore(mem + n, internal_data1(k));
+    }
+
     ///\copybrief Vector::reversed
     inline fixed_size_simd<T, N> reversed() const //{{{2
     {
@@ -1786,6 +1806,25 @@ Vc_ALL_COMPARES(Vc_BINARY_OPERATORS_);
     }                                                                                    \
     Vc_NOTHING_EXPECTING_SEMICOLON
 
+#define Vc_FORWARD_TAGGED_UNARY_OPERATOR_(name_, tag_)                                   \
+    /*!\brief Applies name_ component-wise with the accuracy tier tag_. */               \
+    template <typename T, std::size_t N, typename V, std::size_t M>                      \
+    inline fixed_size_simd<T, N> name_(const SimdArray<T, N, V, M> &x, tag_)             \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(                                     \
+            Common::Operations::Forward_##name_(), x, tag_());                           \
+    }                                                                                    \
+    template <class T, int N>                                                            \
+    fixed_size_simd<T, N> name_(const fixed_size_simd<T, N> &x, tag_)                    \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(                                     \
+            Common::Operations::Forward_##name_(), x, tag_());                           \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+#define Vc_FORWARD_TAGGED_UNARY_OPERATOR(name_)                                          \
+    Vc_FORWARD_TAGGED_UNARY_OPERATOR_(name_, PreciseMathTag);                            \
+    Vc_FORWARD_TAGGED_UNARY_OPERATOR_(name_, FastMathTag)
+
 #define Vc_FORWARD_BINARY_OPERATOR(name_)                                                \
     /*!\brief Applies the std::name_ function component-wise and concurrently. */        \
     template <typename T, std::size_t N, typename V, std::size_t M>                      \
@@ -1806,10 +1845,17 @@ Vc_FORWARD_UNARY_OPERATOR(abs);
 Vc_FORWARD_UNARY_OPERATOR(asin);
 Vc_FORWARD_UNARY_OPERATOR(atan);
 Vc_FORWARD_BINARY_OPERATOR(atan2);
+Vc_FORWARD_UNARY_OPERATOR(cbrt);
+Vc_FORWARD_TAGGED_UNARY_OPERATOR(cbrt);
 Vc_FORWARD_UNARY_OPERATOR(ceil);
 Vc_FORWARD_BINARY_OPERATOR(copysign);
 Vc_FORWARD_UNARY_OPERATOR(cos);
 Vc_FORWARD_UNARY_OPERATOR(exp);
+Vc_FORWARD_TAGGED_UNARY_OPERATOR(exp);
+Vc_FORWARD_UNARY_OPERATOR(exp2);
+Vc_FORWARD_TAGGED_UNARY_OPERATOR(exp2);
+Vc_FORWARD_UNARY_OPERATOR(expm1);
+Vc_FORWARD_TAGGED_UNARY_OPERATOR_(expm1, PreciseMathTag);
 Vc_FORWARD_UNARY_OPERATOR(exponent);
 Vc_FORWARD_UNARY_OPERATOR(floor);
 /// Applies the std::fma function component-wise and concurrently.
@@ -1836,8 +1882,29 @@ inline SimdArray<T, N> ldexp(const SimdArray<T, N> &x, const SimdArray<int, N> &
     return SimdArray<T, N>::fromOperation(Common::Operations::Forward_ldexp(), x, e);
 }
 Vc_FORWARD_UNARY_OPERATOR(log);
+Vc_FORWARD_TAGGED_UNARY_OPERATOR(log);
 Vc_FORWARD_UNARY_OPERATOR(log10);
+Vc_FORWARD_UNARY_OPERATOR(log1p);
+Vc_FORWARD_TAGGED_UNARY_OPERATOR(log1p);
 Vc_FORWARD_UNARY_OPERATOR(log2);
+Vc_FORWARD_TAGGED_UNARY_OPERATOR(log2);
+/// Applies pow component-wise and concurrently.
+template <typename T, std::size_t N, typename V, std::size_t M>
+inline fixed_size_simd<T, N> pow(const SimdArray<T, N, V, M> &x,
+                                 const SimdArray<T, N, V, M> &y)
+{
+    return fixed_size_simd<T, N>::fromOperation(Common::Operations::Forward_pow(), x, y);
+}
+/// Applies pow component-wise and concurrently with the accuracy tier \p tag.
+template <typename T, std::size_t N, typename V, std::size_t M, typename Tag>
+inline enable_if<std::is_same<Tag, PreciseMathTag>::value ||
+                     std::is_same<Tag, FastMathTag>::value,
+                 fixed_size_simd<T, N>>
+pow(const SimdArray<T, N, V, M> &x, const SimdArray<T, N, V, M> &y, Tag tag)
+{
+    return fixed_size_simd<T, N>::fromOperation(Common::Operations::Forward_pow(), x, y,
+                                                tag);
+}
 Vc_FORWARD_UNARY_OPERATOR(reciprocal);
 Vc_FORWARD_UNARY_OPERATOR(round);
 Vc_FORWARD_UNARY_OPERATOR(rsqrt);
@@ -1855,6 +1922,8 @@ Vc_FORWARD_BINARY_OPERATOR(max);
 ///@}
 #undef Vc_FORWARD_UNARY_OPERATOR
 #undef Vc_FORWARD_UNARY_BOOL_OPERATOR
+#undef Vc_FORWARD_TAGGED_UNARY_OPERATOR_
+#undef Vc_FORWARD_TAGGED_UNARY_OPERATOR
 #undef Vc_FORWARD_BINARY_OPERATOR
 
 // simd_cast {{{1
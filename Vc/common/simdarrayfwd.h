@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../scalar/types.h"
 #include "../sse/types.h"
 #include "../avx/types.h"
+#include "../avx512/types.h"
 
 #include "utility.h"
 #include "macros.h"
@@ -93,8 +93,11 @@ Vc_DEFINE_OPERATION_FORWARD(atan);
 Vc_DEFINE_OPERATION_FORWARD(atan2);
 Vc_DEFINE_OPERATION_FORWARD(cos);
 Vc_DEFINE_OPERATION_FORWARD(ceil);
+Vc_DEFINE_OPERATION_FORWARD(cbrt);
 Vc_DEFINE_OPERATION_FORWARD(copysign);
 Vc_DEFINE_OPERATION_FORWARD(exp);
+Vc_DEFINE_OPERATION_FORWARD(exp2);
+Vc_DEFINE_OPERATION_FORWARD(expm1);
 Vc_DEFINE_OPERATION_FORWARD(exponent);
 Vc_DEFINE_OPERATION_FORWARD(fma);
 Vc_DEFINE_OPERATION_FORWARD(floor);
@@ -106,7 +109,9 @@ Vc_DEFINE_OPERATION_FORWARD(isnegative);
 Vc_DEFINE_OPERATION_FORWARD(ldexp);
 Vc_DEFINE_OPERATION_FORWARD(log);
 Vc_DEFINE_OPERATION_FORWARD(log10);
+Vc_DEFINE_OPERATION_FORWARD(log1p);
 Vc_DEFINE_OPERATION_FORWARD(log2);
+Vc_DEFINE_OPERATION_FORWARD(pow);
 Vc_DEFINE_OPERATION_FORWARD(reciprocal);
 Vc_DEFINE_OPERATION_FORWARD(round);
 Vc_DEFINE_OPERATION_FORWARD(rsqrt);
@@ -314,6 +319,28 @@ template <std::size_t secondOffset> class Split
         return simd_cast<SSE::Mask<T>, 1>(x);
     }
 #endif  // Vc_IMPL_AVX
+#ifdef Vc_IMPL_AVX512
+    template <class T>
+    static Vc_INTRINSIC AVX2::Vector<T> loImpl(Vector<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Vector<T>, 0>(x);
+    }
+    template <class T>
+    static Vc_INTRINSIC AVX2::Vector<T> hiImpl(Vector<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Vector<T>, 1>(x);
+    }
+    template <class T>
+    static Vc_INTRINSIC AVX2::Mask<T> loImpl(Mask<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Mask<T>, 0>(x);
+    }
+    template <class T>
+    static Vc_INTRINSIC AVX2::Mask<T> hiImpl(Mask<T, VectorAbi::Avx512> &&x)
+    {
+        return simd_cast<AVX2::Mask<T>, 1>(x);
+    }
+#endif  // Vc_IMPL_AVX512
     template <typename T>
     static constexpr bool is_vector_or_mask(){
         return (Traits::is_simd_vector<T>::value && !Traits::isSimdArray<T>::value) ||
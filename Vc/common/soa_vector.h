@@ -0,0 +1,399 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SOA_VECTOR_H_
+#define VC_COMMON_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "simdize.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace SimdizeDetail
+{
+/**\addtogroup Simdize
+ * @{
+ */
+// all_arithmetic {{{
+/**\internal
+ * Determines whether all types in \p Ts are arithmetic types.
+ */
+template <class... Ts> struct all_arithmetic;
+template <> struct all_arithmetic<> : public std::true_type
+{
+};
+template <class T0, class... Ts>
+struct all_arithmetic<T0, Ts...>
+    : public std::integral_constant<bool, std::is_arithmetic<T0>::value &&
+                                              all_arithmetic<Ts...>::value>
+{
+};
+// }}}
+// SoaLayout {{{
+/**\internal
+ * Derives the per-member types of soa_vector<T, N>: the scalar member types, the vector
+ * types of the members of `simdize<T, N>`, and the storage tuple with one aligned array
+ * per member.
+ */
+template <class T, class V, class Seq> struct SoaLayout;
+template <class T, class V, size_t... I> struct SoaLayout<T, V, index_sequence<I...>> {
+    template <size_t J>
+    using member_type = typename std::decay<typename my_tuple_element<J, T>::type>::type;
+    template <size_t J>
+    using member_vector =
+        Traits::decay<decltype(get_dispatcher<J>(std::declval<V &>()))>;
+
+    static_assert(all_arithmetic<member_type<I>...>::value,
+                  "soa_vector<T> requires all members of T to be arithmetic types");
+
+    using storage_type =
+        std::tuple<std::vector<member_type<I>, Vc::Allocator<member_type<I>>>...>;
+};
+// }}}
+/** @}*/
+}  // namespace SimdizeDetail
+
+/**
+ * \ingroup Simdize
+ * \headerfile simdize.h <Vc/simdize>
+ *
+ * A container for objects of type \p T that stores the data as a structure of arrays.
+ *
+ * \p T must be a struct that is supported by simdize (i.e. uses Vc_SIMDIZE_INTERFACE or
+ * the std::tuple interface) and whose members are all arithmetic types. Every member is
+ * stored in its own array, aligned and padded to a multiple of `simdize<T, N>::size()`
+ * entries. Therefore the i-th group of `simd_width` objects can be loaded into (and
+ * stored from) a `simdize<T, N>` object with one aligned vector load (store) per member,
+ * without gathers or deinterleaving.
+ *
+ * \code
+ * Vc::soa_vector<Point> points;
+ * for (...) {
+ *   points.push_back(Point{x, y, z});
+ * }
+ * for (std::size_t i = 0; i < points.vectors_count(); ++i) {
+ *   Vc::simdize<Point> p = points.vector(i);
+ *   p.x += 1.f;
+ *   points.vector(i) = p;
+ * }
+ * Point first = points[0];
+ * points[1] = first;
+ * \endcode
+ *
+ * The last vector may contain entries beyond size(). The values of these padding entries
+ * are unspecified (but valid objects), and writing them via vector(i) does not change the
+ * objects in the container.
+ *
+ * \tparam T The scalar object type.
+ * \tparam N The vector width, see simdize. A value of 0 uses the natural width.
+ */
+template <class T, std::size_t N = 0> class soa_vector
+{
+public:
+    /// The scalar object type.
+    using value_type = T;
+    /// The vectorized object type returned from vector().
+    using simd_type = simdize<T, N>;
+    using size_type = std::size_t;
+
+    /// The number of objects in one simd_type.
+    static constexpr std::size_t simd_width = simd_type::size();
+
+private:
+    static constexpr std::size_t TupleSize =
+        SimdizeDetail::determine_tuple_size_<T>::value;
+    using IndexSeq = Vc::make_index_sequence<TupleSize>;
+    using Layout = SimdizeDetail::SoaLayout<T, simd_type, IndexSeq>;
+    template <std::size_t I> using member_type = typename Layout::template member_type<I>;
+    template <std::size_t I>
+    using member_vector = typename Layout::template member_vector<I>;
+
+    /**\internal
+     * Aligned loads and stores require the byte offset of every vector to be a multiple
+     * of the vector's alignment. This holds for all natural widths; otherwise (e.g.
+     * SimdArray<float, 3>) unaligned loads and stores are used.
+     */
+    template <std::size_t I>
+    using load_flags = typename std::conditional<
+        (simd_width * sizeof(member_type<I>)) % member_vector<I>::MemoryAlignment == 0,
+        Vc::AlignedTag, Vc::UnalignedTag>::type;
+
+    static constexpr std::size_t padded(std::size_t n)
+    {
+        return (n + simd_width - 1) / simd_width * simd_width;
+    }
+
+public:
+    class reference;
+    class vector_reference;
+
+    /// Constructs an empty container.
+    soa_vector() = default;
+
+    /// Constructs a container with \p n value-initialized objects.
+    explicit soa_vector(size_type n) { resize(n); }
+
+    /// Constructs a container with \p n copies of \p value.
+    soa_vector(size_type n, const T &value) { resize(n, value); }
+
+    /// Constructs a container with copies of the objects in \p init.
+    soa_vector(std::initializer_list<T> init)
+    {
+        reserve(init.size());
+        for (const T &x : init) {
+            push_back(x);
+        }
+    }
+
+    ///\name Capacity
+    ///@{
+    /// Returns the number of objects in the container.
+    size_type size() const { return m_size; }
+    /// Returns whether the container holds no objects.
+    bool empty() const { return m_size == 0; }
+    /// Returns the number of objects the container can hold without reallocation.
+    size_type capacity() const { return std::get<0>(m_data).capacity(); }
+    /// Returns the number of simd_type objects needed to cover size() objects.
+    size_type vectors_count() const { return (m_size + simd_width - 1) / simd_width; }
+
+    /// Reserves storage for at least \p n objects in every member array.
+    void reserve(size_type n) { reserveStorage(padded(n), IndexSeq()); }
+
+    /// Changes the number of objects to \p n. New objects are value-initialized.
+    void resize(size_type n)
+    {
+        resizeStorage(padded(n), IndexSeq());
+        fill(m_size, n, nullptr, IndexSeq());
+        m_size = n;
+    }
+
+    /// Changes the number of objects to \p n. New objects are copies of \p value.
+    void resize(size_type n, const T &value)
+    {
+        resizeStorage(padded(n), IndexSeq());
+        fill(m_size, n, &value, IndexSeq());
+        m_size = n;
+    }
+
+    /// Removes all objects. The storage is not released.
+    void clear() { m_size = 0; }
+    ///@}
+
+    ///\name Modifiers
+    ///@{
+    /// Appends a copy of \p x.
+    void push_back(const T &x)
+    {
+        if (m_size == std::get<0>(m_data).size()) {
+            resizeStorage(padded(m_size + 1), IndexSeq());
+        }
+        assign(m_size++, x, IndexSeq());
+    }
+
+    /// Removes the last object.
+    void pop_back()
+    {
+        Vc_ASSERT(m_size > 0);
+        --m_size;
+    }
+    ///@}
+
+    ///\name Scalar access
+    ///@{
+    /// Returns a proxy for the object at index \p i.
+    reference operator[](size_type i)
+    {
+        Vc_ASSERT(i < m_size);
+        return {*this, i};
+    }
+    /// Returns a copy of the object at index \p i.
+    T operator[](size_type i) const
+    {
+        Vc_ASSERT(i < m_size);
+        return extract(i, IndexSeq());
+    }
+
+    /// Returns a pointer to the (aligned) array of the \p I-th member.
+    template <std::size_t I> member_type<I> *data() { return std::get<I>(m_data).data(); }
+    /// Returns a pointer to the (aligned) array of the \p I-th member.
+    template <std::size_t I> const member_type<I> *data() const
+    {
+        return std::get<I>(m_data).data();
+    }
+    ///@}
+
+    ///\name Vector access
+    ///@{
+    /**
+     * Returns a proxy for the objects at indexes `[i * simd_width, (i + 1) *
+     * simd_width)`. It converts to simd_type and can be assigned from simd_type.
+     */
+    vector_reference vector(size_type i)
+    {
+        Vc_ASSERT(i < vectors_count());
+        return {*this, i};
+    }
+    /**
+     * Returns the objects at indexes `[i * simd_width, (i + 1) * simd_width)`, loaded
+     * with one vector load per member.
+     */
+    simd_type vector(size_type i) const
+    {
+        Vc_ASSERT(i < vectors_count());
+        return loadVector(i * simd_width, IndexSeq());
+    }
+    ///@}
+
+    /**
+     * A proxy for one object in soa_vector. It converts to \p T and can be assigned from
+     * \p T.
+     */
+    class reference
+    {
+    public:
+        reference(soa_vector &vv, size_type ii) : v(vv), i(ii) {}
+        reference(const reference &) = default;
+
+        operator T() const { return v.extract(i, IndexSeq()); }
+        reference &operator=(const T &x)
+        {
+            v.assign(i, x, IndexSeq());
+            return *this;
+        }
+        reference &operator=(const reference &x) { return operator=(T(x)); }
+
+    private:
+        soa_vector &v;
+        size_type i;
+    };
+
+    /**
+     * A proxy for one vector of objects in soa_vector. It converts to simd_type and can
+     * be assigned from simd_type.
+     */
+    class vector_reference
+    {
+    public:
+        vector_reference(soa_vector &vv, size_type ii) : v(vv), i(ii) {}
+        vector_reference(const vector_reference &) = default;
+
+        operator simd_type() const { return v.loadVector(i * simd_width, IndexSeq()); }
+        vector_reference &operator=(const simd_type &x)
+        {
+            v.storeVector(i * simd_width, x, IndexSeq());
+            return *this;
+        }
+        vector_reference &operator=(const vector_reference &x)
+        {
+            return operator=(simd_type(x));
+        }
+
+    private:
+        soa_vector &v;
+        size_type i;
+    };
+
+private:
+    template <std::size_t... I> void reserveStorage(size_type n, Vc::index_sequence<I...>)
+    {
+        auto &&unused = {(std::get<I>(m_data).reserve(n), 0)...};
+        if (&unused == &unused) {}
+    }
+
+    // n is a multiple of simd_width, see padded()
+    template <std::size_t... I> void resizeStorage(size_type n, Vc::index_sequence<I...>)
+    {
+        auto &&unused = {(std::get<I>(m_data).resize(n), 0)...};
+        if (&unused == &unused) {}
+    }
+
+    // sets the objects in [first, last) to *value, or value-initializes them if value is
+    // nullptr
+    template <std::size_t... I>
+    void fill(size_type first, size_type last, const T *value, Vc::index_sequence<I...>)
+    {
+        if (first >= last) {
+            return;
+        }
+        auto &&unused = {
+            (std::fill(std::get<I>(m_data).begin() + first,
+                       std::get<I>(m_data).begin() + last,
+                       value ? member_type<I>(SimdizeDetail::get_dispatcher<I>(*value))
+                             : member_type<I>()),
+             0)...};
+        if (&unused == &unused) {}
+    }
+
+    template <std::size_t... I>
+    void assign(size_type i, const T &x, Vc::index_sequence<I...>)
+    {
+        auto &&unused = {
+            (std::get<I>(m_data)[i] = SimdizeDetail::get_dispatcher<I>(x), 0)...};
+        if (&unused == &unused) {}
+    }
+
+    template <std::size_t... I> T extract(size_type i, Vc::index_sequence<I...>) const
+    {
+        return SimdizeDetail::construct<T>(
+            SimdizeDetail::preferred_construction<T, member_type<I>...>(),
+            std::get<I>(m_data)[i]...);
+    }
+
+    template <std::size_t... I>
+    simd_type loadVector(size_type offset, Vc::index_sequence<I...>) const
+    {
+        using Base = typename simd_type::base_type;
+        return simd_type(SimdizeDetail::construct<Base>(
+            SimdizeDetail::preferred_construction<Base, member_vector<I>...>(),
+            member_vector<I>(std::get<I>(m_data).data() + offset, load_flags<I>())...));
+    }
+
+    template <std::size_t... I>
+    void storeVector(size_type offset, const simd_type &x, Vc::index_sequence<I...>)
+    {
+        auto &&unused = {(SimdizeDetail::get_dispatcher<I>(x).store(
+                              std::get<I>(m_data).data() + offset, load_flags<I>()),
+                          0)...};
+        if (&unused == &unused) {}
+    }
+
+    typename Layout::storage_type m_data;
+    size_type m_size = 0;
+};
+
+template <class T, std::size_t N> constexpr std::size_t soa_vector<T, N>::simd_width;
+}  // namespace Vc
+
+#endif  // VC_COMMON_SOA_VECTOR_H_
+
+// vim: foldmethod=marker
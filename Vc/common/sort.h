@@ -0,0 +1,505 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_SORT_H_
+#define VC_COMMON_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "../vector.h"
+#include "memory.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// ranges up to this size are sorted with the SIMD merge sort, larger ranges are
+// partitioned first
+constexpr std::size_t SortPartitionThreshold = 4096;
+// ranges up to this size are sorted with insertion sort in the key/value sort
+constexpr std::size_t SortInsertionThreshold = 16;
+
+// is_sortable_vector {{{1
+// Vector::sorted() has a sort network only for 16- and 32-bit integers, float, and
+// double. Ranges of 8- and 64-bit integers are sorted with std::sort.
+template <typename T>
+using is_sortable_vector = std::integral_constant<
+    bool, Traits::is_valid_vector_argument<T>::value && (Vector<T>::Size > 1) &&
+              (std::is_floating_point<T>::value || sizeof(T) == 2 || sizeof(T) == 4)>;
+
+// bitonic_merge {{{1
+/**\internal
+ * Merges the sorted vectors \p a and \p b such that \p a holds the lower and \p b holds
+ * the upper half of the elements, both in ascending order.
+ *
+ * The first stage of the bitonic merge network compares \p a with \p b reversed. The
+ * remaining stages are done by the sorting network of Vector::sorted(), which sorts any
+ * input, and in particular the bitonic sequences left after the first stage.
+ */
+template <typename V> Vc_INTRINSIC void bitonic_merge(V &a, V &b)
+{
+    const V r = b.reversed();
+    const V lo = Vc::min(a, r);
+    const V hi = Vc::max(a, r);
+    a = lo.sorted();
+    b = hi.sorted();
+}
+
+// merge_runs {{{1
+/**\internal
+ * Merges the sorted runs [\p a, \p a + \p na) and [\p b, \p b + \p nb) into \p out.
+ *
+ * While both runs provide whole vectors, the vector with the smaller first element is
+ * merged into the register holding the V::Size largest elements seen so far, and the
+ * lower half is stored. Partial vectors at the end of a run are merged with scalar code.
+ */
+template <typename V, typename T>
+void merge_runs(const T *a, std::size_t na, const T *b, std::size_t nb, T *out)
+{
+    constexpr std::size_t N = V::Size;
+    if (na < N || nb < N) {
+        std::merge(a, a + na, b, b + nb, out);
+        return;
+    }
+    V lo(a, Vc::Unaligned);
+    V hi(b, Vc::Unaligned);
+    std::size_t ia = N, ib = N;
+    for (;;) {
+        bitonic_merge(lo, hi);
+        lo.store(out, Vc::Unaligned);
+        out += N;
+        bool takeA;
+        if (ia < na && ib < nb) {
+            takeA = a[ia] < b[ib];
+        } else if (ia < na || ib < nb) {
+            takeA = ia < na;
+        } else {
+            break;
+        }
+        if (takeA) {
+            if (ia + N > na) {
+                break;
+            }
+            lo.load(a + ia, Vc::Unaligned);
+            ia += N;
+        } else {
+            if (ib + N > nb) {
+                break;
+            }
+            lo.load(b + ib, Vc::Unaligned);
+            ib += N;
+        }
+    }
+
+    // the elements in hi, a[ia:], and b[ib:] are sorted and not less than any element
+    // already stored
+    alignas(V::MemoryAlignment) T tmp[N];
+    hi.store(&tmp[0], Vc::Aligned);
+    std::size_t it = 0;
+    while (it < N) {
+        if (ia < na && a[ia] < tmp[it] && (ib >= nb || !(b[ib] < a[ia]))) {
+            *out++ = a[ia++];
+        } else if (ib < nb && b[ib] < tmp[it]) {
+            *out++ = b[ib++];
+        } else {
+            *out++ = tmp[it++];
+        }
+    }
+    std::merge(a + ia, a + na, b + ib, b + nb, out);
+}
+
+// merge_sort {{{1
+/**\internal
+ * Sorts [\p data, \p data + \p n) using \p buffer (with room for \p n elements) as
+ * scratch space. Every whole vector is sorted with Vector::sorted() and the resulting
+ * runs are merged bottom-up with merge_runs.
+ */
+template <typename V, typename T> void merge_sort(T *data, std::size_t n, T *buffer)
+{
+    constexpr std::size_t N = V::Size;
+    if (n < 2 * N) {
+        std::sort(data, data + n);
+        return;
+    }
+    const std::size_t whole = n / N * N;
+    for (std::size_t i = 0; i < whole; i += N) {
+        V(data + i, Vc::Unaligned).sorted().store(data + i, Vc::Unaligned);
+    }
+    std::sort(data + whole, data + n);
+
+    T *src = data;
+    T *dst = buffer;
+    for (std::size_t width = N; width < n; width *= 2) {
+        for (std::size_t lo = 0; lo < n; lo += 2 * width) {
+            const std::size_t mid = std::min(lo + width, n);
+            const std::size_t hi = std::min(lo + 2 * width, n);
+            merge_runs<V>(src + lo, mid - lo, src + mid, hi - mid, dst + lo);
+        }
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        std::memcpy(data, src, n * sizeof(T));
+    }
+}
+
+// median_of_three {{{1
+template <typename T> Vc_INTRINSIC T median_of_three(T a, T b, T c)
+{
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+template <typename T> Vc_INTRINSIC T choose_pivot(const T *data, std::size_t n)
+{
+    if (n < 1024) {
+        return median_of_three(data[0], data[n / 2], data[n - 1]);
+    }
+    const std::size_t s = n / 8;
+    return median_of_three(median_of_three(data[0], data[s], data[2 * s]),
+                           median_of_three(data[3 * s], data[n / 2], data[5 * s]),
+                           median_of_three(data[6 * s], data[7 * s], data[n - 1]));
+}
+
+// partition {{{1
+/**\internal
+ * Moves all elements of [\p keys, \p keys + \p n) for which \p less(x, pivot) holds to the
+ * front, and the rest to the back, and returns the number of elements in the front
+ * part. The values (if \p values is not \c nullptr) are moved along with their keys.
+ *
+ * The comparison is done one vector at a time. Every element is then written to both
+ * the next front and the next back slot of the buffers, and the bit of the comparison
+ * mask selects which of the two positions advances. This avoids unpredictable branches.
+ */
+template <typename V, typename T, typename U, typename Less>
+std::size_t partition(T *keys, U *values, std::size_t n, T pivot, T *keyBuffer,
+                      U *valueBuffer, Less less)
+{
+    constexpr std::size_t N = V::Size;
+    const V vpivot = pivot;
+    std::size_t l = 0, r = n;
+    const std::size_t whole = n / N * N;
+    for (std::size_t i = 0; i < whole; i += N) {
+        unsigned int bits = less(V(keys + i, Vc::Unaligned), vpivot).toInt();
+        for (std::size_t k = 0; k < N; ++k, bits >>= 1) {
+            const std::size_t bit = bits & 1;
+            keyBuffer[l] = keys[i + k];
+            keyBuffer[r - 1] = keys[i + k];
+            if (values) {
+                valueBuffer[l] = values[i + k];
+                valueBuffer[r - 1] = values[i + k];
+            }
+            l += bit;
+            r -= bit ^ 1;
+        }
+    }
+    for (std::size_t i = whole; i < n; ++i) {
+        const std::size_t bit = less(keys[i], pivot);
+        keyBuffer[l] = keys[i];
+        keyBuffer[r - 1] = keys[i];
+        if (values) {
+            valueBuffer[l] = values[i];
+            valueBuffer[r - 1] = values[i];
+        }
+        l += bit;
+        r -= bit ^ 1;
+    }
+    std::memcpy(keys, keyBuffer, n * sizeof(T));
+    if (values) {
+        std::copy(valueBuffer, valueBuffer + n, values);
+    }
+    return l;
+}
+
+struct SortLess {
+    template <typename A> Vc_INTRINSIC auto operator()(const A &a, const A &b) const
+        -> decltype(a < b)
+    {
+        return a < b;
+    }
+};
+struct SortLessEqual {
+    template <typename A> Vc_INTRINSIC auto operator()(const A &a, const A &b) const
+        -> decltype(a <= b)
+    {
+        return a <= b;
+    }
+};
+
+// insertion_sort {{{1
+template <typename T, typename U>
+void insertion_sort(T *keys, U *values, std::size_t n)
+{
+    for (std::size_t i = 1; i < n; ++i) {
+        T key = keys[i];
+        U value = std::move(values[i]);
+        std::size_t j = i;
+        for (; j > 0 && key < keys[j - 1]; --j) {
+            keys[j] = keys[j - 1];
+            values[j] = std::move(values[j - 1]);
+        }
+        keys[j] = key;
+        values[j] = std::move(value);
+    }
+}
+
+// quick_sort {{{1
+/**\internal
+ * Partitions [\p keys, \p keys + \p n) recursively until the ranges are small enough for
+ * the leaf sort. If the recursion gets too deep, or the pivot does not split the range
+ * (NaN), the range is handed to the leaf sort unconditionally.
+ */
+template <typename V, typename T, typename U>
+void quick_sort(T *keys, U *values, std::size_t n, T *keyBuffer, U *valueBuffer,
+                int depth)
+{
+    const std::size_t threshold =
+        values ? SortInsertionThreshold : SortPartitionThreshold;
+    while (n > threshold && depth > 0) {
+        --depth;
+        const T pivot = choose_pivot(keys, n);
+        std::size_t nLeft =
+            partition<V>(keys, values, n, pivot, keyBuffer, valueBuffer, SortLess());
+        std::size_t skip = 0;
+        if (nLeft == 0) {
+            // the pivot is the minimum. Split off all elements equal to it, they are in
+            // their final position.
+            skip = partition<V>(keys, values, n, pivot, keyBuffer, valueBuffer,
+                                SortLessEqual());
+            if (skip == 0) {
+                break;
+            }
+        }
+        T *rightKeys = keys + nLeft + skip;
+        U *rightValues = values ? values + nLeft + skip : nullptr;
+        const std::size_t nRight = n - nLeft - skip;
+        // recurse into the smaller part, iterate on the larger one
+        if (nLeft < nRight) {
+            quick_sort<V>(keys, values, nLeft, keyBuffer, valueBuffer, depth);
+            keys = rightKeys;
+            values = rightValues;
+            keyBuffer += nLeft + skip;
+            valueBuffer = valueBuffer ? valueBuffer + nLeft + skip : nullptr;
+            n = nRight;
+        } else {
+            quick_sort<V>(rightKeys, rightValues, nRight, keyBuffer + nLeft + skip,
+                          valueBuffer ? valueBuffer + nLeft + skip : nullptr, depth);
+            n = nLeft;
+        }
+    }
+    if (values) {
+        if (n > SortInsertionThreshold) {
+            // only reached when partitioning failed to make progress
+            std::unique_ptr<std::size_t[]> order(new std::size_t[n]);
+            for (std::size_t i = 0; i < n; ++i) {
+                order[i] = i;
+            }
+            std::sort(order.get(), order.get() + n,
+                      [&](std::size_t a, std::size_t b) { return keys[a] < keys[b]; });
+            for (std::size_t i = 0; i < n; ++i) {
+                keyBuffer[i] = keys[order[i]];
+                valueBuffer[i] = std::move(values[order[i]]);
+            }
+            std::copy(keyBuffer, keyBuffer + n, keys);
+            std::move(valueBuffer, valueBuffer + n, values);
+        } else {
+            insertion_sort(keys, values, n);
+        }
+    } else {
+        merge_sort<V>(keys, n, keyBuffer);
+    }
+}
+
+inline int sort_depth_limit(std::size_t n)
+{
+    int depth = 0;
+    for (; n > 1; n >>= 1) {
+        depth += 2;
+    }
+    return depth;
+}
+
+// sort_impl {{{1
+template <typename T> void sort_impl(T *first, T *last, std::true_type)
+{
+    using V = Vector<T>;
+    const std::size_t n = last - first;
+    if (n < 2) {
+        return;
+    }
+    std::unique_ptr<T[]> buffer(new T[n]);
+    quick_sort<V>(first, static_cast<T *>(nullptr), n, buffer.get(),
+                  static_cast<T *>(nullptr), sort_depth_limit(n));
+}
+template <typename T> void sort_impl(T *first, T *last, std::false_type)
+{
+    std::sort(first, last);
+}
+
+template <typename T, typename U>
+void sort_impl(T *keys, T *keysLast, U *values, std::true_type)
+{
+    using V = Vector<T>;
+    const std::size_t n = keysLast - keys;
+    if (n < 2) {
+        return;
+    }
+    std::unique_ptr<T[]> keyBuffer(new T[n]);
+    std::unique_ptr<U[]> valueBuffer(new U[n]);
+    quick_sort<V>(keys, values, n, keyBuffer.get(), valueBuffer.get(),
+                  sort_depth_limit(n));
+}
+template <typename T, typename U>
+void sort_impl(T *keys, T *keysLast, U *values, std::false_type)
+{
+    const std::size_t n = keysLast - keys;
+    std::unique_ptr<std::size_t[]> order(new std::size_t[n]);
+    for (std::size_t i = 0; i < n; ++i) {
+        order[i] = i;
+    }
+    std::sort(order.get(), order.get() + n,
+              [&](std::size_t a, std::size_t b) { return keys[a] < keys[b]; });
+    std::unique_ptr<T[]> k(new T[n]);
+    std::unique_ptr<U[]> v(new U[n]);
+    for (std::size_t i = 0; i < n; ++i) {
+        k[i] = keys[order[i]];
+        v[i] = std::move(values[order[i]]);
+    }
+    std::copy(k.get(), k.get() + n, keys);
+    std::move(v.get(), v.get() + n, values);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \name Sorting
+ */
+//@{
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/algorithm>
+ *
+ * Sorts the contiguous range [\p first, \p last) in ascending order.
+ *
+ * For element types with a Vc::Vector type the range is partitioned around a pivot
+ * (using vector compares) until the parts fit into the cache. The parts are then sorted
+ * with Vector::sorted() per vector, and the sorted vectors are merged with SIMD bitonic
+ * merges. Other element types are sorted with std::sort.
+ *
+ * The sort is not stable. The range must not contain NaNs. Temporary memory for \p last
+ * \p - \p first elements is allocated.
+ *
+ * \param first Begin of the range. The iterator must refer to contiguous storage, i.e.
+ *              a pointer or an iterator of std::vector or std::array. Unqualified calls
+ *              with other iterators resolve to std::sort.
+ * \param last End of the range.
+ */
+template <typename T> inline void sort(T *first, T *last)
+{
+    Detail::sort_impl(first, last, Detail::is_sortable_vector<T>());
+}
+
+template <template <typename...> class It, typename... Ts>
+inline Detail::enable_if_contiguous_range<It<Ts...>, void> sort(It<Ts...> first,
+                                                                It<Ts...> last)
+{
+    if (first != last) {
+        auto *p = std::addressof(*first);
+        sort(p, p + std::distance(first, last));
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/algorithm>
+ *
+ * Sorts the contiguous range [\p keys, \p keysLast) in ascending order and applies the
+ * same permutation to the range starting at \p values.
+ *
+ * The keys are partitioned with vector compares, the values are moved along with their
+ * keys. Small partitions are finished with insertion sort.
+ *
+ * The sort is not stable. The keys must not contain NaNs. The value type must be
+ * default constructible and move assignable.
+ *
+ * This is not an overload of Vc::sort, because `sort(first, last, x)` would otherwise
+ * compete with `std::sort(first, last, comp)` in unqualified calls found via ADL.
+ */
+template <typename T, typename U> inline void sort_by_key(T *keys, T *keysLast, U *values)
+{
+    Detail::sort_impl(keys, keysLast, values, Detail::is_sortable_vector<T>());
+}
+
+template <typename ContiguousIt1, typename ContiguousIt2>
+inline enable_if<Traits::is_contiguous_iterator<ContiguousIt2>::value,
+                 Detail::enable_if_contiguous_range<ContiguousIt1, void>>
+sort_by_key(ContiguousIt1 keys, ContiguousIt1 keysLast, ContiguousIt2 values)
+{
+    if (keys != keysLast) {
+        auto *k = std::addressof(*keys);
+        sort_by_key(k, k + std::distance(keys, keysLast), std::addressof(*values));
+    }
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/algorithm>
+ *
+ * Sorts the entries of the one-dimensional Vc::Memory object \p m. The padding entries
+ * are not touched.
+ */
+template <typename V, std::size_t Size, bool InitPadding>
+inline void sort(Memory<V, Size, 0u, InitPadding> &m)
+{
+    sort(m.entries(), m.entries() + m.entriesCount());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile sort.h <Vc/algorithm>
+ *
+ * Sorts the entries of \p keys in ascending order and applies the same permutation to
+ * the first `keys.entriesCount()` entries of \p values.
+ */
+template <typename V, std::size_t Size, bool InitPadding, typename W, std::size_t Size2,
+          bool InitPadding2>
+inline void sort_by_key(Memory<V, Size, 0u, InitPadding> &keys,
+                        Memory<W, Size2, 0u, InitPadding2> &values)
+{
+    Vc_ASSERT(values.entriesCount() >= keys.entriesCount());
+    sort_by_key(keys.entries(), keys.entries() + keys.entriesCount(), values.entries());
+}
+//@}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SORT_H_
+
+// vim: foldmethod=marker
@@ -46,7 +46,25 @@ namespace Common
 {
 namespace Detail
 {
-#ifdef Vc_IMPL_AVX
+#ifdef Vc_IMPL_AVX512
+template <typename ValueType, size_t Size> struct IntrinsicType {
+    static constexpr size_t Bytes = sizeof(ValueType) * Size;
+    using type = typename std::conditional<
+        std::is_integral<ValueType>::value,
+        typename std::conditional<
+            Bytes == 16, __m128i,
+            typename std::conditional<Bytes == 32, __m256i, __m512i>::type>::type,
+        typename std::conditional<
+            std::is_same<ValueType, double>::value,
+            typename std::conditional<
+                Bytes == 16, __m128d,
+                typename std::conditional<Bytes == 32, __m256d, __m512d>::type>::type,
+            typename std::conditional<
+                Bytes == 16, __m128,
+                typename std::conditional<Bytes == 32, __m256, __m512>::type>::type>::
+            type>::type;
+};
+#elif defined Vc_IMPL_AVX
 template <typename ValueType, size_t Size> struct IntrinsicType {
     using type = typename std::conditional<
         std::is_integral<ValueType>::value,
@@ -107,6 +125,22 @@ template <size_t Size> struct BuiltinType<unsigned char     , Size, 32> { typede
 template <size_t Size> struct BuiltinType<  signed char     , Size, 32> { typedef   signed char      type Vc_VECBUILTIN; };
 template <size_t Size> struct BuiltinType<         bool     , Size, 32> { typedef unsigned char      type Vc_VECBUILTIN; };
 #undef Vc_VECBUILTIN
+#define Vc_VECBUILTIN __attribute__((__vector_size__(64)))
+template <size_t Size> struct BuiltinType<         double   , Size, 64> { typedef          double    type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<         float    , Size, 64> { typedef          float     type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<         long long, Size, 64> { typedef          long long type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<unsigned long long, Size, 64> { typedef unsigned long long type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<         long     , Size, 64> { typedef          long      type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<unsigned long     , Size, 64> { typedef unsigned long      type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<         int      , Size, 64> { typedef          int       type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<unsigned int      , Size, 64> { typedef unsigned int       type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<         short    , Size, 64> { typedef          short     type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<unsigned short    , Size, 64> { typedef unsigned short     type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<         char     , Size, 64> { typedef          char      type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<unsigned char     , Size, 64> { typedef unsigned char      type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<  signed char     , Size, 64> { typedef   signed char      type Vc_VECBUILTIN; };
+template <size_t Size> struct BuiltinType<         bool     , Size, 64> { typedef unsigned char      type Vc_VECBUILTIN; };
+#undef Vc_VECBUILTIN
 #endif
 }  // namespace Detail
 
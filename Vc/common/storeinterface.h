@@ -89,4 +89,29 @@ Vc_INTRINSIC void Vc_VDECL store(EntryType *mem, MaskType mask, Flags flags) con
 }
 //@}
 
+/**
+ * Store the entries of the vector where \p mask is set contiguously to \p mem.
+ *
+ * \param mem A pointer to memory, where `mask.count()` consecutive values will be stored.
+ * \param mask A mask object that selects the entries of the vector to store.
+ * \return The number of stored values, i.e. `mask.count()`.
+ *
+ * \note
+ * In contrast to the masked store, the selected values are packed into memory: the value
+ * at offset \c i is stored to `mem[j]`, where \c j is the number of set mask entries
+ * before \c i. Memory past the stored values is not touched.
+ *
+ * \see Vc::compress
+ */
+Vc_INTRINSIC std::size_t compressStore(EntryType *mem, MaskType mask) const
+{
+    alignas(MemoryAlignment) EntryType tmp[Size];
+    compress(*this, mask).store(&tmp[0], Vc::Aligned);
+    const std::size_t n = mask.count();
+    for (std::size_t i = 0; i < n; ++i) {
+        mem[i] = tmp[i];
+    }
+    return n;
+}
+
 // vim: foldmethod=marker
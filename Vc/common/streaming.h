@@ -0,0 +1,455 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_STREAMING_H_
+#define VC_COMMON_STREAMING_H_
+
+#include <assert.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include "../vector.h"
+#include "memory.h"
+#if defined __x86_64__ || defined __amd64__ || defined __amd64 || defined __x86_64 ||    \
+    defined _M_AMD64 || defined __i386__
+#include <xmmintrin.h>
+#include "../cpuid.h"
+#define Vc_STREAMING_USE_CPUID 1
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// streaming_threshold {{{1
+/**\internal
+ * The size of the last level cache in bytes, as detected by CpuId, or 0 if unknown.
+ */
+inline std::size_t last_level_cache_size()
+{
+#ifdef Vc_STREAMING_USE_CPUID
+    CpuId::init();
+    const std::size_t l3 = CpuId::L3Data();
+    return l3 != 0 ? l3 : CpuId::L2Data();
+#else
+    return 0;
+#endif
+}
+
+inline std::atomic<std::size_t> &streaming_threshold()
+{
+    static std::atomic<std::size_t> threshold(
+        last_level_cache_size() != 0 ? last_level_cache_size() : 8 * 1024 * 1024);
+    return threshold;
+}
+
+// store_fence {{{1
+/**\internal
+ * Orders the preceding non-temporal stores before all later stores, so that other threads
+ * observe the written data once the algorithm returns.
+ */
+Vc_INTRINSIC void store_fence()
+{
+#ifdef Vc_STREAMING_USE_CPUID
+    _mm_sfence();
+#endif
+}
+
+template <typename V>
+using is_streamable = std::integral_constant<
+    bool, !std::is_same<typename V::abi, VectorAbi::Scalar>::value>;
+
+// sources {{{1
+/**\internal
+ * The sources of bulk_store: `vector(i)` returns the vector for the entries [i, i + N),
+ * `partial(i, n)` the vector for the \p n < N entries starting at \p i (the remaining
+ * entries are unspecified), and `prefetch(i)` prefetches the input for entry \p i.
+ */
+template <typename V> struct CopySource {
+    const typename V::EntryType *first;
+    Vc_INTRINSIC V vector(std::size_t i) const { return V(first + i, Vc::Unaligned); }
+    Vc_INTRINSIC V partial(std::size_t i, std::size_t n) const
+    {
+        return V::generate([&](std::size_t j) { return first[i + std::min(j, n - 1)]; });
+    }
+    Vc_INTRINSIC void prefetch(std::size_t i) const { Vc::prefetchForOneRead(first + i); }
+};
+
+template <typename V> struct FillSource {
+    V value;
+    Vc_INTRINSIC V vector(std::size_t) const { return value; }
+    Vc_INTRINSIC V partial(std::size_t, std::size_t) const { return value; }
+    Vc_INTRINSIC void prefetch(std::size_t) const {}
+};
+
+// the padding entries of partial vectors repeat the last entry, so that \p op does not
+// see values (such as zero divisors) that are not part of the input
+template <typename V, typename F> struct TransformSource {
+    CopySource<V> src;
+    F op;
+    Vc_INTRINSIC V vector(std::size_t i) const { return op(src.vector(i)); }
+    Vc_INTRINSIC V partial(std::size_t i, std::size_t n) const
+    {
+        return op(src.partial(i, n));
+    }
+    Vc_INTRINSIC void prefetch(std::size_t i) const { src.prefetch(i); }
+};
+
+template <typename V, typename F> struct BinaryTransformSource {
+    CopySource<V> src1, src2;
+    F op;
+    Vc_INTRINSIC V vector(std::size_t i) const
+    {
+        return op(src1.vector(i), src2.vector(i));
+    }
+    Vc_INTRINSIC V partial(std::size_t i, std::size_t n) const
+    {
+        return op(src1.partial(i, n), src2.partial(i, n));
+    }
+    Vc_INTRINSIC void prefetch(std::size_t i) const
+    {
+        src1.prefetch(i);
+        src2.prefetch(i);
+    }
+};
+
+// bulk_store {{{1
+template <typename V, typename Source>
+Vc_INTRINSIC void bulk_store_partial(typename V::EntryType *out, std::size_t i,
+                                     std::size_t n, const Source &src)
+{
+    const V x = src.partial(i, n);
+    for (std::size_t j = 0; j < n; ++j) {
+        out[i + j] = x[j];
+    }
+}
+
+/**\internal
+ * Writes the \p n entries produced by \p src to \p out.
+ *
+ * If the working set of the operation, \p bytes, exceeds the streaming threshold, the
+ * output is written with aligned non-temporal stores, one cache line per iteration, and
+ * the input is prefetched with non-temporal prefetches. The data then bypasses the caches
+ * instead of evicting the working set of the application. Otherwise the output is written
+ * with ordinary stores, which is faster as long as the data fits into the cache.
+ */
+template <typename V, typename Source>
+inline void bulk_store(typename V::EntryType *out, std::size_t n, std::size_t bytes,
+                       const Source &src)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = V::Size;
+    std::size_t i = 0;
+    if (is_streamable<V>::value && bytes > streaming_threshold().load() &&
+        reinterpret_cast<std::uintptr_t>(out) % sizeof(T) == 0) {
+        constexpr std::size_t Align = V::MemoryAlignment;
+        constexpr std::size_t LineSize = 64;
+        constexpr std::size_t LineEntries =
+            LineSize > sizeof(V) ? LineSize / sizeof(T) : N;
+        constexpr std::size_t PrefetchDistance = 16 * LineSize / sizeof(T);
+
+        const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(out) % Align;
+        const std::size_t head = std::min(n, (Align - misalignment) % Align / sizeof(T));
+        if (head > 0) {
+            bulk_store_partial<V>(out, 0, head, src);
+            i = head;
+        }
+        for (; i + LineEntries <= n; i += LineEntries) {
+            if (i + PrefetchDistance < n) {
+                src.prefetch(i + PrefetchDistance);
+            }
+            for (std::size_t j = 0; j < LineEntries; j += N) {
+                src.vector(i + j).store(out + i + j, Vc::Streaming);
+            }
+        }
+        for (; i + N <= n; i += N) {
+            src.vector(i).store(out + i, Vc::Streaming);
+        }
+        store_fence();
+    } else {
+        for (; i + N <= n; i += N) {
+            src.vector(i).store(out + i, Vc::Unaligned);
+        }
+    }
+    if (i < n) {
+        bulk_store_partial<V>(out, i, n - i, src);
+    }
+}
+//}}}1
+}  // namespace Detail
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Returns the working set size in bytes above which Vc::copy, Vc::fill, and
+ * Vc::transform write their output with non-temporal (streaming) stores. It defaults to
+ * the size of the last level cache as reported by CpuId (or 8 MiB if that is unknown).
+ */
+inline std::size_t streamingThreshold() { return Detail::streaming_threshold().load(); }
+
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Sets the working set size in bytes above which Vc::copy, Vc::fill, and Vc::transform
+ * use non-temporal stores. Use this if several processes share the last level cache, or
+ * to disable streaming stores altogether with `std::size_t(-1)`.
+ */
+inline void setStreamingThreshold(std::size_t bytes)
+{
+    Detail::streaming_threshold().store(bytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Vc variant of the `std::copy` algorithm for contiguous ranges of arithmetic types.
+ *
+ * Copies [\p first, \p last) to the range starting at \p d_first and returns the end of
+ * the output range. If the bytes read and written exceed Vc::streamingThreshold(), the
+ * output is written with non-temporal stores and the input is prefetched with
+ * non-temporal prefetches, so that a large copy does not evict the contents of the
+ * caches. The ranges must not overlap.
+ */
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> copy(const T *first,
+                                                                      const T *last,
+                                                                      T *d_first)
+{
+    using V = Vector<T>;
+    const std::size_t n = last - first;
+    if (n == 0) {
+        return d_first;
+    }
+    Detail::bulk_store<V>(d_first, n, 2 * n * sizeof(T), Detail::CopySource<V>{first});
+    return d_first + n;
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt>
+inline enable_if<Traits::is_contiguous_iterator<OutputIt>::value,
+                 Detail::enable_if_contiguous_range<It<Ts...>, OutputIt>>
+copy(It<Ts...> first, It<Ts...> last, OutputIt d_first)
+{
+    if (first == last) {
+        return d_first;
+    }
+    const auto *p = std::addressof(*first);
+    auto *out = std::addressof(*d_first);
+    return d_first + (copy(p, p + std::distance(first, last), out) - out);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Vc variant of the `std::fill` algorithm for contiguous ranges of arithmetic types.
+ *
+ * Assigns \p value to all elements of [\p first, \p last). Ranges larger than
+ * Vc::streamingThreshold() are written with non-temporal stores.
+ */
+template <typename T>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, void> fill(
+    T *first, T *last, const typename std::iterator_traits<T *>::value_type &value)
+{
+    using V = Vector<T>;
+    const std::size_t n = last - first;
+    if (n == 0) {
+        return;
+    }
+    Detail::bulk_store<V>(first, n, n * sizeof(T), Detail::FillSource<V>{V(value)});
+}
+
+template <template <typename...> class It, typename... Ts>
+inline Detail::enable_if_contiguous_range<It<Ts...>, void> fill(
+    It<Ts...> first, It<Ts...> last,
+    const typename std::iterator_traits<It<Ts...>>::value_type &value)
+{
+    if (first == last) {
+        return;
+    }
+    auto *p = std::addressof(*first);
+    fill(p, p + std::distance(first, last), value);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Vc variant of the `std::transform` algorithm for contiguous ranges of arithmetic types.
+ *
+ * Writes `op(x)` for the elements \c x of [\p first, \p last) to the range starting at \p
+ * d_first and returns the end of the output range. \p op is called with `Vc::Vector<T>`
+ * arguments and must return `Vc::Vector<T>`. If the input does not fill the last vector,
+ * the remaining entries of the argument repeat the last element of the input. Large
+ * ranges are written with non-temporal stores, see Vc::copy.
+ *
+ * \p d_first may be equal to \p first. Other overlaps are not allowed.
+ *
+ * \code
+ * Vc::transform(in.begin(), in.end(), out.begin(), [](Vc::float_v x) { return x * x; });
+ * \endcode
+ */
+template <typename T, typename UnaryOperation>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> transform(
+    const T *first, const T *last, T *d_first, UnaryOperation op)
+{
+    using V = Vector<T>;
+    const std::size_t n = last - first;
+    if (n == 0) {
+        return d_first;
+    }
+    Detail::bulk_store<V>(d_first, n, 2 * n * sizeof(T),
+                          Detail::TransformSource<V, UnaryOperation>{{first}, op});
+    return d_first + n;
+}
+
+template <template <typename...> class It, typename... Ts, typename OutputIt,
+          typename UnaryOperation>
+inline enable_if<Traits::is_contiguous_iterator<OutputIt>::value,
+                 Detail::enable_if_contiguous_range<It<Ts...>, OutputIt>>
+transform(It<Ts...> first, It<Ts...> last, OutputIt d_first, UnaryOperation op)
+{
+    if (first == last) {
+        return d_first;
+    }
+    const auto *p = std::addressof(*first);
+    auto *out = std::addressof(*d_first);
+    return d_first + (transform(p, p + std::distance(first, last), out, op) - out);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Writes `op(x, y)` for the elements \c x of [\p first1, \p last1) and the corresponding
+ * elements \c y of the range starting at \p first2 to the range starting at \p d_first.
+ * See the unary Vc::transform.
+ */
+template <typename T, typename BinaryOperation>
+inline enable_if<Traits::is_valid_vector_argument<T>::value, T *> transform(
+    const T *first1, const T *last1, const T *first2, T *d_first, BinaryOperation op)
+{
+    using V = Vector<T>;
+    const std::size_t n = last1 - first1;
+    if (n == 0) {
+        return d_first;
+    }
+    Detail::bulk_store<V>(
+        d_first, n, 3 * n * sizeof(T),
+        Detail::BinaryTransformSource<V, BinaryOperation>{{first1}, {first2}, op});
+    return d_first + n;
+}
+
+template <template <typename...> class It, typename... Ts, typename InputIt2,
+          typename OutputIt, typename BinaryOperation>
+inline enable_if<Traits::is_contiguous_iterator<InputIt2>::value &&
+                     Traits::is_contiguous_iterator<OutputIt>::value,
+                 Detail::enable_if_contiguous_range<It<Ts...>, OutputIt>>
+transform(It<Ts...> first1, It<Ts...> last1, InputIt2 first2, OutputIt d_first,
+          BinaryOperation op)
+{
+    if (first1 == last1) {
+        return d_first;
+    }
+    const auto *p = std::addressof(*first1);
+    const auto *q = std::addressof(*first2);
+    auto *out = std::addressof(*d_first);
+    return d_first +
+           (transform(p, p + std::distance(first1, last1), q, out, op) - out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Copies all vectors of \p src to \p dst, using non-temporal stores for large arrays (see
+ * the Vc::copy overload for ranges). Both Memory objects must have the same
+ * vectorsCount().
+ */
+template <typename V, typename P1, typename P2, int Dimension, typename RM1, typename RM2>
+inline void copy(const Common::MemoryBase<V, P1, Dimension, RM1> &src,
+                 Common::MemoryBase<V, P2, Dimension, RM2> &dst)
+{
+    using T = typename V::EntryType;
+    assert(src.vectorsCount() == dst.vectorsCount());
+    const std::size_t n = dst.vectorsCount() * V::Size;
+    Detail::bulk_store<V>(dst.entries(), n, 2 * n * sizeof(T),
+                          Detail::CopySource<V>{src.entries()});
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Assigns \p value to all entries of \p dst, including the padding, using non-temporal
+ * stores for large arrays.
+ */
+template <typename V, typename P, int Dimension, typename RM>
+inline void fill(Common::MemoryBase<V, P, Dimension, RM> &dst,
+                 typename V::EntryType value)
+{
+    using T = typename V::EntryType;
+    const std::size_t n = dst.vectorsCount() * V::Size;
+    Detail::bulk_store<V>(dst.entries(), n, n * sizeof(T),
+                          Detail::FillSource<V>{V(value)});
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile streaming.h <Vc/algorithm>
+ *
+ * Writes `op(v)` for all vectors \c v of \p src to \p dst, using non-temporal stores for
+ * large arrays. Both Memory objects must have the same vectorsCount(). \p dst may be
+ * \p src.
+ */
+template <typename V, typename P1, typename P2, int Dimension, typename RM1, typename RM2,
+          typename UnaryOperation>
+inline void transform(const Common::MemoryBase<V, P1, Dimension, RM1> &src,
+                      Common::MemoryBase<V, P2, Dimension, RM2> &dst, UnaryOperation op)
+{
+    using T = typename V::EntryType;
+    assert(src.vectorsCount() == dst.vectorsCount());
+    const std::size_t n = dst.vectorsCount() * V::Size;
+    Detail::bulk_store<V>(
+        dst.entries(), n, 2 * n * sizeof(T),
+        Detail::TransformSource<V, UnaryOperation>{{src.entries()}, op});
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_STREAMING_H_
+
+// vim: foldmethod=marker
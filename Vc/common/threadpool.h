@@ -0,0 +1,250 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#ifndef VC_COMMON_THREADPOOL_H_
+#define VC_COMMON_THREADPOOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * \internal
+ * A fixed set of worker threads executing parallel loops over an index range.
+ *
+ * The range of a loop is split into one contiguous block per participating thread. Each
+ * thread processes its own block from the front. A thread that runs out of work steals
+ * the upper half of the remaining indexes of another thread. The calling thread
+ * participates in the loop, thus a pool of size N starts N - 1 threads.
+ *
+ * A loop started from inside a running loop, or while another thread uses the pool,
+ * executes serially on the calling thread instead of blocking.
+ */
+class ThreadPool
+{
+public:
+    /// Returns the number of threads the hardware supports concurrently (at least 1).
+    static unsigned int defaultSize()
+    {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /// Returns the process-wide pool, which is started on first use.
+    static ThreadPool &global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    explicit ThreadPool(unsigned int size = defaultSize())
+        : m_slots(new Slot[std::max(1u, size)])
+    {
+        m_workers.reserve(size);
+        for (unsigned int i = 1; i < size; ++i) {
+            m_workers.emplace_back([this, i]() { workerMain(i); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto &t : m_workers) {
+            t.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// Returns the number of threads that can execute a loop, including the caller.
+    unsigned int size() const { return unsigned(m_workers.size()) + 1; }
+
+    /**
+     * Calls \p f(i) for all \p i in [0, \p n), using at most \p maxThreads threads (0
+     * means size()). The function returns after all calls have completed. \p f must not
+     * throw.
+     */
+    template <typename F> void parallel_for(std::size_t n, F &&f, unsigned int maxThreads = 0)
+    {
+        using Fun = typename std::remove_reference<F>::type;
+        const std::size_t participants = std::min<std::size_t>(
+            n, std::min(size(), maxThreads == 0 ? size() : maxThreads));
+        if (participants <= 1 || insidePool() || !m_jobMutex.try_lock()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                f(i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> jobLock(m_jobMutex, std::adopt_lock);
+
+        for (std::size_t p = 0; p < participants; ++p) {
+            m_slots[p].begin = n * p / participants;
+            m_slots[p].end = n * (p + 1) / participants;
+        }
+        m_function = const_cast<void *>(static_cast<const void *>(std::addressof(f)));
+        m_invoke = [](void *fun, std::size_t i) { (*static_cast<Fun *>(fun))(i); };
+        m_pending.store(unsigned(participants - 1), std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_participants = unsigned(participants);
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        insidePool() = true;
+        work(0, unsigned(participants));
+        insidePool() = false;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [&]() { return m_pending.load() == 0; });
+    }
+
+private:
+    // one block of indexes; padded so that the blocks of two threads never share a
+    // cache line
+    struct Slot {
+        std::mutex lock;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        char padding[64];
+    };
+
+    static bool &insidePool()
+    {
+        static thread_local bool inside = false;
+        return inside;
+    }
+
+    void workerMain(unsigned int self)
+    {
+        insidePool() = true;
+        std::uint64_t seen = 0;
+        for (;;) {
+            unsigned int participants;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+                if (m_stop) {
+                    return;
+                }
+                seen = m_generation;
+                participants = m_participants;
+            }
+            if (self < participants) {
+                work(self, participants);
+                if (m_pending.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_done.notify_all();
+                }
+            }
+        }
+    }
+
+    // takes the next index from the front of the own block
+    bool pop(unsigned int self, std::size_t &i)
+    {
+        Slot &s = m_slots[self];
+        std::lock_guard<std::mutex> lock(s.lock);
+        if (s.begin == s.end) {
+            return false;
+        }
+        i = s.begin++;
+        return true;
+    }
+
+    // moves the upper half of another thread's remaining block into the own block
+    bool steal(unsigned int self, unsigned int participants)
+    {
+        for (unsigned int k = 1; k < participants; ++k) {
+            Slot &victim = m_slots[(self + k) % participants];
+            std::size_t begin, end;
+            {
+                std::lock_guard<std::mutex> lock(victim.lock);
+                if (victim.begin == victim.end) {
+                    continue;
+                }
+                begin = victim.begin + (victim.end - victim.begin) / 2;
+                end = victim.end;
+                victim.end = begin;
+            }
+            Slot &s = m_slots[self];
+            std::lock_guard<std::mutex> lock(s.lock);
+            s.begin = begin;
+            s.end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void work(unsigned int self, unsigned int participants)
+    {
+        std::size_t i;
+        do {
+            while (pop(self, i)) {
+                m_invoke(m_function, i);
+            }
+        } while (steal(self, participants));
+    }
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_jobMutex;  // serializes loops
+    std::mutex m_mutex;     // protects m_generation, m_participants, and m_stop
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::uint64_t m_generation = 0;
+    unsigned int m_participants = 0;
+    bool m_stop = false;
+    std::atomic<unsigned int> m_pending{0};
+
+    void *m_function = nullptr;
+    void (*m_invoke)(void *, std::size_t) = nullptr;
+};
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_THREADPOOL_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,648 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+/* exp, exp2, expm1, log, log2, log1p, cbrt, and pow for all native float and double
+ * vectors (Scalar, SSE, AVX, AVX-512). SimdArray forwards to its native pieces, thus the
+ * results are identical for all implementations (up to FMA contraction).
+ *
+ * Every function except expm1 is available in two tiers, selected via a trailing
+ * Vc::PreciseMath (the default) or Vc::FastMath argument; double pow ignores the tag.
+ * The polynomials of both tiers are identical (minimax fits whose own error is far below
+ * 1 ULP); the tiers differ in the handling of the range ends and in the final
+ * summation:
+ * - PreciseMath: ≤ 1 ULP, subnormal arguments and results are handled exactly (the
+ *   scaling by 2ⁿ is split into two multiplications, subnormal arguments to log and cbrt
+ *   are normalized first). log and log2 carry the sum of the exponent and the leading
+ *   term in twice the working precision.
+ * - FastMath: ≤ 4 ULP, a single ldexp does the scaling; results that would be subnormal
+ *   are flushed to zero and subnormal arguments are not supported.
+ */
+
+namespace Detail
+{
+// enable_if_transcendental {{{1
+template <class T, class Abi>
+using enable_if_transcendental =
+    enable_if<std::is_floating_point<T>::value && !detail::is_fixed_size_abi<Abi>::value,
+              Vector<T, Abi>>;
+
+// TranscendentalConst {{{1
+template <class T> struct TranscendentalConst;
+template <> struct TranscendentalConst<float> {
+    static constexpr float log2e() { return 1.44269504088896341f; }
+    static constexpr float log2e_hi() { return 1.4426950216293335f; }
+    static constexpr float log2e_lo() { return 1.9259629911266175e-08f; }
+    // ln2() + ln2_tail() approximates ln(2) to twice the precision
+    static constexpr float ln2() { return 0.6931471824645996f; }
+    static constexpr float ln2_tail() { return -1.904654299957768e-09f; }
+    // Cody-Waite split of ln2 for the argument reduction of exp: n * ln2_hi is exact
+    static constexpr float ln2_hi() { return 0.693359375f; }
+    static constexpr float ln2_lo() { return -2.12194440e-4f; }
+    // split of ln2 for the reconstruction of log: e * log_ln2_hi is exact
+    static constexpr float log_ln2_hi() { return 6.9313812256e-01f; }
+    static constexpr float log_ln2_lo() { return 9.0580006145e-06f; }
+    static constexpr float sqrt_half() { return 0.707106781186547524f; }
+    static constexpr float max_log() { return 88.72283905206835f; }       // ln(FLT_MAX)
+    static constexpr float min_log() { return -103.97207708399179f; }     // ln(2⁻¹⁵⁰)
+    static constexpr float min_normal_log() { return -87.3365447505531f; } // ln(2⁻¹²⁶)
+    static constexpr float max_exp() { return 128.f; }
+    static constexpr float min_exp() { return -150.f; }
+    static constexpr float min_normal_exp() { return -126.f; }
+    static constexpr float expm1_min() { return -18.f; }  // expm1(x) rounds to -1 below
+    static constexpr float min_normal() { return 1.17549435e-38f; }
+    static constexpr float subnormal_scale() { return 16777216.f; }  // 2²⁴
+    static constexpr int subnormal_scale_exp() { return 24; }
+};
+template <> struct TranscendentalConst<double> {
+    static constexpr double log2e() { return 1.4426950408889634074; }
+    static constexpr double log2e_hi() { return 1.4426950408889634; }
+    static constexpr double log2e_lo() { return 2.0355273740931033e-17; }
+    static constexpr double ln2() { return 0.6931471805599453; }
+    static constexpr double ln2_tail() { return 2.3190468138462996e-17; }
+    static constexpr double ln2_hi() { return 6.93145751953125E-1; }
+    static constexpr double ln2_lo() { return 1.42860682030941723212E-6; }
+    static constexpr double log_ln2_hi() { return 6.93147180369123816490e-01; }
+    static constexpr double log_ln2_lo() { return 1.90821492927058770002e-10; }
+    static constexpr double sqrt_half() { return 0.70710678118654752440; }
+    static constexpr double max_log() { return 709.782712893384; }        // ln(DBL_MAX)
+    static constexpr double min_log() { return -745.1332191019412; }      // ln(2⁻¹⁰⁷⁵)
+    static constexpr double min_normal_log() { return -708.3964185322641; } // ln(2⁻¹⁰²²)
+    static constexpr double max_exp() { return 1024.; }
+    static constexpr double min_exp() { return -1075.; }
+    static constexpr double min_normal_exp() { return -1022.; }
+    static constexpr double expm1_min() { return -40.; }
+    static constexpr double min_normal() { return 2.2250738585072014e-308; }
+    static constexpr double subnormal_scale() { return 18014398509481984.; }  // 2⁵⁴
+    static constexpr int subnormal_scale_exp() { return 54; }
+};
+
+// is_precise {{{1
+constexpr bool is_precise(PreciseMathTag) { return true; }
+constexpr bool is_precise(FastMathTag) { return false; }
+
+// DoubleDouble {{{1
+// unevaluated sum hi + lo: carries rounding errors of the argument reductions and of
+// log(x) in pow
+template <class V> struct DoubleDouble {
+    V hi, lo;
+};
+// With -ffp-contract=fast GCC fuses a rounded product of builtin floating-point types
+// into the addition that consumes it, while other uses of the product still see the
+// rounded value. That breaks the error-free transformations below; the empty asm hides
+// the value of x from the optimizer and thus forces the rounding.
+template <class V> Vc_INTRINSIC V keep_rounded(V x) { return x; }
+#if defined Vc_GNU_ASM && (defined __FMA__ || defined __FMA4__)
+template <class T> Vc_INTRINSIC Scalar::Vector<T> keep_rounded(Scalar::Vector<T> x)
+{
+    asm("" : "+x"(x.data()));
+    return x;
+}
+#endif
+template <class V> Vc_INTRINSIC DoubleDouble<V> two_sum(const V &a_, const V &b_)
+{
+    const V a = keep_rounded(a_);
+    const V b = keep_rounded(b_);
+    const V s = a + b;
+    const V bb = s - a;
+    return {s, (a - (s - bb)) + (b - bb)};
+}
+// requires |a| ≥ |b|
+template <class V> Vc_INTRINSIC DoubleDouble<V> fast_two_sum(const V &a_, const V &b_)
+{
+    const V a = keep_rounded(a_);
+    const V b = keep_rounded(b_);
+    const V s = a + b;
+    return {s, b - (s - a)};
+}
+template <class V> Vc_INTRINSIC DoubleDouble<V> two_prod(const V &a, const V &b)
+{
+    const V p = keep_rounded(a * b);
+#ifdef Vc_IMPL_FMA
+    return {p, fma(a, b, -p)};
+#else
+    // Dekker's product
+    using T = typename V::EntryType;
+    const T splitter = std::is_same<T, float>::value ? T(4097) : T(134217729);
+    const V ta = keep_rounded(a * splitter);
+    const V tb = keep_rounded(b * splitter);
+    const V ah = ta - (ta - a);
+    const V bh = tb - (tb - b);
+    const V al = a - ah;
+    const V bl = b - bh;
+    return {p, ((ah * bh - p) + ah * bl + al * bh) + al * bl};
+#endif
+}
+template <class V>
+Vc_INTRINSIC DoubleDouble<V> dd_mul(const DoubleDouble<V> &a, const DoubleDouble<V> &b)
+{
+    const DoubleDouble<V> p = two_prod(a.hi, b.hi);
+    return fast_two_sum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+
+// expm1_tail {{{1
+// returns eʳ - 1 - r = ½r² + r³ q(r) for |r| ≤ ln(2)/2, with ½r² evaluated exactly
+template <class V> Vc_INTRINSIC V expm1_q(const V &r, float)
+{
+    return (((1.988269636348599313282e-04f * r + 1.392618181048934266105e-03f) * r +
+             8.333320888355046877407e-03f) * r + 4.166655462787808321319e-02f) * r +
+           1.666666666666666666667e-01f;
+}
+template <class V> Vc_INTRINSIC V expm1_q(const V &r, double)
+{
+    return ((((((((2.091123498804083026312e-09 * r + 2.510038319586702133463e-08) * r +
+                  2.755728297300241753159e-07) * r + 2.755726846483162645217e-06) * r +
+                2.480158731714227710917e-05) * r + 1.984126986305050554873e-04) * r +
+              1.388888888888655296181e-03) * r + 8.333333333330062455457e-03) * r +
+            4.166666666666666722791e-02) * r +
+           1.666666666666666745255e-01;
+}
+template <class V> Vc_INTRINSIC DoubleDouble<V> expm1_tail(const V &r)
+{
+    using T = typename V::EntryType;
+    const DoubleDouble<V> r2 = two_prod(r, r);
+    return {T(0.5) * r2.hi, T(0.5) * r2.lo + r2.hi * r * expm1_q(r, T())};
+}
+
+// exp_mantissa {{{1
+// returns e^(r + c) for |r| ≤ ln(2)/2 and a small correction c. The sums 1 + r and ½r²
+// are evaluated exactly, so that essentially only the final addition rounds.
+template <class V> Vc_INTRINSIC V exp_mantissa(const V &r, const V &c)
+{
+    const DoubleDouble<V> s = fast_two_sum(V::One(), r);
+    const DoubleDouble<V> t = expm1_tail(r);
+    return s.hi + (t.hi + (s.lo + (t.lo + c)));
+}
+
+// reduce_ln2 {{{1
+// returns r + c = x - n ln(2) with n = round(x / ln(2)) and the rounding error c of r
+template <class V> Vc_INTRINSIC V reduce_ln2(const V &x, V &n, V &c)
+{
+    using T = typename V::EntryType;
+    using C = TranscendentalConst<T>;
+    n = floor(x * C::log2e() + T(0.5));
+    const V hi = x - n * C::ln2_hi();  // exact
+    const V lo = n * C::ln2_lo();
+    const V r = hi - lo;
+    c = (hi - r) - lo;
+    return r;
+}
+
+// scale_exp2 {{{1
+// returns p * 2ⁿ for integral n. The precise variant splits the scaling into two factors
+// so that n may exceed the normal exponent range by a factor of two (subnormal results and
+// overflow to inf are rounded correctly).
+template <class V> Vc_INTRINSIC V scale_exp2(const V &p, const V &n, PreciseMathTag)
+{
+    using IV = SimdArray<int, V::Size>;
+    const V n1 = floor(n * typename V::EntryType(0.5));
+    return p * ldexp(V::One(), static_cast<IV>(n1)) * ldexp(V::One(), static_cast<IV>(n - n1));
+}
+template <class V> Vc_INTRINSIC V scale_exp2(const V &p, const V &n, FastMathTag)
+{
+    return ldexp(p, static_cast<SimdArray<int, V::Size>>(n));
+}
+
+// log_decompose {{{1
+// returns f = m - 1 and e with x = 2ᵉ m, m ∈ [√½, √2) for positive finite x
+template <class V, class Tag> Vc_INTRINSIC V log_decompose(V x, V &e, Tag)
+{
+    using T = typename V::EntryType;
+    using C = TranscendentalConst<T>;
+    V bias = V::Zero();
+    if (is_precise(Tag())) {
+        const auto subnormal = x < C::min_normal();
+        x(subnormal) *= C::subnormal_scale();
+        bias(subnormal) = T(-C::subnormal_scale_exp());
+    }
+    SimdArray<int, V::Size> exponent;
+    V m = frexp(x, &exponent);  // m ∈ [½, 1)
+    e = simd_cast<V>(exponent) + bias;
+    const auto small = m < C::sqrt_half();
+    m(small) += m;
+    e(small) -= V::One();
+    return m - V::One();
+}
+
+// log_kernel {{{1
+// returns 2 z P(z) for log(1 + f) = 2 atanh(s) = 2s + s · (2 z P(z)), s = f / (2 + f), z = s²
+template <class V> Vc_INTRINSIC V log_kernel(const V &z, float)
+{
+    return z * ((2.958004616831219886636e-01f * z + 3.998877843365143732716e-01f) * z +
+                6.666668504478587830298e-01f);
+}
+template <class V> Vc_INTRINSIC V log_kernel(const V &z, double)
+{
+    return z * ((((((1.461657642164438596022e-01 * z + 1.533171134667299597865e-01) * z +
+                    1.818288943375751642284e-01) * z + 2.222221113056072644210e-01) * z +
+                  2.857142862600142557472e-01) * z + 3.999999999989944729712e-01) * z +
+                6.666666666666669688164e-01);
+}
+
+// log_reconstruct {{{1
+// returns e ln(2) + log(1 + f) + corr for f ∈ [√½ - 1, √2 - 1) and a small correction term
+template <class V> Vc_INTRINSIC V log_reconstruct(const V &f, const V &e, const V &corr,
+                                                  PreciseMathTag)
+{
+    using T = typename V::EntryType;
+    using C = TranscendentalConst<T>;
+    const V s = f / (T(2) + f);
+    const V hfsq = T(0.5) * f * f;
+    const V R = log_kernel(s * s, T());
+    // e ln2_hi is exact; its sum with f is carried exactly so that only the small terms
+    // are rounded before the final addition
+    const DoubleDouble<V> a = two_sum(e * C::log_ln2_hi(), f);
+    return a.hi + (a.lo + ((s * (hfsq + R) - hfsq) + (e * C::log_ln2_lo() + corr)));
+}
+template <class V> Vc_INTRINSIC V log_reconstruct(const V &f, const V &e, const V &corr,
+                                                  FastMathTag)
+{
+    using T = typename V::EntryType;
+    using C = TranscendentalConst<T>;
+    const V s = f / (T(2) + f);
+    const V hfsq = T(0.5) * f * f;
+    const V R = log_kernel(s * s, T());
+    // fdlibm's evaluation order: the small terms are summed first
+    return e * C::log_ln2_hi() -
+           ((hfsq - (s * (hfsq + R) + (e * C::log_ln2_lo() + corr))) - f);
+}
+
+// log2_reconstruct {{{1
+// returns e + log₂(1 + f) for f ∈ [√½ - 1, √2 - 1)
+template <class V> Vc_INTRINSIC V log2_reconstruct(const V &f, const V &e, PreciseMathTag)
+{
+    using T = typename V::EntryType;
+    using C = TranscendentalConst<T>;
+    const V s = f / (T(2) + f);
+    const DoubleDouble<V> f2 = two_prod(f, f);
+    const V hfsq = T(0.5) * f2.hi;
+    const V R = log_kernel(s * s, T());
+    // log(1 + f) = f - ½f² + s (½f² + R) as a double-double l, then
+    // log₂(1 + f) = l · log₂(e) with log₂(e) split into head and tail
+    const DoubleDouble<V> l0 = two_sum(f, -hfsq);
+    const DoubleDouble<V> l = {l0.hi, l0.lo + (s * (hfsq + R) - T(0.5) * f2.lo)};
+    const DoubleDouble<V> p = two_prod(l.hi, V(C::log2e_hi()));
+    const DoubleDouble<V> r = two_sum(e, p.hi);
+    return r.hi + (r.lo + (p.lo + (l.hi * C::log2e_lo() + l.lo * C::log2e())));
+}
+template <class V> Vc_INTRINSIC V log2_reconstruct(const V &f, const V &e, FastMathTag)
+{
+    using T = typename V::EntryType;
+    using C = TranscendentalConst<T>;
+    const V s = f / (T(2) + f);
+    const V hfsq = T(0.5) * f * f;
+    const V R = log_kernel(s * s, T());
+    return e + (f + (s * (hfsq + R) - hfsq)) * C::log2e();
+}
+
+// log_fixup {{{1
+template <class V> Vc_INTRINSIC V log_fixup(V ret, const V &x)
+{
+    using T = typename V::EntryType;
+    ret(x == V::Zero()) = -std::numeric_limits<T>::infinity();
+    ret(isinf(x)) = x;
+    ret.setQnan(x < V::Zero() || isnan(x));
+    return ret;
+}
+
+// log_dd {{{1
+// log(x) for positive, finite, normal double x with ~2⁻⁶⁸ relative error
+template <class V> Vc_INTRINSIC DoubleDouble<V> log_dd(const V &x)
+{
+    using C = TranscendentalConst<double>;
+    V e;
+    const V num = log_decompose(x, e, PreciseMath);  // m - 1, exact
+    const DoubleDouble<V> den = two_sum(num, V(2.));    // m + 1
+    // s = (m - 1) / (m + 1), log(m) = 2 atanh(s) = 2s + ⅔ s³ + 2 s³ z Q(z)
+    const V q1 = num / den.hi;
+    const DoubleDouble<V> p = two_prod(q1, den.hi);
+    const V q2 = (((num - p.hi) - p.lo) - q1 * den.lo) / den.hi;
+    const DoubleDouble<V> s = fast_two_sum(q1, q2);
+    const DoubleDouble<V> s3 = dd_mul(dd_mul(s, s), s);
+    const DoubleDouble<V> t =
+        dd_mul(s3, DoubleDouble<V>{V(0.6666666666666666), V(3.700743415417188e-17)});
+    const V z = s.hi * s.hi;
+    const V tail =
+        V(2.) * s3.hi * z *
+        (((((((5.861585080401532739984e-02 * z + 5.853118574407951645059e-02) * z +
+              6.667402331812179816811e-02) * z + 7.692297481537066932848e-02) * z +
+            9.090909167693800352536e-02) * z + 1.111111111082795432349e-01) * z +
+          1.428571428571468309867e-01) * z + 1.999999999999999990858e-01);
+    DoubleDouble<V> r = two_sum(e * C::log_ln2_hi(), V(2.) * s.hi);
+    const DoubleDouble<V> r2 = two_sum(r.hi, t.hi);
+    return fast_two_sum(r2.hi, r.lo + r2.lo +
+                                   (V(2.) * s.lo + e * C::log_ln2_lo() + t.lo + tail));
+}
+
+// exp_dd {{{1
+// e^(a.hi + a.lo) with |a.lo| ≤ ulp(a.hi)
+template <class V> Vc_INTRINSIC V exp_dd(const DoubleDouble<V> &a)
+{
+    using C = TranscendentalConst<double>;
+    const V x = min(max(a.hi, V(C::min_log() - 1)), V(C::max_log() + 1));
+    const V n = floor(x * C::log2e() + 0.5);
+    const DoubleDouble<V> r = two_sum(x - n * C::ln2_hi(), a.lo - n * C::ln2_lo());
+    return scale_exp2(exp_mantissa(r.hi, r.lo), n, PreciseMath);
+}
+
+// pow_fixup {{{1
+// applies the sign and the C99 special cases to r = |x|ʸ
+template <class V> Vc_INTRINSIC V pow_fixup(V r, const V &x, const V &y)
+{
+    using T = typename V::EntryType;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+    const V ax = abs(x);
+    const auto yIsInt = isfinite(y) && floor(y) == y;
+    const auto yIsOdd = yIsInt && floor(y * T(0.5)) != y * T(0.5);
+    const auto yNegative = y < V::Zero();
+
+    r.setQnan(x < V::Zero() && !yIsInt);
+    r(x == V::Zero() || isinf(x)) = iif((x == V::Zero()) == yNegative, V(inf), V::Zero());
+    r(isinf(y)) = iif(ax == V::One(), V::One(), iif((ax < V::One()) == yNegative, V(inf), V::Zero()));
+    r(yIsOdd && isnegative(x)) = -r;
+    r.setQnan(isnan(x) || isnan(y));
+    r(y == V::Zero() || x == V::One()) = V::One();
+    return r;
+}
+
+// pow_impl {{{1
+template <class V, class Tag> Vc_INTRINSIC V pow_impl(const V &x, const V &y, Tag, double)
+{
+    // |x|ʸ = e^(y log|x|) with log|x| and the product in double-double precision. A
+    // plain double log loses up to |y log|x|| · 2⁻⁵³ and cannot meet even 4 ULP, therefore
+    // both tiers use this algorithm.
+    const V ax = abs(x);
+    const V axs = iif(ax == V::Zero() || !isfinite(ax), V::One(), ax);
+    // |y| ≤ 2⁶⁴ avoids overflow in the splitting; y log|x| overflows anyway beyond
+    const V ys = iif(isfinite(y), min(max(y, V(-18446744073709551616.)), V(18446744073709551616.)), V::Zero());
+    const DoubleDouble<V> l = log_dd(axs);
+    const DoubleDouble<V> p = two_prod(l.hi, ys);
+    return pow_fixup(exp_dd(fast_two_sum(p.hi, p.lo + l.lo * ys)), x, y);
+}
+template <class V, class Tag> Vc_INTRINSIC V pow_impl(const V &x, const V &y, Tag, float)
+{
+    // In double precision, e^(y log|x|) has an error of at most 2⁻⁴⁵ for all float
+    // results, which is far below the final rounding to float.
+    using D = fixed_size_simd<double, V::Size>;
+    const V ax = abs(x);
+    const V axs = iif(ax == V::Zero() || !isfinite(ax), V::One(), ax);
+    const V ys = iif(isfinite(y), y, V::Zero());
+    const D r = exp(simd_cast<D>(ys) * log(simd_cast<D>(axs), Tag()), Tag());
+    return pow_fixup(simd_cast<V>(r), x, y);
+}
+//}}}1
+}  // namespace Detail
+
+// exp {{{1
+/**
+ * Returns \f$e^x\f$, evaluated with the accuracy tier given by \p tag.
+ */
+template <class T, class Abi>
+inline Detail::enable_if_transcendental<T, Abi> exp(const Vector<T, Abi> &x, PreciseMathTag)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::TranscendentalConst<T>;
+    V n, c;
+    const V r =
+        Detail::reduce_ln2(min(max(x, V(C::min_log() - 1)), V(C::max_log() + 1)), n, c);
+    V ret = Detail::scale_exp2(Detail::exp_mantissa(r, c), n, PreciseMath);
+    ret(isnan(x)) = x;
+    return ret;
+}
+template <class T, class Abi>
+inline Detail::enable_if_transcendental<T, Abi> exp(const Vector<T, Abi> &x, FastMathTag)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::TranscendentalConst<T>;
+    V n, c;
+    const V r = Detail::reduce_ln2(min(max(x, V(C::min_normal_log())), V(C::max_log())), n, c);
+    V ret = Detail::scale_exp2(Detail::exp_mantissa(r, c), n, FastMath);
+    ret.setZero(x < C::min_normal_log());
+    ret(x > C::max_log()) = std::numeric_limits<T>::infinity();
+    ret(isnan(x)) = x;
+    return ret;
+}
+
+// exp2 {{{1
+/**
+ * Returns \f$2^x\f$.
+ *
+ * \param x The exponent.
+ * \param tag Vc::PreciseMath (default) or Vc::FastMath.
+ */
+template <class T, class Abi>
+inline Detail::enable_if_transcendental<T, Abi> exp2(const Vector<T, Abi> &x,
+                                                     PreciseMathTag = PreciseMath)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::TranscendentalConst<T>;
+    const V xc = min(max(x, V(C::min_exp() - 1)), V(C::max_exp() + 1));
+    const V n = floor(xc + T(0.5));
+    const V f = xc - n;  // exact
+    const Detail::DoubleDouble<V> r = Detail::two_prod(f, V(C::ln2()));
+    V ret = Detail::scale_exp2(
+        Detail::exp_mantissa(r.hi, r.lo + f * C::ln2_tail()), n, PreciseMath);
+    ret(isnan(x)) = x;
+    return ret;
+}
+template <class T, class Abi>
+inline Detail::enable_if_transcendental<T, Abi> exp2(const Vector<T, Abi> &x, FastMathTag)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::TranscendentalConst<T>;
+    const V xc = min(max(x, V(C::min_normal_exp())), V(C::max_exp()));
+    const V n = floor(xc + T(0.5));
+    const V f = xc - n;  // exact
+    const Detail::DoubleDouble<V> r = Detail::two_prod(f, V(C::ln2()));
+    V ret = Detail::scale_exp2(
+        Detail::exp_mantissa(r.hi, r.lo + f * C::ln2_tail()), n, FastMath);
+    ret.setZero(x < C::min_normal_exp());
+    ret(x >= C::max_exp()) = std::numeric_limits<T>::infinity();
+    ret(isnan(x)) = x;
+    return ret;
+}
+
+// expm1 {{{1
+/**
+ * Returns \f$e^x - 1\f$, accurate also for \p x close to zero.
+ *
+ * There is no Vc::FastMath tier. The cancellation in \f$e^x - 1\f$ has to be carried in
+ * extended precision in any case, which leaves nothing to trade for speed.
+ */
+template <class T, class Abi>
+inline Detail::enable_if_transcendental<T, Abi> expm1(const Vector<T, Abi> &x,
+                                                      PreciseMathTag = PreciseMath)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::TranscendentalConst<T>;
+    V n, c;
+    const V r = Detail::reduce_ln2(min(max(x, V(C::expm1_min())), V(C::max_log())), n, c);
+    // eˣ - 1 = 2ⁿ (1 + r + c + t) - 1 = 2 ((h - ½) + h r + h (c + t)) with h = 2ⁿ⁻¹ and
+    // t = expm1_tail(r). h - ½ is exact for n ≤ digits, for larger n the -½ moves to the
+    // small terms instead. 2ⁿ⁻¹ does not overflow for x ≤ max_log.
+    const V h = ldexp(V(T(0.5)), static_cast<SimdArray<int, V::Size>>(n));
+    const V half = iif(n > T(std::numeric_limits<T>::digits), V::Zero(), V(T(0.5)));
+    const Detail::DoubleDouble<V> s = Detail::two_sum(h - half, h * r);
+    const Detail::DoubleDouble<V> t = Detail::expm1_tail(r);
+    V ret = T(2) * (s.hi + (h * t.hi + (s.lo + (h * (t.lo + c) - (T(0.5) - half)))));
+    ret(x > C::max_log()) = std::numeric_limits<T>::infinity();
+    // expm1(x) rounds to x; this also avoids halving subnormal x above
+    ret(abs(x) < T(0.5) * std::numeric_limits<T>::epsilon() || isnan(x)) = x;
+    return ret;
+}
+
+// log {{{1
+/**
+ * Returns the natural logarithm of \p x, evaluated with the accuracy tier given by the
+ * second argument.
+ */
+template <class T, class Abi, class Tag>
+inline enable_if<std::is_same<Tag, PreciseMathTag>::value ||
+                     std::is_same<Tag, FastMathTag>::value,
+                 Detail::enable_if_transcendental<T, Abi>>
+log(const Vector<T, Abi> &x, Tag)
+{
+    using V = Vector<T, Abi>;
+    V e;
+    const V f = Detail::log_decompose(x, e, Tag());
+    const V ret = Detail::log_reconstruct(f, e, V::Zero(), Tag());
+    return Detail::log_fixup(ret, x);
+}
+
+// log2 {{{1
+/**
+ * Returns the base-2 logarithm of \p x, evaluated with the accuracy tier given by the
+ * second argument.
+ */
+template <class T, class Abi, class Tag>
+inline enable_if<std::is_same<Tag, PreciseMathTag>::value ||
+                     std::is_same<Tag, FastMathTag>::value,
+                 Detail::enable_if_transcendental<T, Abi>>
+log2(const Vector<T, Abi> &x, Tag)
+{
+    using V = Vector<T, Abi>;
+    V e;
+    const V f = Detail::log_decompose(x, e, Tag());
+    return Detail::log_fixup(Detail::log2_reconstruct(f, e, Tag()), x);
+}
+
+// log1p {{{1
+/**
+ * Returns \f$\ln(1 + x)\f$, accurate also for \p x close to zero, evaluated with the
+ * accuracy tier given by \p tag.
+ */
+template <class T, class Abi, class Tag = PreciseMathTag>
+inline enable_if<std::is_same<Tag, PreciseMathTag>::value ||
+                     std::is_same<Tag, FastMathTag>::value,
+                 Detail::enable_if_transcendental<T, Abi>>
+log1p(const Vector<T, Abi> &x, Tag = Tag())
+{
+    using V = Vector<T, Abi>;
+    const V u = V::One() + x;
+    V e;
+    // 1 + x is zero or at least ε/2, i.e. never subnormal
+    const V fu = Detail::log_decompose(u, e, FastMath);
+    // for e = 0 the argument x is used directly, otherwise u - 1 may differ from x and the
+    // first order correction is (x - (u - 1)) / u
+    const auto e0 = e == V::Zero();
+    const V f = iif(e0, x, fu);
+    const V corr = iif(e0, V::Zero(), (x - (u - V::One())) / u);
+    V ret = Detail::log_reconstruct(f, e, corr, Tag());
+    ret(x == std::numeric_limits<T>::infinity()) = x;
+    ret(x == -V::One()) = -std::numeric_limits<T>::infinity();
+    ret.setQnan(x < -V::One() || isnan(x));
+    return ret;
+}
+
+// cbrt {{{1
+/**
+ * Returns the cube root of \p x.
+ *
+ * \param x The argument (negative values yield negative results).
+ * \param tag Vc::PreciseMath (default) or Vc::FastMath.
+ */
+template <class T, class Abi, class Tag = PreciseMathTag>
+inline enable_if<std::is_same<Tag, PreciseMathTag>::value ||
+                     std::is_same<Tag, FastMathTag>::value,
+                 Detail::enable_if_transcendental<T, Abi>>
+cbrt(const Vector<T, Abi> &x, Tag = Tag())
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::TranscendentalConst<T>;
+    V ax = abs(x);
+    V bias = V::Zero();
+    if (Detail::is_precise(Tag())) {
+        const auto subnormal = ax < C::min_normal();
+        ax(subnormal) *= C::subnormal_scale();
+        bias(subnormal) = T(-C::subnormal_scale_exp() / 3);
+    }
+    SimdArray<int, V::Size> exponent;
+    V m = frexp(ax, &exponent);  // m ∈ [½, 1)
+    const V e = simd_cast<V>(exponent);
+    const V q = floor((e + T(0.5)) * T(1. / 3.));
+    const V rem = e - T(3) * q;  // 0, 1, or 2
+    V y = (((T(-1.282900999192806502880e-01) * m + T(5.275189932675064653450e-01)) * m -
+            T(9.332461525564668945094e-01)) * m + T(1.129820613223312051991e+00)) * m +
+          T(4.041905114544540218019e-01);  // cbrt(m) with 1.3e-5 relative error
+    y *= iif(rem == V::One(), V(T(1.2599210498948732)),
+             iif(rem == V::Zero(), V::One(), V(T(1.5874010519681994))));
+    m *= iif(rem == V::One(), V(T(2)), iif(rem == V::Zero(), V::One(), V(T(4))));
+    // Newton iterations double the number of correct bits each
+    y -= (y - m / (y * y)) * T(1. / 3.);
+    if (std::is_same<T, double>::value) {
+        y -= (y - m / (y * y)) * T(1. / 3.);
+        y -= (y - m / (y * y)) * T(1. / 3.);
+    }
+    V ret = copysign(ldexp(y, static_cast<SimdArray<int, V::Size>>(q + bias)), x);
+    ret(x == V::Zero() || !isfinite(x)) = x;
+    return ret;
+}
+
+// pow {{{1
+/**
+ * Returns \f$x^y\f$, including all special cases of C99 pow.
+ *
+ * \param x The base.
+ * \param y The exponent.
+ * \param tag Vc::PreciseMath (default) or Vc::FastMath.
+ *
+ * float is evaluated in double precision, with the tier applied to the double exp and
+ * log. For double there is no Vc::FastMath tier: \f$y \log|x|\f$ needs double-double
+ * arithmetic to stay within 4 ULP, so the tag is accepted and ignored.
+ */
+template <class T, class Abi, class Tag = PreciseMathTag>
+inline enable_if<std::is_same<Tag, PreciseMathTag>::value ||
+                     std::is_same<Tag, FastMathTag>::value,
+                 Detail::enable_if_transcendental<T, Abi>>
+pow(const Vector<T, Abi> &x, const Vector<T, Abi> &y, Tag = Tag())
+{
+    return Detail::pow_impl(x, y, Tag(), T());
+}
+//}}}1
+
+#endif  // Vc_COMMON_MATH_H_INTERNAL
@@ -89,6 +89,28 @@ constexpr VectorSpecialInitializerOne One = {};
  * initialized to values 0, 1, 2, 3, 4, ...
  */
 constexpr VectorSpecialInitializerIndexesFromZero IndexesFromZero = {};
+
+/**\internal
+ * Tag type selecting the accurate variant of a math function.
+ */
+struct PreciseMathTag {};
+/**\internal
+ * Tag type selecting the fast variant of a math function.
+ */
+struct FastMathTag {};
+/**
+ * The special object \p Vc::PreciseMath selects the accurate variant of exp, exp2, expm1,
+ * log, log2, log1p, cbrt, and pow: at most 1 ULP error, subnormal inputs and results are
+ * supported. This is the default.
+ */
+constexpr PreciseMathTag PreciseMath = {};
+/**
+ * The special object \p Vc::FastMath selects the fast variant of exp, exp2, log, log2,
+ * log1p, cbrt, and float pow: at most 4 ULP error, subnormal inputs and results are not
+ * supported (results that would be subnormal are flushed to zero). NaN and infinity
+ * are still handled. expm1 has no fast variant, double pow accepts and ignores the tag.
+ */
+constexpr FastMathTag FastMath = {};
 ///@}
 
 namespace Detail
@@ -104,6 +126,19 @@ template<typename T> struct MayAliasImpl {
 #endif
 };
 //template<size_t Bytes> struct MayAlias<MaskBool<Bytes>> { typedef MaskBool<Bytes> type; };
+
+/**\internal
+ * Enables the iterator overloads of the algorithms for contiguous ranges of arithmetic
+ * types. The overloads that share their name with a std algorithm take the iterators as
+ * `It<Ts...>`. That is more specialized than the iterator parameters of the std
+ * algorithm, so an unqualified call with `using namespace Vc` is not ambiguous.
+ */
+template <typename It, typename R>
+using enable_if_contiguous_range =
+    enable_if<Traits::is_contiguous_iterator<It>::value &&
+                  Traits::is_valid_vector_argument<
+                      typename std::iterator_traits<It>::value_type>::value,
+              R>;
 }  // namespace Detail
 /**\internal
  * Helper MayAlias<T> that turns T into the type to be used for an aliasing pointer. This
@@ -189,40 +224,6 @@ namespace Common {
 template <typename T, std::ptrdiff_t N> class span;
 }
 
-/* TODO: add type for half-float, something along these lines:
-class half_float
-{
-    uint16_t data;
-public:
-    constexpr half_float() : data(0) {}
-    constexpr half_float(const half_float &) = default;
-    constexpr half_float(half_float &&) = default;
-    constexpr half_float &operator=(const half_float &) = default;
-
-    constexpr explicit half_float(float);
-    constexpr explicit half_float(double);
-    constexpr explicit half_float(int);
-    constexpr explicit half_float(unsigned int);
-
-    explicit operator float       () const;
-    explicit operator double      () const;
-    explicit operator int         () const;
-    explicit operator unsigned int() const;
-
-    bool operator==(half_float rhs) const;
-    bool operator!=(half_float rhs) const;
-    bool operator>=(half_float rhs) const;
-    bool operator<=(half_float rhs) const;
-    bool operator> (half_float rhs) const;
-    bool operator< (half_float rhs) const;
-
-    half_float operator+(half_float rhs) const;
-    half_float operator-(half_float rhs) const;
-    half_float operator*(half_float rhs) const;
-    half_float operator/(half_float rhs) const;
-};
-*/
-
 // TODO: the following doesn't really belong into the toplevel Vc namespace.
 #ifndef Vc_CHECK_ALIGNMENT
 template<typename _T> static Vc_ALWAYS_INLINE void assertCorrectAlignment(const _T *){}
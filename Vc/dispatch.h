@@ -0,0 +1,231 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_DISPATCH_H_
+#define VC_DISPATCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "global.h"
+#include "support.h"
+#include "common/macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \name Runtime Dispatch
+ */
+//@{
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch.h>
+ *
+ * Tests whether the system the code is executing on supports the Vc::Implementation
+ * and all Vc::ExtraInstructions encoded in \p features.
+ *
+ * \param features A bitmask as returned from ImplementationT::features().
+ */
+inline bool featuresSupported(unsigned int features)
+{
+    const unsigned int extra = features & ExtraInstructionsMask;
+    return isImplementationSupported(
+               static_cast<Implementation>(features & ImplementationMask)) &&
+           (extraInstructionsSupported() & extra) == extra;
+}
+
+template <typename Signature> class FunctionDispatcher;
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch.h <Vc/dispatch.h>
+ *
+ * Selects one of several ISA-specific variants of a function at runtime.
+ *
+ * The variants are typically produced by compiling one source file several times with
+ * different \c Vc_IMPL settings (see \c vc_compile_for_all_implementations in
+ * VcMacros.cmake). Each compilation explicitly instantiates a function template for
+ * `Vc::CurrentImplementation::current()`:
+ * \code
+ * // kernel.h
+ * template <Vc::Implementation Impl> float dot(const float *a, const float *b, size_t n);
+ *
+ * // kernel.cpp, compiled once per Vc_IMPL
+ * template <Vc::Implementation Impl> float dot(const float *a, const float *b, size_t n)
+ * {
+ *   Vc::float_v sum = 0.f; ...
+ * }
+ * template float dot<Vc::CurrentImplementation::current()>(const float *, const float *, size_t);
+ *
+ * // main.cpp, compiled for the lowest common ISA
+ * static const Vc::FunctionDispatcher<float(const float *, const float *, size_t)> dotDispatch = {
+ *   {Vc::ScalarImpl, &dot<Vc::ScalarImpl>},
+ *   {Vc::SSE2Impl, &dot<Vc::SSE2Impl>},
+ *   {Vc::AVXImpl, &dot<Vc::AVXImpl>},
+ *   {Vc::AVX2Impl + Vc::FmaInstructions + Vc::Bmi2Instructions, &dot<Vc::AVX2Impl>}};
+ * float x = dotDispatch(a, b, n);
+ * \endcode
+ * The feature bitmask of a variant must include every Vc::ExtraInstructions flag the
+ * variant was compiled with (here AVX2+FMA+BMI2), otherwise it could be selected on a
+ * CPU that cannot execute it.
+ *
+ * The best supported variant is determined on the first call and cached in an atomic
+ * function pointer. Every later call therefore costs one relaxed load and one indirect
+ * call. "Best" means the highest Vc::Implementation and, among variants with equal
+ * Vc::Implementation, the one requiring the most Vc::ExtraInstructions.
+ *
+ * \note The variants must be compiled in separate translation units. Code that is not
+ * inlined into the variant (i.e. non-Vc_INTRINSIC functions with identical mangled
+ * names) may be deduplicated by the linker across translation units with different
+ * target flags. Keep the kernels self-contained.
+ */
+template <typename R, typename... Args> class FunctionDispatcher<R(Args...)>
+{
+public:
+    /// The function pointer type of all variants.
+    using pointer = R (*)(Args...);
+
+    /// One variant: the feature bitmask it was compiled for, and its entry point.
+    struct Variant {
+        unsigned int features;
+        pointer function;
+    };
+
+    /// The maximum number of variants one dispatcher can hold.
+    static constexpr std::size_t MaxVariants = 16;
+
+    /**
+     * Constructs the dispatcher from the list of available variants. The order of the
+     * list is irrelevant.
+     *
+     * \throws std::length_error if the list contains more than MaxVariants variants.
+     */
+    FunctionDispatcher(std::initializer_list<Variant> variants) : m_selected(nullptr)
+    {
+        if (variants.size() > MaxVariants) {
+            throw std::length_error("Vc::FunctionDispatcher: too many variants");
+        }
+        for (const Variant &v : variants) {
+            m_variants[m_count++] = v;
+        }
+    }
+
+    FunctionDispatcher(const FunctionDispatcher &) = delete;
+    FunctionDispatcher &operator=(const FunctionDispatcher &) = delete;
+
+    /**
+     * Calls the best supported variant.
+     *
+     * \throws std::runtime_error if no variant is supported on this system.
+     */
+    Vc_ALWAYS_INLINE R operator()(Args... args) const
+    {
+        return cached()(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Returns the best supported variant. The first call determines the variant, all
+     * later calls return the cached pointer.
+     *
+     * \return \c nullptr if no variant is supported on this system.
+     */
+    Vc_ALWAYS_INLINE pointer resolve() const
+    {
+        const pointer f = cached();
+        return f == &noVariant ? nullptr : f;
+    }
+
+    /**
+     * Returns the best supported variant whose Vc::Implementation is not above \p
+     * maxImpl, without consulting or updating the cache. This is useful for comparing
+     * the variants against each other.
+     *
+     * \return \c nullptr if no such variant exists or is supported.
+     */
+    pointer select(Implementation maxImpl = ImplementationMask) const
+    {
+        const Variant *best = nullptr;
+        for (std::size_t i = 0; i < m_count; ++i) {
+            const Variant &v = m_variants[i];
+            if ((v.features & ImplementationMask) > static_cast<unsigned int>(maxImpl) ||
+                !featuresSupported(v.features)) {
+                continue;
+            }
+            if (best == nullptr || isBetter(v.features, best->features)) {
+                best = &v;
+            }
+        }
+        return best ? best->function : nullptr;
+    }
+
+private:
+    /// Loads the cached variant. If no variant is supported, noVariant is cached.
+    Vc_ALWAYS_INLINE pointer cached() const
+    {
+        pointer f = m_selected.load(std::memory_order_relaxed);
+        if (Vc_IS_UNLIKELY(f == nullptr)) {
+            f = select();
+            if (f == nullptr) {
+                f = &noVariant;
+            }
+            m_selected.store(f, std::memory_order_relaxed);
+        }
+        return f;
+    }
+    static R noVariant(Args...)
+    {
+        throw std::runtime_error("Vc::FunctionDispatcher: no variant is supported");
+    }
+
+    static int extraCount(unsigned int features)
+    {
+        int n = 0;
+        for (unsigned int x = features & ExtraInstructionsMask; x; x &= x - 1) {
+            ++n;
+        }
+        return n;
+    }
+    static bool isBetter(unsigned int a, unsigned int b)
+    {
+        const unsigned int implA = a & ImplementationMask;
+        const unsigned int implB = b & ImplementationMask;
+        return implA > implB || (implA == implB && extraCount(a) > extraCount(b));
+    }
+
+    Variant m_variants[MaxVariants] = {};
+    std::size_t m_count = 0;
+    mutable std::atomic<pointer> m_selected;
+};
+//@}
+}  // namespace Vc
+
+#endif  // VC_DISPATCH_H_
+
+// vim: foldmethod=marker
@@ -39,6 +39,7 @@ namespace VectorAbi
 struct Scalar {};
 struct Sse {};
 struct Avx {};
+struct Avx512 {};
 struct Mic {};
 template <class T> struct DeduceCompatible;
 template <class T> struct DeduceBest;
@@ -93,7 +94,7 @@ template <class T> using compatible = typename VectorAbi::DeduceCompatible<T>::t
 template <class T> using native = typename VectorAbi::DeduceBest<T>::type;
 using __sse = VectorAbi::Sse;
 using __avx = VectorAbi::Avx;
-struct __avx512;
+using __avx512 = VectorAbi::Avx512;
 struct __neon;
 }  // namespace simd_abi
 
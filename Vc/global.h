@@ -163,6 +163,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SSE4_2 0x00700000
 #define AVX    0x00800000
 #define AVX2   0x00900000
+#define AVX512 0x00A00000
 
 #define XOP    0x00000001
 #define FMA4   0x00000002
@@ -269,7 +270,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #else // Vc_IMPL
 
-#  if (Vc_IMPL & IMPL_MASK) == AVX2 // AVX2 supersedes SSE
+#  if (Vc_IMPL & IMPL_MASK) == AVX512 // AVX512 supersedes AVX2
+#    define Vc_IMPL_AVX512 1
+#    define Vc_IMPL_AVX2 1
+#    define Vc_IMPL_AVX 1
+#  elif (Vc_IMPL & IMPL_MASK) == AVX2 // AVX2 supersedes SSE
 #    define Vc_IMPL_AVX2 1
 #    define Vc_IMPL_AVX 1
 #  elif (Vc_IMPL & IMPL_MASK) == AVX // AVX supersedes SSE
@@ -372,6 +377,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #        if defined(Vc_IMPL_AVX2)
 #            undef Vc_IMPL_AVX2
 #        endif
+#        if defined(Vc_IMPL_AVX512)
+#            undef Vc_IMPL_AVX512
+#        endif
 #    endif
 #endif
 
@@ -379,6 +387,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #  error "No suitable Vc implementation was selected! Probably Vc_IMPL was set to an invalid value."
 # elif defined(Vc_IMPL_SSE) && !defined(Vc_IMPL_SSE2)
 #  error "SSE requested but no SSE2 support. Vc needs at least SSE2!"
+# elif defined(Vc_IMPL_AVX512) && !(defined(__AVX512F__) && defined(__AVX512BW__) &&      \
+                                    defined(__AVX512DQ__) && defined(__AVX512VL__))
+#  error "AVX512 requested but the compiler does not target AVX512F/BW/DQ/VL. Vc needs e.g. -march=skylake-avx512 for Vc_IMPL=AVX512!"
 # endif
 
 #undef Scalar
@@ -390,6 +401,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef SSE4_2
 #undef AVX
 #undef AVX2
+#undef AVX512
 
 #undef XOP
 #undef FMA4
@@ -402,7 +414,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef IMPL_MASK
 #undef EXT_MASK
 
-#if defined Vc_IMPL_AVX2
+#if defined Vc_IMPL_AVX512
+#define Vc_DEFAULT_IMPL_AVX512
+#elif defined Vc_IMPL_AVX2
 #define Vc_DEFAULT_IMPL_AVX2
 #elif defined Vc_IMPL_AVX
 #define Vc_DEFAULT_IMPL_AVX
@@ -452,7 +466,27 @@ enum MallocAlignment {
      * full page access to the end. Thus the allocated memory contains a multiple of
      * 4096 bytes.
      */
-    AlignOnPage
+    AlignOnPage,
+    /**
+     * Align on boundary of huge pages (2 MiB) and pad to a multiple of 2 MiB. On Linux the
+     * kernel is asked to back the memory with transparent huge pages (`madvise`), which
+     * reduces TLB misses when traversing large arrays. Only use this for allocations of
+     * several MiB.
+     */
+    AlignOnHugePage,
+    /**
+     * Like AlignOnPage, and on Linux the pages are distributed round-robin over all NUMA
+     * nodes (`mbind` with `MPOL_INTERLEAVE`). This balances the memory bandwidth of large
+     * arrays that are accessed by threads on all sockets. The pages must not have been
+     * touched before, thus only use this for large allocations, which the C library
+     * serves with fresh pages.
+     */
+    AlignOnPageInterleaved,
+    /**
+     * Combines AlignOnHugePage and AlignOnPageInterleaved: the memory is interleaved over
+     * the NUMA nodes in units of huge pages.
+     */
+    AlignOnHugePageInterleaved
 };
 
 /**
@@ -481,6 +515,8 @@ enum Implementation : std::uint_least32_t { // TODO: make enum class
     AVXImpl,
     /// x86 AVX + AVX2
     AVX2Impl,
+    /// x86 AVX + AVX2 + AVX512F/BW/DQ/VL
+    AVX512Impl,
     /// Intel Xeon Phi
     MICImpl,
     ImplementationMask = 0xfff
@@ -491,7 +527,7 @@ enum Implementation : std::uint_least32_t { // TODO: make enum class
  *
  * The list of available instructions is not easily described by a linear list of instruction sets.
  * On x86 the following instruction sets always include their predecessors:
- * SSE2, SSE3, SSSE3, SSE4.1, SSE4.2, AVX, AVX2
+ * SSE2, SSE3, SSSE3, SSE4.1, SSE4.2, AVX, AVX2, AVX512
  *
  * But there are additional instructions that are not necessarily required by this list. These are
  * covered in this enum.
@@ -534,6 +570,11 @@ template <unsigned int Features> struct ImplementationT {
     {
         return static_cast<Implementation>(Features & ImplementationMask);
     }
+    /**
+     * Returns the complete bitmask, i.e. the Vc::Implementation combined with the
+     * Vc::ExtraInstructions flags.
+     */
+    static constexpr unsigned int features() { return Features; }
     /// Returns whether \p impl is the current Vc::Implementation.
     static constexpr bool is(Implementation impl)
     {
@@ -566,6 +607,8 @@ template <unsigned int Features> struct ImplementationT {
 using CurrentImplementation = ImplementationT<
 #ifdef Vc_IMPL_Scalar
     ScalarImpl
+#elif defined(Vc_IMPL_AVX512)
+    AVX512Impl
 #elif defined(Vc_IMPL_AVX2)
     AVX2Impl
 #elif defined(Vc_IMPL_AVX)
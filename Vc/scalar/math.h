@@ -84,13 +84,48 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> rsqrt(const Scala
 
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
+                               std::is_same<T, schar>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, llong>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Scalar::Vector<T> abs(Scalar::Vector<T> x)
 {
-    return std::abs(x.data());
+    return T(std::abs(x.data()));
 }
 
+// saturating arithmetic {{{1
+#define Vc_SATURATING(V)                                                                 \
+    static Vc_ALWAYS_INLINE Scalar::V add_sat(const Scalar::V &x, const Scalar::V &y)    \
+    {                                                                                    \
+        using T = Scalar::V::EntryType;                                                  \
+        return T(std::min(std::max(int(x.data()) + int(y.data()),                        \
+                                   int(std::numeric_limits<T>::min())),                  \
+                          int(std::numeric_limits<T>::max())));                          \
+    }                                                                                    \
+    static Vc_ALWAYS_INLINE Scalar::V sub_sat(const Scalar::V &x, const Scalar::V &y)    \
+    {                                                                                    \
+        using T = Scalar::V::EntryType;                                                  \
+        return T(std::min(std::max(int(x.data()) - int(y.data()),                        \
+                                   int(std::numeric_limits<T>::min())),                  \
+                          int(std::numeric_limits<T>::max())));                          \
+    }
+Vc_SATURATING(schar_v);
+Vc_SATURATING(uchar_v);
+Vc_SATURATING(short_v);
+Vc_SATURATING(ushort_v);
+#undef Vc_SATURATING
+
+// table_lookup {{{1
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<T, schar>::value || std::is_same<T, uchar>::value,
+                       Scalar::Vector<T>>
+table_lookup(const T (&table)[16], const Scalar::Vector<T> &idx)
+{
+    const uchar j = idx.data();
+    return j < 16 ? table[j] : T(0);
+}
+// }}}1
+
 template<typename T> static Vc_ALWAYS_INLINE void sincos(const Scalar::Vector<T> &x, Scalar::Vector<T> *sin, Scalar::Vector<T> *cos)
 {
 #if defined(_WIN32) || defined(__APPLE__)
@@ -151,6 +151,82 @@ Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ushort>) { return v;
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ushort>) { return convert(convert(v, ConvertTag<double, int>()), ConvertTag<int, ushort>()); }
 
+// 64-bit integers {{{1
+// only the low two entries of a wider source are converted; narrower results are
+// zero-padded
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, llong >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, ullong>) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , llong >) {
+#ifdef Vc_IMPL_SSE4_1
+    return _mm_cvtepi32_epi64(v);
+#else
+    return _mm_unpacklo_epi32(v, _mm_srai_epi32(v, 31));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , llong >) { return _mm_unpacklo_epi32(v, _mm_setzero_si128()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , llong >) { return convert(convert(v, ConvertTag<short, int>()), ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, llong >) { return convert(convert(v, ConvertTag<ushort, int>()), ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, llong >) {
+#ifdef Vc_IMPL_AVX512
+    return _mm_cvttpd_epi64(v);
+#else
+    return _mm_set_epi64x(static_cast<llong>(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))),
+                          static_cast<llong>(_mm_cvtsd_f64(v)));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ullong>) {
+#ifdef Vc_IMPL_AVX512
+    return _mm_cvttpd_epu64(v);
+#else
+    return _mm_set_epi64x(static_cast<ullong>(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))),
+                          static_cast<ullong>(_mm_cvtsd_f64(v)));
+#endif
+}
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , llong >) { return convert(_mm_cvtps_pd(v), ConvertTag<double, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , ullong>) { return convert(_mm_cvtps_pd(v), ConvertTag<double, ullong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , ullong>) { return convert(v, ConvertTag<int, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , ullong>) { return convert(v, ConvertTag<uint, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ullong>) { return convert(v, ConvertTag<short, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ullong>) { return convert(v, ConvertTag<ushort, llong>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , int   >) { return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(0, 0, 2, 0))); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, int   >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<llong , uint  >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ullong, uint  >) { return convert(v, ConvertTag<llong, int>()); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<ullong, double>) {
+#ifdef Vc_IMPL_AVX512
+    return _mm_cvtepu64_pd(v);
+#else
+    // The high and low halves are placed in the mantissas of 2^84 and 2^52 resp. The
+    // subtraction of the bias is exact, thus the final addition is the only rounding step.
+    const __m128i lo = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi64x(0xffffffffll)),
+                                    _mm_set1_epi64x(0x4330000000000000ll));
+    const __m128i hi = _mm_xor_si128(_mm_srli_epi64(v, 32), _mm_set1_epi64x(0x4530000000000000ll));
+    return _mm_add_pd(
+        _mm_sub_pd(_mm_castsi128_pd(hi),
+                   _mm_castsi128_pd(_mm_set1_epi64x(0x4530000000100000ll))),
+        _mm_castsi128_pd(lo));
+#endif
+}
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<llong , double>) {
+#ifdef Vc_IMPL_AVX512
+    return _mm_cvtepi64_pd(v);
+#else
+    // as above, but flipping the sign bit turns the signed high half into an unsigned
+    // one with a bias of 2^31, which is subtracted together with the exponent bias
+    const __m128i lo = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi64x(0xffffffffll)),
+                                    _mm_set1_epi64x(0x4330000000000000ll));
+    const __m128i hi = _mm_xor_si128(_mm_srli_epi64(v, 32), _mm_set1_epi64x(0x4530000080000000ll));
+    return _mm_add_pd(
+        _mm_sub_pd(_mm_castsi128_pd(hi),
+                   _mm_castsi128_pd(_mm_set1_epi64x(0x4530000080100000ll))),
+        _mm_castsi128_pd(lo));
+#endif
+}
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<llong , float >) { return _mm_cvtpd_ps(convert(v, ConvertTag<llong, double>())); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<ullong, float >) { return _mm_cvtpd_ps(convert(v, ConvertTag<ullong, double>())); }
+
 // }}}1
 }  // namespace SSE
 }  // namespace Vc
@@ -40,6 +40,13 @@ alignas(16) extern const unsigned int   _IndexesFromZero4[4];
 alignas(16) extern const unsigned short _IndexesFromZero8[8];
 alignas(16) extern const unsigned char  _IndexesFromZero16[16];
 
+// permutation indexes for compress and expand of up to 8 lanes, indexed by the mask bits.
+// Lanes without a source are 0xff.
+alignas(64) extern const unsigned char _CompressIndexes8[256][8];
+alignas(64) extern const unsigned char _ExpandIndexes8[256][8];
+// loading 16 bytes at offset 16 - n yields a pshufb control that shifts up by n bytes
+alignas(32) extern const unsigned char _ShiftBytesUp[32];
+
 struct c_general
 {
     alignas(64) static const int absMaskFloat[4];
@@ -445,6 +445,21 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 4, __m128>(__m128i k)
     return SSE::sse_cast<__m128>(_mm_unpacklo_epi16(k, k));
 }
 
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
+}
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 16, __m128>(__m128i k)
+{
+    return mask_cast<8, 16, __m128>(
+        _mm_packs_epi16(k, _mm_setzero_si128()));
+}
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 16, __m128>(__m128i k)
+{
+    return mask_cast<4, 16, __m128>(
+        _mm_packs_epi16(k, _mm_setzero_si128()));
+}
+
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<16, 8, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_unpacklo_epi8(k, k));
@@ -481,6 +496,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m128d negate(__m128d v, std::integral_constant<std::
 {
     return _mm_xor_pd(v, SSE::_mm_setsignmask_pd());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm_sub_epi64(_mm_setzero_si128(), v);
+}
 Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 4>)
 {
 #ifdef Vc_IMPL_SSSE3
@@ -497,6 +516,14 @@ Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::
     return _mm_sub_epi16(_mm_setzero_si128(), v);
 #endif
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 1>)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_sign_epi8(v, allone<__m128i>());
+#else
+    return _mm_sub_epi8(_mm_setzero_si128(), v);
+#endif
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m128 xor_(__m128 a, __m128 b) { return _mm_xor_ps(a, b); }
@@ -526,6 +553,8 @@ Vc_INTRINSIC __m128i not_(__m128i a) { return andnot_(a, allone<__m128i>()); }
 // add{{{1
 Vc_INTRINSIC __m128  add(__m128  a, __m128  b,  float) { return _mm_add_ps(a, b); }
 Vc_INTRINSIC __m128d add(__m128d a, __m128d b, double) { return _mm_add_pd(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  llong) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ullong) { return _mm_add_epi64(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,    int) { return _mm_add_epi32(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,   uint) { return _mm_add_epi32(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  short) { return _mm_add_epi16(a, b); }
@@ -536,6 +565,8 @@ Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  uchar) { return _mm_add_epi8 (a,
 // sub{{{1
 Vc_INTRINSIC __m128  sub(__m128  a, __m128  b,  float) { return _mm_sub_ps(a, b); }
 Vc_INTRINSIC __m128d sub(__m128d a, __m128d b, double) { return _mm_sub_pd(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  llong) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ullong) { return _mm_sub_epi64(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,    int) { return _mm_sub_epi32(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,   uint) { return _mm_sub_epi32(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  short) { return _mm_sub_epi16(a, b); }
@@ -546,6 +577,8 @@ Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  uchar) { return _mm_sub_epi8 (a,
 // mul{{{1
 Vc_INTRINSIC __m128  mul(__m128  a, __m128  b,  float) { return _mm_mul_ps(a, b); }
 Vc_INTRINSIC __m128d mul(__m128d a, __m128d b, double) { return _mm_mul_pd(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  llong) { return SSE::mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b, ullong) { return SSE::mullo_epi64(a, b); }
 Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,    int) {
 #ifdef Vc_IMPL_SSE4_1
     return _mm_mullo_epi32(a, b);
@@ -583,6 +616,32 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
 #endif
 }
 
+// mulhi{{{1
+// The upper half of the double-width product, i.e. (a * b) >> (8 * sizeof(T)).
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,   uint) {
+    const __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+#ifdef Vc_IMPL_SSE4_1
+    return _mm_blend_epi16(even, odd, 0xcc);
+#else
+    return _mm_or_si128(even, _mm_and_si128(odd, _mm_setr_epi32(0, -1, 0, -1)));
+#endif
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,    int) {
+#ifdef Vc_IMPL_SSE4_1
+    const __m128i even = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+    const __m128i odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_blend_epi16(even, odd, 0xcc);
+#else
+    // signed = unsigned - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+    const __m128i hi = mulhi(a, b, uint());
+    return _mm_sub_epi32(_mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(a, 31), b)),
+                         _mm_and_si128(_mm_srai_epi32(b, 31), a));
+#endif
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,  short) { return _mm_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b, ushort) { return _mm_mulhi_epu16(a, b); }
+
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
 Vc_INTRINSIC __m128d div(__m128d a, __m128d b, double) { return _mm_div_pd(a, b); }
@@ -600,6 +659,8 @@ Vc_INTRINSIC __m128d div(__m128d a, __m128d b, double) { return _mm_div_pd(a, b)
 // min{{{1
 Vc_INTRINSIC __m128  min(__m128  a, __m128  b,  float) { return _mm_min_ps(a, b); }
 Vc_INTRINSIC __m128d min(__m128d a, __m128d b, double) { return _mm_min_pd(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  llong) { return SSE::min_epi64(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ullong) { return SSE::min_epu64(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,    int) { return SSE::min_epi32(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,   uint) { return SSE::min_epu32(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  short) { return _mm_min_epi16(a, b); }
@@ -610,6 +671,8 @@ Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  uchar) { return _mm_min_epu8 (a,
 // max{{{1
 Vc_INTRINSIC __m128  max(__m128  a, __m128  b,  float) { return _mm_max_ps(a, b); }
 Vc_INTRINSIC __m128d max(__m128d a, __m128d b, double) { return _mm_max_pd(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  llong) { return SSE::max_epi64(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ullong) { return SSE::max_epu64(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,    int) { return SSE::max_epi32(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,   uint) { return SSE::max_epu32(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  short) { return _mm_max_epi16(a, b); }
@@ -627,6 +690,12 @@ Vc_INTRINSIC double add(__m128d a, double) {
     a = _mm_add_sd(a, _mm_unpackhi_pd(a, a));
     return _mm_cvtsd_f64(a);
 }
+Vc_INTRINSIC  llong add(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong add(__m128i a, ullong) {
+    return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
 Vc_INTRINSIC    int add(__m128i a,    int) {
     a = add(a, _mm_srli_si128(a, 8), int());
     a = add(a, _mm_srli_si128(a, 4), int());
@@ -659,6 +728,12 @@ Vc_INTRINSIC double mul(__m128d a, double) {
     a = _mm_mul_sd(a, _mm_unpackhi_pd(a, a));
     return _mm_cvtsd_f64(a);
 }
+Vc_INTRINSIC  llong mul(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong mul(__m128i a, ullong) {
+    return _mm_cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
 Vc_INTRINSIC    int mul(__m128i a,    int) {
     a = mul(a, _mm_srli_si128(a, 8), int());
     a = mul(a, _mm_srli_si128(a, 4), int());
@@ -673,10 +748,9 @@ Vc_INTRINSIC  short mul(__m128i a,  short) {
 }
 Vc_INTRINSIC ushort mul(__m128i a, ushort) { return mul(a, short()); }
 Vc_INTRINSIC  schar mul(__m128i a,  schar) {
-    // convert to two short vectors, multiply them and then do horizontal reduction
-    const __m128i s0 = _mm_srai_epi16(a, 1);
-    const __m128i s1 = Detail::and_(a, _mm_set1_epi32(0x0f0f0f0f));
-    return mul(mul(s0, s1, short()), short());
+    // multiply neighboring bytes as shorts; the low byte of a 16-bit product only depends
+    // on the low bytes of the factors
+    return mul(_mm_mullo_epi16(a, _mm_srli_epi16(a, 8)), short());
 }
 Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return mul(a, schar()); }
 
@@ -690,6 +764,12 @@ Vc_INTRINSIC double min(__m128d a, double) {
     a = _mm_min_sd(a, _mm_unpackhi_pd(a, a));
     return _mm_cvtsd_f64(a);
 }
+Vc_INTRINSIC  llong min(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong min(__m128i a, ullong) {
+    return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
 Vc_INTRINSIC    int min(__m128i a,    int) {
     a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), int());
     a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), int());
@@ -719,9 +799,9 @@ Vc_INTRINSIC  schar min(__m128i a,  schar) {
     return std::min(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar min(__m128i a,  uchar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::min((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
 
@@ -735,6 +815,12 @@ Vc_INTRINSIC double max(__m128d a, double) {
     a = _mm_max_sd(a, _mm_unpackhi_pd(a, a));
     return _mm_cvtsd_f64(a);
 }
+Vc_INTRINSIC  llong max(__m128i a,  llong) {
+    return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), llong()));
+}
+Vc_INTRINSIC ullong max(__m128i a, ullong) {
+    return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), ullong()));
+}
 Vc_INTRINSIC    int max(__m128i a,    int) {
     a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), int());
     a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), int());
@@ -764,9 +850,9 @@ Vc_INTRINSIC  schar max(__m128i a,  schar) {
     return std::max(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar max(__m128i a,  uchar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::max((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
 
@@ -817,6 +903,110 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 16), V> rotated(V v, int am
     return sse_cast<V>(_mm_setzero_si128());
 }
 
+// compress / expand{{{1
+#ifdef Vc_IMPL_SSSE3
+Vc_INTRINSIC __m128i load_lane_indexes(const unsigned char *row)
+{
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(row));
+}
+
+/**\internal
+ * Turns a row of lane indexes from SSE::_CompressIndexes8 or SSE::_ExpandIndexes8 into a
+ * pshufb control for lanes of \p Bytes bytes. The 0xff entries keep their sign bit when
+ * scaled and thus zero their lanes.
+ */
+Vc_INTRINSIC __m128i lane_shuffle_control(__m128i idx, std::integral_constant<std::size_t, 2>)
+{
+    idx = _mm_unpacklo_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    return _mm_add_epi8(idx, _mm_set1_epi16(0x0100));
+}
+Vc_INTRINSIC __m128i lane_shuffle_control(__m128i idx, std::integral_constant<std::size_t, 4>)
+{
+    idx = _mm_unpacklo_epi8(idx, idx);
+    idx = _mm_unpacklo_epi16(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    return _mm_add_epi8(idx, _mm_set1_epi32(0x03020100));
+}
+Vc_INTRINSIC __m128i lane_shuffle_control(__m128i idx, std::integral_constant<std::size_t, 8>)
+{
+    idx = _mm_unpacklo_epi8(idx, idx);
+    idx = _mm_unpacklo_epi16(idx, idx);
+    idx = _mm_unpacklo_epi32(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    idx = _mm_add_epi8(idx, idx);
+    return _mm_add_epi8(idx, _mm_set1_epi64x(0x0706050403020100ll));
+}
+
+/**\internal
+ * Moves the entries of \p x selected by the mask \p bits (one bit per entry) to the front
+ * and zeros the remaining entries.
+ */
+template <typename T> Vc_INTRINSIC __m128i compress(__m128i x, int bits, T)
+{
+    return _mm_shuffle_epi8(
+        x, lane_shuffle_control(load_lane_indexes(SSE::_CompressIndexes8[bits]),
+                                std::integral_constant<std::size_t, sizeof(T)>()));
+}
+// 16 byte entries: each half is compressed with the 8 lane table, then the upper half is
+// shifted up behind the entries of the lower half
+Vc_INTRINSIC __m128i compress_epi8(__m128i x, int bits)
+{
+    const __m128i halves = _mm_shuffle_epi8(
+        x, _mm_unpacklo_epi64(
+               load_lane_indexes(SSE::_CompressIndexes8[bits & 0xff]),
+               _mm_or_si128(load_lane_indexes(SSE::_CompressIndexes8[bits >> 8]),
+                            _mm_set1_epi8(8))));
+    const __m128i shift = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+        SSE::_ShiftBytesUp + 16 - popcnt8(bits & 0xff)));
+    return _mm_or_si128(_mm_move_epi64(halves),
+                        _mm_shuffle_epi8(_mm_srli_si128(halves, 8), shift));
+}
+Vc_INTRINSIC __m128i compress(__m128i x, int bits, schar) { return compress_epi8(x, bits); }
+Vc_INTRINSIC __m128i compress(__m128i x, int bits, uchar) { return compress_epi8(x, bits); }
+Vc_INTRINSIC __m128 compress(__m128 x, int bits, float)
+{
+    return _mm_castsi128_ps(compress(_mm_castps_si128(x), bits, int()));
+}
+Vc_INTRINSIC __m128d compress(__m128d x, int bits, double)
+{
+    return _mm_castsi128_pd(compress(_mm_castpd_si128(x), bits, llong()));
+}
+
+/**\internal
+ * The inverse of compress: moves the leading entries of \p x to the entries selected by the
+ * mask \p bits and zeros the remaining entries.
+ */
+template <typename T> Vc_INTRINSIC __m128i expand(__m128i x, int bits, T)
+{
+    return _mm_shuffle_epi8(
+        x, lane_shuffle_control(load_lane_indexes(SSE::_ExpandIndexes8[bits]),
+                                std::integral_constant<std::size_t, sizeof(T)>()));
+}
+// the upper half reads from behind the entries consumed by the lower half; the
+// saturating add keeps the 0xff entries
+Vc_INTRINSIC __m128i expand_epi8(__m128i x, int bits)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_unpacklo_epi64(
+               load_lane_indexes(SSE::_ExpandIndexes8[bits & 0xff]),
+               _mm_adds_epu8(load_lane_indexes(SSE::_ExpandIndexes8[bits >> 8]),
+                             _mm_set1_epi8(popcnt8(bits & 0xff)))));
+}
+Vc_INTRINSIC __m128i expand(__m128i x, int bits, schar) { return expand_epi8(x, bits); }
+Vc_INTRINSIC __m128i expand(__m128i x, int bits, uchar) { return expand_epi8(x, bits); }
+Vc_INTRINSIC __m128 expand(__m128 x, int bits, float)
+{
+    return _mm_castsi128_ps(expand(_mm_castps_si128(x), bits, int()));
+}
+Vc_INTRINSIC __m128d expand(__m128d x, int bits, double)
+{
+    return _mm_castsi128_pd(expand(_mm_castpd_si128(x), bits, llong()));
+}
+#endif  // Vc_IMPL_SSSE3
+
 //InterleaveImpl{{{1
 template<typename V, size_t Size, size_t VSize> struct InterleaveImpl;
 template<typename V> struct InterleaveImpl<V, 8, 16> {
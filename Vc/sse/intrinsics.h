@@ -102,6 +102,8 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu32(__m128i a, __m128i b) { return _mm_comlt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu32(__m128i a, __m128i b) { return _mm_comgt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu64(__m128i a, __m128i b) { return _mm_comlt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b) { return _mm_comgt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b) { return _mm_comgt_epi64(a, b); }
 #else
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu8(__m128i a, __m128i b)
     {
@@ -152,6 +154,11 @@ namespace SseIntrinsics
         return _mm_or_si128(gt2, lo);
 #endif
     }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b)
+    {
+        const auto signmask = _mm_slli_epi64(_mm_setallone_si128(), 63);
+        return cmpgt_epi64(_mm_xor_si128(a, signmask), _mm_xor_si128(b, signmask));
+    }
 #endif
 }  // namespace SseIntrinsics
 }  // namespace Vc
@@ -615,8 +622,80 @@ namespace SseIntrinsics
     Vc_INTRINSIC Vc_PURE __m128i _mm_cvtsi64_si128(int64_t x) {
         return _mm_castpd_si128(_mm_load_sd(reinterpret_cast<const double *>(&x)));
     }
+    Vc_INTRINSIC Vc_PURE int64_t _mm_cvtsi128_si64(__m128i x) {
+        int64_t r;
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(&r), x);
+        return r;
+    }
 #endif
 
+    // 64-bit integer operations that SSE (and AVX2) lack {{{
+    // sign of each 64-bit entry broadcast to all of its bits
+    Vc_INTRINSIC Vc_CONST __m128i signbits_epi64(__m128i a) {
+        return _mm_srai_epi32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+    }
+    Vc_INTRINSIC Vc_CONST __m128i sra_epi64(__m128i a, int shift) {
+#ifdef Vc_IMPL_AVX512
+        return _mm_sra_epi64(a, _mm_cvtsi32_si128(shift));
+#else
+        const __m128i sign = signbits_epi64(a);
+        return _mm_xor_si128(_mm_srl_epi64(_mm_xor_si128(a, sign), _mm_cvtsi32_si128(shift)),
+                             sign);
+#endif
+    }
+    Vc_INTRINSIC Vc_CONST __m128i mullo_epi64(__m128i a, __m128i b) {
+#ifdef Vc_IMPL_AVX512
+        return _mm_mullo_epi64(a, b);
+#else
+        // a * b mod 2^64 = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+        const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                                            _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+        return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));
+#endif
+    }
+    Vc_INTRINSIC Vc_CONST __m128i abs_epi64(__m128i a) {
+#ifdef Vc_IMPL_AVX512
+        return _mm_abs_epi64(a);
+#else
+        const __m128i sign = signbits_epi64(a);
+        return _mm_sub_epi64(_mm_xor_si128(a, sign), sign);
+#endif
+    }
+    Vc_INTRINSIC Vc_CONST __m128i min_epi64(__m128i a, __m128i b) {
+        return blendv_epi8(a, b, cmpgt_epi64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i max_epi64(__m128i a, __m128i b) {
+        return blendv_epi8(b, a, cmpgt_epi64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i min_epu64(__m128i a, __m128i b) {
+        return blendv_epi8(a, b, cmpgt_epu64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i max_epu64(__m128i a, __m128i b) {
+        return blendv_epi8(b, a, cmpgt_epu64(a, b));
+    }
+    // }}}
+
+    // 8-bit integer operations that SSE lacks, emulated with 16-bit instructions {{{
+    Vc_INTRINSIC Vc_CONST __m128i mullo_epi8(__m128i a, __m128i b) {
+        const __m128i even = _mm_mullo_epi16(a, b);
+        const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+        return _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_and_si128(even, _mm_set1_epi16(0xff)));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i sll_epi8(__m128i a, int shift) {
+        return _mm_and_si128(_mm_sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                             _mm_set1_epi8(static_cast<char>(0xff << shift)));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i srl_epi8(__m128i a, int shift) {
+        return _mm_and_si128(_mm_srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                             _mm_set1_epi8(static_cast<char>(0xff >> shift)));
+    }
+    // (a + 128) >> shift == (a >> shift) + (128 >> shift) for shift < 8
+    Vc_INTRINSIC Vc_CONST __m128i sra_epi8(__m128i a, int shift) {
+        const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80 >> shift));
+        return _mm_sub_epi8(srl_epi8(_mm_xor_si128(a, setmin_epi8()), shift), bias);
+    }
+    // }}}
+
 #ifdef Vc_IMPL_AVX2
 template <int Scale> __m128 gather(const float *addr, __m128i idx)
 {
@@ -653,6 +732,24 @@ __m128i gather(__m128i src, __m128i k, const unsigned *addr, __m128i idx)
 {
     return _mm_mask_i32gather_epi32(src, aliasing_cast<int>(addr), idx, k, Scale);
 }
+template <int Scale> __m128i gather(const long long *addr, __m128i idx)
+{
+    return _mm_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+template <int Scale> __m128i gather(const unsigned long long *addr, __m128i idx)
+{
+    return _mm_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+template <int Scale>
+__m128i gather(__m128i src, __m128i k, const long long *addr, __m128i idx)
+{
+    return _mm_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
+template <int Scale>
+__m128i gather(__m128i src, __m128i k, const unsigned long long *addr, __m128i idx)
+{
+    return _mm_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
 #endif
 
 }  // namespace SseIntrinsics
@@ -251,6 +251,16 @@ Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 8>)
                           gen(4) ? 0xffffu : 0, gen(5) ? 0xffffu : 0,
                           gen(6) ? 0xffffu : 0, gen(7) ? 0xffffu : 0);
 }
+template <typename M, typename G>
+Vc_INTRINSIC M generate_impl(G &&gen, std::integral_constant<int, 16>)
+{
+    return _mm_setr_epi8(gen( 0) ? 0xff : 0, gen( 1) ? 0xff : 0, gen( 2) ? 0xff : 0,
+                         gen( 3) ? 0xff : 0, gen( 4) ? 0xff : 0, gen( 5) ? 0xff : 0,
+                         gen( 6) ? 0xff : 0, gen( 7) ? 0xff : 0, gen( 8) ? 0xff : 0,
+                         gen( 9) ? 0xff : 0, gen(10) ? 0xff : 0, gen(11) ? 0xff : 0,
+                         gen(12) ? 0xff : 0, gen(13) ? 0xff : 0, gen(14) ? 0xff : 0,
+                         gen(15) ? 0xff : 0);
+}
 template <typename T>
 template <typename G>
 Vc_INTRINSIC Mask<T, VectorAbi::Sse> Mask<T, VectorAbi::Sse>::generate(G &&gen)
@@ -98,6 +98,52 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v);
 Vc_SIMD_CAST_1( float_v, ushort_v);
 Vc_SIMD_CAST_1(double_v, ushort_v);
 Vc_SIMD_CAST_1( short_v, ushort_v);
+Vc_SIMD_CAST_1(ullong_v,  llong_v);
+Vc_SIMD_CAST_1(   int_v,  llong_v);
+Vc_SIMD_CAST_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_1( short_v,  llong_v);
+Vc_SIMD_CAST_1(ushort_v,  llong_v);
+Vc_SIMD_CAST_1( float_v,  llong_v);
+Vc_SIMD_CAST_1(double_v,  llong_v);
+Vc_SIMD_CAST_1( llong_v, ullong_v);
+Vc_SIMD_CAST_1(   int_v, ullong_v);
+Vc_SIMD_CAST_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_1( short_v, ullong_v);
+Vc_SIMD_CAST_1(ushort_v, ullong_v);
+Vc_SIMD_CAST_1( float_v, ullong_v);
+Vc_SIMD_CAST_1(double_v, ullong_v);
+Vc_SIMD_CAST_1( llong_v,    int_v);
+Vc_SIMD_CAST_1( llong_v,   uint_v);
+Vc_SIMD_CAST_1( llong_v,  short_v);
+Vc_SIMD_CAST_1( llong_v, ushort_v);
+Vc_SIMD_CAST_1( llong_v,  float_v);
+Vc_SIMD_CAST_1( llong_v, double_v);
+Vc_SIMD_CAST_1(ullong_v,    int_v);
+Vc_SIMD_CAST_1(ullong_v,   uint_v);
+Vc_SIMD_CAST_1(ullong_v,  short_v);
+Vc_SIMD_CAST_1(ullong_v, ushort_v);
+Vc_SIMD_CAST_1(ullong_v,  float_v);
+Vc_SIMD_CAST_1(ullong_v, double_v);
+Vc_SIMD_CAST_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_1( short_v,  schar_v);
+Vc_SIMD_CAST_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_1(   int_v,  schar_v);
+Vc_SIMD_CAST_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_1( schar_v,  uchar_v);
+Vc_SIMD_CAST_1( short_v,  uchar_v);
+Vc_SIMD_CAST_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_1( schar_v,  short_v);
+Vc_SIMD_CAST_1( schar_v, ushort_v);
+Vc_SIMD_CAST_1( schar_v,    int_v);
+Vc_SIMD_CAST_1( schar_v,   uint_v);
+Vc_SIMD_CAST_1( schar_v,  float_v);
+Vc_SIMD_CAST_1( uchar_v,  short_v);
+Vc_SIMD_CAST_1( uchar_v, ushort_v);
+Vc_SIMD_CAST_1( uchar_v,    int_v);
+Vc_SIMD_CAST_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_1( uchar_v,  float_v);
 
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v);
@@ -111,6 +157,20 @@ Vc_SIMD_CAST_2(   int_v, ushort_v);
 Vc_SIMD_CAST_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_2( float_v, ushort_v);
 Vc_SIMD_CAST_2(double_v, ushort_v);
+Vc_SIMD_CAST_2( llong_v,    int_v);
+Vc_SIMD_CAST_2( llong_v,   uint_v);
+Vc_SIMD_CAST_2( llong_v,  float_v);
+Vc_SIMD_CAST_2( llong_v,  short_v);
+Vc_SIMD_CAST_2( llong_v, ushort_v);
+Vc_SIMD_CAST_2(ullong_v,    int_v);
+Vc_SIMD_CAST_2(ullong_v,   uint_v);
+Vc_SIMD_CAST_2(ullong_v,  float_v);
+Vc_SIMD_CAST_2(ullong_v,  short_v);
+Vc_SIMD_CAST_2(ullong_v, ushort_v);
+Vc_SIMD_CAST_2( short_v,  schar_v);
+Vc_SIMD_CAST_2(ushort_v,  schar_v);
+Vc_SIMD_CAST_2( short_v,  uchar_v);
+Vc_SIMD_CAST_2(ushort_v,  uchar_v);
 
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 #define Vc_CAST_(To_)                                                                    \
@@ -122,6 +182,14 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c);
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v);
 Vc_SIMD_CAST_4(double_v, ushort_v);
+Vc_SIMD_CAST_4( llong_v,  short_v);
+Vc_SIMD_CAST_4( llong_v, ushort_v);
+Vc_SIMD_CAST_4(ullong_v,  short_v);
+Vc_SIMD_CAST_4(ullong_v, ushort_v);
+Vc_SIMD_CAST_4(   int_v,  schar_v);
+Vc_SIMD_CAST_4(  uint_v,  schar_v);
+Vc_SIMD_CAST_4(   int_v,  uchar_v);
+Vc_SIMD_CAST_4(  uint_v,  uchar_v);
 //}}}2
 }  // namespace SSE
 using SSE::simd_cast;
@@ -151,6 +219,16 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                    std::is_same<Return, SSE::ullong_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::schar_v>::value ||
+                    std::is_same<Return, SSE::uchar_v>::value> = nullarg);
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -178,6 +256,12 @@ Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
 
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                    std::is_same<Return, SSE::ullong_v>::value> = nullarg);
+
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
@@ -322,6 +406,19 @@ Vc_INTRINSIC __m128i convert_int32_to_int16(__m128i a, __m128i b)
     return _mm_unpacklo_epi16(tmp2, tmp3);       // 0 1 2 3 4 5 6 7
 }
 
+// narrowing to 8 bits is modular, like convert_int32_to_int16
+Vc_INTRINSIC __m128i convert_int16_to_int8(__m128i a, __m128i b)
+{
+    const __m128i lo = _mm_set1_epi16(0x00ff);
+    return _mm_packus_epi16(_mm_and_si128(a, lo), _mm_and_si128(b, lo));
+}
+Vc_INTRINSIC __m128i convert_int32_to_int8(__m128i a, __m128i b, __m128i c, __m128i d)
+{
+    const __m128i lo = _mm_set1_epi32(0xff);
+    return _mm_packus_epi16(_mm_packs_epi32(_mm_and_si128(a, lo), _mm_and_si128(b, lo)),
+                            _mm_packs_epi32(_mm_and_si128(c, lo), _mm_and_si128(d, lo)));
+}
+
 // 1 SSE::Vector to 1 SSE::Vector {{{2
 // to int_v {{{3
 Vc_SIMD_CAST_1( float_v,    int_v) { return convert< float, int>(x.data()); }
@@ -372,6 +469,56 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x.data()
 Vc_SIMD_CAST_1( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1( short_v, ushort_v) { return x.data(); }
+// to llong_v and ullong_v {{{3
+Vc_SIMD_CAST_1(ullong_v,  llong_v) { return convert<ullong,  llong>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  llong_v) { return convert<   int,  llong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  llong_v) { return convert<  uint,  llong>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  llong_v) { return convert< short,  llong>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  llong_v) { return convert<ushort,  llong>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  llong_v) { return convert< float,  llong>(x.data()); }
+Vc_SIMD_CAST_1(double_v,  llong_v) { return convert<double,  llong>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, ullong_v) { return convert< llong, ullong>(x.data()); }
+Vc_SIMD_CAST_1(   int_v, ullong_v) { return convert<   int, ullong>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v, ullong_v) { return convert<  uint, ullong>(x.data()); }
+Vc_SIMD_CAST_1( short_v, ullong_v) { return convert< short, ullong>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v, ullong_v) { return convert<ushort, ullong>(x.data()); }
+Vc_SIMD_CAST_1( float_v, ullong_v) { return convert< float, ullong>(x.data()); }
+Vc_SIMD_CAST_1(double_v, ullong_v) { return convert<double, ullong>(x.data()); }
+// from llong_v and ullong_v {{{3
+Vc_SIMD_CAST_1( llong_v,    int_v) { return convert< llong,    int>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,   uint_v) { return convert< llong,   uint>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,  float_v) { return convert< llong,  float>(x.data()); }
+Vc_SIMD_CAST_1( llong_v, double_v) { return convert< llong, double>(x.data()); }
+Vc_SIMD_CAST_1( llong_v,  short_v) { return SSE::convert_int32_to_int16(convert< llong, int>(x.data()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1( llong_v, ushort_v) { return SSE::convert_int32_to_int16(convert< llong, int>(x.data()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(ullong_v,    int_v) { return convert<ullong,    int>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,   uint_v) { return convert<ullong,   uint>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  float_v) { return convert<ullong,  float>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v, double_v) { return convert<ullong, double>(x.data()); }
+Vc_SIMD_CAST_1(ullong_v,  short_v) { return SSE::convert_int32_to_int16(convert<ullong, int>(x.data()), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(ullong_v, ushort_v) { return SSE::convert_int32_to_int16(convert<ullong, int>(x.data()), _mm_setzero_si128()); }
+// to schar_v and uchar_v {{{3
+Vc_SIMD_CAST_1( uchar_v,  schar_v) { return x.data(); }
+Vc_SIMD_CAST_1( short_v,  schar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(ushort_v,  schar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(   int_v,  schar_v) { const auto z = _mm_setzero_si128(); return SSE::convert_int32_to_int8(x.data(), z, z, z); }
+Vc_SIMD_CAST_1(  uint_v,  schar_v) { const auto z = _mm_setzero_si128(); return SSE::convert_int32_to_int8(x.data(), z, z, z); }
+Vc_SIMD_CAST_1( schar_v,  uchar_v) { return x.data(); }
+Vc_SIMD_CAST_1( short_v,  uchar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(ushort_v,  uchar_v) { return SSE::convert_int16_to_int8(x.data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_1(   int_v,  uchar_v) { const auto z = _mm_setzero_si128(); return SSE::convert_int32_to_int8(x.data(), z, z, z); }
+Vc_SIMD_CAST_1(  uint_v,  uchar_v) { const auto z = _mm_setzero_si128(); return SSE::convert_int32_to_int8(x.data(), z, z, z); }
+// from schar_v and uchar_v {{{3
+Vc_SIMD_CAST_1( schar_v,  short_v) { return SSE::cvtepi8_epi16(x.data()); }
+Vc_SIMD_CAST_1( schar_v, ushort_v) { return SSE::cvtepi8_epi16(x.data()); }
+Vc_SIMD_CAST_1( schar_v,    int_v) { return SSE::cvtepi8_epi32(x.data()); }
+Vc_SIMD_CAST_1( schar_v,   uint_v) { return SSE::cvtepi8_epi32(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  float_v) { return _mm_cvtepi32_ps(SSE::cvtepi8_epi32(x.data())); }
+Vc_SIMD_CAST_1( uchar_v,  short_v) { return SSE::cvtepu8_epi16(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, ushort_v) { return SSE::cvtepu8_epi16(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,    int_v) { return SSE::cvtepu8_epi32(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,   uint_v) { return SSE::cvtepu8_epi32(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  float_v) { return _mm_cvtepi32_ps(SSE::cvtepu8_epi32(x.data())); }
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v) {
 #ifdef Vc_IMPL_AVX
@@ -405,6 +552,22 @@ Vc_SIMD_CAST_2(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x0.data(
 Vc_SIMD_CAST_2( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
 Vc_SIMD_CAST_2(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1)); }
 
+Vc_SIMD_CAST_2( llong_v,    int_v) { return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(x0.data()), _mm_castsi128_ps(x1.data()), _MM_SHUFFLE(2, 0, 2, 0))); }
+Vc_SIMD_CAST_2( llong_v,   uint_v) { return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(x0.data()), _mm_castsi128_ps(x1.data()), _MM_SHUFFLE(2, 0, 2, 0))); }
+Vc_SIMD_CAST_2( llong_v,  float_v) { return _mm_movelh_ps(convert< llong, float>(x0.data()), convert< llong, float>(x1.data())); }
+Vc_SIMD_CAST_2( llong_v,  short_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_2( llong_v, ushort_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_2(ullong_v,    int_v) { return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(x0.data()), _mm_castsi128_ps(x1.data()), _MM_SHUFFLE(2, 0, 2, 0))); }
+Vc_SIMD_CAST_2(ullong_v,   uint_v) { return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(x0.data()), _mm_castsi128_ps(x1.data()), _MM_SHUFFLE(2, 0, 2, 0))); }
+Vc_SIMD_CAST_2(ullong_v,  float_v) { return _mm_movelh_ps(convert<ullong, float>(x0.data()), convert<ullong, float>(x1.data())); }
+Vc_SIMD_CAST_2(ullong_v,  short_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), _mm_setzero_si128()); }
+Vc_SIMD_CAST_2(ullong_v, ushort_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), _mm_setzero_si128()); }
+
+Vc_SIMD_CAST_2( short_v,  schar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  schar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2( short_v,  uchar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  uchar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 Vc_CAST_(short_v) simd_cast(double_v a, double_v b, double_v c)
 {
@@ -419,6 +582,14 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c)
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v) { return _mm_packs_epi32(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
 Vc_SIMD_CAST_4(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+Vc_SIMD_CAST_4( llong_v,  short_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
+Vc_SIMD_CAST_4( llong_v, ushort_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
+Vc_SIMD_CAST_4(ullong_v,  short_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
+Vc_SIMD_CAST_4(ullong_v, ushort_v) { return SSE::convert_int32_to_int16(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
+Vc_SIMD_CAST_4(   int_v,  schar_v) { return SSE::convert_int32_to_int8(x0.data(), x1.data(), x2.data(), x3.data()); }
+Vc_SIMD_CAST_4(  uint_v,  schar_v) { return SSE::convert_int32_to_int8(x0.data(), x1.data(), x2.data(), x3.data()); }
+Vc_SIMD_CAST_4(   int_v,  uchar_v) { return SSE::convert_int32_to_int8(x0.data(), x1.data(), x2.data(), x3.data()); }
+Vc_SIMD_CAST_4(  uint_v,  uchar_v) { return SSE::convert_int32_to_int8(x0.data(), x1.data(), x2.data(), x3.data()); }
 }  // namespace SSE
 
 // 1 Scalar::Vector to 1 SSE::Vector {{{2
@@ -466,6 +637,24 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x.data(), 0, 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                    std::is_same<Return, SSE::ullong_v>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm_set_epi64x(0, static_cast<U>(x.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<std::is_same<Return, SSE::schar_v>::value ||
+                    std::is_same<Return, SSE::uchar_v>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm_cvtsi32_si128(static_cast<uchar>(static_cast<U>(x.data())));
+}
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -520,6 +709,16 @@ Vc_INTRINSIC Vc_CONST Return
         x0.data(), x1.data(), 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
 
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<std::is_same<Return, SSE::llong_v>::value ||
+                    std::is_same<Return, SSE::ullong_v>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm_set_epi64x(static_cast<U>(x1.data()), static_cast<U>(x0.data()));
+}
+
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
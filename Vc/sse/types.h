@@ -50,6 +50,10 @@ typedef Vector<int>               int_v;
 typedef Vector<unsigned int>     uint_v;
 typedef Vector<short>           short_v;
 typedef Vector<unsigned short> ushort_v;
+typedef Vector<long long>          llong_v;
+typedef Vector<unsigned long long> ullong_v;
+typedef Vector<signed char>        schar_v;
+typedef Vector<unsigned char>      uchar_v;
 
 template <typename T> using Mask = Vc::Mask<T, VectorAbi::Sse>;
 typedef Mask<double>         double_m;
@@ -58,6 +62,10 @@ typedef Mask<int>               int_m;
 typedef Mask<unsigned int>     uint_m;
 typedef Mask<short>           short_m;
 typedef Mask<unsigned short> ushort_m;
+typedef Mask<long long>          llong_m;
+typedef Mask<unsigned long long> ullong_m;
+typedef Mask<signed char>        schar_m;
+typedef Mask<unsigned char>      uchar_m;
 
 template <typename T> struct Const;
 
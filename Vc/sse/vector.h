@@ -37,6 +37,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../common/aliasingentryhelper.h"
 #include "../common/memoryfwd.h"
 #include "../common/loadstoreflags.h"
+#include "../common/gatherimplementation.h"
 #include <algorithm>
 #include <cmath>
 #include "detail.h"
@@ -158,6 +159,14 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<T, Vector<U, A>, Scale> &args)
         {
+#ifdef Vc_USE_CALIBRATED_GATHERS
+            const auto impl = Common::calibratedGatherImplementation<Vector>();
+            if (impl != Common::GatherScatterImplementation::Hardware) {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes,
+                                      Mask(true));
+                return;
+            }
+#endif
             d.v() = SSE::gather<sizeof(T) * Scale>(
                 args.address, simd_cast<SSE::int_v>(args.indexes).data());
         }
@@ -168,6 +177,13 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         Vc_INTRINSIC void gatherImplementation(
             const Common::GatherArguments<T, Vector<U, A>, Scale> &args, MaskArgument k)
         {
+#ifdef Vc_USE_CALIBRATED_GATHERS
+            const auto impl = Common::calibratedGatherImplementation<Vector>();
+            if (impl != Common::GatherScatterImplementation::Hardware) {
+                Common::executeGather(impl, *this, args.address, Scale * args.indexes, k);
+                return;
+            }
+#endif
             d.v() = SSE::gather<sizeof(T) * Scale>(
                 d.v(), k.data(), args.address,
                 simd_cast<SSE::int_v>(args.indexes).data());
@@ -220,9 +236,11 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         }
 
         ////////////////////////////////////////////////////////////////////////////////
-        // all remaining converting gathers
+        // all remaining converting gathers; fixed_size_simd has no 8-bit entry types,
+        // therefore 8-bit memory types use the generic gather
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
+                                sizeof(MT) != 1 &&
                                 Traits::is_valid_vector_argument<MT>::value &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
@@ -235,6 +253,7 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         // masked overload
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
+                                sizeof(MT) != 1 &&
                                 Traits::is_valid_vector_argument<MT>::value &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
@@ -429,24 +448,76 @@ static Vc_ALWAYS_INLINE Vc_PURE SSE::int_v    min(const SSE::int_v    &x, const
 static Vc_ALWAYS_INLINE Vc_PURE SSE::uint_v   min(const SSE::uint_v   &x, const SSE::uint_v   &y) { return SSE::min_epu32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  min(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_min_epi16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v min(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::min_epu16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  min(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::min_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  min(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_min_epu8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  min(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::min_epi64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v min(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::min_epu64(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  min(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_min_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v min(const SSE::double_v &x, const SSE::double_v &y) { return _mm_min_pd(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::int_v    max(const SSE::int_v    &x, const SSE::int_v    &y) { return SSE::max_epi32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::uint_v   max(const SSE::uint_v   &x, const SSE::uint_v   &y) { return SSE::max_epu32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  max(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_max_epi16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v max(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::max_epu16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  max(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::max_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  max(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_max_epu8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::llong_v  max(const SSE::llong_v  &x, const SSE::llong_v  &y) { return SSE::max_epi64(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ullong_v max(const SSE::ullong_v &x, const SSE::ullong_v &y) { return SSE::max_epu64(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  max(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_max_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v max(const SSE::double_v &x, const SSE::double_v &y) { return _mm_max_pd(x.data(), y.data()); }
 
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
+                               std::is_same<T, schar>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, llong>::value>>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> abs(Vector<T, VectorAbi::Sse> x)
 {
     return SSE::VectorHelper<T>::abs(x.data());
 }
 
+// saturating arithmetic {{{
+/**
+ * Returns \p x + \p y with the result clamped to the range of the entry type instead
+ * of wrapping around. Available for 8- and 16-bit entry types.
+ */
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  add_sat(const SSE::schar_v  &x, const SSE::schar_v  &y) { return _mm_adds_epi8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  add_sat(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_adds_epu8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  add_sat(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_adds_epi16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v add_sat(const SSE::ushort_v &x, const SSE::ushort_v &y) { return _mm_adds_epu16(x.data(), y.data()); }
+/**
+ * Returns \p x - \p y with the result clamped to the range of the entry type instead
+ * of wrapping around. Available for 8- and 16-bit entry types.
+ */
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  sub_sat(const SSE::schar_v  &x, const SSE::schar_v  &y) { return _mm_subs_epi8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  sub_sat(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_subs_epu8 (x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  sub_sat(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_subs_epi16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v sub_sat(const SSE::ushort_v &x, const SSE::ushort_v &y) { return _mm_subs_epu16(x.data(), y.data()); }
+// }}}
+// table_lookup {{{
+/**
+ * Returns a vector where entry \c i is \p table[\p idx[i]] if \p idx[i] lies in
+ * [0, 16) and 0 otherwise. With SSSE3 this is a single \c pshufb.
+ */
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<T, schar>::value || std::is_same<T, uchar>::value,
+                       Vector<T, VectorAbi::Sse>>
+table_lookup(const T (&table)[16], const Vector<T, VectorAbi::Sse> &idx)
+{
+#ifdef Vc_IMPL_SSSE3
+    // adding 0x70 with unsigned saturation sets the MSB of every index >= 16, which
+    // makes pshufb return 0 for that entry
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(table)),
+                            _mm_adds_epu8(idx.data(), _mm_set1_epi8(0x70)));
+#else
+    return Vector<T, VectorAbi::Sse>::generate([&](int i) {
+        const uchar j = idx[i];
+        return j < 16 ? table[j] : T(0);
+    });
+#endif
+}
+// }}}
+
   template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> sqrt (const Vector<T, VectorAbi::Sse> &x) { return SSE::VectorHelper<T>::sqrt(x.data()); }
   template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> rsqrt(const Vector<T, VectorAbi::Sse> &x) { return SSE::VectorHelper<T>::rsqrt(x.data()); }
   template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> reciprocal(const Vector<T, VectorAbi::Sse> &x) { return SSE::VectorHelper<T>::reciprocal(x.data()); }
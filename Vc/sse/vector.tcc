@@ -45,6 +45,10 @@ Vc_INTRINSIC SSE::   int_m operator==(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator==(SSE::  uint_v a, SSE::  uint_v b) { return _mm_cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: short_m operator==(SSE:: short_v a, SSE:: short_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC SSE::ushort_m operator==(SSE::ushort_v a, SSE::ushort_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: llong_m operator==(SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator==(SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator==(SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator==(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator!=(SSE::double_v a, SSE::double_v b) { return _mm_cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator!=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpneq_ps(a.data(), b.data()); }
@@ -52,6 +56,10 @@ Vc_INTRINSIC SSE::   int_m operator!=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator!=(SSE::  uint_v a, SSE::  uint_v b) { return not_(_mm_cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC SSE:: short_m operator!=(SSE:: short_v a, SSE:: short_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC SSE::ushort_m operator!=(SSE::ushort_v a, SSE::ushort_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: llong_m operator!=(SSE:: llong_v a, SSE:: llong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC SSE::ullong_m operator!=(SSE::ullong_v a, SSE::ullong_v b) { return not_(SSE::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: schar_m operator!=(SSE:: schar_v a, SSE:: schar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: uchar_m operator!=(SSE:: uchar_v a, SSE:: uchar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
 
 Vc_INTRINSIC SSE::double_m operator> (SSE::double_v a, SSE::double_v b) { return _mm_cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator> (SSE:: float_v a, SSE:: float_v b) { return _mm_cmpgt_ps(a.data(), b.data()); }
@@ -71,6 +79,10 @@ Vc_INTRINSIC SSE::ushort_m operator> (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmpgt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: llong_m operator> (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ullong_m operator> (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator> (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator> (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator< (SSE::double_v a, SSE::double_v b) { return _mm_cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator< (SSE:: float_v a, SSE:: float_v b) { return _mm_cmplt_ps(a.data(), b.data()); }
@@ -90,6 +102,10 @@ Vc_INTRINSIC SSE::ushort_m operator< (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmplt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: llong_m operator< (SSE:: llong_v a, SSE:: llong_v b) { return SSE::cmpgt_epi64(b.data(), a.data()); }
+Vc_INTRINSIC SSE::ullong_m operator< (SSE::ullong_v a, SSE::ullong_v b) { return SSE::cmpgt_epu64(b.data(), a.data()); }
+Vc_INTRINSIC SSE:: schar_m operator< (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator< (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8(b.data(), a.data()); }
 
 Vc_INTRINSIC SSE::double_m operator>=(SSE::double_v a, SSE::double_v b) { return _mm_cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator>=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpnlt_ps(a.data(), b.data()); }
@@ -97,6 +113,10 @@ Vc_INTRINSIC SSE::   int_m operator>=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator>=(SSE::  uint_v a, SSE::  uint_v b) { return !(a < b); }
 Vc_INTRINSIC SSE:: short_m operator>=(SSE:: short_v a, SSE:: short_v b) { return !(a < b); }
 Vc_INTRINSIC SSE::ushort_m operator>=(SSE::ushort_v a, SSE::ushort_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: llong_m operator>=(SSE:: llong_v a, SSE:: llong_v b) { return !(a < b); }
+Vc_INTRINSIC SSE::ullong_m operator>=(SSE::ullong_v a, SSE::ullong_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: schar_m operator>=(SSE:: schar_v a, SSE:: schar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: uchar_m operator>=(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8(_mm_max_epu8(a.data(), b.data()), a.data()); }
 
 Vc_INTRINSIC SSE::double_m operator<=(SSE::double_v a, SSE::double_v b) { return _mm_cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator<=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmple_ps(a.data(), b.data()); }
@@ -104,6 +124,10 @@ Vc_INTRINSIC SSE::   int_m operator<=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator<=(SSE::  uint_v a, SSE::  uint_v b) { return !(a > b); }
 Vc_INTRINSIC SSE:: short_m operator<=(SSE:: short_v a, SSE:: short_v b) { return !(a > b); }
 Vc_INTRINSIC SSE::ushort_m operator<=(SSE::ushort_v a, SSE::ushort_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: llong_m operator<=(SSE:: llong_v a, SSE:: llong_v b) { return !(a > b); }
+Vc_INTRINSIC SSE::ullong_m operator<=(SSE::ullong_v a, SSE::ullong_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: schar_m operator<=(SSE:: schar_v a, SSE:: schar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: uchar_m operator<=(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8(_mm_min_epu8(a.data(), b.data()), a.data()); }
 
 // bitwise operators {{{1
 template <typename T>
@@ -144,9 +168,10 @@ Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, SSE::Vector<T>> operato
     return div(a.data(), b.data(), T());
 }
 template <typename T>
-Vc_INTRINSIC
-    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value, SSE::Vector<T>>
-    operator/(SSE::Vector<T> a, SSE::Vector<T> b)
+Vc_INTRINSIC enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value ||
+                           std::is_same<llong, T>::value || std::is_same<ullong, T>::value,
+                       SSE::Vector<T>>
+operator/(SSE::Vector<T> a, SSE::Vector<T> b)
 {
     return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
 }
@@ -163,6 +188,19 @@ operator/(SSE::Vector<T> a, SSE::Vector<T> b)
     return HT::concat(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
 }
 template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<schar, T>::value || std::is_same<uchar, T>::value,
+                       SSE::Vector<T>>
+operator/(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    // every 8-bit quotient is exact in the 16-bit division; the narrowing is modular
+    // so that -128 / -1 wraps like the other integer types
+    using HT = SSE::VectorHelper<T>;
+    const SSE::short_v lo = SSE::short_v(HT::expand0(a.data())) / HT::expand0(b.data());
+    const SSE::short_v hi = SSE::short_v(HT::expand1(a.data())) / HT::expand1(b.data());
+    const __m128i mask = _mm_set1_epi16(0x00ff);
+    return _mm_packus_epi16(_mm_and_si128(lo.data(), mask), _mm_and_si128(hi.data(), mask));
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_integral<T>::value, SSE::Vector<T>> operator%(
     SSE::Vector<T> a, SSE::Vector<T> b)
 {
@@ -207,6 +245,18 @@ Vc_INTRINSIC Vector<double, VectorAbi::Sse>::Vector(VectorSpecialInitializerInde
 {
 }
 
+template <>
+Vc_INTRINSIC Vector<llong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
+template <>
+Vc_INTRINSIC Vector<ullong, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero)
+    : d(_mm_set_epi64x(1, 0))
+{
+}
+
 // load member functions {{{1
 template <typename DstT>
 template <typename SrcT, typename Flags>
@@ -334,6 +384,8 @@ Vc_GATHER_IMPL(double_v) { d.v() = _mm_setr_pd(Vc_M(0), Vc_M(1)); }
 Vc_GATHER_IMPL(float_v)  { d.v() = _mm_setr_ps(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
 Vc_GATHER_IMPL(int_v)    { d.v() = _mm_setr_epi32(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
 Vc_GATHER_IMPL(uint_v)   { d.v() = _mm_setr_epi32(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
+Vc_GATHER_IMPL(llong_v)  { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
+Vc_GATHER_IMPL(ullong_v) { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
 Vc_GATHER_IMPL(short_v)
 {
     d.v() =
@@ -344,6 +396,18 @@ Vc_GATHER_IMPL(ushort_v)
     d.v() =
         Vc::set(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6), Vc_M(7));
 }
+Vc_GATHER_IMPL(schar_v)
+{
+    d.v() = _mm_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6),
+                          Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12), Vc_M(13),
+                          Vc_M(14), Vc_M(15));
+}
+Vc_GATHER_IMPL(uchar_v)
+{
+    d.v() = _mm_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6),
+                          Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12), Vc_M(13),
+                          Vc_M(14), Vc_M(15));
+}
 #undef Vc_M
 #undef Vc_GATHER_IMPL
 
@@ -608,6 +672,15 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  5: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<5 * EntryTypeSizeof>(v, v));
     case  6: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<6 * EntryTypeSizeof>(v, v));
     case  7: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<7 * EntryTypeSizeof>(v, v));
+             // the following eight calls are only reachable for 8-bit entries
+    case  8: return SSE::sse_cast<VectorType>(SSE::alignr_epi8< 8 * EntryTypeSizeof>(v, v));
+    case  9: return SSE::sse_cast<VectorType>(SSE::alignr_epi8< 9 * EntryTypeSizeof>(v, v));
+    case 10: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<10 * EntryTypeSizeof>(v, v));
+    case 11: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<11 * EntryTypeSizeof>(v, v));
+    case 12: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<12 * EntryTypeSizeof>(v, v));
+    case 13: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<13 * EntryTypeSizeof>(v, v));
+    case 14: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<14 * EntryTypeSizeof>(v, v));
+    case 15: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<15 * EntryTypeSizeof>(v, v));
     }
     return Zero();
 }
@@ -620,6 +693,77 @@ inline Vc_CONST SSE::double_v sorted(SSE::double_v x_)
     const __m128d y = _mm_shuffle_pd(x, x, _MM_SHUFFLE2(0, 1));
     return _mm_unpacklo_pd(_mm_min_sd(x, y), _mm_max_sd(x, y));
 }
+inline Vc_CONST SSE::llong_v sorted(SSE::llong_v x_)
+{
+    const __m128i x = x_.data();
+    const __m128i y = _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm_unpacklo_epi64(SSE::min_epi64(x, y), SSE::max_epi64(x, y));
+}
+inline Vc_CONST SSE::ullong_v sorted(SSE::ullong_v x_)
+{
+    const __m128i x = x_.data();
+    const __m128i y = _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm_unpacklo_epi64(SSE::min_epu64(x, y), SSE::max_epu64(x, y));
+}
+
+// returns the entries i ^ J of the 8-bit entries of x
+Vc_INTRINSIC __m128i xor_permute_epi8(__m128i x, std::integral_constant<int, 1>)
+{
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+Vc_INTRINSIC __m128i xor_permute_epi8(__m128i x, std::integral_constant<int, 2>)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)),
+                               _MM_SHUFFLE(2, 3, 0, 1));
+}
+Vc_INTRINSIC __m128i xor_permute_epi8(__m128i x, std::integral_constant<int, 4>)
+{
+    return _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+Vc_INTRINSIC __m128i xor_permute_epi8(__m128i x, std::integral_constant<int, 8>)
+{
+    return _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+}
+
+/**\internal
+ * One compare-exchange stage of a bitonic sort network: entry i is compared with entry
+ * i ^ \p J, and the blocks of \p K entries are sorted alternately ascending and
+ * descending.
+ */
+template <typename T, int J, int K> Vc_INTRINSIC __m128i bitonic_stage_epi8(__m128i x)
+{
+    const __m128i y = xor_permute_epi8(x, std::integral_constant<int, J>());
+    const __m128i iota =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i zero = _mm_setzero_si128();
+    // the lower entry of a pair takes the minimum unless its block is descending
+    const __m128i takeMax =
+        _mm_xor_si128(_mm_cmpeq_epi8(_mm_and_si128(iota, _mm_set1_epi8(J)), zero),
+                      _mm_cmpeq_epi8(_mm_and_si128(iota, _mm_set1_epi8(K)), zero));
+    return SSE::blendv_epi8(min(x, y, T()), max(x, y, T()), takeMax);
+}
+
+template <typename T> Vc_INTRINSIC __m128i sorted_epi8(__m128i x)
+{
+    x = bitonic_stage_epi8<T, 1, 2>(x);
+    x = bitonic_stage_epi8<T, 2, 4>(x);
+    x = bitonic_stage_epi8<T, 1, 4>(x);
+    x = bitonic_stage_epi8<T, 4, 8>(x);
+    x = bitonic_stage_epi8<T, 2, 8>(x);
+    x = bitonic_stage_epi8<T, 1, 8>(x);
+    x = bitonic_stage_epi8<T, 8, 16>(x);
+    x = bitonic_stage_epi8<T, 4, 16>(x);
+    x = bitonic_stage_epi8<T, 2, 16>(x);
+    return bitonic_stage_epi8<T, 1, 16>(x);
+}
+inline Vc_CONST SSE::schar_v sorted(SSE::schar_v x)
+{
+    return sorted_epi8<schar>(x.data());
+}
+inline Vc_CONST SSE::uchar_v sorted(SSE::uchar_v x)
+{
+    return sorted_epi8<uchar>(x.data());
+}
 }  // namespace Detail
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::sorted()
@@ -640,6 +784,14 @@ template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveLow ( SSE::short
 template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveHigh( SSE::short_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveLow (SSE::ushort_v x) const { return _mm_unpacklo_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveHigh(SSE::ushort_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveLow ( SSE::llong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::llong_v  SSE::llong_v::interleaveHigh( SSE::llong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveLow (SSE::ullong_v x) const { return _mm_unpacklo_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::interleaveHigh(SSE::ullong_v x) const { return _mm_unpackhi_epi64(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveLow ( SSE::schar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveHigh( SSE::schar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveLow ( SSE::uchar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveHigh( SSE::uchar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
 // }}}1
 // generate {{{1
 template <> template <typename G> Vc_INTRINSIC SSE::double_v SSE::double_v::generate(G gen)
@@ -648,6 +800,18 @@ template <> template <typename G> Vc_INTRINSIC SSE::double_v SSE::double_v::gene
     const auto tmp1 = gen(1);
     return _mm_setr_pd(tmp0, tmp1);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::llong_v SSE::llong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::ullong_v SSE::ullong_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    return _mm_set_epi64x(tmp1, tmp0);
+}
 template <> template <typename G> Vc_INTRINSIC SSE::float_v SSE::float_v::generate(G gen)
 {
     const auto tmp0 = gen(0);
@@ -696,12 +860,62 @@ template <> template <typename G> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::gene
     const auto tmp7 = gen(7);
     return _mm_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::schar_v SSE::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::uchar_v SSE::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10,
+                         tmp11, tmp12, tmp13, tmp14, tmp15);
+}
 // }}}1
 // reversed {{{1
 template <> Vc_INTRINSIC Vc_PURE SSE::double_v SSE::double_v::reversed() const
 {
     return Mem::permute<X1, X0>(d.v());
 }
+template <> Vc_INTRINSIC Vc_PURE SSE::llong_v SSE::llong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::ullong_v SSE::ullong_v::reversed() const
+{
+    return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));
+}
 template <> Vc_INTRINSIC Vc_PURE SSE::float_v SSE::float_v::reversed() const
 {
     return Mem::permute<X3, X2, X1, X0>(d.v());
@@ -726,6 +940,28 @@ template <> Vc_INTRINSIC Vc_PURE SSE::ushort_v SSE::ushort_v::reversed() const
         Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
                              sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
 }
+template <> Vc_INTRINSIC Vc_PURE SSE::schar_v SSE::schar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    const __m128i x = _mm_or_si128(_mm_slli_epi16(d.v(), 8), _mm_srli_epi16(d.v(), 8));
+    return _mm_shuffle_epi32(_mm_shufflelo_epi16(_mm_shufflehi_epi16(x, _MM_SHUFFLE(0, 1, 2, 3)),
+                                                 _MM_SHUFFLE(0, 1, 2, 3)),
+                             _MM_SHUFFLE(1, 0, 3, 2));
+#endif
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::uchar_v SSE::uchar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    const __m128i x = _mm_or_si128(_mm_slli_epi16(d.v(), 8), _mm_srli_epi16(d.v(), 8));
+    return _mm_shuffle_epi32(_mm_shufflelo_epi16(_mm_shufflehi_epi16(x, _MM_SHUFFLE(0, 1, 2, 3)),
+                                                 _MM_SHUFFLE(0, 1, 2, 3)),
+                             _MM_SHUFFLE(1, 0, 3, 2));
+#endif
+}
 // }}}1
 // permutation via operator[] {{{1
 template <>
@@ -0,0 +1,83 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_TRAITS_IS_CONTIGUOUS_ITERATOR_H_
+#define VC_TRAITS_IS_CONTIGUOUS_ITERATOR_H_
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Traits
+{
+namespace is_contiguous_iterator_impl
+{
+// libc++ and the MSVC STL use the same std::vector iterator type for all allocators
+template <typename It, typename T = typename std::iterator_traits<It>::value_type,
+          typename = typename std::enable_if<std::is_arithmetic<T>::value &&
+                                             !std::is_same<T, bool>::value>::type>
+std::integral_constant<bool,
+                       std::is_same<It, typename std::vector<T>::iterator>::value ||
+                           std::is_same<It, typename std::vector<T>::const_iterator>::value>
+test(int);
+template <typename It> std::false_type test(...);
+}  // namespace is_contiguous_iterator_impl
+
+/**\internal
+ * True for pointers and for the iterators of std::vector (other than `std::vector<bool>`)
+ * over arithmetic types. The algorithms for contiguous ranges read these through a
+ * pointer to the first element.
+ */
+template <typename It>
+struct is_contiguous_iterator
+    : public decltype(is_contiguous_iterator_impl::test<It>(int())) {
+};
+template <typename T> struct is_contiguous_iterator<T *> : public std::true_type {};
+// libstdc++ wraps the pointer together with the container type
+template <template <typename...> class W, typename P, typename T, typename A>
+struct is_contiguous_iterator<W<P, std::vector<T, A>>>
+    : public std::integral_constant<
+          bool, std::is_same<W<P, std::vector<T, A>>,
+                             typename std::vector<T, A>::iterator>::value ||
+                    std::is_same<W<P, std::vector<T, A>>,
+                                 typename std::vector<T, A>::const_iterator>::value> {
+};
+
+static_assert(is_contiguous_iterator<const int *>::value, "");
+static_assert(is_contiguous_iterator<std::vector<float>::iterator>::value, "");
+static_assert(is_contiguous_iterator<std::vector<float>::const_iterator>::value, "");
+static_assert(!is_contiguous_iterator<std::vector<bool>::iterator>::value, "");
+static_assert(!is_contiguous_iterator<std::reverse_iterator<int *>>::value, "");
+
+}  // namespace Traits
+}  // namespace Vc
+
+#endif  // VC_TRAITS_IS_CONTIGUOUS_ITERATOR_H_
+
+// vim: foldmethod=marker
@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "has_contiguous_storage.h"
 #include "is_functor_argument_immutable.h"
 #include "is_output_iterator.h"
+#include "is_contiguous_iterator.h"
 #include "is_index_sequence.h"
 #include "is_implicit_cast_allowed.h"
 
@@ -69,6 +70,10 @@ template <> struct is_valid_vector_argument<int>    : public std::true_type {};
 template <> struct is_valid_vector_argument<unsigned int>   : public std::true_type {};
 template <> struct is_valid_vector_argument<short>  : public std::true_type {};
 template <> struct is_valid_vector_argument<unsigned short> : public std::true_type {};
+template <> struct is_valid_vector_argument<long long> : public std::true_type {};
+template <> struct is_valid_vector_argument<unsigned long long> : public std::true_type {};
+template <> struct is_valid_vector_argument<signed char> : public std::true_type {};
+template <> struct is_valid_vector_argument<unsigned char> : public std::true_type {};
 
 template<typename T> struct is_simd_mask_internal : public std::false_type {};
 template<typename T> struct is_simd_vector_internal : public std::false_type {};
@@ -37,6 +37,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef Vc_IMPL_AVX
 # include "avx/vector.h"
 #endif
+#ifdef Vc_IMPL_AVX512
+# include "avx512/vector.h"
+#endif
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -230,6 +233,11 @@ constexpr std::size_t MemoryAlignment = alignof(MemoryAlignedBase);
 # include "avx/math.h"
 # include "avx/simd_cast_caller.tcc"
 #endif
+#if defined(Vc_IMPL_AVX512)
+# include "avx512/helperimpl.h"
+# include "avx512/math.h"
+# include "avx512/simd_cast_caller.tcc"
+#endif
 
 #include "common/math.h"
 
@@ -243,6 +251,8 @@ constexpr std::size_t MemoryAlignment = alignof(MemoryAlignedBase);
 #include "common/vectortuple.h"
 #include "common/where.h"
 #include "common/iif.h"
+#include "common/float16.h"
+#include "common/compress.h"
 
 #ifndef Vc_NO_STD_FUNCTIONS
 namespace std
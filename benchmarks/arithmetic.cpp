@@ -0,0 +1,93 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+/* Every operation is written as x = op(x, y) with an opaque y (1 unless stated otherwise)
+ * so that the chain stays in range.
+ */
+static Registrar arithmetic([] {
+    AllVectors::forEach([](auto v) {
+        using V = decltype(v);
+        addOperation<V>("arithmetic", "add", [](const V &x, const V &y) { return x + y; });
+        addOperation<V>("arithmetic", "sub", [](const V &x, const V &y) { return x - y; }, 100);
+        addOperation<V>("arithmetic", "mul", [](const V &x, const V &y) { return x * y; });
+        addOperation<V>("arithmetic", "div", [](const V &x, const V &y) { return x / y; });
+        addOperation<V>("arithmetic", "fma",
+                        [](const V &x, const V &y) { return Vc::fma(x, y, x - x); });
+        addOperation<V>("arithmetic", "min",
+                        [](const V &x, const V &y) { return Vc::min(x, y); });
+        addOperation<V>("arithmetic", "max",
+                        [](const V &x, const V &y) { return Vc::max(x, y); });
+        addOperation<V>("arithmetic", "compare+blend",
+                        [](const V &x, const V &y) { return Vc::iif(x < y, y, x); });
+        addOperation<V>("arithmetic", "masked_add", [](const V &x, const V &y) {
+            V r = x;
+            r(x < y) += y;
+            return r;
+        });
+        addOperation<V>("reduction", "sum", [](const V &x, const V &) { return V(x.sum()); });
+        addOperation<V>("reduction", "min", [](const V &x, const V &) { return V(x.min()); });
+        addOperation<V>("reduction", "max", [](const V &x, const V &) { return V(x.max()); });
+        addOperation<V>("reduction", "any_of", [](const V &x, const V &y) {
+            return x + V(static_cast<Entry<V>>(Vc::any_of(x < y)));
+        });
+    });
+
+    SignedVectors::forEach([](auto v) {
+        using V = decltype(v);
+        addOperation<V>("arithmetic", "neg", [](const V &x, const V &) { return -x; });
+        addOperation<V>("arithmetic", "abs", [](const V &x, const V &) { return Vc::abs(x); },
+                        -1);
+    });
+
+    IntVectors::forEach([](auto v) {
+        using V = decltype(v);
+        using T = typename V::EntryType;
+        const T allOnes = ~T();
+        int count = 0;  // not const: the captured copy is opaque to the compiler
+        addOperation<V>("arithmetic", "and", [](const V &x, const V &y) { return x & y; }, 1,
+                        allOnes);
+        addOperation<V>("arithmetic", "or", [](const V &x, const V &y) { return x | y; }, 1, 0);
+        addOperation<V>("arithmetic", "xor", [](const V &x, const V &y) { return x ^ y; }, 1,
+                        0);
+        addOperation<V>("arithmetic", "not", [](const V &x, const V &) { return ~x; });
+        addOperation<V>("arithmetic", "mod", [](const V &x, const V &y) { return x % y; }, 3,
+                        7);
+        addOperation<V>("shift", "shl", [count](const V &x, const V &) { return x << count; });
+        addOperation<V>("shift", "shr", [count](const V &x, const V &) { return x >> count; });
+        addOperation<V>("shift", "shl+shr_imm",
+                        [](const V &x, const V &) { return (x << 1) >> 1; });
+        addOperation<V>("shift", "shlv", [](const V &x, const V &y) { return x << y; }, 1, 0);
+        addOperation<V>("shift", "shrv", [](const V &x, const V &y) { return x >> y; }, 1, 0);
+    });
+});
+
+// vim: foldmethod=marker
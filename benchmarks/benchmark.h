@@ -0,0 +1,355 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_BENCHMARKS_BENCHMARK_H_
+#define VC_BENCHMARKS_BENCHMARK_H_
+
+/* A minimal micro-benchmark harness in the spirit of Google Benchmark.
+ *
+ * Every benchmark translation unit registers its cases from a static initializer via
+ * Benchmark::addOperation / addFunction / addKernel. main.cpp runs all registered cases
+ * and prints a table or (with --benchmark_format=json) a JSON document.
+ *
+ * All timings are reported per vector operation:
+ * - throughput: the operation is applied to Benchmark::Streams independent inputs per
+ *   iteration, i.e. the reciprocal throughput (the issue rate) is measured.
+ * - latency: the result of each operation is the input of the next one, i.e. the length
+ *   of the dependency chain is measured.
+ * Cycles are reference cycles of the time stamp counter, not core clock cycles.
+ */
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma intrinsic(__rdtsc)
+#endif
+
+#include <Vc/Vc>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Benchmark
+{
+// fakeModify / fakeRead {{{1
+/* fakeModify(x) makes the optimizer forget the value of x without emitting any code
+ * (as long as x lives in a register), fakeRead(x) forces x to be computed.
+ */
+namespace Detail
+{
+#if defined Vc_GCC || defined Vc_CLANG || defined Vc_ICC
+template <typename T> Vc_ALWAYS_INLINE void fakeModifyReg(T &x) { asm("" : "+m"(x)); }
+template <typename T> Vc_ALWAYS_INLINE void fakeReadReg(const T &x) { asm volatile("" ::"m"(x)); }
+#if defined __x86_64__ || defined __i386__
+#define Vc_BENCHMARK_REG(T_, C_)                                                         \
+    Vc_ALWAYS_INLINE void fakeModifyReg(T_ &x) { asm("" : "+" C_(x)); }                  \
+    Vc_ALWAYS_INLINE void fakeReadReg(const T_ &x) { asm volatile("" ::C_(x)); }
+Vc_BENCHMARK_REG(float, "x")
+Vc_BENCHMARK_REG(double, "x")
+Vc_BENCHMARK_REG(int, "r")
+Vc_BENCHMARK_REG(unsigned int, "r")
+Vc_BENCHMARK_REG(short, "r")
+Vc_BENCHMARK_REG(unsigned short, "r")
+#ifdef Vc_IMPL_SSE
+Vc_BENCHMARK_REG(__m128, "x")
+Vc_BENCHMARK_REG(__m128d, "x")
+Vc_BENCHMARK_REG(__m128i, "x")
+#endif
+#ifdef Vc_IMPL_AVX
+Vc_BENCHMARK_REG(__m256, "x")
+Vc_BENCHMARK_REG(__m256d, "x")
+Vc_BENCHMARK_REG(__m256i, "x")
+#endif
+#ifdef Vc_IMPL_AVX512
+Vc_BENCHMARK_REG(__m512, "v")
+Vc_BENCHMARK_REG(__m512d, "v")
+Vc_BENCHMARK_REG(__m512i, "v")
+#endif
+#undef Vc_BENCHMARK_REG
+#endif  // x86
+#else   // MSVC
+template <typename T> Vc_ALWAYS_INLINE void fakeModifyReg(T &x)
+{
+    x = *static_cast<volatile T *>(&x);
+}
+template <typename T> Vc_ALWAYS_INLINE void fakeReadReg(const T &x)
+{
+    volatile T tmp = x;
+    (void)tmp;
+}
+#endif
+}  // namespace Detail
+
+template <typename T, typename Abi, typename = Vc::detail::not_fixed_size_abi<Abi>>
+Vc_ALWAYS_INLINE void fakeModify(Vc::Vector<T, Abi> &x)
+{
+    Detail::fakeModifyReg(x.data());
+}
+template <typename T> Vc_ALWAYS_INLINE void fakeModify(T &x) { Detail::fakeModifyReg(x); }
+
+template <typename T, typename Abi, typename = Vc::detail::not_fixed_size_abi<Abi>>
+Vc_ALWAYS_INLINE void fakeRead(const Vc::Vector<T, Abi> &x)
+{
+    Detail::fakeReadReg(x.data());
+}
+template <typename T> Vc_ALWAYS_INLINE void fakeRead(const T &x) { Detail::fakeReadReg(x); }
+
+// type names {{{1
+template <typename T> struct EntryName;
+template <> struct EntryName<float> { static const char *get() { return "float"; } };
+template <> struct EntryName<double> { static const char *get() { return "double"; } };
+template <> struct EntryName<int> { static const char *get() { return "int"; } };
+template <> struct EntryName<unsigned int> { static const char *get() { return "uint"; } };
+template <> struct EntryName<short> { static const char *get() { return "short"; } };
+template <> struct EntryName<unsigned short> { static const char *get() { return "ushort"; } };
+
+template <typename Abi> struct AbiName;
+template <> struct AbiName<Vc::VectorAbi::Scalar> { static std::string get() { return "Scalar"; } };
+template <> struct AbiName<Vc::VectorAbi::Sse> { static std::string get() { return "SSE"; } };
+template <> struct AbiName<Vc::VectorAbi::Avx> { static std::string get() { return "AVX"; } };
+template <> struct AbiName<Vc::VectorAbi::Avx512> { static std::string get() { return "AVX512"; } };
+template <int N> struct AbiName<Vc::simd_abi::fixed_size<N>> {
+    static std::string get() { return "fixed_size<" + std::to_string(N) + ">"; }
+};
+
+template <typename V> struct TypeInfo;
+template <typename T, typename Abi> struct TypeInfo<Vc::Vector<T, Abi>> {
+    static std::string name()
+    {
+        return Vc::detail::is_fixed_size_abi<Abi>::value
+                   ? std::string("simdarray<") + EntryName<T>::get() + ", " +
+                         std::to_string(Vc::Vector<T, Abi>::Size) + ">"
+                   : std::string(EntryName<T>::get()) + "_v";
+    }
+    static std::string entry() { return EntryName<T>::get(); }
+    static std::string abi() { return AbiName<Abi>::get(); }
+    static int width() { return Vc::Vector<T, Abi>::Size; }
+};
+template <typename T, std::size_t N, typename V, std::size_t M>
+struct TypeInfo<Vc::SimdArray<T, N, V, M>>
+    : public TypeInfo<Vc::fixed_size_simd<T, int(N)>> {
+};
+
+// Timer {{{1
+inline unsigned long long readTsc()
+{
+#if defined _MSC_VER
+    return __rdtsc();
+#elif defined __x86_64__ || defined __i386__
+    unsigned int lo, hi;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return (static_cast<unsigned long long>(hi) << 32) | lo;
+#else
+    return 0;
+#endif
+}
+
+struct Sample {
+    double ns;
+    double cycles;
+};
+
+class Timer
+{
+public:
+    void start()
+    {
+        m_start = std::chrono::steady_clock::now();
+        m_tsc = readTsc();
+    }
+    Sample stop() const
+    {
+        const auto tsc = readTsc();
+        const auto end = std::chrono::steady_clock::now();
+        return {std::chrono::duration<double, std::nano>(end - m_start).count(),
+                static_cast<double>(tsc - m_tsc)};
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+    unsigned long long m_tsc;
+};
+
+// registry {{{1
+/// The number of independent inputs used for throughput measurements.
+constexpr int Streams = 8;
+
+/// A kernel executes the operation under test \p n times.
+using Kernel = std::function<void(std::size_t n)>;
+
+struct Case {
+    std::string group;
+    std::string operation;
+    std::string type;
+    std::string entry;
+    std::string abi;
+    int width;
+    Kernel throughput;
+    Kernel latency;  // may be empty
+    Kernel latencyBaseline;  // may be empty; subtracted from latency
+};
+
+inline std::vector<Case> &registry()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+template <typename V>
+void addKernel(std::string group, std::string operation, Kernel throughput,
+               Kernel latency = Kernel(), Kernel latencyBaseline = Kernel())
+{
+    registry().push_back({std::move(group), std::move(operation), TypeInfo<V>::name(),
+                          TypeInfo<V>::entry(), TypeInfo<V>::abi(), TypeInfo<V>::width(),
+                          std::move(throughput), std::move(latency),
+                          std::move(latencyBaseline)});
+}
+
+// throughput and latency kernels {{{1
+/* The kernels construct their vectors from scalars: std::function may store the closure in
+ * memory that is not sufficiently aligned for V. For the same reason the operations
+ * passed to addOperation and addFunction must not capture vectors.
+ */
+template <typename V> using Entry = typename V::EntryType;
+
+template <typename V, typename F>
+Kernel throughputKernel(F op, Entry<V> input, Entry<V> operand)
+{
+    return [=](std::size_t n) {
+        V x[Streams];
+        for (int k = 0; k < Streams; ++k) {
+            x[k] = V(input);
+        }
+        V y(operand);
+        fakeModify(y);
+        for (std::size_t i = 0; i < n; i += Streams) {
+            for (int k = 0; k < Streams; ++k) {
+                fakeModify(x[k]);
+                fakeRead(op(x[k], y));
+            }
+        }
+    };
+}
+
+template <typename V, typename F> Kernel chainKernel(F op, Entry<V> input, Entry<V> operand)
+{
+    return [=](std::size_t n) {
+        V x(input);
+        V y(operand);
+        fakeModify(x);
+        fakeModify(y);
+        for (std::size_t i = 0; i < n; ++i) {
+            x = op(x, y);
+        }
+        fakeRead(x);
+    };
+}
+
+/* Closes the dependency chain of a function whose result is no valid argument (e.g.
+ * exp): x + f(x) * 0 equals x, but the compiler cannot know this as the zero is opaque.
+ */
+template <typename V, typename F> Kernel feedbackKernel(F f, Entry<V> input)
+{
+    return [=](std::size_t n) {
+        V x(input);
+        V zero = V::Zero();
+        fakeModify(x);
+        fakeModify(zero);
+        for (std::size_t i = 0; i < n; ++i) {
+            x = x + f(x) * zero;
+        }
+        fakeRead(x);
+    };
+}
+
+/**
+ * Registers the operation `op(x, y)`, which returns a V that is again a valid argument
+ * for \p op. \p x starts out as \p input, \p y is an opaque vector of \p operand. The
+ * latency is measured on the chain `x = op(x, y)`.
+ */
+template <typename V, typename F>
+void addOperation(std::string group, std::string operation, F op, Entry<V> input = 1,
+                  Entry<V> operand = 1)
+{
+    addKernel<V>(std::move(group), std::move(operation),
+                 throughputKernel<V>(op, input, operand), chainKernel<V>(op, input, operand));
+}
+
+/**
+ * Registers the function `f(x)` whose result need not be a valid argument for \p f. The
+ * latency is measured on the chain `x = x + f(x) * 0` minus the latency of `x = x + x * 0`.
+ */
+template <typename V, typename F>
+void addFunction(std::string group, std::string operation, F f, Entry<V> input)
+{
+    const auto unary = [f](const V &x, const V &) { return f(x); };
+    addKernel<V>(std::move(group), std::move(operation),
+                 throughputKernel<V>(unary, input, Entry<V>()), feedbackKernel<V>(f, input),
+                 feedbackKernel<V>([](const V &x) { return x; }, input));
+}
+
+/**
+ * Registers a kernel, which only has a throughput measurement.
+ */
+template <typename V, typename F>
+void addThroughput(std::string group, std::string operation, F kernel)
+{
+    addKernel<V>(std::move(group), std::move(operation), Kernel(kernel));
+}
+
+/// Executes its constructor argument at static initialization time.
+struct Registrar {
+    template <typename F> Registrar(F &&f) { f(); }
+};
+
+// type lists {{{1
+/// Invokes `f(V())` for every \p V in \p Vs.
+template <typename... Vs> struct TypeList {
+    template <typename F> static void forEach(F &&f)
+    {
+        auto &&unused = {(f(Vs()), 0)...};
+        if (&unused == &unused) {}
+    }
+};
+
+using AllVectors = TypeList<Vc::float_v, Vc::double_v, Vc::int_v, Vc::uint_v, Vc::short_v,
+                            Vc::ushort_v>;
+using IntVectors = TypeList<Vc::int_v, Vc::uint_v, Vc::short_v, Vc::ushort_v>;
+using SignedVectors = TypeList<Vc::float_v, Vc::double_v, Vc::int_v, Vc::short_v>;
+using RealVectors = TypeList<Vc::float_v, Vc::double_v>;
+using GatherVectors = TypeList<Vc::float_v, Vc::double_v, Vc::int_v, Vc::uint_v>;
+
+// }}}1
+}  // namespace Benchmark
+
+#endif  // VC_BENCHMARKS_BENCHMARK_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,93 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/complex>
+#include <complex>
+#include <memory>
+
+using namespace Benchmark;
+
+constexpr std::size_t Entries = 1024;  // keeps every buffer L1-resident
+
+template <typename T> using Buffer = std::vector<T, Vc::Allocator<T>>;
+
+// One operation multiplies (divides) V::Size complex numbers from two interleaved arrays
+// and stores the products to a third array. The std::complex variants are the plain
+// loops over V::Size elements, i.e. whatever the compiler makes of them.
+template <typename V> void addComplex()
+{
+    using T = Entry<V>;
+    using C = Vc::complex_v<T>;
+    struct Buffers {
+        Buffer<std::complex<T>> a, b, out;
+    };
+    const auto buf = std::make_shared<Buffers>();
+    for (std::size_t i = 0; i < Entries; ++i) {
+        buf->a.emplace_back(T(1) + T(i % 7), T(2) - T(i % 5));
+        buf->b.emplace_back(T(0.5) + T(i % 3), T(1) + T(i % 11));
+    }
+    buf->out.resize(Entries);
+    const std::size_t mask = Entries / V::Size - 1;
+
+    addThroughput<V>("complex", "multiply(std::complex)", [=](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t j = (i & mask) * V::Size;
+            for (std::size_t l = 0; l < V::Size; ++l) {
+                buf->out[j + l] = buf->a[j + l] * buf->b[j + l];
+            }
+        }
+    });
+    addThroughput<V>("complex", "multiply(complex_v)", [=](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t j = (i & mask) * V::Size;
+            const C x(&buf->a[j], Vc::Aligned), y(&buf->b[j], Vc::Aligned);
+            (x * y).store(&buf->out[j], Vc::Aligned);
+        }
+    });
+    addThroughput<V>("complex", "divide(std::complex)", [=](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t j = (i & mask) * V::Size;
+            for (std::size_t l = 0; l < V::Size; ++l) {
+                buf->out[j + l] = buf->a[j + l] / buf->b[j + l];
+            }
+        }
+    });
+    addThroughput<V>("complex", "divide(complex_v)", [=](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t j = (i & mask) * V::Size;
+            const C x(&buf->a[j], Vc::Aligned), y(&buf->b[j], Vc::Aligned);
+            (x / y).store(&buf->out[j], Vc::Aligned);
+        }
+    });
+}
+
+static Registrar complex([] {
+    RealVectors::forEach([](auto v) { addComplex<decltype(v)>(); });
+});
+
+// vim: foldmethod=marker
@@ -0,0 +1,130 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "benchmark.h"
+#include <memory>
+#include <utility>
+
+using namespace Benchmark;
+
+constexpr std::size_t Entries = 1024;  // keeps every buffer L1-resident
+
+template <typename T, std::size_t N> struct Struct {
+    T d[N];
+};
+
+template <typename T> using Buffer = std::vector<T, Vc::Allocator<T>>;
+
+// deinterleave {{{1
+template <typename V, typename Flags>
+void addDeinterleave(const char *flagsName, Flags flags)
+{
+    using T = Entry<V>;
+    const auto buffer = std::make_shared<Buffer<T>>(2 * Entries + V::Size);
+    const std::size_t offset = Flags::IsUnaligned ? 1 : 0;
+    const std::size_t mask = Entries / V::Size - 1;
+    addThroughput<V>("deinterleave", std::string("deinterleave(") + flagsName + ')',
+                     [=](std::size_t n) {
+                         const T *mem = buffer->data() + offset;
+                         for (std::size_t i = 0; i < n; i += Streams) {
+                             for (int k = 0; k < Streams; ++k) {
+                                 V a, b;
+                                 Vc::deinterleave(&a, &b, mem + ((i + k) & mask) * 2 * V::Size,
+                                                  flags);
+                                 fakeRead(a);
+                                 fakeRead(b);
+                             }
+                         }
+                     });
+}
+
+// InterleavedMemoryWrapper {{{1
+template <typename V, std::size_t... Is>
+void addInterleavedMemory(Vc::index_sequence<Is...>)
+{
+    using T = Entry<V>;
+    using S = Struct<T, sizeof...(Is)>;
+    using IV = typename V::IndexType;
+    const std::string members = std::to_string(sizeof...(Is));
+    const auto buffer = std::make_shared<Buffer<S>>(Entries + V::Size);
+    const auto indexes = std::make_shared<Buffer<int>>(Entries);
+    for (std::size_t i = 0; i < Entries; ++i) {
+        (*indexes)[i] = static_cast<int>((i * 317 + 11) % Entries);
+    }
+    const std::size_t mask = Entries / V::Size - 1;
+
+    addThroughput<V>("interleaved_memory", "load<" + members + ">", [=](std::size_t n) {
+        const Vc::InterleavedMemoryWrapper<const S, V> w(buffer->data());
+        for (std::size_t i = 0; i < n; i += Streams) {
+            for (int k = 0; k < Streams; ++k) {
+                V v[sizeof...(Is)];
+                Vc::tie(v[Is]...) = w[((i + k) & mask) * V::Size];
+                auto &&unused = {(fakeRead(v[Is]), 0)...};
+                if (&unused == &unused) {}
+            }
+        }
+    });
+    addThroughput<V>("interleaved_memory", "store<" + members + ">", [=](std::size_t n) {
+        Vc::InterleavedMemoryWrapper<S, V> w(buffer->data());
+        V v[sizeof...(Is)] = {};
+        for (std::size_t i = 0; i < n; i += Streams) {
+            for (int k = 0; k < Streams; ++k) {
+                auto &&unused = {(fakeModify(v[Is]), 0)...};
+                if (&unused == &unused) {}
+                w[((i + k) & mask) * V::Size] = Vc::tie(v[Is]...);
+            }
+        }
+    });
+    addThroughput<V>("interleaved_memory", "gather<" + members + ">", [=](std::size_t n) {
+        const Vc::InterleavedMemoryWrapper<const S, V> w(buffer->data());
+        for (std::size_t i = 0; i < n; i += Streams) {
+            for (int k = 0; k < Streams; ++k) {
+                const IV idx(&(*indexes)[((i + k) & mask) * V::Size], Vc::Aligned);
+                V v[sizeof...(Is)];
+                Vc::tie(v[Is]...) = w[idx];
+                auto &&unused = {(fakeRead(v[Is]), 0)...};
+                if (&unused == &unused) {}
+            }
+        }
+    });
+}
+
+// registration {{{1
+static Registrar deinterleave([] {
+    AllVectors::forEach([](auto v) {
+        using V = decltype(v);
+        addDeinterleave<V>("Aligned", Vc::Aligned);
+        addDeinterleave<V>("Unaligned", Vc::Unaligned);
+        addInterleavedMemory<V>(Vc::make_index_sequence<2>());
+        addInterleavedMemory<V>(Vc::make_index_sequence<3>());
+        addInterleavedMemory<V>(Vc::make_index_sequence<4>());
+    });
+});
+// }}}1
+
+// vim: foldmethod=marker
@@ -0,0 +1,94 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+/* Compares the builtin integer division and modulo with Vc::Divider for a divisor that is
+ * invariant over the loop. The Divider is constructed once per kernel call from an opaque
+ * scalar, i.e. its setup cost is not part of the measurement.
+ */
+template <typename V, typename F> Kernel dividerThroughput(F op, Entry<V> divisor)
+{
+    return [=](std::size_t n) {
+        Entry<V> d = divisor;
+        fakeModify(d);
+        const Vc::Divider<V> divider(d);
+        V x[Streams];
+        for (int k = 0; k < Streams; ++k) {
+            x[k] = V(Entry<V>(1000 + k));
+        }
+        for (std::size_t i = 0; i < n; i += Streams) {
+            for (int k = 0; k < Streams; ++k) {
+                fakeModify(x[k]);
+                fakeRead(op(x[k], divider));
+            }
+        }
+    };
+}
+
+// x = x / d + 1000 stays in range and keeps the dependency chain.
+template <typename V, typename F> Kernel dividerChain(F op, Entry<V> divisor)
+{
+    return [=](std::size_t n) {
+        Entry<V> d = divisor;
+        fakeModify(d);
+        const Vc::Divider<V> divider(d);
+        V x(Entry<V>(1000));
+        V offset(Entry<V>(1000));
+        fakeModify(x);
+        fakeModify(offset);
+        for (std::size_t i = 0; i < n; ++i) {
+            x = op(x, divider) + offset;
+        }
+        fakeRead(x);
+    };
+}
+
+template <typename V, typename F>
+void addDivision(std::string operation, F op, Entry<V> divisor)
+{
+    addKernel<V>("divider", std::move(operation), dividerThroughput<V>(op, divisor),
+                 dividerChain<V>(op, divisor));
+}
+
+static Registrar divider([] {
+    IntVectors::forEach([](auto v) {
+        using V = decltype(v);
+        using D = Vc::Divider<V>;
+        addDivision<V>("operator/",
+                       [](const V &x, const D &d) { return x / V(d.divisor()); }, 7);
+        addDivision<V>("Divider/", [](const V &x, const D &d) { return x / d; }, 7);
+        addDivision<V>("operator%",
+                       [](const V &x, const D &d) { return x % V(d.divisor()); }, 7);
+        addDivision<V>("Divider%", [](const V &x, const D &d) { return x % d; }, 7);
+    });
+});
+
+// vim: foldmethod=marker
@@ -0,0 +1,123 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+
+#include "benchmark.h"
+#include <Vc/flat_hash_map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+using namespace Benchmark;
+
+// tables {{{1
+/* Both maps hold the same Size random keys. Half of the queried keys are in the maps. One
+ * operation looks up V::Size keys: with V::Size scalar find() calls or with one batched
+ * find(keys, values).
+ */
+constexpr std::size_t QueryVectors = 1024;
+
+template <typename V> struct Maps {
+    using T = Entry<V>;
+    std::unordered_map<T, T> stdMap;
+    Vc::flat_hash_map<T, T> flatMap;
+    std::vector<T, Vc::Allocator<T>> queries;
+
+    explicit Maps(std::size_t size) : flatMap(size), queries(QueryVectors * V::Size)
+    {
+        stdMap.reserve(size);
+        unsigned int state = 2463534242u;  // xorshift32
+        const auto next = [&]() {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        };
+        std::vector<T> keys(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            keys[i] = static_cast<T>(next() >> 1);
+            stdMap[keys[i]] = keys[i];
+            flatMap[keys[i]] = keys[i];
+        }
+        for (T &q : queries) {
+            const unsigned int r = next();
+            q = r & 1 ? keys[r % size] : static_cast<T>(next() >> 1);
+        }
+    }
+
+    Vc_ALWAYS_INLINE V query(std::size_t i) const
+    {
+        return V(&queries[(i & (QueryVectors - 1)) * V::Size], Vc::Aligned);
+    }
+};
+
+// kernels {{{1
+template <typename V> void addLookups(std::size_t size, const std::string &suffix)
+{
+    using T = Entry<V>;
+    const auto maps = std::make_shared<Maps<V>>(size);
+    addThroughput<V>("hashmap", "std::unordered_map::find" + suffix, [=](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const V keys = maps->query(i);
+            T sum = 0;
+            for (std::size_t j = 0; j < V::Size; ++j) {
+                const auto it = maps->stdMap.find(keys[j]);
+                sum += it == maps->stdMap.end() ? T() : it->second;
+            }
+            fakeRead(sum);
+        }
+    });
+    addThroughput<V>("hashmap", "flat_hash_map::find" + suffix, [=](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const V keys = maps->query(i);
+            T sum = 0;
+            for (std::size_t j = 0; j < V::Size; ++j) {
+                const auto it = maps->flatMap.find(keys[j]);
+                sum += it == maps->flatMap.end() ? T() : it->second;
+            }
+            fakeRead(sum);
+        }
+    });
+    addThroughput<V>("hashmap", "flat_hash_map::find(V)" + suffix, [=](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            V values = V::Zero();
+            maps->flatMap.find(maps->query(i), values);
+            fakeRead(values);
+        }
+    });
+}
+
+static Registrar hashmap([] {
+    TypeList<Vc::int_v, Vc::uint_v>::forEach([](auto v) {
+        using V = decltype(v);
+        addLookups<V>(1 << 12, "/4k");  // cache resident
+        addLookups<V>(1 << 22, "/4M");  // memory bound
+    });
+});
+
+// vim: foldmethod=marker
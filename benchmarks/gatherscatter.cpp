@@ -0,0 +1,209 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "benchmark.h"
+#include <memory>
+
+using namespace Benchmark;
+
+// tables {{{1
+/* Gathers and scatters access an L1-resident table at random (but fixed) indexes. The
+ * indexes and the masks are loaded from memory, as they would be in real code.
+ */
+constexpr std::size_t TableSize = 1024;
+constexpr std::size_t IndexVectors = 64;
+
+template <typename V> struct Tables {
+    using T = Entry<V>;
+    std::vector<T, Vc::Allocator<T>> table;
+    std::vector<int, Vc::Allocator<int>> indexes;
+    std::vector<T, Vc::Allocator<T>> selection;
+
+    Tables()
+        : table(TableSize), indexes(IndexVectors * V::Size), selection(IndexVectors * V::Size)
+    {
+        unsigned int state = 2463534242u;  // xorshift32
+        const auto next = [&]() {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        };
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            // a permutation of the table slots, which the latency kernel chases
+            table[i] = static_cast<T>((i * 317 + 11) % TableSize);
+        }
+        for (std::size_t i = 0; i < indexes.size(); ++i) {
+            indexes[i] = static_cast<int>(next() % TableSize);
+            selection[i] = static_cast<T>(next() & 1);
+        }
+    }
+
+    Vc_ALWAYS_INLINE typename V::IndexType index(std::size_t i) const
+    {
+        return typename V::IndexType(&indexes[(i & (IndexVectors - 1)) * V::Size],
+                                     Vc::Aligned);
+    }
+    Vc_ALWAYS_INLINE typename V::Mask mask(std::size_t i) const
+    {
+        return V(&selection[(i & (IndexVectors - 1)) * V::Size], Vc::Aligned) > V::Zero();
+    }
+};
+
+// gather / scatter strategies {{{1
+// The software strategies are only implemented for the SIMD implementations.
+#ifndef Vc_IMPL_Scalar
+template <typename V, typename Strategy>
+void addGatherStrategy(const char *name, std::shared_ptr<Tables<V>> t)
+{
+    addThroughput<V>("gather", std::string("masked_gather(") + name + ')',
+                     [=](std::size_t n) {
+                         for (std::size_t i = 0; i < n; i += Streams) {
+                             for (int k = 0; k < Streams; ++k) {
+                                 V v = V::Zero();
+                                 Vc::Common::executeGather(Strategy(), v, t->table.data(),
+                                                           t->index(i + k), t->mask(i + k));
+                                 fakeRead(v);
+                             }
+                         }
+                     });
+}
+
+template <typename V, typename Strategy>
+void addScatterStrategy(const char *name, std::shared_ptr<Tables<V>> t)
+{
+    addThroughput<V>("scatter", std::string("masked_scatter(") + name + ')',
+                     [=](std::size_t n) {
+                         V v = V::Zero();
+                         for (std::size_t i = 0; i < n; i += Streams) {
+                             for (int k = 0; k < Streams; ++k) {
+                                 fakeModify(v);
+                                 Vc::Common::executeScatter(Strategy(), v, t->table.data(),
+                                                            t->index(i + k), t->mask(i + k));
+                             }
+                         }
+                     });
+}
+
+// PopcntSwitch is implemented for 2, 4, 8, and 16 entries.
+template <typename V> void addPopcntSwitch(std::shared_ptr<Tables<V>>, std::false_type) {}
+template <typename V> void addPopcntSwitch(std::shared_ptr<Tables<V>> t, std::true_type)
+{
+    addGatherStrategy<V, Vc::Common::PopcntSwitchT>("PopcntSwitch", t);
+    addScatterStrategy<V, Vc::Common::PopcntSwitchT>("PopcntSwitch", t);
+}
+
+template <typename V> void addStrategies(std::shared_ptr<Tables<V>> t)
+{
+    using namespace Vc::Common;
+    addGatherStrategy<V, SimpleLoopT>("SimpleLoop", t);
+    addGatherStrategy<V, BitScanLoopT>("BitScanLoop", t);
+    addScatterStrategy<V, SimpleLoopT>("SimpleLoop", t);
+    addScatterStrategy<V, BitScanLoopT>("BitScanLoop", t);
+    addPopcntSwitch<V>(t, std::integral_constant<bool, (V::Size <= 16)>());
+}
+#endif  // Vc_IMPL_Scalar
+
+// registration {{{1
+/* The gather latency is the length of a chain in which the indexes of every gather are
+ * the result of the previous gather. This includes the conversion to V::IndexType.
+ */
+static Registrar gatherscatter([] {
+    AllVectors::forEach([](auto v) {
+        using V = decltype(v);
+        using IV = typename V::IndexType;
+        const auto t = std::make_shared<Tables<V>>();
+        addKernel<V>("gather", "gather",
+                     [=](std::size_t n) {
+                         for (std::size_t i = 0; i < n; i += Streams) {
+                             for (int k = 0; k < Streams; ++k) {
+                                 fakeRead(V(t->table.data(), t->index(i + k)));
+                             }
+                         }
+                     },
+                     [=](std::size_t n) {
+                         IV idx = t->index(0);
+                         for (std::size_t i = 0; i < n; ++i) {
+                             idx = Vc::simd_cast<IV>(V(t->table.data(), idx));
+                         }
+                         fakeRead(idx);
+                     });
+        addThroughput<V>("gather", "masked_gather", [=](std::size_t n) {
+            for (std::size_t i = 0; i < n; i += Streams) {
+                for (int k = 0; k < Streams; ++k) {
+                    V v = V::Zero();
+                    v.gather(t->table.data(), t->index(i + k), t->mask(i + k));
+                    fakeRead(v);
+                }
+            }
+        });
+        addThroughput<V>("scatter", "scatter", [=](std::size_t n) {
+            V v = V::Zero();
+            for (std::size_t i = 0; i < n; i += Streams) {
+                for (int k = 0; k < Streams; ++k) {
+                    fakeModify(v);
+                    v.scatter(t->table.data(), t->index(i + k));
+                }
+            }
+        });
+        addThroughput<V>("scatter", "masked_scatter", [=](std::size_t n) {
+            V v = V::Zero();
+            for (std::size_t i = 0; i < n; i += Streams) {
+                for (int k = 0; k < Streams; ++k) {
+                    fakeModify(v);
+                    v.scatter(t->table.data(), t->index(i + k), t->mask(i + k));
+                }
+            }
+        });
+        // adds zeros, which leaves the table intact
+        addThroughput<V>("scatter", "scatter_add", [=](std::size_t n) {
+            V v = V::Zero();
+            for (std::size_t i = 0; i < n; i += Streams) {
+                for (int k = 0; k < Streams; ++k) {
+                    fakeModify(v);
+                    Vc::scatter_add(t->table.data(), t->index(i + k), v);
+                }
+            }
+        });
+        addThroughput<V>("scatter", "masked_scatter_add", [=](std::size_t n) {
+            V v = V::Zero();
+            for (std::size_t i = 0; i < n; i += Streams) {
+                for (int k = 0; k < Streams; ++k) {
+                    fakeModify(v);
+                    Vc::scatter_add(t->table.data(), t->index(i + k), v, t->mask(i + k));
+                }
+            }
+        });
+#ifndef Vc_IMPL_Scalar
+        addStrategies<V>(t);
+#endif
+    });
+});
+// }}}1
+
+// vim: foldmethod=marker
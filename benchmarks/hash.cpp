@@ -0,0 +1,51 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+
+#include "benchmark.h"
+#include <Vc/algorithm>
+
+using namespace Benchmark;
+
+// One operation hashes V::Size keys. benchmark_scalar hashes one key at a time.
+static Registrar hash([] {
+    TypeList<Vc::uint_v>::forEach([](auto v) {
+        using V = decltype(v);
+        addFunction<V>("hash", "murmur3_fmix32",
+                       [](const V &x) { return Vc::murmur3_fmix32(x); }, 12345u);
+        addFunction<V>("hash", "murmur3_32",
+                       [](const V &x) { return Vc::murmur3_32(x, 42u); }, 12345u);
+        addFunction<V>("hash", "xxhash32",
+                       [](const V &x) { return Vc::xxhash32(x, 42u); }, 12345u);
+        addFunction<V>("hash", "multiply_shift",
+                       [](const V &x) { return Vc::multiply_shift(x, 0x9e3779b1u, 10); },
+                       12345u);
+    });
+});
+
+// vim: foldmethod=marker
@@ -0,0 +1,122 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "benchmark.h"
+#include <memory>
+
+using namespace Benchmark;
+
+// buffer {{{1
+/* The kernels cycle through an L1-resident buffer. Unaligned accesses use an address one
+ * entry past a vector boundary, so that they really are misaligned (except for Scalar).
+ */
+constexpr std::size_t BufferVectors = 64;
+
+template <typename T> using Buffer = std::vector<T, Vc::Allocator<T>>;
+
+template <typename V, typename Flags>
+std::shared_ptr<Buffer<Entry<V>>> makeBuffer(std::size_t &offset)
+{
+    offset = Flags::IsUnaligned ? 1 : 0;
+    return std::make_shared<Buffer<Entry<V>>>((BufferVectors + 1) * V::Size, Entry<V>());
+}
+
+Vc_ALWAYS_INLINE std::size_t slot(std::size_t i) { return i & (BufferVectors - 1); }
+
+// load / store {{{1
+/* The load latency is the length of a chain in which the address of every load depends on
+ * (the first entry of) the previous load. This includes the extraction of that entry.
+ */
+template <typename V, typename Flags> void addLoadStore(const char *flagsName, Flags flags)
+{
+    using T = Entry<V>;
+    std::size_t offset;
+    const auto buffer = makeBuffer<V, Flags>(offset);
+    const std::string load = std::string("load(") + flagsName + ')';
+    const std::string store = std::string("store(") + flagsName + ')';
+    const std::string masked = std::string("masked_store(") + flagsName + ')';
+
+    addKernel<V>("loadstore", load,
+                 [=](std::size_t n) {
+                     const T *mem = buffer->data() + offset;
+                     for (std::size_t i = 0; i < n; i += Streams) {
+                         for (int k = 0; k < Streams; ++k) {
+                             fakeRead(V(mem + slot(i + k) * V::Size, flags));
+                         }
+                     }
+                 },
+                 [=](std::size_t n) {
+                     const T *mem = buffer->data() + offset;
+                     std::size_t next = 0;
+                     for (std::size_t i = 0; i < n; ++i) {
+                         const V x(mem + slot(next + i) * V::Size, flags);
+                         next = static_cast<std::size_t>(x[0]);
+                     }
+                     fakeRead(next);
+                 });
+    addThroughput<V>("loadstore", store, [=](std::size_t n) {
+        T *mem = buffer->data() + offset;
+        V x = V::Zero();
+        for (std::size_t i = 0; i < n; i += Streams) {
+            for (int k = 0; k < Streams; ++k) {
+                fakeModify(x);
+                x.store(mem + slot(i + k) * V::Size, flags);
+            }
+        }
+    });
+    addThroughput<V>("loadstore", masked, [=](std::size_t n) {
+        T *mem = buffer->data() + offset;
+        V x = V::Zero();
+        const auto mask = V::IndexesFromZero() < V(T(V::Size / 2 + 1));
+        for (std::size_t i = 0; i < n; i += Streams) {
+            for (int k = 0; k < Streams; ++k) {
+                fakeModify(x);
+                x.store(mem + slot(i + k) * V::Size, mask, flags);
+            }
+        }
+    });
+}
+
+// registration {{{1
+static Registrar loadstore([] {
+    AllVectors::forEach([](auto v) {
+        using V = decltype(v);
+        addLoadStore<V>("Aligned", Vc::Aligned);
+        addLoadStore<V>("Unaligned", Vc::Unaligned);
+        addLoadStore<V>("Streaming", Vc::Streaming);
+        addLoadStore<V>("Unaligned|Streaming", Vc::Unaligned | Vc::Streaming);
+        addLoadStore<V>("Aligned|PrefetchDefault", Vc::Aligned | Vc::PrefetchDefault);
+        addLoadStore<V>("Unaligned|PrefetchDefault", Vc::Unaligned | Vc::PrefetchDefault);
+        addLoadStore<V>("Streaming|PrefetchDefault", Vc::Streaming | Vc::PrefetchDefault);
+        addLoadStore<V>("Unaligned|Streaming|PrefetchDefault",
+                        Vc::Unaligned | Vc::Streaming | Vc::PrefetchDefault);
+    });
+});
+// }}}1
+
+// vim: foldmethod=marker
@@ -0,0 +1,326 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+using namespace Benchmark;
+
+// options {{{1
+struct Options {
+    std::string filter = ".";
+    bool json = false;
+    bool list = false;
+    std::string out;
+    double minTime = 0.01;  // seconds per repetition
+    int repetitions = 5;
+};
+
+static bool startsWith(const char *arg, const char *prefix, const char **value)
+{
+    const std::size_t n = std::strlen(prefix);
+    if (std::strncmp(arg, prefix, n) == 0) {
+        *value = arg + n;
+        return true;
+    }
+    return false;
+}
+
+static void usage(const char *self)
+{
+    std::cerr
+        << "Usage: " << self << " [options]\n"
+        << "  --benchmark_filter=<regex>     run only cases whose name matches\n"
+        << "  --benchmark_format=console|json\n"
+        << "  --benchmark_out=<file>         additionally write JSON to <file>\n"
+        << "  --benchmark_min_time=<seconds> minimum time per repetition (0.01)\n"
+        << "  --benchmark_repetitions=<n>    the minimum of <n> runs is reported (5)\n"
+        << "  --benchmark_list_tests         list the case names and exit\n";
+}
+
+static bool parse(int argc, char **argv, Options &o)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char *v = nullptr;
+        if (startsWith(argv[i], "--benchmark_filter=", &v)) {
+            o.filter = v;
+        } else if (startsWith(argv[i], "--benchmark_format=", &v)) {
+            if (std::strcmp(v, "json") == 0) {
+                o.json = true;
+            } else if (std::strcmp(v, "console") == 0) {
+                o.json = false;
+            } else {
+                return false;
+            }
+        } else if (startsWith(argv[i], "--benchmark_out=", &v)) {
+            o.out = v;
+        } else if (startsWith(argv[i], "--benchmark_min_time=", &v)) {
+            o.minTime = std::atof(v);
+        } else if (startsWith(argv[i], "--benchmark_repetitions=", &v)) {
+            o.repetitions = std::max(1, std::atoi(v));
+        } else if (std::strcmp(argv[i], "--benchmark_list_tests") == 0) {
+            o.list = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// implementation name {{{1
+static std::string implementationName()
+{
+    static const char *const names[] = {"Scalar", "SSE2",   "SSE3",   "SSSE3", "SSE4_1",
+                                        "SSE4_2", "AVX",    "AVX2",   "AVX512", "MIC"};
+    const unsigned int impl = Vc::CurrentImplementation::current();
+    std::string name = impl < sizeof(names) / sizeof(*names) ? names[impl] : "unknown";
+    const unsigned int features = Vc::CurrentImplementation::features();
+    if (features & Vc::XopInstructions) {
+        name += "+XOP";
+    }
+    if (features & Vc::FmaInstructions) {
+        name += "+FMA";
+    }
+    if (features & Vc::Fma4Instructions) {
+        name += "+FMA4";
+    }
+    if (features & Vc::Bmi2Instructions) {
+        name += "+BMI2";
+    }
+    return name;
+}
+
+static std::string compilerName()
+{
+#if defined Vc_CLANG
+    return "clang " __clang_version__;
+#elif defined Vc_ICC
+    return "icc " + std::to_string(__INTEL_COMPILER);
+#elif defined Vc_GCC
+    return "gcc " __VERSION__;
+#elif defined Vc_MSVC
+    return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+    return "unknown";
+#endif
+}
+
+// measurement {{{1
+struct Result {
+    const Case *c;
+    std::size_t iterations;
+    Sample throughput;
+    Sample latency;
+    bool hasLatency;
+};
+
+static Sample run(const Kernel &k, std::size_t n)
+{
+    Timer t;
+    t.start();
+    k(n);
+    return t.stop();
+}
+
+/* Grows n until one run takes at least minTime and returns the fastest of `repetitions`
+ * runs of that length, normalized to one operation.
+ */
+static Sample measure(const Kernel &k, const Options &o, std::size_t &n)
+{
+    const double minNs = o.minTime * 1e9;
+    n = 64;
+    for (Sample s = run(k, n); s.ns < minNs && n < (std::size_t(1) << 40); s = run(k, n)) {
+        const double factor = s.ns > 0 ? std::min(10., 1.4 * minNs / s.ns) : 10.;
+        n = std::max(n * 2, static_cast<std::size_t>(n * factor)) & ~std::size_t(63);
+    }
+    Sample best = {std::numeric_limits<double>::infinity(),
+                   std::numeric_limits<double>::infinity()};
+    for (int r = 0; r < o.repetitions; ++r) {
+        const Sample s = run(k, n);
+        best.ns = std::min(best.ns, s.ns);
+        best.cycles = std::min(best.cycles, s.cycles);
+    }
+    return {best.ns / n, best.cycles / n};
+}
+
+static Result measure(const Case &c, const Options &o)
+{
+    Result r = {&c, 0, {0, 0}, {0, 0}, bool(c.latency)};
+    r.throughput = measure(c.throughput, o, r.iterations);
+    if (r.hasLatency) {
+        std::size_t n;
+        r.latency = measure(c.latency, o, n);
+        if (c.latencyBaseline) {
+            const Sample base = measure(c.latencyBaseline, o, n);
+            r.latency.ns = std::max(0., r.latency.ns - base.ns);
+            r.latency.cycles = std::max(0., r.latency.cycles - base.cycles);
+        }
+    }
+    return r;
+}
+
+// output {{{1
+static std::string caseName(const Case &c)
+{
+    return c.group + '/' + c.operation + '/' + c.type;
+}
+
+static std::string jsonString(const std::string &s)
+{
+    std::string r = "\"";
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') {
+            r += '\\';
+        }
+        r += ch;
+    }
+    return r + '"';
+}
+
+static void writeJson(std::ostream &out, const std::vector<Result> &results)
+{
+    char date[64] = {};
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+    out << std::setprecision(6);
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": " << jsonString(date) << ",\n"
+        << "    \"library_version\": " << jsonString(Vc_VERSION_STRING) << ",\n"
+        << "    \"implementation\": " << jsonString(implementationName()) << ",\n"
+        << "    \"compiler\": " << jsonString(compilerName()) << ",\n"
+        << "    \"streams\": " << Streams << ",\n"
+        << "    \"time_unit\": \"ns\",\n"
+        << "    \"cycle_unit\": \"tsc\"\n"
+        << "  },\n  \"benchmarks\": [";
+    const char *separator = "\n";
+    for (const Result &r : results) {
+        const Case &c = *r.c;
+        out << separator << "    {\n"
+            << "      \"name\": " << jsonString(caseName(c)) << ",\n"
+            << "      \"group\": " << jsonString(c.group) << ",\n"
+            << "      \"operation\": " << jsonString(c.operation) << ",\n"
+            << "      \"type\": " << jsonString(c.type) << ",\n"
+            << "      \"entry_type\": " << jsonString(c.entry) << ",\n"
+            << "      \"abi\": " << jsonString(c.abi) << ",\n"
+            << "      \"width\": " << c.width << ",\n"
+            << "      \"iterations\": " << r.iterations << ",\n"
+            << "      \"throughput_ns\": " << r.throughput.ns << ",\n"
+            << "      \"throughput_cycles\": " << r.throughput.cycles << ",\n";
+        if (r.hasLatency) {
+            out << "      \"latency_ns\": " << r.latency.ns << ",\n"
+                << "      \"latency_cycles\": " << r.latency.cycles << "\n";
+        } else {
+            out << "      \"latency_ns\": null,\n"
+                << "      \"latency_cycles\": null\n";
+        }
+        out << "    }";
+        separator = ",\n";
+    }
+    out << "\n  ]\n}\n";
+}
+
+static void writeConsoleHeader(std::ostream &out)
+{
+    out << "Vc " << Vc_VERSION_STRING << ", " << implementationName() << ", "
+        << compilerName() << "\n"
+        << std::left << std::setw(64) << "Benchmark" << std::right << std::setw(8)
+        << "ABI" << std::setw(14) << "throughput" << std::setw(14) << "latency"
+        << "   (cycles per operation)\n"
+        << std::string(100, '-') << '\n';
+}
+
+static void writeConsoleLine(std::ostream &out, const Result &r)
+{
+    const Case &c = *r.c;
+    out << std::left << std::setw(64) << caseName(c) << std::right << std::setw(8) << c.abi
+        << std::fixed << std::setprecision(2) << std::setw(14) << r.throughput.cycles;
+    if (r.hasLatency) {
+        out << std::setw(14) << r.latency.cycles;
+    } else {
+        out << std::setw(14) << '-';
+    }
+    out << std::endl;
+}
+
+// main {{{1
+int main(int argc, char **argv)
+{
+    Options o;
+    if (!parse(argc, argv, o)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    const std::regex filter(o.filter);
+    std::vector<const Case *> selected;
+    for (const Case &c : registry()) {
+        if (std::regex_search(caseName(c), filter)) {
+            selected.push_back(&c);
+        }
+    }
+    if (o.list) {
+        for (const Case *c : selected) {
+            std::cout << caseName(*c) << '\n';
+        }
+        return 0;
+    }
+
+    if (!o.json) {
+        writeConsoleHeader(std::cout);
+    }
+    std::vector<Result> results;
+    results.reserve(selected.size());
+    for (const Case *c : selected) {
+        results.push_back(measure(*c, o));
+        if (!o.json) {
+            writeConsoleLine(std::cout, results.back());
+        }
+    }
+    if (o.json) {
+        writeJson(std::cout, results);
+    }
+    if (!o.out.empty()) {
+        std::ofstream file(o.out);
+        writeJson(file, results);
+        if (!file) {
+            std::cerr << "failed to write " << o.out << '\n';
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,108 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+/* Functions that map their argument into their domain (sqrt, floor, ...) are measured as
+ * operations, the others (exp, sin, ...) via addFunction.
+ */
+static Registrar math([] {
+    RealVectors::forEach([](auto v) {
+        using V = decltype(v);
+        using IV = typename V::IndexType;
+        // basic {{{1
+        addOperation<V>("math", "sqrt", [](const V &x, const V &) { return Vc::sqrt(x); }, 2);
+        addOperation<V>("math", "rsqrt", [](const V &x, const V &) { return Vc::rsqrt(x); },
+                        2);
+        addOperation<V>("math", "reciprocal",
+                        [](const V &x, const V &) { return Vc::reciprocal(x); }, 2);
+        addOperation<V>("math", "floor", [](const V &x, const V &) { return Vc::floor(x); },
+                        1.5);
+        addOperation<V>("math", "ceil", [](const V &x, const V &) { return Vc::ceil(x); },
+                        1.5);
+        addOperation<V>("math", "round", [](const V &x, const V &) { return Vc::round(x); },
+                        1.5);
+        addOperation<V>("math", "trunc", [](const V &x, const V &) { return Vc::trunc(x); },
+                        1.5);
+        addOperation<V>("math", "copysign",
+                        [](const V &x, const V &y) { return Vc::copysign(x, y); }, -2);
+        addOperation<V>("math", "isnan",
+                        [](const V &x, const V &y) { return Vc::iif(Vc::isnan(x), y, x); });
+        addOperation<V>("math", "isfinite", [](const V &x, const V &y) {
+            return Vc::iif(Vc::isfinite(x), x, y);
+        });
+        addFunction<V>("math", "exponent", [](const V &x) { return Vc::exponent(x); }, 3);
+        addFunction<V>("math", "frexp", [](const V &x) {
+            IV e;
+            const V m = Vc::frexp(x, &e);
+            return m + Vc::simd_cast<V>(e);
+        }, 3);
+        addFunction<V>("math", "ldexp", [](const V &x) { return Vc::ldexp(x, IV(3)); }, 3);
+
+        // transcendental {{{1
+        addFunction<V>("math", "exp", [](const V &x) { return Vc::exp(x); }, 0.5);
+        addFunction<V>("math", "log", [](const V &x) { return Vc::log(x); }, 0.5);
+        addFunction<V>("math", "log2", [](const V &x) { return Vc::log2(x); }, 0.5);
+        addFunction<V>("math", "log10", [](const V &x) { return Vc::log10(x); }, 0.5);
+        addFunction<V>("math", "sin", [](const V &x) { return Vc::sin(x); }, 0.5);
+        addFunction<V>("math", "cos", [](const V &x) { return Vc::cos(x); }, 0.5);
+        addFunction<V>("math", "sincos", [](const V &x) {
+            V s, c;
+            Vc::sincos(x, &s, &c);
+            return s + c;
+        }, 0.5);
+        addFunction<V>("math", "asin", [](const V &x) { return Vc::asin(x); }, 0.5);
+        addFunction<V>("math", "atan", [](const V &x) { return Vc::atan(x); }, 0.5);
+        addFunction<V>("math", "atan2", [](const V &x) { return Vc::atan2(x, x + V(1)); },
+                       0.5);
+
+        // accuracy tiers {{{1
+#define Vc_BENCHMARK_TIERS(name_, input_)                                                \
+    addFunction<V>("math", #name_ "(PreciseMath)",                                        \
+                   [](const V &x) { return Vc::name_(x, Vc::PreciseMath); }, input_);    \
+    addFunction<V>("math", #name_ "(FastMath)",                                           \
+                   [](const V &x) { return Vc::name_(x, Vc::FastMath); }, input_)
+        Vc_BENCHMARK_TIERS(exp, 0.5);
+        Vc_BENCHMARK_TIERS(exp2, 0.5);
+        Vc_BENCHMARK_TIERS(expm1, 0.5);
+        Vc_BENCHMARK_TIERS(log, 0.5);
+        Vc_BENCHMARK_TIERS(log2, 0.5);
+        Vc_BENCHMARK_TIERS(log1p, 0.5);
+        Vc_BENCHMARK_TIERS(cbrt, 0.5);
+#undef Vc_BENCHMARK_TIERS
+        addFunction<V>("math", "pow(PreciseMath)",
+                       [](const V &x) { return Vc::pow(x, x + V(1), Vc::PreciseMath); }, 0.5);
+        addFunction<V>("math", "pow(FastMath)",
+                       [](const V &x) { return Vc::pow(x, x + V(1), Vc::FastMath); }, 0.5);
+        // }}}1
+    });
+});
+
+// vim: foldmethod=marker
@@ -0,0 +1,75 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+/* Registers simd_cast<To>(From). The latency is the one of the round trip
+ * simd_cast<From>(simd_cast<To>(x)), as a cast alone cannot form a chain.
+ */
+template <typename From, typename To> void addCast()
+{
+    addKernel<From>(
+        "simd_cast", "to<" + TypeInfo<To>::name() + ">",
+        throughputKernel<From>([](const From &x, const From &) { return Vc::simd_cast<To>(x); },
+                               1, 0),
+        chainKernel<From>(
+            [](const From &x, const From &) {
+                return Vc::simd_cast<From>(Vc::simd_cast<To>(x));
+            },
+            1, 0));
+}
+
+static Registrar simdcast([] {
+    using Vc::float_v;
+    using Vc::double_v;
+    using Vc::int_v;
+    using Vc::uint_v;
+    using Vc::short_v;
+    using Vc::ushort_v;
+    addCast<int_v, float_v>();
+    addCast<float_v, int_v>();
+    addCast<uint_v, float_v>();
+    addCast<float_v, uint_v>();
+    addCast<float_v, double_v>();
+    addCast<double_v, float_v>();
+    addCast<int_v, double_v>();
+    addCast<double_v, int_v>();
+    addCast<int_v, short_v>();
+    addCast<short_v, int_v>();
+    addCast<uint_v, ushort_v>();
+    addCast<ushort_v, uint_v>();
+    addCast<short_v, float_v>();
+    addCast<float_v, short_v>();
+    addCast<float_v, Vc::fixed_size_simd<double, float_v::Size>>();
+    addCast<Vc::fixed_size_simd<double, float_v::Size>, float_v>();
+    addCast<int_v, Vc::fixed_size_simd<float, int_v::Size>>();
+});
+
+// vim: foldmethod=marker
@@ -389,7 +389,7 @@ macro(_vc_compile_one_implementation _srcs _impl)
       endif()
       list(REMOVE_AT _disabled_targets ${_disabled_index})
       # skip the rest and return
-   elseif(NOT _only_targets OR ${_only_index} GREATER -1)
+   elseif(NOT _only_given OR ${_only_index} GREATER -1)
       if(${_only_index} GREATER -1)
          list(REMOVE_AT _only_targets ${_only_index})
       endif()
@@ -450,6 +450,7 @@ macro(vc_compile_for_all_implementations _srcs _src)
    set(_flags)
    unset(_disabled_targets)
    unset(_only_targets)
+   set(_only_given FALSE)
    set(_state 0)
    foreach(_arg ${ARGN})
       if(_arg STREQUAL "FLAGS")
@@ -464,6 +465,7 @@ macro(vc_compile_for_all_implementations _srcs _src)
          list(APPEND _disabled_targets "${_arg}")
       elseif(_state EQUAL 3)
          list(APPEND _only_targets "${_arg}")
+         set(_only_given TRUE)
       else()
          message(FATAL_ERROR "incorrect argument to vc_compile_for_all_implementations")
       endif()
@@ -499,6 +501,8 @@ macro(vc_compile_for_all_implementations _srcs _src)
       #_vc_compile_one_implementation(${_srcs} AVX2+BMI2 "-mavx2 -mbmi2")
       _vc_compile_one_implementation(${_srcs} AVX2+FMA+BMI2 "-xCORE-AVX2" "-mavx2 -mfma -mbmi2" "/arch:AVX2")
       #_vc_compile_one_implementation(${_srcs} AVX2+FMA "-mavx2 -mfma")
+      # The AVX512 target assumes the Skylake-SP subset (F, CD, BW, DQ, VL)
+      _vc_compile_one_implementation(${_srcs} AVX512+FMA+BMI2 "-xCORE-AVX512" "-march=skylake-avx512" "/arch:AVX512")
    endif()
    list(LENGTH _only_targets _len)
    if(_len GREATER 0)
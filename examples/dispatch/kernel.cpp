@@ -0,0 +1,54 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "kernel.h"
+#include <Vc/Vc>
+
+// This file is compiled once for every Vc_IMPL listed in CMakeLists.txt. Every
+// compilation contributes the dot<Impl> instantiation for its own implementation.
+template <Vc::Implementation Impl>
+float dot(const float *a, const float *b, std::size_t n)
+{
+    using Vc::float_v;
+    float_v sum0 = 0.f;
+    float_v sum1 = 0.f;
+    std::size_t i = 0;
+    for (; i + 2 * float_v::Size <= n; i += 2 * float_v::Size) {
+        sum0 += float_v(&a[i], Vc::Unaligned) * float_v(&b[i], Vc::Unaligned);
+        sum1 += float_v(&a[i + float_v::Size], Vc::Unaligned) *
+                float_v(&b[i + float_v::Size], Vc::Unaligned);
+    }
+    float r = (sum0 + sum1).sum();
+    for (; i < n; ++i) {
+        r += a[i] * b[i];
+    }
+    return r;
+}
+
+template float dot<Vc::CurrentImplementation::current()>(const float *, const float *,
+                                                          std::size_t);
@@ -0,0 +1,82 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include <Vc/dispatch.h>
+#include <cstdio>
+#include <vector>
+#include "kernel.h"
+#include "../tsc.h"
+
+using DotFunction = float(const float *, const float *, std::size_t);
+
+static const Vc::FunctionDispatcher<DotFunction> dotDispatch = {
+    {Vc::ScalarImpl, &dot<Vc::ScalarImpl>},
+    {Vc::SSE2Impl, &dot<Vc::SSE2Impl>},
+    {Vc::SSE42Impl, &dot<Vc::SSE42Impl>},
+    {Vc::AVXImpl, &dot<Vc::AVXImpl>},
+    {Vc::AVX2Impl + Vc::FmaInstructions + Vc::Bmi2Instructions, &dot<Vc::AVX2Impl>},
+    {Vc::AVX512Impl + Vc::FmaInstructions + Vc::Bmi2Instructions, &dot<Vc::AVX512Impl>}};
+
+int Vc_CDECL main()
+{
+    constexpr std::size_t N = 4096;
+    constexpr int Repetitions = 1000;
+    std::vector<float> a(N), b(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        a[i] = float(i % 7) * 0.25f;
+        b[i] = float(i % 5) * 0.5f;
+    }
+
+    const char *names[] = {"Scalar", "SSE2",   "SSE3", "SSSE3",
+                           "SSE4.1", "SSE4.2", "AVX",  "AVX2", "AVX512"};
+    TimeStampCounter tsc;
+    for (unsigned int impl = Vc::ScalarImpl; impl <= Vc::AVX512Impl; ++impl) {
+        DotFunction *f = dotDispatch.select(static_cast<Vc::Implementation>(impl));
+        if (f == nullptr || (impl > Vc::ScalarImpl &&
+                             f == dotDispatch.select(static_cast<Vc::Implementation>(impl - 1)))) {
+            continue;  // no variant for this implementation or not supported
+        }
+        float r = 0.f;
+        tsc.start();
+        for (int rep = 0; rep < Repetitions; ++rep) {
+            r += f(a.data(), b.data(), N);
+        }
+        tsc.stop();
+        std::printf("%8s: %10.2f cycles/call (result %g)\n", names[impl],
+                    double(tsc.cycles()) / Repetitions, double(r / Repetitions));
+    }
+
+    unsigned int selected = Vc::ScalarImpl;
+    while (dotDispatch.select(static_cast<Vc::Implementation>(selected)) !=
+           dotDispatch.resolve()) {
+        ++selected;
+    }
+    std::printf("selected: %8s (result %g)\n", names[selected],
+                double(dotDispatch(a.data(), b.data(), N)));
+    return 0;
+}
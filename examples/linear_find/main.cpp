@@ -107,19 +107,6 @@ inline Iterator lower_bound(Iterator first, Iterator last,
     return first;
 }
 
-template <class Iterator, class T>
-inline Iterator find(Iterator first, Iterator last, const T &value)
-{
-    typename simdize<Iterator>::value_type value_v = value;
-    for (simdize<Iterator> it = first; it < last; ++it) {
-        const auto mask = *it == value_v;
-        if (any_of(mask)) {
-            return static_cast<Iterator>(it) + mask.firstOne();
-        }
-    }
-    return last;
-}
-
 template <class Iterator, class V>
 inline std::array<Iterator, V::size()> find_parallel(Iterator first, Iterator last,
                                                      const V &value)
@@ -0,0 +1,95 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "../tsc.h"
+
+/*
+ * This example shows how the parallel Vc::simd_for_each scales with the number of threads.
+ * For a small number of FLOPs per element the loop is limited by memory bandwidth and stops
+ * scaling early, for a large number of FLOPs it should scale with the number of cores.
+ */
+
+template <int FLOPs> struct Kernel {
+    template <typename V> Vc_ALWAYS_INLINE void operator()(V &x) const
+    {
+        V y = x;
+        for (int i = 0; i < FLOPs / 2; ++i) {
+            y = y * V(0.999f) + V(0.001f);
+        }
+        x = y;
+    }
+};
+
+template <int FLOPs> void benchmark(std::vector<float> &data, unsigned int maxThreads)
+{
+    std::cout << std::setw(6) << FLOPs << " FLOPs/element:\n";
+    unsigned long long baseline = 0;
+    // doubles the thread count, but always ends with a measurement of maxThreads
+    for (unsigned int threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+        TimeStampCounter tsc;
+        unsigned long long best = ~0ull;
+        for (int rep = 0; rep < 5; ++rep) {
+            tsc.start();
+            Vc::simd_for_each(Vc::Parallel(threads), data.begin(), data.end(),
+                              Kernel<FLOPs>());
+            tsc.stop();
+            best = std::min(best, tsc.cycles());
+        }
+        if (threads == 1) {
+            baseline = best;
+        }
+        std::cout << std::setw(10) << threads << " threads: " << std::setw(12) << best
+                  << " cycles, " << std::setw(8) << std::setprecision(3)
+                  << double(best) / data.size() << " cycles/element, speedup "
+                  << std::setw(5) << double(baseline) / best << '\n';
+        if (threads == maxThreads) {
+            break;
+        }
+    }
+}
+
+int Vc_CDECL main(int argc, char **argv)
+{
+    const unsigned int maxThreads =
+        argc > 1 ? static_cast<unsigned int>(std::max(1, std::atoi(argv[1])))
+                 : static_cast<unsigned int>(Vc::Common::ThreadPool::global().size());
+    std::vector<float> data(1 << 25, 1.f);  // 128 MiB
+    std::cout << "Vc::simd_for_each(Vc::Parallel(n), ...) over " << data.size()
+              << " floats, " << Vc::float_v::Size << " floats per vector, "
+              << Vc::Common::ThreadPool::global().size() << " threads in the pool\n";
+    benchmark<2>(data, maxThreads);
+    benchmark<16>(data, maxThreads);
+    benchmark<128>(data, maxThreads);
+    return 0;
+}
@@ -486,5 +486,38 @@ namespace SSE
         //floatConstant< 1, 0x001a209a, -2>(), // log10(2)
         //floatConstant< 1, 0x001a209a, -2>(), // log10(2)
     };
+
+    // compress/expand permutations for up to 8 lanes, indexed by the mask bits
+    constexpr unsigned char nthSetBit(unsigned int bits, unsigned int n, unsigned char pos = 0)
+    {
+        return bits == 0 ? 0xff
+                         : (bits & 1) ? (n == 0 ? pos : nthSetBit(bits >> 1, n - 1, pos + 1))
+                                      : nthSetBit(bits >> 1, n, pos + 1);
+    }
+    constexpr unsigned char setBitsBelow(unsigned int bits, unsigned int n)
+    {
+        return n == 0 ? 0 : (bits & 1) + setBitsBelow(bits >> 1, n - 1);
+    }
+    constexpr unsigned char expandIndex(unsigned int bits, unsigned int n)
+    {
+        return (bits >> n) & 1 ? setBitsBelow(bits, n) : 0xff;
+    }
+#define Vc_ROW(f_, m_) {f_(m_, 0), f_(m_, 1), f_(m_, 2), f_(m_, 3), f_(m_, 4), f_(m_, 5), f_(m_, 6), f_(m_, 7)}
+#define Vc_ROWS4(f_, m_) Vc_ROW(f_, m_), Vc_ROW(f_, m_ + 1), Vc_ROW(f_, m_ + 2), Vc_ROW(f_, m_ + 3)
+#define Vc_ROWS16(f_, m_) Vc_ROWS4(f_, m_), Vc_ROWS4(f_, m_ + 4), Vc_ROWS4(f_, m_ + 8), Vc_ROWS4(f_, m_ + 12)
+#define Vc_ROWS256(f_)                                                                   \
+    Vc_ROWS16(f_, 0), Vc_ROWS16(f_, 16), Vc_ROWS16(f_, 32), Vc_ROWS16(f_, 48),           \
+        Vc_ROWS16(f_, 64), Vc_ROWS16(f_, 80), Vc_ROWS16(f_, 96), Vc_ROWS16(f_, 112),     \
+        Vc_ROWS16(f_, 128), Vc_ROWS16(f_, 144), Vc_ROWS16(f_, 160), Vc_ROWS16(f_, 176),  \
+        Vc_ROWS16(f_, 192), Vc_ROWS16(f_, 208), Vc_ROWS16(f_, 224), Vc_ROWS16(f_, 240)
+    alignas(64) extern const unsigned char _CompressIndexes8[256][8] = {Vc_ROWS256(nthSetBit)};
+    alignas(64) extern const unsigned char _ExpandIndexes8[256][8] = {Vc_ROWS256(expandIndex)};
+#undef Vc_ROWS256
+#undef Vc_ROWS16
+#undef Vc_ROWS4
+#undef Vc_ROW
+    alignas(32) extern const unsigned char _ShiftBytesUp[32] = {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
 }
 }
@@ -0,0 +1,215 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/complex>
+#include <complex>
+#include <limits>
+#include <random>
+
+using RealScalars = vir::Typelist<float, double>;
+
+// helpers {{{1
+template <typename T> static std::complex<T> randomComplex(std::mt19937 &engine)
+{
+    std::uniform_real_distribution<T> dist(T(-10), T(10));
+    const T re = dist(engine);
+    return {re, dist(engine)};
+}
+
+template <typename T>
+static Vc::complex_v<T> randomComplexV(std::mt19937 &engine, std::complex<T> *lanes)
+{
+    for (std::size_t i = 0; i < Vc::complex_v<T>::Size; ++i) {
+        lanes[i] = randomComplex<T>(engine);
+    }
+    return Vc::complex_v<T>(lanes);
+}
+
+// Relative error bound for results that may differ in rounding from std::complex, e.g.
+// because of FMA contraction or the reciprocal in the division.
+template <typename T>
+static bool closeTo(std::complex<T> x, std::complex<T> ref, T ulps = T(16))
+{
+    return std::abs(x - ref) <= ulps * std::numeric_limits<T>::epsilon() * std::abs(ref);
+}
+
+TEST_TYPES(T, construction, RealScalars)  // {{{1
+{
+    using C = Vc::complex_v<T>;
+    using V = typename C::vector_type;
+    const C zero;
+    COMPARE(zero.real(), V::Zero());
+    COMPARE(zero.imag(), V::Zero());
+
+    const C broadcast(std::complex<T>(1, 2));
+    const C fromReal(T(3));
+    const C fromParts(V::IndexesFromZero(), -V::IndexesFromZero());
+    for (std::size_t i = 0; i < C::Size; ++i) {
+        COMPARE(broadcast[i], std::complex<T>(1, 2));
+        COMPARE(fromReal[i], std::complex<T>(3, 0));
+        COMPARE(fromParts[i], std::complex<T>(T(i), -T(i)));
+    }
+
+    C z;
+    z.real(V(T(5)));
+    z.imag(V(T(6)));
+    COMPARE(real(z), V(T(5)));
+    COMPARE(imag(z), V(T(6)));
+}
+
+TEST_TYPES(T, loadStore, RealScalars)  // {{{1
+{
+    using C = Vc::complex_v<T>;
+    constexpr std::size_t N = 3 * C::Size + 1;
+    alignas(C::vector_type::MemoryAlignment) std::complex<T> mem[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        mem[i] = {T(i), T(1000) - T(i)};
+    }
+
+    for (std::size_t offset : {std::size_t(0), C::Size}) {
+        const C aligned(&mem[offset], Vc::Aligned);
+        for (std::size_t i = 0; i < C::Size; ++i) {
+            COMPARE(aligned[i], mem[offset + i]) << offset;
+        }
+    }
+    for (std::size_t offset = 1; offset < 2 * C::Size + 1; ++offset) {
+        const C unaligned(&mem[offset]);
+        for (std::size_t i = 0; i < C::Size; ++i) {
+            COMPARE(unaligned[i], mem[offset + i]) << offset;
+        }
+    }
+
+    alignas(C::vector_type::MemoryAlignment) std::complex<T> out[N] = {};
+    C(&mem[1]).store(&out[0], Vc::Aligned);
+    C(&mem[2]).store(&out[C::Size + 1]);
+    for (std::size_t i = 0; i < C::Size; ++i) {
+        COMPARE(out[i], mem[1 + i]);
+        COMPARE(out[C::Size + 1 + i], mem[2 + i]);
+    }
+    COMPARE(out[C::Size], std::complex<T>());
+    COMPARE(out[2 * C::Size + 1], std::complex<T>());
+}
+
+TEST_TYPES(T, arithmetic, RealScalars)  // {{{1
+{
+    using C = Vc::complex_v<T>;
+    using V = typename C::vector_type;
+    std::mt19937 engine(1);
+    std::complex<T> a[C::Size], b[C::Size];
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        const C x = randomComplexV(engine, a);
+        const C y = randomComplexV(engine, b);
+        const C sum = x + y, diff = x - y, prod = x * y, quot = x / y, neg = -x;
+        for (std::size_t i = 0; i < C::Size; ++i) {
+            COMPARE(sum[i], a[i] + b[i]);
+            COMPARE(diff[i], a[i] - b[i]);
+            COMPARE(neg[i], -a[i]);
+            VERIFY(closeTo(prod[i], a[i] * b[i])) << prod[i] << " != " << a[i] * b[i];
+            VERIFY(closeTo(quot[i], a[i] / b[i])) << quot[i] << " != " << a[i] / b[i];
+        }
+
+        // mixed complex / real operands
+        const V s = y.real();
+        const C xs = x * s, sx = s * x, xt = x * T(2), tx = T(2) * x, xdiv = x / s;
+        const C xdivt = x / T(4), xplust = x + T(1), tminusx = T(1) - x;
+        for (std::size_t i = 0; i < C::Size; ++i) {
+            COMPARE(xs[i], a[i] * b[i].real());
+            COMPARE(sx[i], b[i].real() * a[i]);
+            COMPARE(xt[i], a[i] * T(2));
+            COMPARE(tx[i], T(2) * a[i]);
+            COMPARE(xdiv[i], a[i] / b[i].real());
+            COMPARE(xdivt[i], a[i] / T(4));
+            COMPARE(xplust[i], a[i] + T(1));
+            COMPARE(tminusx[i], T(1) - a[i]);
+        }
+
+        C z = x;
+        z += y;
+        z -= T(1);
+        z *= y;
+        z /= s;
+        for (std::size_t i = 0; i < C::Size; ++i) {
+            const std::complex<T> ref = (a[i] + b[i] - T(1)) * b[i] / b[i].real();
+            VERIFY(closeTo(z[i], ref, T(64))) << z[i] << " != " << ref;
+        }
+    }
+}
+
+TEST_TYPES(T, functions, RealScalars)  // {{{1
+{
+    using C = Vc::complex_v<T>;
+    using V = typename C::vector_type;
+    // arg is Vc::atan2, see the atan2 test in trigonometric.cpp
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(2);
+    std::mt19937 engine(2);
+    std::complex<T> a[C::Size];
+    for (int repeat = 0; repeat < 1000; ++repeat) {
+        const C x = randomComplexV(engine, a);
+        const C c = conj(x);
+        const V n = norm(x), m = abs(x), phi = arg(x);
+        const C p = Vc::polar(m, phi);
+        FUZZY_COMPARE(n, V::generate([&](int i) { return std::norm(a[i]); }));
+        FUZZY_COMPARE(m, V::generate([&](int i) { return std::abs(a[i]); }));
+        FUZZY_COMPARE(phi, V::generate([&](int i) { return std::arg(a[i]); }))
+            << x.real() << x.imag();
+        for (std::size_t i = 0; i < C::Size; ++i) {
+            COMPARE(c[i], std::conj(a[i]));
+            VERIFY(closeTo(p[i], a[i], T(32))) << p[i] << " != " << a[i];
+        }
+    }
+
+    // arg covers all four quadrants and the axes
+    const T pi = T(3.14159265358979323846);
+    COMPARE(arg(C(std::complex<T>(1, 0)))[0], T(0));
+    COMPARE(arg(C(std::complex<T>(0, 1)))[0], pi / 2);
+    COMPARE(arg(C(std::complex<T>(-1, 0)))[0], pi);
+    COMPARE(arg(C(std::complex<T>(0, -1)))[0], -pi / 2);
+    FUZZY_COMPARE(arg(C(std::complex<T>(-1, -1))), V(-3 * pi / 4));
+}
+
+TEST_TYPES(T, compareAndSelect, RealScalars)  // {{{1
+{
+    using C = Vc::complex_v<T>;
+    using V = typename C::vector_type;
+    const V i = V::IndexesFromZero();
+    const C x(i, i);
+    const C y(i, V::Zero());
+    const auto eq = x == y;
+    const auto ne = x != y;
+    COMPARE(eq, i == V::Zero());
+    COMPARE(ne, !eq);
+    COMPARE(x == x, (i == i));
+
+    const C sel = iif(eq, C(std::complex<T>(7, 8)), x);
+    for (std::size_t k = 0; k < C::Size; ++k) {
+        COMPARE(sel[k], k == 0 ? std::complex<T>(7, 8) : std::complex<T>(T(k), T(k)));
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,163 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using NativeTypes =
+    vir::concat<AllVectors, vir::Typelist<llong_v, ullong_v, schar_v, uchar_v>>;
+using CompressTypes = vir::concat<NativeTypes, SimdArrays<19>, SimdArrays<3>>;
+
+// forAllMasks {{{1
+// Calls f(mask) with all masks for vectors of up to 8 entries and with random masks
+// otherwise.
+template <typename V, typename F> static void forAllMasks(F &&f)
+{
+    using T = typename V::EntryType;
+    using M = typename V::mask_type;
+    const V one = T(1);
+    if (V::Size <= 8) {
+        for (unsigned int bits = 0; bits < (1u << V::Size); ++bits) {
+            f(V::generate([&](int i) { return T((bits >> i) & 1); }) == one);
+        }
+    } else {
+        std::mt19937 rng(1);
+        std::uniform_int_distribution<int> dist(0, 1);
+        for (int n = 0; n < 2000; ++n) {
+            int sel[V::Size];
+            for (auto &s : sel) {
+                s = dist(rng);
+            }
+            f(V::generate([&](int i) { return T(sel[i]); }) == one);
+        }
+        f(M(true));
+        f(M(false));
+    }
+}
+
+// compress {{{1
+TEST_TYPES(V, compressVector, CompressTypes)
+{
+    using T = typename V::EntryType;
+    const V v = V::generate([](int i) { return T(i + 1); });
+    forAllMasks<V>([&](const typename V::mask_type &mask) {
+        T ref[V::Size] = {};
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (mask[i]) {
+                ref[n++] = v[i];
+            }
+        }
+        COMPARE(compress(v, mask), V(&ref[0], Vc::Unaligned)) << "mask: " << mask;
+    });
+}
+
+// expand {{{1
+TEST_TYPES(V, expandVector, CompressTypes)
+{
+    using T = typename V::EntryType;
+    const V v = V::generate([](int i) { return T(i + 1); });
+    forAllMasks<V>([&](const typename V::mask_type &mask) {
+        T ref[V::Size] = {};
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (mask[i]) {
+                ref[i] = v[n++];
+            }
+        }
+        COMPARE(expand(v, mask), V(&ref[0], Vc::Unaligned)) << "mask: " << mask;
+        COMPARE(expand(compress(v, mask), mask), iif(mask, v, V(0))) << "mask: " << mask;
+    });
+}
+
+// compressStore {{{1
+TEST_TYPES(V, compressStore, CompressTypes)
+{
+    using T = typename V::EntryType;
+    const V v = V::generate([](int i) { return T(i + 1); });
+    forAllMasks<V>([&](const typename V::mask_type &mask) {
+        T mem[V::Size + 1];
+        std::fill_n(&mem[0], V::Size + 1, T(99));
+        const std::size_t n = v.compressStore(&mem[0], mask);
+        COMPARE(n, std::size_t(mask.count()));
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (mask[i]) {
+                COMPARE(mem[j], v[i]) << "mask: " << mask;
+                ++j;
+            }
+        }
+        for (; j < V::Size + 1; ++j) {
+            COMPARE(mem[j], T(99)) << "mask: " << mask << ", j = " << j;
+        }
+    });
+}
+
+// copy_if {{{1
+TEST_TYPES(V, copyIf, NativeTypes)
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> dist(0, 100);
+    for (std::size_t size : {0, 1, 3, 15, 16, 17, 31, 32, 33, 100, 1000, 4099}) {
+        std::vector<T> in(size);
+        for (auto &x : in) {
+            x = T(dist(rng));
+        }
+        for (int threshold : {-1, 10, 50, 90, 100}) {
+            const T t = T(threshold < 0 ? 0 : threshold);
+            const auto pred = [&](V x) { return x >= V(t); };
+            std::vector<T> ref;
+            std::copy_if(in.begin(), in.end(), std::back_inserter(ref),
+                         [&](T x) { return x >= t; });
+
+            std::vector<T> out(size + 1, T(99));
+            // unqualified, which also finds std::copy_if via ADL
+            const auto end = copy_if(in.begin(), in.end(), out.begin(), pred);
+            COMPARE(std::size_t(end - out.begin()), ref.size()) << "size: " << size;
+            COMPARE(std::equal(ref.begin(), ref.end(), out.begin()), true)
+                << "size: " << size << ", threshold: " << threshold;
+            COMPARE(out[ref.size()], T(99)) << "size: " << size;
+
+            // in place
+            std::vector<T> inout = in;
+            const T *inplaceEnd =
+                Vc::copy_if(inout.data(), inout.data() + size, inout.data(), pred);
+            COMPARE(std::size_t(inplaceEnd - inout.data()), ref.size());
+            COMPARE(std::equal(ref.begin(), ref.end(), inout.begin()), true)
+                << "size: " << size << ", threshold: " << threshold;
+        }
+    }
+}
+
+// vim: foldmethod=marker
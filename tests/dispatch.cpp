@@ -0,0 +1,116 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/dispatch.h>
+#include <stdexcept>
+
+static int variantScalar(int x) { return x + 1; }
+static int variantSse2(int x) { return x + 2; }
+static int variantSse2Popcnt(int x) { return x + 3; }
+static int variantMic(int x) { return x + 4; }
+
+using Dispatcher = Vc::FunctionDispatcher<int(int)>;
+
+TEST(testFeaturesSupported)
+{
+    VERIFY(Vc::featuresSupported(Vc::ScalarImpl));
+    VERIFY(Vc::featuresSupported(Vc::CurrentImplementation::features()));
+    COMPARE(Vc::featuresSupported(Vc::SSE2Impl + Vc::PopcntInstructions),
+            Vc::isImplementationSupported(Vc::SSE2Impl) &&
+                (Vc::extraInstructionsSupported() & Vc::PopcntInstructions) != 0);
+}
+
+TEST(testSelectBest)
+{
+    const Dispatcher d = {{Vc::SSE2Impl, &variantSse2}, {Vc::ScalarImpl, &variantScalar}};
+    const auto expected =
+        Vc::isImplementationSupported(Vc::SSE2Impl) ? &variantSse2 : &variantScalar;
+    COMPARE(d.select(), expected);
+    COMPARE(d.resolve(), expected);
+    COMPARE(d(1), expected(1));
+    COMPARE(d.select(Vc::ScalarImpl), &variantScalar);
+}
+
+TEST(testExtraInstructionsRank)
+{
+    const Dispatcher d = {{Vc::SSE2Impl + Vc::PopcntInstructions, &variantSse2Popcnt},
+                          {Vc::SSE2Impl, &variantSse2},
+                          {Vc::ScalarImpl, &variantScalar}};
+    if (!Vc::isImplementationSupported(Vc::SSE2Impl)) {
+        COMPARE(d.resolve(), &variantScalar);
+    } else if (Vc::extraInstructionsSupported() & Vc::PopcntInstructions) {
+        COMPARE(d.resolve(), &variantSse2Popcnt);
+    } else {
+        COMPARE(d.resolve(), &variantSse2);
+    }
+}
+
+TEST(testUnsupported)
+{
+    if (Vc::isImplementationSupported(Vc::MICImpl)) {
+        return;
+    }
+    const Dispatcher onlyMic = {{Vc::MICImpl, &variantMic}};
+    VERIFY(onlyMic.select() == nullptr);
+    VERIFY(onlyMic.resolve() == nullptr);
+    VERIFY(onlyMic.resolve() == nullptr);
+    bool threw = false;
+    try {
+        onlyMic(1);
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    VERIFY(threw);
+    const Dispatcher d = {{Vc::MICImpl, &variantMic}, {Vc::ScalarImpl, &variantScalar}};
+    COMPARE(d.resolve(), &variantScalar);
+    COMPARE(d(2), 3);
+}
+
+TEST(testTooManyVariants)
+{
+    bool threw = false;
+    try {
+        const Dispatcher d = {
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::ScalarImpl, &variantScalar}, {Vc::ScalarImpl, &variantScalar},
+            {Vc::SSE2Impl, &variantSse2}};
+        d(0);
+    } catch (const std::length_error &) {
+        threw = true;
+    }
+    VERIFY(threw);
+}
+
+// vim: foldmethod=marker
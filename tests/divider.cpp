@@ -0,0 +1,130 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/Utils>
+#include <limits>
+#include <random>
+#include <vector>
+
+using DividerTypes =
+    vir::Typelist<Vc::int_v, Vc::uint_v, Vc::short_v, Vc::ushort_v, Vc::SimdArray<int, 7>,
+                  Vc::SimdArray<unsigned short, 3>>;
+
+// the edge cases of T plus random values, or all values of a 16-bit T
+template <typename T> static std::vector<T> interestingValues(std::size_t randomCount)
+{
+    using L = std::numeric_limits<T>;
+    std::vector<T> values;
+    if (sizeof(T) == 2 && randomCount > 1000) {
+        for (int x = L::min(); x <= L::max(); ++x) {
+            values.push_back(T(x));
+        }
+        return values;
+    }
+    values = {T(0), T(1), T(2), T(3), T(5), T(7), T(10), T(64), T(100), T(1000),
+              L::max(), T(L::max() - 1), T(L::max() / 2), T(L::max() / 2 + 1), L::min(),
+              T(L::min() + 1), T(L::min() / 2), T(-1), T(-2), T(-3), T(-7), T(-64)};
+    for (int shift = 1; shift < std::numeric_limits<T>::digits; ++shift) {
+        values.push_back(T(T(1) << shift));
+        values.push_back(T(T(T(1) << shift) + 1));
+        values.push_back(T(T(T(1) << shift) - 1));
+    }
+    std::mt19937 engine(1);
+    std::uniform_int_distribution<long long> dist(L::min(), L::max());
+    for (std::size_t i = 0; i < randomCount; ++i) {
+        values.push_back(T(dist(engine)));
+    }
+    return values;
+}
+
+// the builtin division lane by lane; x / -1 of the minimum overflows and is skipped
+template <typename V>
+static void compareDivision(const V &n, typename V::EntryType d, const V &q, const V &r)
+{
+    using T = typename V::EntryType;
+    const auto overflows = [&](std::size_t j) {
+        return std::is_signed<T>::value && n[j] == std::numeric_limits<T>::min() &&
+               d == T(-1);
+    };
+    const V q0 =
+        V::generate([&](std::size_t j) { return overflows(j) ? q[j] : T(n[j] / d); });
+    const V r0 =
+        V::generate([&](std::size_t j) { return overflows(j) ? r[j] : T(n[j] % d); });
+    if (Vc::all_of(q == q0 && r == r0)) {
+        return;  // spares the report formatting of COMPARE in the hot loops
+    }
+    COMPARE(q, q0) << "n = " << n << ", d = " << d;
+    COMPARE(r, r0) << "n = " << n << ", d = " << d;
+}
+
+TEST_TYPES(V, divideByInvariant, DividerTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    const auto dividends = interestingValues<T>(100000);
+    for (T d : interestingValues<T>(sizeof(T) == 2 ? 0 : 200)) {
+        if (d == 0) {
+            continue;
+        }
+        const Vc::Divider<V> divider(d);
+        COMPARE(divider.divisor(), d);
+        for (std::size_t i = 0; i < dividends.size(); i += V::Size) {
+            const V n = V::generate([&](std::size_t j) {
+                return dividends[std::min(i + j, dividends.size() - 1)];
+            });
+            compareDivision(n, d, n / divider, n % divider);
+        }
+    }
+}
+
+TEST_TYPES(V, divideByAll16BitDivisors, DividerTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    if (sizeof(T) != 2) {
+        return;
+    }
+    const auto dividends = interestingValues<T>(0);
+    // int holds all 16-bit values; the casts only silence -Wsign-compare for the 32-bit
+    // instantiations, which return above
+    const int first = int(std::numeric_limits<T>::min());
+    const int last = int(std::numeric_limits<T>::max());
+    for (int d = first; d <= last; ++d) {
+        if (d == 0) {
+            continue;
+        }
+        const Vc::Divider<V> divider((T(d)));
+        for (std::size_t i = 0; i < dividends.size(); i += V::Size) {
+            const V n = V::generate([&](std::size_t j) {
+                return dividends[std::min(i + j, dividends.size() - 1)];
+            });
+            compareDivision(n, T(d), n / divider, n % divider);
+        }
+    }
+}
+
+// vim: foldmethod=marker
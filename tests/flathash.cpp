@@ -0,0 +1,246 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/flat_hash_map>
+#include <Vc/flat_hash_set>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using KeyVectors = vir::Typelist<Vc::int_v, Vc::uint_v, Vc::SimdArray<int, 7>,
+                                 Vc::SimdArray<unsigned int, 17>>;
+
+template <typename Set> std::vector<typename Set::value_type> sorted(const Set &set)
+{
+    std::vector<typename Set::value_type> r(set.begin(), set.end());
+    std::sort(r.begin(), r.end());
+    return r;
+}
+
+TEST_TYPES(T, setMatchesStd, vir::Typelist<int, unsigned int>)  // {{{1
+{
+    std::mt19937 engine(1);
+    // a small key range provokes long probe sequences and many backward shifts on erase
+    for (T range : {T(20), T(200), T(100000)}) {
+        std::uniform_int_distribution<T> dist(0, range - 1);
+        Vc::flat_hash_set<T> set;
+        std::unordered_set<T> ref;
+        for (int i = 0; i < 20000; ++i) {
+            // max() is the marker of free slots and therefore stored separately
+            const T key = i % 101 == 0 ? std::numeric_limits<T>::max() : dist(engine);
+            if (i % 3 == 2) {
+                const auto erased = set.erase(key);
+                const auto expected = ref.erase(key);
+                COMPARE(erased, expected) << key;
+            } else {
+                const bool inserted = set.insert(key).second;
+                const bool expected = ref.insert(key).second;
+                COMPARE(inserted, expected) << key;
+            }
+            COMPARE(set.size(), ref.size());
+            COMPARE(set.contains(key), ref.count(key) == 1) << key;
+        }
+        for (T key = 0; key < std::min(range, T(1000)); ++key) {
+            COMPARE(set.count(key), ref.count(key)) << key;
+            COMPARE(set.find(key) == set.end(), ref.count(key) == 0) << key;
+        }
+        std::vector<T> refSorted(ref.begin(), ref.end());
+        std::sort(refSorted.begin(), refSorted.end());
+        VERIFY(sorted(set) == refSorted);
+    }
+}
+
+TEST(setGrowth)  // {{{1
+{
+    Vc::flat_hash_set<int> set;
+    COMPARE(set.capacity(), 0u);
+    COMPARE(set.contains(1), false);
+    COMPARE(set.contains(Vc::int_v::IndexesFromZero()), Vc::int_m(false));
+    for (int i = 0; i < 100000; ++i) {
+        VERIFY(set.insert(i * 7919).second);
+    }
+    COMPARE(set.size(), 100000u);
+    VERIFY(set.capacity() * 3 / 4 >= set.size());
+    for (int i = 0; i < 100000; ++i) {
+        VERIFY(set.contains(i * 7919)) << i;
+        VERIFY(!set.contains(i * 7919 + 1)) << i;
+    }
+    const auto capacity = set.capacity();
+    set.clear();
+    COMPARE(set.size(), 0u);
+    COMPARE(set.capacity(), capacity);
+    VERIFY(set.begin() == set.end());
+
+    Vc::flat_hash_set<int> reserved(1000);
+    const auto reservedCapacity = reserved.capacity();
+    for (int i = 0; i < 1000; ++i) {
+        reserved.insert(i);
+    }
+    COMPARE(reserved.capacity(), reservedCapacity);
+}
+
+TEST_TYPES(V, batchedLookup, KeyVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    using M = typename V::Mask;
+    std::mt19937 engine(2);
+    std::uniform_int_distribution<T> dist(0, 3000);
+    Vc::flat_hash_set<T> set;
+    for (int i = 0; i < 1000; ++i) {
+        set.insert(dist(engine));
+    }
+    set.insert(std::numeric_limits<T>::max());
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V keys = V::generate([&](int i) {
+            return i == repetition % 11 ? std::numeric_limits<T>::max() : dist(engine);
+        });
+        const M found = set.contains(keys);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(found[i], set.contains(T(keys[i]))) << "keys = " << keys;
+        }
+    }
+    set.erase(std::numeric_limits<T>::max());
+    COMPARE(set.contains(V(std::numeric_limits<T>::max())), M(false));
+}
+
+TEST_TYPES(V, batchedInsert, KeyVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    using M = typename V::Mask;
+    Vc::flat_hash_set<T> set = {T(1), T(3)};
+    const V keys = V::generate([](int i) { return T(i % 5); });
+    const M inserted = set.insert(keys);
+    std::size_t newKeys = 0;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(inserted[i], i < 5 && i != 1 && i != 3) << "keys = " << keys;
+        newKeys += inserted[i];
+    }
+    COMPARE(set.size(), 2 + newKeys);
+    const M insertedAgain = set.insert(keys);
+    COMPARE(insertedAgain, M(false));
+}
+
+TEST(mapBasics)  // {{{1
+{
+    Vc::flat_hash_map<int, std::string> map = {{1, "one"}, {2, "two"}};
+    COMPARE(map.size(), 2u);
+    COMPARE(map.at(1), "one");
+    COMPARE(map[2], "two");
+    COMPARE(map[3], "");
+    COMPARE(map.size(), 3u);
+
+    VERIFY(!map.try_emplace(1, "uno").second);
+    COMPARE(map.at(1), "one");
+    VERIFY(!map.insert_or_assign(1, "uno").second);
+    COMPARE(map.at(1), "uno");
+    VERIFY(map.insert({-1, "minus one"}).second);
+    VERIFY(map.try_emplace(std::numeric_limits<int>::max(), 3, 'x').second);
+    COMPARE(map.at(std::numeric_limits<int>::max()), "xxx");
+
+    auto it = map.find(2);
+    VERIFY(it != map.end());
+    COMPARE(it->first, 2);
+    it->second += "!";
+    COMPARE(map.at(2), "two!");
+    VERIFY(map.find(4) == map.end());
+
+    bool threw = false;
+    try {
+        map.at(4);
+    } catch (const std::out_of_range &) {
+        threw = true;
+    }
+    VERIFY(threw);
+
+    std::vector<std::pair<int, std::string>> entries;
+    for (const auto &x : static_cast<const decltype(map) &>(map)) {
+        entries.emplace_back(x.first, x.second);
+    }
+    std::sort(entries.begin(), entries.end());
+    COMPARE(entries.size(), 5u);
+    COMPARE(entries[0].second, "minus one");
+    COMPARE(entries[4].first, std::numeric_limits<int>::max());
+
+    VERIFY(map.erase(std::numeric_limits<int>::max()) == 1);
+    VERIFY(map.erase(2) == 1);
+    VERIFY(map.erase(2) == 0);
+    COMPARE(map.size(), 3u);
+}
+
+TEST(mapMatchesStd)  // {{{1
+{
+    std::mt19937 engine(3);
+    std::uniform_int_distribution<int> dist(-50, 50);
+    Vc::flat_hash_map<int, std::string> map;
+    std::unordered_map<int, std::string> ref;
+    for (int i = 0; i < 20000; ++i) {
+        const int key = dist(engine);
+        if (i % 3 == 2) {
+            const auto erased = map.erase(key);
+            const auto expected = ref.erase(key);
+            COMPARE(erased, expected) << key;
+        } else {
+            map[key] += std::to_string(i);
+            ref[key] += std::to_string(i);
+        }
+    }
+    COMPARE(map.size(), ref.size());
+    for (const auto &x : ref) {
+        COMPARE(map.at(x.first), x.second) << x.first;
+    }
+}
+
+TEST_TYPES(V, batchedFind, KeyVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    using FV = Vc::SimdArray<float, V::Size>;
+    Vc::flat_hash_map<T, float> map;
+    for (T key = 0; key < 1000; key += 2) {
+        map[key] = key * 0.5f;
+    }
+    map[std::numeric_limits<T>::max()] = -1.f;
+    for (T offset = 0; offset < 100; ++offset) {
+        const V keys = V::generate([&](int i) {
+            return i == 3 ? std::numeric_limits<T>::max() : T(offset + 3 * i);
+        });
+        FV values = -2.f;
+        const auto found = map.find(keys, values);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const T key = keys[i];
+            COMPARE(found[i], map.contains(key)) << "keys = " << keys;
+            COMPARE(values[i], found[i] ? map.at(key) : -2.f) << "keys = " << keys;
+        }
+    }
+}
+
+// vim: foldmethod=marker
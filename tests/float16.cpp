@@ -0,0 +1,237 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <cmath>
+#include <vector>
+
+using Vc::half;
+using Vc::bfloat16;
+using Vc::half_v;
+using Vc::bfloat16_v;
+using Vc::float_v;
+
+// reference conversion of the binary16 bit pattern h to float
+static float reference(std::uint16_t h)
+{
+    const int exponent = (h >> 10) & 0x1f;
+    const int mantissa = h & 0x3ff;
+    float r;
+    if (exponent == 0x1f) {
+        r = mantissa ? std::numeric_limits<float>::quiet_NaN()
+                     : std::numeric_limits<float>::infinity();
+    } else if (exponent == 0) {
+        r = std::ldexp(float(mantissa), -24);
+    } else {
+        r = std::ldexp(float(mantissa | 0x400), exponent - 25);
+    }
+    return (h & 0x8000) ? -r : r;
+}
+
+static bool sameValue(float a, float b)
+{
+    return (std::isnan(a) && std::isnan(b)) ||
+           (a == b && std::signbit(a) == std::signbit(b));
+}
+
+TEST(half_scalar_conversion)
+{
+    for (std::uint32_t i = 0; i < 0x10000; ++i) {
+        const std::uint16_t h = i;
+        const float f = float(half::fromBits(h));
+        VERIFY(sameValue(f, reference(h))) << "h: " << std::hex << h << " f: " << f;
+        if (!std::isnan(f)) {
+            COMPARE(half(f).bits(), h);
+        } else {
+            VERIFY(std::isnan(float(half(f))));
+        }
+    }
+    COMPARE(half(65520.f).bits(), 0x7c00);  // rounds to inf
+    COMPARE(half(65519.f).bits(), 0x7bff);
+    COMPARE(half(-1e10f).bits(), 0xfc00);
+    COMPARE(half(std::ldexp(1.f, -25)).bits(), 0);  // tie to even: zero
+    COMPARE(half(std::ldexp(1.5f, -25)).bits(), 1);
+    COMPARE(half(std::ldexp(3.f, -25)).bits(), 2);  // tie to even
+}
+
+TEST(half_rounds_to_nearest_even)
+{
+    // between two adjacent positive finite halves, the midpoint rounds to the even one
+    for (std::uint16_t h = 0; h < 0x7bff; ++h) {
+        const float lo = reference(h);
+        const float hi = reference(h + 1);
+        const float mid = (lo + hi) * 0.5f;
+        const std::uint16_t even = (h & 1) ? h + 1 : h;
+        COMPARE(half(mid).bits(), even) << "h: " << h;
+        COMPARE(half(-mid).bits(), even | 0x8000) << "h: " << h;
+        COMPARE(half(std::nextafter(mid, 0.f)).bits(), h);
+        COMPARE(half(std::nextafter(mid, 1e9f)).bits(), h + 1);
+    }
+}
+
+TEST(bfloat16_scalar_conversion)
+{
+    for (std::uint32_t i = 0; i < 0x10000; ++i) {
+        const std::uint16_t b = i;
+        const float f = float(bfloat16::fromBits(b));
+        std::uint32_t u = std::uint32_t(b) << 16;
+        float expected;
+        std::memcpy(&expected, &u, 4);
+        VERIFY(sameValue(f, expected));
+        if (!std::isnan(f)) {
+            COMPARE(bfloat16(f).bits(), b);
+        } else {
+            VERIFY(std::isnan(float(bfloat16(f))));
+        }
+    }
+    COMPARE(bfloat16(1.f + std::ldexp(1.f, -8)).bits(), 0x3f80);  // tie to even
+    COMPARE(bfloat16(1.f + std::ldexp(3.f, -8)).bits(), 0x3f82);  // tie to even
+    COMPARE(bfloat16(1.f + std::ldexp(1.f, -8) + std::ldexp(1.f, -20)).bits(), 0x3f81);
+    VERIFY(std::isnan(float(bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+    // a NaN with only low mantissa bits set must not truncate to inf
+    std::uint32_t snan = 0x7f800001u;
+    float f;
+    std::memcpy(&f, &snan, 4);
+    VERIFY(std::isnan(float(bfloat16(f))));
+}
+
+template <typename V> static void testAllBitPatterns()
+{
+    using T = typename V::EntryType;
+    std::vector<T> in(0x10000);
+    for (std::uint32_t i = 0; i < 0x10000; ++i) {
+        in[i] = T::fromBits(i);
+    }
+    std::vector<T> out(0x10000 + 1);
+    for (std::size_t i = 0; i < in.size(); i += V::Size) {
+        const V v(&in[i]);
+        const float_v f = v;
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            VERIFY(sameValue(f[j], float(in[i + j]))) << "bits: " << std::hex
+                                                      << in[i + j].bits();
+        }
+        // unaligned store
+        v.store(&out[i + 1], Vc::Unaligned);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            if (std::isnan(f[j])) {
+                VERIFY(std::isnan(float(out[i + 1 + j])));
+            } else {
+                COMPARE(out[i + 1 + j].bits(), in[i + j].bits());
+            }
+        }
+    }
+}
+
+TEST(half_v_load_store)
+{
+    testAllBitPatterns<half_v>();
+}
+
+TEST(bfloat16_v_load_store)
+{
+    testAllBitPatterns<bfloat16_v>();
+}
+
+template <typename V> static void testRounding()
+{
+    using T = typename V::EntryType;
+    // random floats of all magnitudes, including values that round to inf or to
+    // subnormals, must be rounded exactly as the scalar conversion does
+    for (int repetition = 0; repetition < 10000; ++repetition) {
+        const float_v x = Vc::ldexp(float_v::Random() * 2.f - 1.f,
+                                    simd_cast<float_v::IndexType>(
+                                        float_v::Random() * 48.f - 30.f));
+        const V v = x;
+        T mem[V::Size];
+        v.store(mem);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            COMPARE(mem[j].bits(), T(x[j]).bits()) << "x: " << x[j];
+            COMPARE(v[j].bits(), T(x[j]).bits());
+        }
+    }
+}
+
+TEST(half_v_rounding)
+{
+    testRounding<half_v>();
+}
+
+TEST(bfloat16_v_rounding)
+{
+    testRounding<bfloat16_v>();
+}
+
+TEST(masked_store)
+{
+    half mem[half_v::Size];
+    for (auto &x : mem) {
+        x = half(-1.f);
+    }
+    const half_v v = float_v::IndexesFromZero();
+    v.store(mem, float_v::IndexesFromZero() > 1.f);
+    for (std::size_t i = 0; i < half_v::Size; ++i) {
+        COMPARE(float(mem[i]), i > 1 ? float(i) : -1.f);
+    }
+}
+
+TEST(memory)
+{
+    Vc::Memory<half_v, 3 * half_v::Size + 1> data;
+    for (std::size_t i = 0; i < data.entriesCount(); ++i) {
+        data[i] = half(float(i));
+    }
+    for (std::size_t i = 0; i < data.vectorsCount(); ++i) {
+        data.vector(i) = data.vector(i) * 0.5f + 1.f;
+    }
+    for (std::size_t i = 0; i < data.entriesCount(); ++i) {
+        COMPARE(float(data[i]), float(i) * 0.5f + 1.f);
+    }
+    Vc::Memory<bfloat16_v> dyn(21);
+    dyn.setZero();
+    dyn.vector(0) += bfloat16_v::One();
+    COMPARE(float(dyn[0]), 1.f);
+    COMPARE(float(dyn[20]), 0.f);
+}
+
+TEST(casts)
+{
+    const float_v x = float_v::IndexesFromZero() + 0.25f;
+    const half_v h = x;
+    const bfloat16_v b = Vc::simd_cast<bfloat16_v>(h);
+    COMPARE(float_v(b), x);
+    COMPARE(Vc::simd_cast<float_v>(h), x);
+    const auto i = Vc::simd_cast<float_v::IndexType>(h);
+    COMPARE(i, simd_cast<float_v::IndexType>(float_v::IndexesFromZero()));
+    const auto h2 = Vc::simd_cast<half_v>(Vc::simd_cast<float_v::IndexType>(x));
+    COMPARE(float_v(h2), float_v::IndexesFromZero());
+    COMPARE(h + h, x + x);
+    COMPARE(2.f * h, x + x);
+    COMPARE(h < half_v(x + 1.f), x < x + 1.f);
+}
+
+// vim: foldmethod=marker
@@ -295,3 +295,34 @@ TEST_TYPES(Vec, gather2dim, ALL_TYPES)
         }
     }
 }
+
+#ifdef Vc_USE_CALIBRATED_GATHERS
+TEST_TYPES(Vec, calibratedGather, AllVectors)
+{
+    using T = typename Vec::EntryType;
+    using It = typename Vec::IndexType;
+    using Impl = Vc::Common::GatherScatterImplementation;
+    const Impl chosen = Vc::Common::calibrateGather<Vec>();
+    VERIFY(chosen == Impl::Hardware || chosen == Impl::BitScanLoop ||
+           chosen == Impl::SimpleLoop);
+    VERIFY(Vc::Common::calibratedGatherImplementation<Vec>() == chosen);
+
+    T data[256];
+    for (int i = 0; i < 256; ++i) {
+        data[i] = T(i);
+    }
+    const It idx = (It(IndexesFromZero) * 7) & 255;
+    const Vec reference = Vec::generate([&](int i) { return data[idx[i]]; });
+    const auto mask = simd_cast<typename Vec::Mask>((It(IndexesFromZero) & 1) == 0);
+    // every strategy has to produce the same result
+    for (Impl impl : {Impl::Hardware, Impl::BitScanLoop, Impl::SimpleLoop}) {
+        Vc::Common::gatherCalibrationCache<Vec>().store(int(impl));
+        const Vec a(data, idx);
+        COMPARE(a, reference);
+        Vec b = Vec::Zero();
+        b.gather(data, idx, mask);
+        COMPARE(b, iif(mask, reference, Vec::Zero()));
+    }
+    Vc::Common::gatherCalibrationCache<Vec>().store(int(chosen));
+}
+#endif
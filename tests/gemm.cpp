@@ -0,0 +1,193 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/Memory>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using GemmTypes = vir::Typelist<float_v, double_v>;
+
+// reference {{{1
+template <typename T>
+static std::vector<double> reference_gemm(std::size_t m, std::size_t n, std::size_t k,
+                                          T alpha, const T *a, std::size_t lda,
+                                          const T *b, std::size_t ldb, T beta,
+                                          const T *c, std::size_t ldc)
+{
+    std::vector<double> r(m * n);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            double sum = 0;
+            for (std::size_t p = 0; p < k; ++p) {
+                sum += double(a[i * lda + p]) * double(b[p * ldb + j]);
+            }
+            r[i * n + j] = double(alpha) * sum + double(beta) * double(c[i * ldc + j]);
+        }
+    }
+    return r;
+}
+
+template <typename T> static std::vector<T> random_matrix(std::size_t size, int seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<T> dist(-1, 1);
+    std::vector<T> r(size);
+    for (auto &x : r) {
+        x = dist(rng);
+    }
+    return r;
+}
+
+// gemm {{{1
+TEST_TYPES(V, gemmDynamic, GemmTypes)
+{
+    using T = typename V::EntryType;
+    const T tolerance = std::is_same<T, float>::value ? 1e-4f : 1e-12;
+    struct Shape {
+        std::size_t m, n, k;
+    };
+    for (Shape s : {Shape{1, 1, 1}, Shape{3, 5, 7}, Shape{6, 16, 4}, Shape{17, 33, 9},
+                    Shape{64, 64, 64}, Shape{100, 37, 300}, Shape{130, 250, 1100}}) {
+        for (std::size_t pad : {0, 3}) {
+            const std::size_t lda = s.k + pad, ldb = s.n + pad, ldc = s.n + pad;
+            const auto a = random_matrix<T>(s.m * lda, 1);
+            const auto b = random_matrix<T>(s.k * ldb, 2);
+            for (T beta : {T(0), T(1), T(-0.5)}) {
+                auto c = random_matrix<T>(s.m * ldc, 3);
+                const T alpha = 1.5;
+                const auto ref = reference_gemm(s.m, s.n, s.k, alpha, a.data(), lda,
+                                                b.data(), ldb, beta, c.data(), ldc);
+                Vc::gemm(s.m, s.n, s.k, alpha, a.data(), lda, b.data(), ldb, beta,
+                         c.data(), ldc);
+                for (std::size_t i = 0; i < s.m; ++i) {
+                    for (std::size_t j = 0; j < s.n; ++j) {
+                        const double err = std::abs(c[i * ldc + j] - ref[i * s.n + j]);
+                        VERIFY(err <= tolerance * std::sqrt(double(s.k)) * 4)
+                            << "m: " << s.m << ", n: " << s.n << ", k: " << s.k
+                            << ", i: " << i << ", j: " << j << ", error: " << err;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, gemmBetaZeroIgnoresC, GemmTypes)
+{
+    using T = typename V::EntryType;
+    const std::size_t n = 9;
+    const auto a = random_matrix<T>(n * n, 1);
+    const auto b = random_matrix<T>(n * n, 2);
+    std::vector<T> c(n * n, std::numeric_limits<T>::quiet_NaN());
+    Vc::gemm(n, n, n, T(1), a.data(), n, b.data(), n, T(0), c.data(), n);
+    for (T x : c) {
+        VERIFY(!std::isnan(x));
+    }
+}
+
+TEST_TYPES(V, gemmMemory, GemmTypes)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t M = 13, K = 21, N = 11;
+    Vc::Memory<V, M, K> a;
+    Vc::Memory<V, K, N> b;
+    Vc::Memory<V, M, N> c;
+    for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t p = 0; p < K; ++p) {
+            a[i][p] = T(int(i + 2 * p) % 7 - 3);
+        }
+    }
+    for (std::size_t p = 0; p < K; ++p) {
+        for (std::size_t j = 0; j < N; ++j) {
+            b[p][j] = T(int(3 * p + j) % 5 - 2);
+        }
+    }
+    Vc::gemm(a, b, c);
+    for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            T sum = 0;
+            for (std::size_t p = 0; p < K; ++p) {
+                sum += a[i][p] * b[p][j];
+            }
+            COMPARE(c[i][j], sum) << "i: " << i << ", j: " << j;
+        }
+    }
+}
+
+// gemv {{{1
+TEST_TYPES(V, gemvDynamic, GemmTypes)
+{
+    using T = typename V::EntryType;
+    const T tolerance = std::is_same<T, float>::value ? 1e-4f : 1e-12;
+    for (std::size_t m : {1, 3, 4, 5, 31, 200}) {
+        for (std::size_t n : {1, 7, 8, 33, 300}) {
+            const std::size_t lda = n + 1;
+            const auto a = random_matrix<T>(m * lda, 4);
+            const auto x = random_matrix<T>(n, 5);
+            auto y = random_matrix<T>(m, 6);
+            const auto ref = reference_gemm(m, 1, n, T(2), a.data(), lda, x.data(), 1,
+                                            T(0.5), y.data(), 1);
+            Vc::gemv(m, n, T(2), a.data(), lda, x.data(), T(0.5), y.data());
+            for (std::size_t i = 0; i < m; ++i) {
+                VERIFY(std::abs(y[i] - ref[i]) <= tolerance * std::sqrt(double(n)) * 4)
+                    << "m: " << m << ", n: " << n << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, gemvMemory, GemmTypes)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t M = 7, N = 19;
+    Vc::Memory<V, M, N> a;
+    Vc::Memory<V, N> x;
+    Vc::Memory<V, M> y;
+    for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            a[i][j] = T(int(i * j) % 5 - 2);
+        }
+    }
+    for (std::size_t j = 0; j < N; ++j) {
+        x[j] = T(int(j) % 3 - 1);
+    }
+    Vc::gemv(a, x, y);
+    for (std::size_t i = 0; i < M; ++i) {
+        T sum = 0;
+        for (std::size_t j = 0; j < N; ++j) {
+            sum += a[i][j] * x[j];
+        }
+        COMPARE(y[i], sum) << "i: " << i;
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,232 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using UintVectors = vir::Typelist<Vc::uint_v, Vc::SimdArray<unsigned int, 1>,
+                                  Vc::SimdArray<unsigned int, 7>,
+                                  Vc::SimdArray<unsigned int, 17>>;
+
+// reference implementations {{{1
+// Byte-oriented transcriptions of the reference implementations of MurmurHash3_x86_32 and
+// XXH32 for inputs of any length. The library functions hash four bytes.
+static std::uint32_t rotl(std::uint32_t x, int r) { return (x << r) | (x >> (32 - r)); }
+
+static std::uint32_t read32(const unsigned char *p)
+{
+    return std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 | std::uint32_t(p[2]) << 16 |
+           std::uint32_t(p[3]) << 24;
+}
+
+static std::uint32_t fmix32(std::uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+static std::uint32_t murmurHash3_x86_32(const unsigned char *data, int len,
+                                        std::uint32_t seed)
+{
+    const std::uint32_t c1 = 0xcc9e2d51;
+    const std::uint32_t c2 = 0x1b873593;
+    std::uint32_t h1 = seed;
+    const int nblocks = len / 4;
+    for (int i = 0; i < nblocks; ++i) {
+        std::uint32_t k1 = read32(data + 4 * i);
+        k1 *= c1;
+        k1 = rotl(k1, 15);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = rotl(h1, 13);
+        h1 = h1 * 5 + 0xe6546b64;
+    }
+    const unsigned char *tail = data + 4 * nblocks;
+    std::uint32_t k1 = 0;
+    switch (len & 3) {
+    case 3: k1 ^= std::uint32_t(tail[2]) << 16;  // fall through
+    case 2: k1 ^= std::uint32_t(tail[1]) << 8;   // fall through
+    case 1:
+        k1 ^= tail[0];
+        k1 *= c1;
+        k1 = rotl(k1, 15);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+    h1 ^= std::uint32_t(len);
+    return fmix32(h1);
+}
+
+static std::uint32_t xxh32(const unsigned char *p, int len, std::uint32_t seed)
+{
+    const std::uint32_t prime1 = 0x9e3779b1u;
+    const std::uint32_t prime2 = 0x85ebca77u;
+    const std::uint32_t prime3 = 0xc2b2ae3du;
+    const std::uint32_t prime4 = 0x27d4eb2fu;
+    const std::uint32_t prime5 = 0x165667b1u;
+    const unsigned char *const end = p + len;
+    std::uint32_t h32;
+    if (len >= 16) {
+        std::uint32_t v1 = seed + prime1 + prime2;
+        std::uint32_t v2 = seed + prime2;
+        std::uint32_t v3 = seed;
+        std::uint32_t v4 = seed - prime1;
+        const auto round = [&](std::uint32_t acc, std::uint32_t input) {
+            return rotl(acc + input * prime2, 13) * prime1;
+        };
+        do {
+            v1 = round(v1, read32(p));
+            v2 = round(v2, read32(p + 4));
+            v3 = round(v3, read32(p + 8));
+            v4 = round(v4, read32(p + 12));
+            p += 16;
+        } while (p + 16 <= end);
+        h32 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    } else {
+        h32 = seed + prime5;
+    }
+    h32 += std::uint32_t(len);
+    for (; p + 4 <= end; p += 4) {
+        h32 += read32(p) * prime3;
+        h32 = rotl(h32, 17) * prime4;
+    }
+    for (; p < end; ++p) {
+        h32 += *p * prime5;
+        h32 = rotl(h32, 11) * prime1;
+    }
+    h32 ^= h32 >> 15;
+    h32 *= prime2;
+    h32 ^= h32 >> 13;
+    h32 *= prime3;
+    h32 ^= h32 >> 16;
+    return h32;
+}
+
+static std::uint32_t murmurOfKey(std::uint32_t key, std::uint32_t seed)
+{
+    const unsigned char bytes[4] = {static_cast<unsigned char>(key),
+                                    static_cast<unsigned char>(key >> 8),
+                                    static_cast<unsigned char>(key >> 16),
+                                    static_cast<unsigned char>(key >> 24)};
+    return murmurHash3_x86_32(bytes, 4, seed);
+}
+
+static std::uint32_t xxh32OfKey(std::uint32_t key, std::uint32_t seed)
+{
+    const unsigned char bytes[4] = {static_cast<unsigned char>(key),
+                                    static_cast<unsigned char>(key >> 8),
+                                    static_cast<unsigned char>(key >> 16),
+                                    static_cast<unsigned char>(key >> 24)};
+    return xxh32(bytes, 4, seed);
+}
+
+TEST(referenceImplementations)  // {{{1
+{
+    // published test vectors
+    COMPARE(xxh32(nullptr, 0, 0), 0x02cc5d05u);
+    COMPARE(murmurHash3_x86_32(nullptr, 0, 0), 0u);
+    COMPARE(murmurHash3_x86_32(nullptr, 0, 1), 0x514e28b7u);
+    const unsigned char hello[] = "Hello, world!";
+    COMPARE(murmurHash3_x86_32(hello, 13, 1234), 0xfaf6cdb3u);
+}
+
+TEST(scalarMatchesReference)  // {{{1
+{
+    std::mt19937 engine(1);
+    for (int i = 0; i < 10000; ++i) {
+        const unsigned int key = i < 100 ? unsigned(i) - 50u : engine();
+        const unsigned int seed = i % 3 == 0 ? 0u : engine();
+        COMPARE(Vc::murmur3_fmix32(key), fmix32(key)) << key;
+        COMPARE(Vc::murmur3_32(key, seed), murmurOfKey(key, seed)) << key << ' ' << seed;
+        COMPARE(Vc::xxhash32(key, seed), xxh32OfKey(key, seed)) << key << ' ' << seed;
+        COMPARE(Vc::multiply_shift(key, seed | 1u, 1 + i % 32),
+                std::uint32_t(key * (seed | 1u)) >> (31 - i % 32))
+            << key << ' ' << seed;
+    }
+}
+
+TEST_TYPES(V, vectorMatchesScalar, UintVectors)  // {{{1
+{
+    std::mt19937 engine(2);
+    for (int i = 0; i < 1000; ++i) {
+        const V keys = V::generate([&](int) { return engine(); });
+        const unsigned int seed = engine();
+        const int bits = 1 + i % 32;
+        const V fmix = Vc::murmur3_fmix32(keys);
+        const V murmur = Vc::murmur3_32(keys, seed);
+        const V xxh = Vc::xxhash32(keys, seed);
+        const V ms = Vc::multiply_shift(keys, seed | 1u, bits);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            const unsigned int key = keys[j];
+            COMPARE(fmix[j], Vc::murmur3_fmix32(key)) << keys;
+            COMPARE(murmur[j], murmurOfKey(key, seed)) << keys;
+            COMPARE(xxh[j], xxh32OfKey(key, seed)) << keys;
+            COMPARE(ms[j], Vc::multiply_shift(key, seed | 1u, bits)) << keys;
+        }
+    }
+}
+
+TEST(batchHash)  // {{{1
+{
+    std::mt19937 engine(3);
+    for (std::size_t n : {0u, 1u, 7u, 64u, 1001u}) {
+        std::vector<unsigned int> keys(n), out(n);
+        for (auto &k : keys) {
+            k = engine();
+        }
+        Vc::hash(keys.begin(), keys.end(), out.begin(), Vc::XXHash32(42));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], xxh32OfKey(keys[i], 42)) << i;
+        }
+        Vc::hash(keys.begin(), keys.end(), out.begin(), Vc::Murmur3Hash(7));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], murmurOfKey(keys[i], 7)) << i;
+        }
+        Vc::hash(keys.begin(), keys.end(), out.begin(),
+                 Vc::MultiplyShiftHash(0x9e3779b1u, 6));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], (keys[i] * 0x9e3779b1u) >> 26) << i;
+        }
+        // in place
+        const std::vector<unsigned int> original = keys;
+        Vc::hash(keys.begin(), keys.end(), keys.begin(), Vc::Murmur3Finalizer());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(keys[i], fmix32(original[i])) << i;
+        }
+    }
+}
+
+// vim: foldmethod=marker
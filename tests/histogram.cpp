@@ -0,0 +1,123 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <random>
+#include <vector>
+
+using HistogramTypes = vir::Typelist<Vc::int_v, Vc::uint_v, Vc::short_v, Vc::ushort_v,
+                                     Vc::schar_v, Vc::uchar_v, Vc::llong_v, Vc::ullong_v>;
+
+TEST_TYPES(V, scatterAdd, AllVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    std::mt19937 engine(1);
+    // few distinct indexes provoke many lane conflicts
+    for (int range : {1, 2, 3, int(V::Size), 100}) {
+        std::uniform_int_distribution<int> dist(0, range - 1);
+        for (int repetition = 0; repetition < 100; ++repetition) {
+            std::vector<T> mem(range, T(1)), ref(range, T(1));
+            const IT indexes = IT::generate([&](int) { return dist(engine); });
+            const V values = V::generate([&](int i) { return T(i + 1); });
+            const auto mask =
+                Vc::simd_cast<typename V::Mask>(IT([](int i) { return i; }) % 3 != 0);
+            Vc::scatter_add(mem.data(), indexes, values);
+            Vc::scatter_add(mem.data(), indexes, values, mask);
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                ref[indexes[i]] += values[i];
+                if (mask[i]) {
+                    ref[indexes[i]] += values[i];
+                }
+            }
+            for (int i = 0; i < range; ++i) {
+                COMPARE(mem[i], ref[i]) << "indexes = " << indexes << ", mask = " << mask;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, scatterAddIgnoresMaskedIndexes, AllVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    std::vector<T> mem(2, T(0));
+    // the masked-off lanes hold indexes out of bounds
+    const IT indexes =
+        IT::generate([](int i) { return i % 2 == 0 ? i % 4 / 2 : 1 << 20; });
+    const auto mask =
+        Vc::simd_cast<typename V::Mask>(IT([](int i) { return i; }) % 2 == 0);
+    Vc::scatter_add(mem.data(), indexes, V(T(1)), mask);
+    COMPARE(mem[0] + mem[1], T((V::Size + 1) / 2));
+    COMPARE(mem[0], T((V::Size + 3) / 4));
+}
+
+TEST_TYPES(V, histogramModes, HistogramTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    std::mt19937 engine(2);
+    for (std::size_t binCount : {1u, 3u, 16u, 1000u}) {
+        for (std::size_t n : {0u, 1u, 7u, 100u, 10001u}) {
+            std::uniform_int_distribution<int> dist(-2, int(binCount) + 1);
+            std::vector<T> data(n);
+            for (auto &x : data) {
+                // unsigned types turn -1 and -2 into huge values, which are ignored, too
+                x = T(dist(engine));
+            }
+            std::vector<unsigned> ref(binCount, 5u);
+            for (T x : data) {
+                if (!(x < T(0)) && std::size_t(x) < binCount) {
+                    ++ref[std::size_t(x)];
+                }
+            }
+            for (auto mode : {Vc::HistogramMode::ConflictDetection,
+                              Vc::HistogramMode::Replicated}) {
+                std::vector<unsigned> bins(binCount, 5u);
+                Vc::histogram(data, bins, mode);
+                for (std::size_t b = 0; b < binCount; ++b) {
+                    COMPARE(bins[b], ref[b]) << "binCount = " << binCount << ", n = " << n
+                                             << ", b = " << b << ", mode = " << int(mode);
+                }
+            }
+        }
+    }
+}
+
+TEST(histogramFloatCounts)  // {{{1
+{
+    std::vector<int> data = {0, 1, 1, 2, 2, 2, 3, 3, 3, 3, 0, 1, 2, 3, 3, 3, 3, 3, 3};
+    float bins[4] = {};
+    Vc::histogram(data.begin(), data.end(), bins, 4);
+    COMPARE(bins[0], 2.f);
+    COMPARE(bins[1], 3.f);
+    COMPARE(bins[2], 4.f);
+    COMPARE(bins[3], 10.f);
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,291 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/limits>
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace Vc;
+
+using Int64Types =
+    vir::Typelist<llong_v, ullong_v, fixed_size_simd<llong, 3>, fixed_size_simd<ullong, 3>,
+                  fixed_size_simd<llong, 9>, fixed_size_simd<ullong, 9>>;
+
+// values {{{1
+// Returns inputs that stress the parts emulated with 32-bit instructions: carries between
+// the dword halves, equal high dwords, and the sign bit.
+template <typename T> static std::vector<T> interestingValues()
+{
+    std::vector<T> r = {T(0),
+                        T(1),
+                        T(2),
+                        T(3),
+                        T(-1),
+                        T(-2),
+                        T(0xffffffffull),
+                        T(0x100000000ull),
+                        T(0x100000001ull),
+                        T(0x7fffffffull),
+                        T(0x80000000ull),
+                        T(0x1ffffffffull),
+                        T(0xffffffff00000000ull),
+                        T(0x123456789abcdefull),
+                        T(0x8000000000000000ull),
+                        T(0x7fffffffffffffffull),
+                        T(0x8000000000000001ull),
+                        T(0x0010000000000000ull),
+                        T(0x0020000000000001ull),
+                        T(0xfedcba9876543210ull)};
+    std::mt19937_64 engine;
+    for (int i = 0; i < 64; ++i) {
+        r.push_back(T(engine()));
+        r.push_back(T(engine() >> (i % 64)));
+    }
+    return r;
+}
+
+// Calls f(a, b) with vectors covering all combinations of interestingValues.
+template <typename V, typename F> static void forAllPairs(F &&f)
+{
+    using T = typename V::EntryType;
+    const auto values = interestingValues<T>();
+    const std::size_t n = values.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; j += V::size()) {
+            const V a = values[i];
+            const V b = V::generate([&](std::size_t k) { return values[(j + k) % n]; });
+            f(a, b);
+            f(b, a);
+        }
+    }
+}
+
+// arithmetics {{{1
+TEST_TYPES(V, arithmetics, Int64Types)
+{
+    using T = typename V::EntryType;
+    forAllPairs<V>([](const V &a, const V &b) {
+        COMPARE(a + b, V::generate([&](int i) { return T(a[i] + b[i]); })) << a << b;
+        COMPARE(a - b, V::generate([&](int i) { return T(a[i] - b[i]); })) << a << b;
+        COMPARE(a * b, V::generate([&](int i) { return T(a[i] * b[i]); })) << a << b;
+        COMPARE(-a, V::generate([&](int i) { return T(-a[i]); })) << a;
+        COMPARE(a & b, V::generate([&](int i) { return T(a[i] & b[i]); })) << a << b;
+        COMPARE(a | b, V::generate([&](int i) { return T(a[i] | b[i]); })) << a << b;
+        COMPARE(a ^ b, V::generate([&](int i) { return T(a[i] ^ b[i]); })) << a << b;
+        COMPARE(~a, V::generate([&](int i) { return T(~a[i]); })) << a;
+        const V c = iif(b == 0 || (a == std::numeric_limits<T>::min() && b == T(-1)),
+                        V(1), b);
+        COMPARE(a / c, V::generate([&](int i) { return T(a[i] / c[i]); })) << a << c;
+        COMPARE(a % c, V::generate([&](int i) { return T(a[i] % c[i]); })) << a << c;
+    });
+    V x([](int i) { return T(i); });
+    COMPARE(x, V::generate([](int i) { return T(i); }));
+    x += V(T(0x100000000ull));
+    x *= V(3);
+    COMPARE(x, V::generate([](int i) { return T((i + 0x100000000ull) * 3); }));
+}
+
+// compares {{{1
+TEST_TYPES(V, compares, Int64Types)
+{
+    using T = typename V::EntryType;
+    using M = typename V::MaskType;
+    forAllPairs<V>([](const V &a, const V &b) {
+        COMPARE(a == b, M::generate([&](int i) { return a[i] == b[i]; })) << a << b;
+        COMPARE(a != b, M::generate([&](int i) { return a[i] != b[i]; })) << a << b;
+        COMPARE(a < b, M::generate([&](int i) { return a[i] < b[i]; })) << a << b;
+        COMPARE(a <= b, M::generate([&](int i) { return a[i] <= b[i]; })) << a << b;
+        COMPARE(a > b, M::generate([&](int i) { return a[i] > b[i]; })) << a << b;
+        COMPARE(a >= b, M::generate([&](int i) { return a[i] >= b[i]; })) << a << b;
+        COMPARE(min(a, b), V::generate([&](int i) { return std::min(a[i], b[i]); }));
+        COMPARE(max(a, b), V::generate([&](int i) { return std::max(a[i], b[i]); }));
+    });
+    COMPARE(V(std::numeric_limits<T>::max()).min(), std::numeric_limits<T>::max());
+    COMPARE(std::numeric_limits<Vc::Vector<T>>::min()[0], std::numeric_limits<T>::min());
+    COMPARE(std::numeric_limits<Vc::Vector<T>>::max()[0], std::numeric_limits<T>::max());
+}
+
+// shifts {{{1
+TEST_TYPES(V, shifts, Int64Types)
+{
+    using T = typename V::EntryType;
+    for (T x : interestingValues<T>()) {
+        const V a = x;
+        for (int n = 0; n < 64; ++n) {
+            COMPARE(a << n, V(T(x << n))) << "x: " << x << " n: " << n;
+            COMPARE(a >> n, V(T(x >> n))) << "x: " << x << " n: " << n;
+            const V s = V::generate([&](int i) { return T((n + i) % 64); });
+            V l = a;
+            l <<= s;
+            COMPARE(l, V::generate([&](int i) { return T(x << s[i]); })) << a << s;
+            V r = a;
+            r >>= s;
+            COMPARE(r, V::generate([&](int i) { return T(x >> s[i]); })) << a << s;
+        }
+        COMPARE(a << 3, V(T(x << 3)));
+        COMPARE(a >> 7, V(T(x >> 7)));
+    }
+}
+
+// reductions {{{1
+template <typename V> static void testAbs(const V &, std::false_type) {}
+template <typename V> static void testAbs(const V &a, std::true_type)
+{
+    using T = typename V::EntryType;
+    COMPARE(abs(a), V::generate([&](int i) { return a[i] < 0 ? T(-a[i]) : a[i]; })) << a;
+}
+
+TEST_TYPES(V, reductions, Int64Types)
+{
+    using T = typename V::EntryType;
+    const auto values = interestingValues<T>();
+    for (std::size_t j = 0; j + V::size() <= values.size(); ++j) {
+        const V a(&values[j], Vc::Unaligned);
+        T sum = 0, product = 1, mn = a[0], mx = a[0];
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            sum += a[i];
+            product *= a[i];
+            mn = std::min(mn, a[i]);
+            mx = std::max(mx, a[i]);
+        }
+        COMPARE(a.sum(), sum) << a;
+        COMPARE(a.product(), product) << a;
+        COMPARE(a.min(), mn) << a;
+        COMPARE(a.max(), mx) << a;
+        testAbs(a, std::is_signed<T>());
+    }
+}
+
+TEST_TYPES(V, sorted, Int64Types)
+{
+    using T = typename V::EntryType;
+    const auto values = interestingValues<T>();
+    for (std::size_t j = 0; j + V::size() <= values.size(); ++j) {
+        const V a(&values[j], Vc::Unaligned);
+        std::vector<T> ref(&values[j], &values[j] + V::size());
+        std::sort(ref.begin(), ref.end());
+        COMPARE(a.sorted(), V(&ref[0], Vc::Unaligned)) << a;
+        COMPARE(a.reversed().sorted(), V(&ref[0], Vc::Unaligned)) << a;
+    }
+}
+
+// conversions {{{1
+template <typename To, typename From> static To castTo(From x)
+{
+    return static_cast<To>(x);
+}
+
+TEST_TYPES(V, conversions, Int64Types)
+{
+    using T = typename V::EntryType;
+    using D = Vc::fixed_size_simd<double, V::size()>;
+    using I = Vc::fixed_size_simd<int, V::size()>;
+    using U = Vc::fixed_size_simd<uint, V::size()>;
+    using F = Vc::fixed_size_simd<float, V::size()>;
+    using Other = Vc::fixed_size_simd<
+        typename std::conditional<std::is_signed<T>::value, ullong, llong>::type, V::size()>;
+    for (T x : interestingValues<T>()) {
+        const V a = V::generate([&](int i) { return T(x + T(i)); });
+        COMPARE(simd_cast<D>(a), D::generate([&](int i) { return double(a[i]); })) << a;
+        COMPARE(simd_cast<F>(a), F::generate([&](int i) { return float(a[i]); })) << a;
+        COMPARE(simd_cast<I>(a), I::generate([&](int i) { return int(a[i]); })) << a;
+        COMPARE(simd_cast<U>(a), U::generate([&](int i) { return uint(a[i]); })) << a;
+        using O = typename Other::EntryType;
+        COMPARE(simd_cast<Other>(a), Other::generate([&](int i) { return O(a[i]); }));
+        COMPARE(simd_cast<V>(simd_cast<Other>(a)), a);
+
+        const I b = I::generate([&](int i) { return int(x >> 3) + i; });
+        COMPARE(simd_cast<V>(b), V::generate([&](int i) { return T(b[i]); })) << b;
+        const U c = U::generate([&](int i) { return uint(x >> 3) + i; });
+        COMPARE(simd_cast<V>(c), V::generate([&](int i) { return T(c[i]); })) << c;
+
+        // only values representable in T are well-defined for double -> T
+        const D d = D::generate([&](int i) {
+            return std::is_signed<T>::value ? double(std::llround(double(x >> 12) * 1.5)) + i
+                                            : double(ullong(x >> 12)) * 1.5 + i;
+        });
+        COMPARE(simd_cast<V>(d), V::generate([&](int i) { return castTo<T>(d[i]); })) << d;
+    }
+    COMPARE(simd_cast<V>(D(9007199254740993.)), V(T(9007199254740992ull)));
+    COMPARE(simd_cast<D>(V(T(0x8000000000000000ull))),
+            D(std::is_signed<T>::value ? -9223372036854775808. : 9223372036854775808.));
+    COMPARE(simd_cast<D>(V(T(0xffffffffffffffffull))),
+            D(std::is_signed<T>::value ? -1. : 18446744073709551616.));
+}
+
+// gather/scatter {{{1
+TEST_TYPES(V, gatherScatter, Int64Types)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    const auto values = interestingValues<T>();
+    const int n = values.size();
+    for (int j = 0; j < n; ++j) {
+        const IT idx = IT::generate([&](int i) { return (j + 7 * i) % n; });
+        const V a(values.data(), idx);
+        COMPARE(a, V::generate([&](int i) { return values[idx[i]]; })) << idx;
+        const auto m = (a & 1) == 0;
+        V b = V(T(42));
+        b.gather(values.data(), idx, m);
+        COMPARE(b, iif(m, a, V(T(42)))) << idx << m;
+
+        std::vector<T> out(n, T(0));
+        const IT idx2 = IT::generate([&](int i) { return (j + i) % n; });
+        a.scatter(out.data(), idx2);
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            COMPARE(out[idx2[i]], a[i]);
+        }
+    }
+}
+
+// memory {{{1
+TEST_TYPES(V, memory, Int64Types)
+{
+    using T = typename V::EntryType;
+    Vc::Memory<Vc::Vector<T>, 37> mem;
+    for (std::size_t i = 0; i < mem.entriesCount(); ++i) {
+        mem[i] = T(i) << 33 | T(i);
+    }
+    for (std::size_t i = 0; i < mem.vectorsCount(); ++i) {
+        Vc::Vector<T> x = mem.vector(i);
+        x <<= 1;
+        mem.vector(i) = x;
+    }
+    for (std::size_t i = 0; i < mem.entriesCount(); ++i) {
+        COMPARE(mem[i], T((T(i) << 33 | T(i)) << 1)) << i;
+    }
+    alignas(V::MemoryAlignment) T buf[V::size()] = {};
+    V(T(-3)).store(buf, Vc::Aligned);
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(buf[i], T(-3));
+    }
+    COMPARE(V(buf, Vc::Aligned), V(T(-3)));
+}
+
+// vim: foldmethod=marker
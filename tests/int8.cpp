@@ -0,0 +1,326 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/limits>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <random>
+
+using namespace Vc;
+
+using Int8Types = vir::Typelist<schar_v, uchar_v>;
+
+// values {{{1
+// Calls f(a, b) with vectors covering all pairs of 8-bit values.
+template <typename V, typename F> static void forAllPairs(F &&f)
+{
+    using T = typename V::EntryType;
+    for (int i = 0; i < 256; ++i) {
+        for (int j = 0; j < 256; j += V::size()) {
+            const V a = T(i);
+            const V b = V::generate([&](int k) { return T(j + k); });
+            f(a, b);
+            f(b, a);
+        }
+    }
+}
+
+template <typename T> static T saturate(int x)
+{
+    return T(std::min(std::max(x, int(std::numeric_limits<T>::min())),
+                      int(std::numeric_limits<T>::max())));
+}
+
+// arithmetics {{{1
+TEST_TYPES(V, arithmetics, Int8Types)
+{
+    using T = typename V::EntryType;
+    forAllPairs<V>([](const V &a, const V &b) {
+        COMPARE(a + b, V::generate([&](int i) { return T(a[i] + b[i]); })) << a << b;
+        COMPARE(a - b, V::generate([&](int i) { return T(a[i] - b[i]); })) << a << b;
+        COMPARE(a * b, V::generate([&](int i) { return T(a[i] * b[i]); })) << a << b;
+        COMPARE(-a, V::generate([&](int i) { return T(-a[i]); })) << a;
+        COMPARE(a & b, V::generate([&](int i) { return T(a[i] & b[i]); })) << a << b;
+        COMPARE(a | b, V::generate([&](int i) { return T(a[i] | b[i]); })) << a << b;
+        COMPARE(a ^ b, V::generate([&](int i) { return T(a[i] ^ b[i]); })) << a << b;
+        COMPARE(~a, V::generate([&](int i) { return T(~a[i]); })) << a;
+        const V c = iif(b == 0, V(1), b);
+        COMPARE(a / c, V::generate([&](int i) { return T(a[i] / c[i]); })) << a << c;
+        COMPARE(a % c, V::generate([&](int i) { return T(a[i] % c[i]); })) << a << c;
+    });
+    V x = V::IndexesFromZero();
+    COMPARE(x, V::generate([](int i) { return T(i); }));
+    x += V(T(3));
+    x *= V(3);
+    COMPARE(x, V::generate([](int i) { return T((i + 3) * 3); }));
+}
+
+// saturating {{{1
+TEST_TYPES(V, saturating, Int8Types)
+{
+    using T = typename V::EntryType;
+    forAllPairs<V>([](const V &a, const V &b) {
+        COMPARE(add_sat(a, b), V::generate([&](int i) { return saturate<T>(a[i] + b[i]); }))
+            << a << b;
+        COMPARE(sub_sat(a, b), V::generate([&](int i) { return saturate<T>(a[i] - b[i]); }))
+            << a << b;
+    });
+    COMPARE(add_sat(V(std::numeric_limits<T>::max()), V(1)), V(std::numeric_limits<T>::max()));
+    COMPARE(sub_sat(V(std::numeric_limits<T>::min()), V(1)), V(std::numeric_limits<T>::min()));
+    COMPARE(add_sat(short_v(0x7ff0), short_v(0x20)), short_v(0x7fff));
+    COMPARE(sub_sat(ushort_v(3), ushort_v(7)), ushort_v(0));
+}
+
+// compares {{{1
+TEST_TYPES(V, compares, Int8Types)
+{
+    using T = typename V::EntryType;
+    using M = typename V::MaskType;
+    forAllPairs<V>([](const V &a, const V &b) {
+        COMPARE(a == b, M::generate([&](int i) { return a[i] == b[i]; })) << a << b;
+        COMPARE(a != b, M::generate([&](int i) { return a[i] != b[i]; })) << a << b;
+        COMPARE(a < b, M::generate([&](int i) { return a[i] < b[i]; })) << a << b;
+        COMPARE(a <= b, M::generate([&](int i) { return a[i] <= b[i]; })) << a << b;
+        COMPARE(a > b, M::generate([&](int i) { return a[i] > b[i]; })) << a << b;
+        COMPARE(a >= b, M::generate([&](int i) { return a[i] >= b[i]; })) << a << b;
+        COMPARE(min(a, b), V::generate([&](int i) { return std::min(a[i], b[i]); }));
+        COMPARE(max(a, b), V::generate([&](int i) { return std::max(a[i], b[i]); }));
+    });
+    COMPARE(std::numeric_limits<V>::min()[0], std::numeric_limits<T>::min());
+    COMPARE(std::numeric_limits<V>::max()[0], std::numeric_limits<T>::max());
+}
+
+// shifts {{{1
+TEST_TYPES(V, shifts, Int8Types)
+{
+    using T = typename V::EntryType;
+    for (int x = 0; x < 256; ++x) {
+        const V a = T(x);
+        for (int n = 0; n < 8; ++n) {
+            COMPARE(a << n, V(T(T(x) << n))) << "x: " << x << " n: " << n;
+            COMPARE(a >> n, V(T(T(x) >> n))) << "x: " << x << " n: " << n;
+            const V s = V::generate([&](int i) { return T((n + i) % 8); });
+            COMPARE(a << s, V::generate([&](int i) { return T(T(x) << s[i]); })) << a << s;
+            COMPARE(a >> s, V::generate([&](int i) { return T(T(x) >> s[i]); })) << a << s;
+        }
+    }
+}
+
+// reductions {{{1
+template <typename V> static void testAbs(const V &, std::false_type) {}
+template <typename V> static void testAbs(const V &a, std::true_type)
+{
+    using T = typename V::EntryType;
+    COMPARE(abs(a), V::generate([&](int i) { return a[i] < 0 ? T(-a[i]) : a[i]; })) << a;
+}
+
+TEST_TYPES(V, reductions, Int8Types)
+{
+    using T = typename V::EntryType;
+    T values[256 + V::Size];
+    for (int i = 0; i < 256 + int(V::Size); ++i) {
+        values[i] = T(i * 97 + (i >> 3));
+    }
+    for (int j = 0; j < 256; ++j) {
+        const V a(&values[j], Vc::Unaligned);
+        T sum = 0, product = 1, mn = a[0], mx = a[0];
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            sum += a[i];
+            product *= a[i];
+            mn = std::min(mn, a[i]);
+            mx = std::max(mx, a[i]);
+        }
+        COMPARE(a.sum(), sum) << a;
+        COMPARE(a.product(), product) << a;
+        COMPARE(a.min(), mn) << a;
+        COMPARE(a.max(), mx) << a;
+        testAbs(a, std::is_signed<T>());
+    }
+}
+
+// conversions {{{1
+template <typename V> static void testNarrowing(std::false_type) {}
+template <typename V> static void testNarrowing(std::true_type)
+{
+    using T = typename V::EntryType;
+    const short_v s0 = short_v::generate([](int i) { return short(i * 0x101 - 3); });
+    const short_v s1 = short_v::generate([](int i) { return short(i * -0x0ff + 0x180); });
+    COMPARE(simd_cast<V>(s0, s1), V::generate([&](int i) {
+                return T(i < int(short_v::Size) ? s0[i] : s1[i - short_v::Size]);
+            }));
+    const int_v i0 = int_v::generate([](int i) { return i * 0x10101 - 200; });
+    const int_v i1 = i0 + 1000;
+    const int_v i2 = i0 * -3;
+    const int_v i3 = i0 ^ 0x5555;
+    const int_v in[4] = {i0, i1, i2, i3};
+    COMPARE(simd_cast<V>(i0, i1, i2, i3), V::generate([&](int i) {
+                return T(in[i / int_v::Size][i % int_v::Size]);
+            }));
+}
+
+TEST_TYPES(V, conversions, Int8Types)
+{
+    using T = typename V::EntryType;
+    using Other = Vc::Vector<typename std::conditional<std::is_signed<T>::value, uchar, schar>::type>;
+    for (int x = 0; x < 256; ++x) {
+        const V a = V::generate([&](int i) { return T(x + 7 * i); });
+        COMPARE(simd_cast<short_v>(a), short_v::generate([&](int i) { return short(a[i]); }))
+            << a;
+        COMPARE(simd_cast<ushort_v>(a), ushort_v::generate([&](int i) { return ushort(a[i]); }))
+            << a;
+        COMPARE(simd_cast<int_v>(a), int_v::generate([&](int i) { return int(a[i]); })) << a;
+        COMPARE(simd_cast<uint_v>(a), uint_v::generate([&](int i) { return uint(a[i]); })) << a;
+        COMPARE(simd_cast<float_v>(a), float_v::generate([&](int i) { return float(a[i]); }))
+            << a;
+        COMPARE(simd_cast<Other>(a), Other::generate([&](int i) {
+                    return typename Other::EntryType(a[i]);
+                }));
+        COMPARE(simd_cast<V>(simd_cast<Other>(a)), a);
+
+        const short_v s = short_v::generate([&](int i) { return short(x * 0x0102 + i); });
+        COMPARE(simd_cast<V>(s), V::generate([&](int i) {
+                    return i < int(short_v::Size) ? T(s[i]) : T(0);
+                })) << s;
+        const int_v n = int_v::generate([&](int i) { return x * 0x10203 - i; });
+        COMPARE(simd_cast<V>(n), V::generate([&](int i) {
+                    return i < int(int_v::Size) ? T(n[i]) : T(0);
+                })) << n;
+    }
+    testNarrowing<V>(std::integral_constant<bool, V::Size == 2 * short_v::Size &&
+                                                      V::Size == 4 * int_v::Size>());
+}
+
+// table_lookup {{{1
+TEST_TYPES(V, tableLookup, Int8Types)
+{
+    using T = typename V::EntryType;
+    const T table[16] = {T(10), T(-1),  T(12), T(13),  T(14), T(-15), T(16), T(17),
+                         T(18), T(-19), T(20), T(127), T(22), T(23),  T(24), T(-128)};
+    for (int x = 0; x < 256; ++x) {
+        const V idx = V::generate([&](int i) { return T(x + i); });
+        COMPARE(table_lookup(table, idx), V::generate([&](int i) {
+                    const int j = uchar(idx[i]);
+                    return j < 16 ? table[j] : T(0);
+                })) << idx;
+        // the usual nibble-classification idiom
+        COMPARE(table_lookup(table, idx & 0xf), V::generate([&](int i) {
+                    return table[idx[i] & 0xf];
+                })) << idx;
+    }
+}
+
+// gather/scatter {{{1
+TEST_TYPES(V, gatherScatter, Int8Types)
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    T values[256];
+    for (int i = 0; i < 256; ++i) {
+        values[i] = T(i * 13 + 5);
+    }
+    for (int j = 0; j < 256; ++j) {
+        const IT idx = IT::generate([&](int i) { return (j + 7 * i) % 256; });
+        const V a(values, idx);
+        COMPARE(a, V::generate([&](int i) { return values[idx[i]]; })) << idx;
+        const auto m = (a & 1) == 0;
+        V b = V(T(42));
+        b.gather(values, idx, m);
+        COMPARE(b, iif(m, a, V(T(42)))) << idx << m;
+
+        T out[256] = {};
+        const IT idx2 = IT::generate([&](int i) { return (j + i) % 256; });
+        a.scatter(out, idx2);
+        for (std::size_t i = 0; i < V::size(); ++i) {
+            COMPARE(out[idx2[i]], a[i]);
+        }
+    }
+}
+
+// memory {{{1
+TEST_TYPES(V, memory, Int8Types)
+{
+    using T = typename V::EntryType;
+    Vc::Memory<V, 101> mem;
+    for (std::size_t i = 0; i < mem.entriesCount(); ++i) {
+        mem[i] = T(i);
+    }
+    for (std::size_t i = 0; i < mem.vectorsCount(); ++i) {
+        V x = mem.vector(i);
+        x <<= 1;
+        mem.vector(i) = x;
+    }
+    for (std::size_t i = 0; i < mem.entriesCount(); ++i) {
+        COMPARE(mem[i], T(T(i) << 1)) << i;
+    }
+    alignas(V::MemoryAlignment) T buf[V::size()] = {};
+    V(T(-3)).store(buf, Vc::Aligned);
+    for (std::size_t i = 0; i < V::size(); ++i) {
+        COMPARE(buf[i], T(-3));
+    }
+    COMPARE(V(buf, Vc::Aligned), V(T(-3)));
+    const V r = V::IndexesFromZero();
+    COMPARE(r.reversed(), V::generate([](int i) { return T(V::Size - 1 - i); }));
+    COMPARE(r.interleaveLow(r + 100), V::generate([](int i) {
+                return T(i / 2 + (i & 1) * 100);
+            }));
+}
+
+// permutations {{{1
+TEST_TYPES(V, rotated, Int8Types)
+{
+    using T = typename V::EntryType;
+    const V r = V::generate([](int i) { return T(3 * i + 1); });
+    for (int amount = -int(V::Size) - 1; amount <= 2 * int(V::Size); ++amount) {
+        COMPARE(r.rotated(amount), V::generate([&](int i) {
+                    const int n = V::Size;
+                    return T(3 * ((i + amount % n + n) % n) + 1);
+                })) << "amount = " << amount;
+    }
+}
+
+TEST_TYPES(V, sorted, Int8Types)
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for (int n = 0; n < 1000; ++n) {
+        // few distinct values in every other vector
+        const int mod = n % 2 ? 256 : 4;
+        T ref[V::Size];
+        for (auto &x : ref) {
+            x = T(dist(rng) % mod);
+        }
+        const V a(&ref[0], Vc::Unaligned);
+        std::sort(std::begin(ref), std::end(ref));
+        COMPARE(a.sorted(), V(&ref[0], Vc::Unaligned)) << a;
+    }
+    COMPARE(V::IndexesFromZero().reversed().sorted(), V::IndexesFromZero());
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,209 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/Memory>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#ifdef Vc_HAVE_MAPPED_MEMORY
+// a file name unique to this process and vector type
+template <typename V> static std::string tempFile(const char *tag)
+{
+    const char *dir = std::getenv("TMPDIR");
+    return std::string(dir ? dir : "/tmp") + "/vc_mappedmemory_" + tag + '_' +
+           std::to_string(getpid()) + '_' +
+           std::to_string(sizeof(typename V::EntryType)) + '_' +
+           std::to_string(V::Size) + ".vcm";
+}
+
+TEST_TYPES(V, mappedWriteRead, AllVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    const auto path = tempFile<V>("rw");
+    for (std::size_t n : {0u, 1u, 17u, 1000u}) {
+        {
+            Vc::MappedMemory<V> out(path, Vc::MappedMemoryMode::Create);
+            COMPARE(out.entriesCount(), 0u);
+            for (std::size_t i = 0; i < n; ++i) {
+                out.append(T(i % 100));
+            }
+            COMPARE(out.entriesCount(), n);
+        }
+        Vc::MappedMemory<V> in(path);
+        COMPARE(in.entriesCount(), n);
+        COMPARE(in.vectorsCount(), (n + V::Size - 1) / V::Size);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(in[i], T(i % 100)) << "n = " << n << ", i = " << i;
+        }
+        for (std::size_t i = 0; i < in.vectorsCount(); ++i) {
+            const V v = in.vector(i);
+            for (std::size_t j = 0; j < V::Size; ++j) {
+                const std::size_t k = i * V::Size + j;
+                COMPARE(v[j], k < n ? T(k % 100) : T(0)) << "n = " << n << ", k = " << k;
+            }
+        }
+        VERIFY(reinterpret_cast<std::uintptr_t>(in.entries()) % V::MemoryAlignment == 0);
+        if (n > 0) {
+            COMPARE(V(in.firstVector()), V(in.vector(0)));
+            COMPARE(V(in.lastVector()), V(in.vector(in.vectorsCount() - 1)));
+        }
+    }
+    std::remove(path.c_str());
+}
+
+TEST_TYPES(V, mappedAppend, AllVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    const auto path = tempFile<V>("append");
+    std::vector<T> data(100);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = T(i);
+    }
+    {
+        Vc::MappedMemory<V> out(path, Vc::MappedMemoryMode::Create);
+        out.append(data.data(), 3);
+        out.append(V(T(7)));
+    }
+    {
+        Vc::MappedMemory<V> out(path, Vc::MappedMemoryMode::ReadWrite);
+        COMPARE(out.entriesCount(), 3 + V::Size);
+        out.append(data.data(), data.size());
+        out.vector(0) += V(T(1));
+    }
+    Vc::MappedMemory<V> in(path);
+    COMPARE(in.entriesCount(), 3 + V::Size + data.size());
+    for (std::size_t i = 0; i < in.entriesCount(); ++i) {
+        const T expected =
+            i < 3 ? data[i] : i < 3 + V::Size ? T(7) : data[i - 3 - V::Size];
+        COMPARE(in[i], T(expected + (i < V::Size ? T(1) : T(0)))) << "i = " << i;
+    }
+    std::remove(path.c_str());
+}
+
+TEST_TYPES(V, mappedResize, AllVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    const auto path = tempFile<V>("resize");
+    {
+        Vc::MappedMemory<V> m(path, Vc::MappedMemoryMode::Create);
+        m.resize(3 * V::Size);
+        for (auto &x : m) {
+            x = V(T(1));
+        }
+        m.resize(V::Size + 1);
+        COMPARE(m.vectorsCount(), 2u);
+        COMPARE(V(m.vector(0)), V(T(1)));
+        COMPARE(V(m.vector(1)), Vc::iif(V::IndexesFromZero() < T(1), V(T(1)), V(T(0))));
+        m.reserve(1000);
+        VERIFY(m.capacity() >= 1000u);
+        COMPARE(m.entriesCount(), V::Size + 1);
+    }
+    Vc::MappedMemory<V> in(path);
+    COMPARE(in.entriesCount(), V::Size + 1);
+    COMPARE(V(in.lastVector()), Vc::iif(V::IndexesFromZero() < T(1), V(T(1)), V(T(0))));
+    std::remove(path.c_str());
+}
+
+TEST_TYPES(V, mappedReadIsPrivate, AllVectors)  // {{{1
+{
+    using T = typename V::EntryType;
+    const auto path = tempFile<V>("private");
+    {
+        Vc::MappedMemory<V> out(path, Vc::MappedMemoryMode::Create);
+        out.resize(V::Size);
+    }
+    {
+        Vc::MappedMemory<V> in(path);
+        in.vector(0) = V(T(3));
+        COMPARE(V(in.vector(0)), V(T(3)));
+        Vc::MappedMemory<V> other(std::move(in));
+        COMPARE(V(other.vector(0)), V(T(3)));
+        COMPARE(in.vectorsCount(), 0u);
+    }
+    Vc::MappedMemory<V> in(path);
+    COMPARE(V(in.vector(0)), V(T(0)));
+    std::remove(path.c_str());
+}
+
+TEST(mappedExpression)  // {{{1
+{
+    const auto path = tempFile<Vc::float_v>("expr");
+    Vc::Memory<Vc::float_v> a(1000), b(1000);
+    for (std::size_t i = 0; i < a.entriesCount(); ++i) {
+        a[i] = float(i);
+        b[i] = 2.f;
+    }
+    {
+        Vc::MappedMemory<Vc::float_v> out(path, Vc::MappedMemoryMode::Create);
+        out.resize(1000);
+        out = a * b + 1.f;
+    }
+    Vc::MappedMemory<Vc::float_v> in(path);
+    for (std::size_t i = 0; i < in.entriesCount(); ++i) {
+        COMPARE(in[i], 2.f * i + 1.f);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(mappedErrors)  // {{{1
+{
+    const auto path = tempFile<Vc::float_v>("errors");
+    std::remove(path.c_str());
+    try {
+        Vc::MappedMemory<Vc::float_v> m(path);
+        FAIL() << "opening a missing file must throw";
+    } catch (const std::system_error &) {
+    }
+    {
+        Vc::MappedMemory<Vc::float_v> out(path, Vc::MappedMemoryMode::Create);
+        out.append(1.f);
+    }
+    try {
+        Vc::MappedMemory<Vc::int_v> m(path);
+        FAIL() << "opening a float file as int must throw";
+    } catch (const std::runtime_error &) {
+    }
+    FILE *f = std::fopen(path.c_str(), "w");
+    std::fputs("not a Vc file", f);
+    std::fclose(f);
+    try {
+        Vc::MappedMemory<Vc::float_v> m(path);
+        FAIL() << "opening a foreign file must throw";
+    } catch (const std::runtime_error &) {
+    }
+    std::remove(path.c_str());
+}
+#endif  // Vc_HAVE_MAPPED_MEMORY
+
+// vim: foldmethod=marker
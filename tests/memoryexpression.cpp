@@ -0,0 +1,184 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/Memory>
+#include <cmath>
+
+using namespace Vc;
+
+using ArithmeticTypes = vir::Typelist<float_v, double_v, int_v, uint_v, short_v>;
+using FloatTypes = vir::Typelist<float_v, double_v>;
+
+template <typename V, typename M> static void fill(M &m, int offset)
+{
+    using T = typename V::EntryType;
+    for (std::size_t i = 0; i < m.entriesCount(); ++i) {
+        m[i] = T((i + offset) % 23 + 1);
+    }
+}
+
+TEST_TYPES(V, fusedArithmetic, ArithmeticTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = 5 * V::Size + 3;
+    Memory<V, N> a, b, c, d;
+    fill<V>(b, 0);
+    fill<V>(c, 5);
+    fill<V>(d, 11);
+    a = b * c + d;
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(b[i] * c[i] + d[i])) << "i: " << i;
+    }
+    // the padding entries are zero and evaluated as well, so avoid dividing by them
+    a = (b - T(1)) * T(2) + c / (d + T(1));
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T((b[i] - T(1)) * T(2) + c[i] / (d[i] + T(1)))) << "i: " << i;
+    }
+    a = -b + T(3) * c;
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(-b[i] + T(3) * c[i])) << "i: " << i;
+    }
+}
+
+TEST_TYPES(V, compoundAssignment, ArithmeticTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = 3 * V::Size;
+    Memory<V, N> a, b, c, ref;
+    fill<V>(a, 2);
+    fill<V>(b, 7);
+    fill<V>(c, 13);
+    ref = a;
+    a += b * c;
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(ref[i] + b[i] * c[i])) << "i: " << i;
+    }
+    ref = a;
+    a -= b + c;
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(ref[i] - (b[i] + c[i]))) << "i: " << i;
+    }
+    ref = a;
+    a *= b - T(1);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(ref[i] * (b[i] - T(1)))) << "i: " << i;
+    }
+    fill<V>(a, 3);
+    ref = a;
+    a /= b * T(1);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(ref[i] / b[i])) << "i: " << i;
+    }
+}
+
+TEST_TYPES(V, selfAliasing, ArithmeticTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = 4 * V::Size + 1;
+    Memory<V, N> a, ref;
+    fill<V>(a, 1);
+    ref = a;
+    a = a * T(2) + a;
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(ref[i] * T(3))) << "i: " << i;
+    }
+}
+
+TEST_TYPES(V, mathFunctions, FloatTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = 6 * V::Size;
+    Memory<V, N> a, b, c;
+    fill<V>(b, 0);
+    fill<V>(c, 4);
+    a = Vc::sqrt(b * c) + Vc::exp(-b);
+    for (std::size_t i = 0; i < N; ++i) {
+        FUZZY_COMPARE(a[i], T(std::sqrt(b[i] * c[i]) + std::exp(-b[i]))) << "i: " << i;
+    }
+    a = Vc::max(b, c) - Vc::min(b, T(10));
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], std::max(b[i], c[i]) - std::min(b[i], T(10))) << "i: " << i;
+    }
+    a = Vc::abs(b - c);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], std::abs(b[i] - c[i])) << "i: " << i;
+    }
+}
+
+TEST_TYPES(V, whereSelect, ArithmeticTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = 4 * V::Size + 2;
+    Memory<V, N> a, b, c;
+    fill<V>(b, 0);
+    fill<V>(c, 9);
+    a = Vc::where(b > T(5), b - T(5), c);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], b[i] > T(5) ? T(b[i] - T(5)) : c[i]) << "i: " << i;
+    }
+    a = Vc::where(b * T(2) <= c, b, c);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], b[i] * T(2) <= c[i] ? b[i] : c[i]) << "i: " << i;
+    }
+    // comparing two Memory objects directly keeps its bool semantics
+    VERIFY(b == b);
+    VERIFY(!(b == c));
+}
+
+TEST_TYPES(V, twoDimensionalAndDynamic, FloatTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t Rows = 3, Cols = 2 * V::Size + 1;
+    Memory<V, Rows, Cols> a, b;
+    for (std::size_t r = 0; r < Rows; ++r) {
+        for (std::size_t i = 0; i < Cols; ++i) {
+            b[r][i] = T(r * Cols + i);
+        }
+    }
+    a = b * T(2) + T(1);
+    for (std::size_t r = 0; r < Rows; ++r) {
+        for (std::size_t i = 0; i < Cols; ++i) {
+            COMPARE(a[r][i], T(b[r][i] * T(2) + T(1))) << "r: " << r << ", i: " << i;
+        }
+    }
+
+    Memory<V> x(37), y(37), z(37);
+    fill<V>(y, 3);
+    fill<V>(z, 8);
+    x = Vc::sqrt(y) * z;
+    for (std::size_t i = 0; i < 37; ++i) {
+        FUZZY_COMPARE(x[i], T(std::sqrt(y[i]) * z[i])) << "i: " << i;
+    }
+    x += y;
+    for (std::size_t i = 0; i < 37; ++i) {
+        FUZZY_COMPARE(x[i], T(std::sqrt(y[i]) * z[i] + y[i])) << "i: " << i;
+    }
+}
+
+// vim: foldmethod=marker
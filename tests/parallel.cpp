@@ -0,0 +1,99 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+TEST(threadPoolCoversRange)
+{
+    Vc::Common::ThreadPool pool(4);
+    COMPARE(pool.size(), 4u);
+    for (std::size_t n : {0u, 1u, 3u, 4u, 17u, 1000u}) {
+        std::vector<std::atomic<int>> hits(n);
+        for (auto &h : hits) {
+            h = 0;
+        }
+        pool.parallel_for(n, [&](std::size_t i) { ++hits[i]; });
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(hits[i].load(), 1) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST(threadPoolNested)
+{
+    Vc::Common::ThreadPool pool(3);
+    std::atomic<int> sum(0);
+    pool.parallel_for(6, [&](std::size_t i) {
+        // nested loops run serially on the calling thread
+        pool.parallel_for(10, [&](std::size_t j) { sum += int(i * 10 + j); });
+    });
+    COMPARE(sum.load(), 59 * 60 / 2);
+}
+
+TEST_TYPES(V, parallelForEach, AllVectors)
+{
+    using T = typename V::EntryType;
+    std::vector<T> data(100000);
+    for (std::size_t offset : {0u, 1u, 3u}) {
+        for (std::size_t n : {0u, 1u, 15u, 1000u, 99000u}) {
+            std::iota(data.begin(), data.end(), T());
+            const auto first = data.begin() + offset;
+            Vc::simd_for_each(Vc::Parallel, first, first + n,
+                              [](auto &x) { x += T(1); });
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                const bool inRange = i >= offset && i < offset + n;
+                COMPARE(data[i], T(T(i) + (inRange ? 1 : 0)))
+                    << "offset = " << offset << ", n = " << n << ", i = " << i;
+            }
+        }
+    }
+
+    // empty ranges must not dereference the end iterator
+    std::vector<T> empty;
+    Vc::simd_for_each(Vc::Parallel, empty.begin(), empty.end(), [](auto &x) { x += T(1); });
+    Vc::simd_for_each(Vc::Parallel, data.end(), data.end(), [](auto &x) { x += T(1); });
+}
+
+TEST_TYPES(V, parallelForEachImmutable, AllVectors)
+{
+    using T = typename V::EntryType;
+    std::vector<T> data(50000, T(1));
+    std::atomic<std::size_t> count(0);
+    std::atomic<std::size_t> wrong(0);
+    Vc::simd_for_each_n(Vc::Parallel(2), data.begin() + 1, data.size() - 1,
+                        [&](const auto &x) {
+                            count += x.size();
+                            wrong += (x != T(1)).count();
+                        });
+    COMPARE(count.load(), data.size() - 1);
+    COMPARE(wrong.load(), 0u);
+}
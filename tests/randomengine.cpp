@@ -0,0 +1,248 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/random>
+#include <cmath>
+
+// scalar reference implementation of xoshiro128++
+struct Xoshiro128Reference {
+    unsigned int s[4];
+
+    explicit Xoshiro128Reference(std::uint64_t seed)
+    {
+        const std::uint64_t a = Vc::Detail::splitmix64(seed);
+        const std::uint64_t b = Vc::Detail::splitmix64(seed);
+        s[0] = unsigned(a);
+        s[1] = unsigned(a >> 32);
+        s[2] = unsigned(b);
+        s[3] = unsigned(b >> 32);
+    }
+    static unsigned int rotl(unsigned int x, int k) { return (x << k) | (x >> (32 - k)); }
+    unsigned int operator()()
+    {
+        const unsigned int result = rotl(s[0] + s[3], 7) + s[0];
+        const unsigned int t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+    void jump()
+    {
+        static const unsigned int JUMP[] = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
+        unsigned int t[4] = {0, 0, 0, 0};
+        for (unsigned int word : JUMP) {
+            for (int b = 0; b < 32; ++b) {
+                if (word & (1u << b)) {
+                    for (int i = 0; i < 4; ++i) {
+                        t[i] ^= s[i];
+                    }
+                }
+                operator()();
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            s[i] = t[i];
+        }
+    }
+};
+
+TEST(xoshiroMatchesReference)
+{
+    constexpr int N = 8;
+    Vc::Xoshiro128PlusPlus<N> gen(12345);
+    Xoshiro128Reference ref[N] = {
+        Xoshiro128Reference(12345), Xoshiro128Reference(12345), Xoshiro128Reference(12345),
+        Xoshiro128Reference(12345), Xoshiro128Reference(12345), Xoshiro128Reference(12345),
+        Xoshiro128Reference(12345), Xoshiro128Reference(12345)};
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < i; ++j) {
+            ref[i].jump();
+        }
+    }
+    for (int k = 0; k < 100; ++k) {
+        const auto x = gen();
+        for (int i = 0; i < N; ++i) {
+            const unsigned int expected = ref[i]();
+            COMPARE(x[i], expected) << "lane " << i << ", step " << k;
+        }
+    }
+    gen.jump();
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            ref[i].jump();
+        }
+    }
+    const auto x = gen();
+    for (int i = 0; i < N; ++i) {
+        const unsigned int expected = ref[i]();
+        COMPARE(x[i], expected) << "lane " << i << " after jump";
+    }
+}
+
+TEST(philoxKnownAnswers)
+{
+    // known answer tests of the Random123 distribution
+    using U = Vc::Philox4x32<1>::result_type;
+    {
+        U ctr[4] = {0u, 0u, 0u, 0u};
+        const unsigned int key[2] = {0u, 0u};
+        Vc::Philox4x32<1>::block(ctr, key);
+        COMPARE(ctr[0][0], 0x6627e8d5u);
+        COMPARE(ctr[1][0], 0xe169c58du);
+        COMPARE(ctr[2][0], 0xbc57ac4cu);
+        COMPARE(ctr[3][0], 0x9b00dbd8u);
+    }
+    {
+        U ctr[4] = {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu};
+        const unsigned int key[2] = {0xffffffffu, 0xffffffffu};
+        Vc::Philox4x32<1>::block(ctr, key);
+        COMPARE(ctr[0][0], 0x408f276du);
+        COMPARE(ctr[1][0], 0x41c83b0eu);
+        COMPARE(ctr[2][0], 0xa20bc7c6u);
+        COMPARE(ctr[3][0], 0x6d5451fdu);
+    }
+}
+
+TEST(philoxLanesUseConsecutiveCounters)
+{
+    constexpr int N = 4;
+    Vc::Philox4x32<N> gen(0x0123456789abcdefull);
+    const unsigned int key[2] = {0x89abcdefu, 0x01234567u};
+    for (unsigned int block = 0; block < 3; ++block) {
+        Vc::Philox4x32<N>::result_type out[4];
+        for (auto &x : out) {
+            x = gen();
+        }
+        for (unsigned int lane = 0; lane < N; ++lane) {
+            Vc::Philox4x32<1>::result_type ctr[4] = {block * N + lane, 0u, 0u, 0u};
+            Vc::Philox4x32<1>::block(ctr, key);
+            for (int i = 0; i < 4; ++i) {
+                COMPARE(out[i][lane], ctr[i][0]) << "block " << block << ", lane " << lane;
+            }
+        }
+    }
+}
+
+template <typename Engine> void checkReproducibleStreams()
+{
+    Engine a(42), b(42), c(42);
+    c.jump();
+    for (int k = 0; k < 64; ++k) {
+        const auto x = a();
+        const auto y = b();
+        const auto z = c();
+        COMPARE(x, y);
+        VERIFY(any_of(x != z));
+    }
+    a.seed(42);
+    b.seed(42);
+    const auto x = a();
+    const auto y = b();
+    COMPARE(x, y);
+}
+
+TEST(reproducibleStreams)
+{
+    checkReproducibleStreams<Vc::RandomEngine<Vc::float_v>>();
+    checkReproducibleStreams<Vc::RandomEngine<Vc::double_v, Vc::Philox4x32>>();
+}
+
+TEST_TYPES(V, uniformDistribution, AllVectors)
+{
+    using T = typename V::EntryType;
+    Vc::RandomEngine<V> engine(7);
+    constexpr int NBins = 16;
+    constexpr int PerBin = 20000;
+    int histogram[NBins] = {};
+    const T lo = std::is_signed<T>::value ? T(-40) : T(10);
+    const T hi = T(lo + (std::is_floating_point<T>::value ? 16 : 15));
+    Vc::UniformDistribution<V> dist(lo, hi);
+    for (int i = 0; i < NBins * PerBin / int(V::Size); ++i) {
+        const V x = dist(engine);
+        VERIFY(all_of(x >= lo)) << x;
+        if (std::is_floating_point<T>::value) {
+            VERIFY(all_of(x < hi)) << x;
+        } else {
+            VERIFY(all_of(x <= hi)) << x;
+        }
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            ++histogram[int(x[k] - lo)];
+        }
+    }
+    for (int bin = 0; bin < NBins; ++bin) {
+        VERIFY(histogram[bin] > PerBin * 95 / 100) << "bin " << bin << ": " << histogram[bin];
+        VERIFY(histogram[bin] < PerBin * 105 / 100) << "bin " << bin << ": " << histogram[bin];
+    }
+
+    // the default range covers all values of integral types
+    Vc::UniformDistribution<V> full;
+    V min = full(engine), max = min;
+    for (int i = 0; i < 1000000 / int(V::Size); ++i) {
+        const V x = full(engine);
+        min = Vc::min(min, x);
+        max = Vc::max(max, x);
+    }
+    if (std::is_floating_point<T>::value) {
+        VERIFY(min.min() >= T(0));
+        VERIFY(max.max() < T(1));
+        VERIFY(max.max() > T(0.999));
+    } else if (sizeof(T) == 2) {
+        COMPARE(min.min(), std::numeric_limits<T>::min());
+        COMPARE(max.max(), std::numeric_limits<T>::max());
+    }
+}
+
+TEST_TYPES(V, normalDistribution, RealVectors)
+{
+    using T = typename V::EntryType;
+    Vc::RandomEngine<V> engine(3);
+    Vc::NormalDistribution<V> dist(T(2), T(3));
+    double sum = 0, sum2 = 0;
+    constexpr int N = 400000;
+    int within1Sigma = 0;
+    for (int i = 0; i < N / int(V::Size); ++i) {
+        const V x = dist(engine);
+        VERIFY(all_of(Vc::isfinite(x)));
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            sum += x[k];
+            sum2 += double(x[k]) * x[k];
+            within1Sigma += std::abs(x[k] - T(2)) < T(3);
+        }
+    }
+    const int n = N / int(V::Size) * int(V::Size);
+    const double mean = sum / n;
+    const double variance = sum2 / n - mean * mean;
+    VERIFY(std::abs(mean - 2.) < 0.03) << mean;
+    VERIFY(std::abs(variance - 9.) < 0.1) << variance;
+    VERIFY(std::abs(within1Sigma / double(n) - 0.6827) < 0.005) << within1Sigma / double(n);
+}
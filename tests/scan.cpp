@@ -0,0 +1,237 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <vector>
+
+using ScanTypes = vir::concat<AllVectors, vir::Typelist<Vc::schar_v, Vc::llong_v>>;
+
+// small values keep floating-point sums exact
+template <typename T> static std::vector<T> scan_input(std::size_t n)
+{
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = T((i * 7919u) % 3);
+    }
+    return data;
+}
+
+// a stateful operation: the result depends on floor, which a default-constructed copy
+// would not know
+template <typename T> struct MaximumWithFloor {
+    T floor;
+    template <typename A> A operator()(const A &a, const A &b) const
+    {
+        return Vc::Maximum()(Vc::Maximum()(a, b), A(floor));
+    }
+};
+
+TEST_TYPES(V, inclusiveSum, ScanTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {0u, 1u, 2u, 3u, 17u, 64u, 1000u, 1001u}) {
+        const auto in = scan_input<T>(n);
+        std::vector<T> out(n + 1, T(7));
+        VERIFY(Vc::inclusive_scan(in.begin(), in.end(), out.begin()) == out.begin() + n);
+        T ref = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            ref = T(ref + in[i]);
+            COMPARE(out[i], ref) << "n = " << n << ", i = " << i;
+        }
+        COMPARE(out[n], T(7));
+
+        // in place, with init
+        std::vector<T> data = in;
+        Vc::inclusive_scan(data.data(), data.data() + n, data.data(), std::plus<T>(), T(5));
+        ref = 5;
+        for (std::size_t i = 0; i < n; ++i) {
+            ref = T(ref + in[i]);
+            COMPARE(data[i], ref) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, exclusiveSum, ScanTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {0u, 1u, 2u, 3u, 17u, 64u, 1000u, 1001u}) {
+        const auto in = scan_input<T>(n);
+        std::vector<T> out(n);
+        Vc::exclusive_scan(in.begin(), in.end(), out.begin(), T(3));
+        T ref = 3;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], ref) << "n = " << n << ", i = " << i;
+            ref = T(ref + in[i]);
+        }
+
+        std::vector<T> data = in;
+        Vc::exclusive_scan(data.begin(), data.end(), data.begin(), T(0));
+        ref = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(data[i], ref) << "n = " << n << ", i = " << i;
+            ref = T(ref + in[i]);
+        }
+    }
+}
+
+TEST_TYPES(V, customOperations, ScanTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    const std::size_t n = 333;
+    std::vector<T> in(n), out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        in[i] = T((i * 7919u) % 101);
+    }
+
+    Vc::inclusive_scan(in.begin(), in.end(), out.begin(), Vc::Maximum());
+    T ref = in[0];
+    for (std::size_t i = 0; i < n; ++i) {
+        ref = std::max(ref, in[i]);
+        COMPARE(out[i], ref) << "i = " << i;
+    }
+
+    Vc::exclusive_scan(in.begin(), in.end(), out.begin(), T(50), Vc::Minimum());
+    ref = 50;
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(out[i], ref) << "i = " << i;
+        ref = std::min(ref, in[i]);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        in[i] = i % 7 == 3 ? T(2) : T(1);
+    }
+    Vc::inclusive_scan(in.begin(), in.end(), out.begin(), std::multiplies<T>());
+    ref = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        ref = T(ref * in[i]);
+        COMPARE(out[i], ref) << "i = " << i;
+    }
+}
+
+TEST_TYPES(V, statefulOperations, ScanTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {1u, 17u, 1000u, 1000000u}) {
+        const auto in = scan_input<T>(n);
+        std::vector<T> out(n);
+
+        // sums saturating at a captured limit
+        const T limit = 60;
+        const auto saturatingPlus = [limit](auto a, auto b) {
+            return Vc::Minimum()(decltype(a)(a + b), decltype(a)(limit));
+        };
+        Vc::inclusive_scan(in.begin(), in.end(), out.begin(), saturatingPlus);
+        T ref = in[0];
+        COMPARE(out[0], ref);
+        for (std::size_t i = 1; i < n; ++i) {
+            ref = std::min(T(ref + in[i]), limit);
+            COMPARE(out[i], ref) << "n = " << n << ", i = " << i;
+        }
+        Vc::exclusive_scan(Vc::Parallel, in.begin(), in.end(), out.begin(), T(1),
+                           saturatingPlus);
+        ref = 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], ref) << "n = " << n << ", i = " << i;
+            ref = std::min(T(ref + in[i]), limit);
+        }
+
+        const MaximumWithFloor<T> op = {T(1)};
+        Vc::inclusive_scan(in.begin(), in.end(), out.begin(), op, T(0));
+        ref = 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            ref = std::max(ref, in[i]);
+            COMPARE(out[i], ref) << "n = " << n << ", i = " << i;
+        }
+        Vc::inclusive_scan(Vc::Parallel, in.begin(), in.end(), out.begin(), op);
+        COMPARE(out[0], in[0]);
+        ref = 1;
+        for (std::size_t i = 1; i < n; ++i) {
+            ref = std::max(ref, in[i]);
+            COMPARE(out[i], ref) << "n = " << n << ", i = " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, parallelScan, ScanTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {0u, 100u, 300001u, 1000000u}) {
+        const auto in = scan_input<T>(n);
+        std::vector<T> out(n);
+        Vc::inclusive_scan(Vc::Parallel, in.begin(), in.end(), out.begin());
+        T ref = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            ref = T(ref + in[i]);
+            COMPARE(out[i], ref) << "n = " << n << ", i = " << i;
+        }
+
+        std::vector<T> data = in;
+        Vc::exclusive_scan(Vc::Parallel(2), data.begin(), data.end(), data.begin(), T(1),
+                           Vc::Maximum());
+        ref = 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(data[i], ref) << "n = " << n << ", i = " << i;
+            ref = std::max(ref, in[i]);
+        }
+    }
+}
+
+TEST_TYPES(V, unqualifiedCalls, ScanTypes)  // {{{1
+{
+    // since C++17 std::inclusive_scan and std::exclusive_scan are found via ADL as well,
+    // and must not make these calls ambiguous
+    using namespace Vc;
+    using T = typename V::EntryType;
+    const auto in = scan_input<T>(100);
+    std::vector<T> out(100);
+    VERIFY(inclusive_scan(in.begin(), in.end(), out.begin()) == out.end());
+    VERIFY(exclusive_scan(in.begin(), in.end(), out.begin(), T(1), Vc::Maximum()) ==
+           out.end());
+    VERIFY(exclusive_scan(&in[0], &in[0] + 100, &out[0], T(2)) == &out[0] + 100);
+    T ref = 2;
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        COMPARE(out[i], ref) << "i = " << i;
+        ref = T(ref + in[i]);
+    }
+}
+
+// only contiguous ranges are accepted {{{1
+template <typename It, typename = decltype(Vc::inclusive_scan(
+                           std::declval<It>(), std::declval<It>(), std::declval<It>()))>
+static std::true_type acceptsInclusiveScan(int);
+template <typename It> static std::false_type acceptsInclusiveScan(...);
+
+static_assert(decltype(acceptsInclusiveScan<int *>(0))::value, "");
+static_assert(decltype(acceptsInclusiveScan<std::vector<int>::iterator>(0))::value, "");
+static_assert(!decltype(acceptsInclusiveScan<std::deque<int>::iterator>(0))::value, "");
+
+// vim: foldmethod=marker
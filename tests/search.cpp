@@ -0,0 +1,181 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using SearchTypes =
+    vir::concat<AllVectors, vir::Typelist<llong_v, ullong_v, schar_v, uchar_v>>;
+
+// forAllSubranges {{{1
+// Calls f(first, last) for subranges of random data with different lengths and
+// alignments.
+template <typename T, typename F> static void forAllSubranges(F &&f)
+{
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(0, 100);
+    std::vector<T, Vc::Allocator<T>> data(5000);
+    for (auto &x : data) {
+        x = T(dist(rng));
+    }
+    for (std::size_t offset : {0, 1, 3, 7, 8, 31}) {
+        for (std::size_t size : {0, 1, 2, 5, 15, 16, 17, 33, 64, 100, 1000, 4500}) {
+            f(data.data() + offset, data.data() + offset + size);
+        }
+    }
+}
+
+// find {{{1
+TEST_TYPES(V, findValue, SearchTypes)
+{
+    using T = typename V::EntryType;
+    forAllSubranges<T>([](const T *first, const T *last) {
+        for (int value : {0, 1, 50, 100, 101}) {
+            COMPARE(Vc::find(first, last, T(value)), std::find(first, last, T(value)))
+                << "size: " << last - first << ", value: " << value;
+        }
+        COMPARE(Vc::find_if(first, last, [](V x) { return x > V(T(90)); }),
+                std::find_if(first, last, [](T x) { return x > T(90); }))
+            << "size: " << last - first;
+    });
+
+    std::vector<T> v = {T(1), T(2), T(3)};
+    COMPARE(Vc::find(v.begin(), v.end(), T(2)) - v.begin(), 1);
+    COMPARE(Vc::find(v.begin(), v.end(), T(4)) - v.begin(), 3);
+}
+
+// count {{{1
+TEST_TYPES(V, countValue, SearchTypes)
+{
+    using T = typename V::EntryType;
+    forAllSubranges<T>([](const T *first, const T *last) {
+        for (int value : {0, 50, 101}) {
+            COMPARE(Vc::count(first, last, T(value)), std::count(first, last, T(value)))
+                << "size: " << last - first << ", value: " << value;
+        }
+        COMPARE(Vc::count_if(first, last, [](V x) { return x < V(T(30)); }),
+                std::count_if(first, last, [](T x) { return x < T(30); }))
+            << "size: " << last - first;
+    });
+}
+
+// minmax_element {{{1
+TEST_TYPES(V, minmaxElement, SearchTypes)
+{
+    using T = typename V::EntryType;
+    forAllSubranges<T>([](const T *first, const T *last) {
+        const auto ref = std::minmax_element(first, last);
+        const auto r = Vc::minmax_element(first, last);
+        COMPARE(r.first, ref.first) << "size: " << last - first;
+        COMPARE(r.second, ref.second) << "size: " << last - first;
+        if (first != last) {
+            COMPARE(Vc::argmin(first, last), std::size_t(ref.first - first));
+            COMPARE(Vc::argmax(first, last),
+                    std::size_t(std::max_element(first, last) - first));
+        } else {
+            COMPARE(Vc::argmin(first, last), 0u);
+            COMPARE(Vc::argmax(first, last), 0u);
+        }
+    });
+
+    // the extremum is in a later block than the first occurrence of an equal value
+    std::vector<T> v(3000, T(5));
+    v[10] = T(1);
+    v[2500] = T(1);
+    v[20] = T(9);
+    v[2900] = T(9);
+    const auto r = Vc::minmax_element(v.begin(), v.end());
+    COMPARE(r.first - v.begin(), 10);
+    COMPARE(r.second - v.begin(), 2900);
+    COMPARE(Vc::argmax(v.begin(), v.end()), 20u);
+}
+
+// unqualified calls {{{1
+// with `using namespace Vc` the calls below also find the std algorithms via ADL
+TEST_TYPES(V, unqualifiedCalls, SearchTypes)
+{
+    using T = typename V::EntryType;
+    std::vector<T, Vc::Allocator<T>> v(100, T(3));
+    v[17] = T(1);
+    v[60] = T(7);
+    const auto isSmall = [](const V &x) { return x < V(T(2)); };
+    COMPARE(find(v.begin(), v.end(), T(7)) - v.begin(), 60);
+    COMPARE(find_if(v.begin(), v.end(), isSmall) - v.begin(), 17);
+    COMPARE(count(v.begin(), v.end(), T(3)), 98);
+    COMPARE(count_if(v.begin(), v.end(), isSmall), 1);
+    const std::vector<T> cv(v.begin(), v.end());
+    const auto r = minmax_element(cv.begin(), cv.end());
+    COMPARE(r.first - cv.begin(), 17);
+    COMPARE(r.second - cv.begin(), 60);
+}
+
+// only contiguous ranges are accepted {{{1
+template <typename It, typename = decltype(Vc::find(std::declval<It>(), std::declval<It>(),
+                                                    std::declval<int>()))>
+static std::true_type acceptsFind(int);
+template <typename It> static std::false_type acceptsFind(...);
+
+static_assert(decltype(acceptsFind<std::vector<int>::iterator>(0))::value, "");
+static_assert(!decltype(acceptsFind<std::deque<int>::iterator>(0))::value, "");
+static_assert(!decltype(acceptsFind<std::list<int>::iterator>(0))::value, "");
+
+// lower_bound {{{1
+TEST_TYPES(V, lowerBound, SearchTypes)
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> dist(0, 100);
+    for (std::size_t size : {0, 1, 2, 3, 7, 16, 100, 1000}) {
+        std::vector<T> sorted(size);
+        for (auto &x : sorted) {
+            x = T(dist(rng));
+        }
+        std::sort(sorted.begin(), sorted.end());
+        for (int n = 0; n < 20; ++n) {
+            const V keys = V::generate([&](int) { return T(dist(rng)); });
+            const auto idx =
+                Vc::lower_bound(sorted.data(), sorted.data() + size, keys);
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                COMPARE(std::size_t(idx[i]),
+                        std::size_t(std::lower_bound(sorted.begin(), sorted.end(),
+                                                     T(keys[i])) -
+                                    sorted.begin()))
+                    << "size: " << size << ", key: " << keys[i];
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
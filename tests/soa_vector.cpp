@@ -0,0 +1,154 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/simdize>
+
+template <typename T> struct PointTemplate {
+    T x, y, z;
+    Vc_SIMDIZE_INTERFACE((x, y, z));
+};
+using Point = PointTemplate<float>;
+using PointV = Vc::simdize<Point>;
+
+static Point makePoint(std::size_t i)
+{
+    return {float(i), float(i) + 0.5f, -float(i)};
+}
+
+TEST(push_back_and_scalar_access)
+{
+    Vc::soa_vector<Point> v;
+    VERIFY(v.empty());
+    COMPARE(v.vectors_count(), 0u);
+    const std::size_t n = 3 * PointV::size() + 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        v.push_back(makePoint(i));
+    }
+    COMPARE(v.size(), n);
+    COMPARE(v.vectors_count(), 4u);
+    VERIFY(v.capacity() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point p = v[i];
+        COMPARE(p.x, float(i));
+        COMPARE(p.y, float(i) + 0.5f);
+        COMPARE(p.z, -float(i));
+        COMPARE(v.data<1>()[i], float(i) + 0.5f);
+    }
+    v[1] = Point{7.f, 8.f, 9.f};
+    v[2] = v[1];
+    const auto &cv = v;
+    COMPARE(cv[2].x, 7.f);
+    COMPARE(cv[2].y, 8.f);
+    COMPARE(cv[2].z, 9.f);
+    v.pop_back();
+    COMPARE(v.size(), n - 1);
+    COMPARE(v.vectors_count(), 3u);
+    v.clear();
+    VERIFY(v.empty());
+}
+
+TEST(alignment)
+{
+    Vc::soa_vector<Point> v(5);
+    COMPARE(reinterpret_cast<std::uintptr_t>(v.data<0>()) % Vc::float_v::MemoryAlignment, 0u);
+    COMPARE(reinterpret_cast<std::uintptr_t>(v.data<1>()) % Vc::float_v::MemoryAlignment, 0u);
+    COMPARE(reinterpret_cast<std::uintptr_t>(v.data<2>()) % Vc::float_v::MemoryAlignment, 0u);
+}
+
+TEST(vector_access)
+{
+    const std::size_t n = 2 * PointV::size() + 3;
+    Vc::soa_vector<Point> v;
+    for (std::size_t i = 0; i < n; ++i) {
+        v.push_back(makePoint(i));
+    }
+    for (std::size_t i = 0; i < v.vectors_count(); ++i) {
+        PointV p = v.vector(i);
+        for (std::size_t j = 0; j < PointV::size() && i * PointV::size() + j < n; ++j) {
+            const Point ref = makePoint(i * PointV::size() + j);
+            COMPARE(p.x[j], ref.x);
+            COMPARE(p.y[j], ref.y);
+            COMPARE(p.z[j], ref.z);
+        }
+        p.x *= 2.f;
+        p.z = p.x + p.y;
+        v.vector(i) = p;
+    }
+    COMPARE(v.size(), n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point p = v[i];
+        COMPARE(p.x, 2.f * i);
+        COMPARE(p.y, float(i) + 0.5f);
+        COMPARE(p.z, 3.f * i + 0.5f);
+    }
+}
+
+TEST(resize)
+{
+    Vc::soa_vector<Point> v(3, Point{1.f, 2.f, 3.f});
+    COMPARE(v.size(), 3u);
+    v.push_back(Point{4.f, 5.f, 6.f});
+    v.resize(1);
+    COMPARE(v.size(), 1u);
+    v.resize(4);
+    COMPARE(v.size(), 4u);
+    for (std::size_t i = 1; i < 4; ++i) {
+        const Point p = v[i];
+        COMPARE(p.x, 0.f);
+        COMPARE(p.y, 0.f);
+        COMPARE(p.z, 0.f);
+    }
+    v.resize(2 * PointV::size() + 5, Point{-1.f, -2.f, -3.f});
+    COMPARE(v.size(), 2 * PointV::size() + 5);
+    COMPARE(Point(v[0]).x, 1.f);
+    COMPARE(Point(v[3]).x, 0.f);
+    for (std::size_t i = 4; i < v.size(); ++i) {
+        COMPARE(Point(v[i]).y, -2.f);
+    }
+}
+
+TEST(mixed_member_types)
+{
+    using T = std::tuple<float, double, int>;
+    using V = Vc::simdize<T>;
+    Vc::soa_vector<T> v = {T{1.f, 2., 3}, T{4.f, 5., 6}, T{7.f, 8., 9}};
+    COMPARE(v.size(), 3u);
+    COMPARE(v.vectors_count(), (3u + V::size() - 1) / V::size());
+    for (std::size_t i = 0; i < v.vectors_count(); ++i) {
+        V x = v.vector(i);
+        std::get<1>(x) += 1.;
+        std::get<2>(x) *= 2;
+        v.vector(i) = x;
+    }
+    for (std::size_t i = 0; i < 3; ++i) {
+        const T t = v[i];
+        COMPARE(std::get<0>(t), float(3 * i + 1));
+        COMPARE(std::get<1>(t), double(3 * i + 3));
+        COMPARE(std::get<2>(t), int(6 * i + 6));
+    }
+}
@@ -0,0 +1,153 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+using SortTypes = vir::concat<AllVectors, vir::Typelist<Vc::schar_v, Vc::uchar_v,
+                                                        Vc::llong_v, Vc::ullong_v>>;
+
+template <typename T> std::vector<T> makeInput(std::size_t n, int kind, std::mt19937 &rng)
+{
+    std::vector<T> data(n);
+    std::uniform_int_distribution<int> dist(-30000, 30000);
+    std::uniform_int_distribution<int> few(0, 7);
+    for (std::size_t i = 0; i < n; ++i) {
+        switch (kind) {
+        case 0: data[i] = T(dist(rng)); break;           // random
+        case 1: data[i] = T(few(rng)); break;            // many duplicates
+        case 2: data[i] = T(5); break;                   // all equal
+        case 3: data[i] = T(i % 30000); break;           // sorted
+        default: data[i] = T((n - i) % 30000); break;    // reversed
+        }
+    }
+    if (std::is_signed<T>::value == false) {
+        for (auto &x : data) {
+            x = T(std::abs(double(x)));
+        }
+    }
+    return data;
+}
+
+static const std::size_t sizes[] = {0,  1,   2,   3,    7,    8,     9,     15,    16,
+                                    17, 31, 100, 1000, 4097, 10007, 65536, 100003};
+
+TEST_TYPES(V, sortRange, SortTypes)
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(1);
+    for (int kind = 0; kind < 5; ++kind) {
+        for (std::size_t n : sizes) {
+            std::vector<T> data = makeInput<T>(n, kind, rng);
+            std::vector<T> ref = data;
+            std::sort(ref.begin(), ref.end());
+            Vc::sort(data.begin(), data.end());
+            COMPARE(data == ref, true) << "n = " << n << ", kind = " << kind;
+        }
+    }
+}
+
+TEST_TYPES(V, sortKeyValue, SortTypes)
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(2);
+    for (int kind = 0; kind < 5; ++kind) {
+        for (std::size_t n : sizes) {
+            const std::vector<T> input = makeInput<T>(n, kind, rng);
+            std::vector<T> keys = input;
+            std::vector<std::size_t> values(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                values[i] = i;
+            }
+            Vc::sort_by_key(keys.begin(), keys.end(), values.begin());
+            VERIFY(std::is_sorted(keys.begin(), keys.end())) << "n = " << n;
+            std::vector<bool> seen(n, false);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(keys[i], input[values[i]]) << "n = " << n << ", i = " << i;
+                VERIFY(!seen[values[i]]);
+                seen[values[i]] = true;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, sortMemory, SortTypes)
+{
+    using T = typename V::EntryType;
+    Vc::Memory<V, 1003> keys;
+    Vc::Memory<V> values(1003);
+    for (std::size_t i = 0; i < keys.entriesCount(); ++i) {
+        keys[i] = T((i * 7919) % 1000);
+        values[i] = keys[i];
+    }
+    Vc::sort_by_key(keys, values);
+    for (std::size_t i = 0; i < keys.entriesCount(); ++i) {
+        COMPARE(values[i], keys[i]);
+        if (i > 0) {
+            VERIFY(!(keys[i] < keys[i - 1])) << i;
+        }
+    }
+    Vc::sort(values);
+    for (std::size_t i = 0; i < values.entriesCount(); ++i) {
+        COMPARE(values[i], keys[i]);
+    }
+}
+
+TEST(unqualifiedSortWithComparator)
+{
+    // ADL finds namespace Vc, which must not hijack std::sort(first, last, comp)
+    using std::sort;
+    Vc::float_v data[4] = {3.f, 1.f, 4.f, 2.f};
+    sort(data, data + 4,
+         [](const Vc::float_v &a, const Vc::float_v &b) { return a[0] > b[0]; });
+    COMPARE(data[0][0], 4.f);
+    COMPARE(data[3][0], 1.f);
+}
+
+TEST(unqualifiedSort)
+{
+    // with both overload sets visible, std::vector iterators resolve to Vc::sort and
+    // other iterators to std::sort
+    using namespace Vc;
+    using std::sort;
+    std::vector<float> data = {3.f, 1.f, 4.f, 1.f, 5.f, 9.f, 2.f, 6.f, 5.f, 3.f};
+    sort(data.begin(), data.end());
+    COMPARE(std::is_sorted(data.begin(), data.end()), true);
+    std::deque<float> d(data.rbegin(), data.rend());
+    sort(d.begin(), d.end());
+    COMPARE(std::is_sorted(d.begin(), d.end()), true);
+    std::vector<int> keys = {3, 1, 2};
+    std::vector<float> values = {30.f, 10.f, 20.f};
+    sort_by_key(keys.begin(), keys.end(), values.begin());
+    COMPARE(values[0], 10.f);
+    COMPARE(values[2], 30.f);
+}
@@ -70,6 +70,35 @@ TEST_TYPES(V, stdVectorAlignment, AllVectors)
     }
 }
 
+template <typename T, typename Policy> static void testAllocationPolicy(std::size_t alignment)
+{
+    for (std::size_t n : {1u, 100u, 3000000u}) {
+        std::vector<T, Vc::Allocator<T, Policy>> v(n, T(1));
+        COMPARE(reinterpret_cast<std::uintptr_t>(v.data()) & (alignment - 1), 0u)
+            << "n = " << n;
+        COMPARE(v.back(), T(1));
+        v.back() = T(2);
+        v.push_back(T(3));
+        COMPARE(v[n - 1], T(2));
+        COMPARE(v[n], T(3));
+    }
+}
+
+TEST_TYPES(V, allocationPolicies, AllVectors)
+{
+    using T = typename V::EntryType;
+    testAllocationPolicy<T, Vc::AllocationPolicy<Vc::PageSize::Huge>>(2 << 20);
+    testAllocationPolicy<T, Vc::AllocationPolicy<Vc::PageSize::ExplicitHuge,
+                                                 Vc::PagePlacement::Interleave>>(2 << 20);
+    testAllocationPolicy<T, Vc::AllocationPolicy<Vc::PageSize::Default,
+                                                 Vc::PagePlacement::ParallelFirstTouch>>(
+        4096);
+    testAllocationPolicy<T, Vc::AllocationPolicy<Vc::PageSize::Huge,
+                                                 Vc::PagePlacement::Local>>(2 << 20);
+    testAllocationPolicy<V, Vc::AllocationPolicy<Vc::PageSize::Default,
+                                                 Vc::PagePlacement::Interleave>>(4096);
+}
+
 template <typename V, typename Container, std::size_t... Indexes>
 void listInitializationImpl(Vc::index_sequence<Indexes...>)
 {
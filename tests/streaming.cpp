@@ -0,0 +1,180 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <list>
+#include <vector>
+
+using StreamingTypes = vir::concat<AllVectors, vir::Typelist<Vc::schar_v, Vc::llong_v>>;
+using MemoryTypes = vir::Typelist<Vc::float_v, Vc::int_v>;
+
+// runs f once with cached stores and once with non-temporal stores
+template <typename F> static void for_each_store_mode(F &&f)
+{
+    const std::size_t threshold = Vc::streamingThreshold();
+    for (std::size_t t : {std::size_t(-1), std::size_t(0)}) {
+        Vc::setStreamingThreshold(t);
+        f(t == 0);
+    }
+    Vc::setStreamingThreshold(threshold);
+}
+
+TEST(streamingThresholdDefault)  // {{{1
+{
+    VERIFY(Vc::streamingThreshold() > 0);
+}
+
+TEST_TYPES(V, bulkCopy, StreamingTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for_each_store_mode([](bool streaming) {
+        for (std::size_t offset : {0u, 1u, 3u}) {
+            for (std::size_t n : {0u, 1u, 5u, 64u, 1000u, 1003u}) {
+                std::vector<T> in(n), out(n + offset + 1, T(9));
+                for (std::size_t i = 0; i < n; ++i) {
+                    in[i] = T(i % 100);
+                }
+                const auto end = Vc::copy(in.begin(), in.end(), out.begin() + offset);
+                VERIFY(end == out.begin() + offset + n);
+                for (std::size_t i = 0; i < out.size(); ++i) {
+                    const bool inRange = i >= offset && i < offset + n;
+                    COMPARE(out[i], inRange ? in[i - offset] : T(9))
+                        << "streaming = " << streaming << ", offset = " << offset
+                        << ", n = " << n << ", i = " << i;
+                }
+            }
+        }
+    });
+}
+
+TEST_TYPES(V, bulkFill, StreamingTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for_each_store_mode([](bool streaming) {
+        for (std::size_t offset : {0u, 1u, 3u}) {
+            for (std::size_t n : {0u, 1u, 5u, 64u, 1000u, 1003u}) {
+                std::vector<T> out(n + offset + 1, T(9));
+                Vc::fill(out.begin() + offset, out.begin() + offset + n, T(4));
+                for (std::size_t i = 0; i < out.size(); ++i) {
+                    const bool inRange = i >= offset && i < offset + n;
+                    COMPARE(out[i], inRange ? T(4) : T(9))
+                        << "streaming = " << streaming << ", offset = " << offset
+                        << ", n = " << n << ", i = " << i;
+                }
+            }
+        }
+    });
+}
+
+TEST_TYPES(V, bulkTransform, StreamingTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for_each_store_mode([](bool streaming) {
+        for (std::size_t n : {0u, 1u, 5u, 64u, 1000u, 1003u}) {
+            std::vector<T> a(n), b(n), out(n + 1, T(9));
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i] = T(i % 10 + 1);
+                b[i] = T(i % 7 + 1);
+            }
+            // integer division must not see zero divisors in the padding
+            Vc::transform(a.begin(), a.end(), out.begin(), [](V x) { return V(T(60)) / x; });
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i], T(T(60) / a[i]))
+                    << "streaming = " << streaming << ", n = " << n << ", i = " << i;
+            }
+            COMPARE(out[n], T(9));
+            Vc::transform(a.begin(), a.end(), b.begin(), a.begin(),
+                          [](V x, V y) { return x * y + x; });
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(a[i], T((i % 10 + 1) * (i % 7 + 1) + (i % 10 + 1)))
+                    << "streaming = " << streaming << ", n = " << n << ", i = " << i;
+            }
+        }
+    });
+}
+
+TEST_TYPES(V, bulkMemory, MemoryTypes)  // {{{1
+{
+    using T = typename V::EntryType;
+    for_each_store_mode([](bool streaming) {
+        Vc::Memory<V> a(1001), b(1001);
+        Vc::fill(a, T(3));
+        for (std::size_t i = 0; i < a.entriesCount(); ++i) {
+            COMPARE(a[i], T(3)) << "streaming = " << streaming << ", i = " << i;
+        }
+        Vc::transform(a, b, [](V x) { return x + T(1); });
+        for (std::size_t i = 0; i < b.entriesCount(); ++i) {
+            COMPARE(b[i], T(4)) << "streaming = " << streaming << ", i = " << i;
+        }
+        Vc::copy(b, a);
+        for (std::size_t i = 0; i < a.entriesCount(); ++i) {
+            COMPARE(a[i], T(4)) << "streaming = " << streaming << ", i = " << i;
+        }
+
+        Vc::Memory<V, 3, 13> m, m2;
+        Vc::fill(m, T(2));
+        Vc::copy(m, m2);
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t i = 0; i < 13; ++i) {
+                COMPARE(m2[r][i], T(2)) << "streaming = " << streaming;
+            }
+        }
+    });
+}
+
+TEST_TYPES(V, unqualifiedCalls, MemoryTypes)  // {{{1
+{
+    // std::copy, std::fill, and std::transform are found via ADL as well, and must not
+    // make these calls ambiguous
+    using namespace Vc;
+    using T = typename V::EntryType;
+    std::vector<T> a(101), b(101);
+    fill(a.begin(), a.end(), T(2));
+    VERIFY(copy(a.begin(), a.end(), b.begin()) == b.end());
+    VERIFY(transform(b.cbegin(), b.cend(), a.begin(), [](V x) { return x + T(1); }) ==
+           a.end());
+    VERIFY(transform(a.begin(), a.end(), b.begin(), b.begin(),
+                     [](V x, V y) { return x * y; }) == b.end());
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        COMPARE(a[i], T(3)) << "i = " << i;
+        COMPARE(b[i], T(6)) << "i = " << i;
+    }
+    fill(&a[0], &a[0] + a.size(), T(5));
+    VERIFY(copy(&a[1], &a[0] + a.size(), &b[0]) == &b[100]);
+    COMPARE(b[99], T(5));
+    COMPARE(b[100], T(6));
+
+    // non-contiguous ranges use the std algorithms
+    std::list<T> l(3);
+    fill(l.begin(), l.end(), T(1));
+    VERIFY(copy(l.begin(), l.end(), a.begin()) == a.begin() + 3);
+    COMPARE(a[2], T(1));
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,332 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2018 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+/*includes {{{*/
+#include "unittest.h"
+#include <cmath>
+#include <limits>
+#include <random>
+/*}}}*/
+using namespace Vc;
+
+// fix isfinite and isnan {{{1
+#ifdef isfinite
+#undef isfinite
+#endif
+#ifdef isnan
+#undef isnan
+#endif
+
+// helpers {{{1
+template <class V, class F> V reference(const V &x, F &&f)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int i) { return static_cast<T>(f(static_cast<long double>(x[i]))); });
+}
+template <class V, class F> V reference(const V &x, const V &y, F &&f)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int i) {
+        return static_cast<T>(
+            f(static_cast<long double>(x[i]), static_cast<long double>(y[i])));
+    });
+}
+
+// uniform in [lo, hi)
+template <class V> V uniform(std::mt19937 &rng, double lo, double hi)
+{
+    using T = typename V::EntryType;
+    std::uniform_real_distribution<double> dist(lo, hi);
+    return V::generate([&](int) { return static_cast<T>(dist(rng)); });
+}
+// log-uniform positive values with exponents in [minExp, maxExp)
+template <class V> V logUniform(std::mt19937 &rng, int minExp, int maxExp)
+{
+    using T = typename V::EntryType;
+    std::uniform_real_distribution<T> mantissa(T(1), T(2));
+    std::uniform_int_distribution<int> exponent(minExp, maxExp - 1);
+    return V::generate([&](int) { return std::ldexp(mantissa(rng), exponent(rng)); });
+}
+
+// ulpDiffToReference measures subnormal results in units of a normal ULP, which makes a
+// correctly rounded subnormal differ by a huge amount. Results in the subnormal range are
+// therefore verified to be within one denorm_min.
+template <class V> void verifySubnormal(const V &val, const V &ref)
+{
+    using L = std::numeric_limits<typename V::EntryType>;
+    VERIFY(all_of(abs(val - ref) <= V(L::denorm_min()))) << val << " vs. " << ref;
+}
+
+constexpr int Iterations = 20000;
+
+// exp {{{1
+TEST_TYPES(V, testExp, RealTypes)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937 rng;
+    const double maxLog = std::log(double(L::max()));
+    const double minLog = std::log(double(L::denorm_min()));
+    const double minNormalLog = std::log(double(L::min()));
+    for (int i = 0; i < Iterations / int(V::Size); ++i) {
+        setFuzzyness<T>(1);
+        V x = uniform<V>(rng, minNormalLog, maxLog);
+        FUZZY_COMPARE(exp(x, PreciseMath), reference(x, [](long double a) { return std::exp(a); }))
+            << "x = " << x;
+        x = uniform<V>(rng, minLog, minNormalLog);
+        verifySubnormal(exp(x, PreciseMath),
+                        reference(x, [](long double a) { return std::exp(a); }));
+        x = uniform<V>(rng, -1, 1);
+        FUZZY_COMPARE(exp(x, PreciseMath), reference(x, [](long double a) { return std::exp(a); }))
+            << "x = " << x;
+        setFuzzyness<T>(4);
+        x = uniform<V>(rng, minNormalLog, maxLog);
+        FUZZY_COMPARE(exp(x, FastMath), reference(x, [](long double a) { return std::exp(a); }))
+            << "x = " << x;
+    }
+    COMPARE(exp(V(0), PreciseMath), V(1));
+    COMPARE(exp(V(0), FastMath), V(1));
+    COMPARE(exp(V(L::infinity()), PreciseMath), V(L::infinity()));
+    COMPARE(exp(V(-L::infinity()), PreciseMath), V(0));
+    COMPARE(exp(V(T(maxLog * 1.01)), PreciseMath), V(L::infinity()));
+    COMPARE(exp(V(T(minLog * 1.01)), PreciseMath), V(0));
+    COMPARE(exp(V(L::infinity()), FastMath), V(L::infinity()));
+    COMPARE(exp(V(-L::infinity()), FastMath), V(0));
+    VERIFY(all_of(isnan(exp(V(L::quiet_NaN()), PreciseMath))));
+    VERIFY(all_of(isnan(exp(V(L::quiet_NaN()), FastMath))));
+}
+
+// exp2 {{{1
+TEST_TYPES(V, testExp2, RealTypes)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937 rng;
+    for (int i = 0; i < Iterations / int(V::Size); ++i) {
+        setFuzzyness<T>(1);
+        V x = uniform<V>(rng, L::min_exponent - 1, L::max_exponent);
+        FUZZY_COMPARE(exp2(x), reference(x, [](long double a) { return std::exp2(a); }))
+            << "x = " << x;
+        x = uniform<V>(rng, L::min_exponent - L::digits, L::min_exponent - 1);
+        verifySubnormal(exp2(x), reference(x, [](long double a) { return std::exp2(a); }));
+        setFuzzyness<T>(4);
+        x = uniform<V>(rng, L::min_exponent - 1, L::max_exponent);
+        FUZZY_COMPARE(exp2(x, FastMath), reference(x, [](long double a) { return std::exp2(a); }))
+            << "x = " << x;
+    }
+    // integral arguments are exact, also for subnormal results
+    for (int e = L::min_exponent - L::digits; e < L::max_exponent; ++e) {
+        COMPARE(exp2(V(T(e))), V(std::ldexp(T(1), e))) << "e = " << e;
+    }
+    COMPARE(exp2(V(T(L::max_exponent))), V(L::infinity()));
+    COMPARE(exp2(V(-L::infinity())), V(0));
+    COMPARE(exp2(V(T(L::max_exponent)), FastMath), V(L::infinity()));
+    VERIFY(all_of(isnan(exp2(V(L::quiet_NaN())))));
+}
+
+// expm1 {{{1
+TEST_TYPES(V, testExpm1, RealTypes)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937 rng;
+    setFuzzyness<T>(1);
+    const double maxLog = std::log(double(L::max()));
+    for (int i = 0; i < Iterations / int(V::Size); ++i) {
+        V x = uniform<V>(rng, -50, maxLog);
+        FUZZY_COMPARE(expm1(x), reference(x, [](long double a) { return std::expm1(a); }))
+            << "x = " << x;
+        x = uniform<V>(rng, -1, 1) * logUniform<V>(rng, L::min_exponent, 0);
+        FUZZY_COMPARE(expm1(x), reference(x, [](long double a) { return std::expm1(a); }))
+            << "x = " << x;
+    }
+    COMPARE(expm1(V(0)), V(0));
+    COMPARE(expm1(V(L::denorm_min())), V(L::denorm_min()));
+    COMPARE(expm1(V(L::infinity())), V(L::infinity()));
+    COMPARE(expm1(V(-L::infinity())), V(-1));
+    VERIFY(all_of(isnan(expm1(V(L::quiet_NaN())))));
+}
+
+// log {{{1
+TEST_TYPES(V, testLog, RealTypes)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937 rng;
+    for (int i = 0; i < Iterations / int(V::Size); ++i) {
+        setFuzzyness<T>(1);
+        V x = logUniform<V>(rng, L::min_exponent - L::digits, L::max_exponent);
+        FUZZY_COMPARE(log(x, PreciseMath), reference(x, [](long double a) { return std::log(a); }))
+            << "x = " << x;
+        FUZZY_COMPARE(log2(x, PreciseMath),
+                      reference(x, [](long double a) { return std::log2(a); }))
+            << "x = " << x;
+        x = uniform<V>(rng, 0.5, 2);
+        FUZZY_COMPARE(log(x, PreciseMath), reference(x, [](long double a) { return std::log(a); }))
+            << "x = " << x;
+        FUZZY_COMPARE(log2(x, PreciseMath),
+                      reference(x, [](long double a) { return std::log2(a); }))
+            << "x = " << x;
+        setFuzzyness<T>(4);
+        FUZZY_COMPARE(log(x, FastMath), reference(x, [](long double a) { return std::log(a); }))
+            << "x = " << x;
+        FUZZY_COMPARE(log2(x, FastMath), reference(x, [](long double a) { return std::log2(a); }))
+            << "x = " << x;
+        x = logUniform<V>(rng, L::min_exponent, L::max_exponent);
+        FUZZY_COMPARE(log(x, FastMath), reference(x, [](long double a) { return std::log(a); }))
+            << "x = " << x;
+        FUZZY_COMPARE(log2(x, FastMath), reference(x, [](long double a) { return std::log2(a); }))
+            << "x = " << x;
+    }
+    for (int e = L::min_exponent - L::digits; e < L::max_exponent; ++e) {
+        COMPARE(log2(V(std::ldexp(T(1), e)), PreciseMath), V(T(e))) << "e = " << e;
+    }
+    COMPARE(log(V(1), PreciseMath), V(0));
+    COMPARE(log(V(1), FastMath), V(0));
+    COMPARE(log(V(0), PreciseMath), V(-L::infinity()));
+    COMPARE(log(V(0), FastMath), V(-L::infinity()));
+    COMPARE(log2(V(0), PreciseMath), V(-L::infinity()));
+    COMPARE(log(V(L::infinity()), PreciseMath), V(L::infinity()));
+    COMPARE(log2(V(L::infinity()), FastMath), V(L::infinity()));
+    VERIFY(all_of(isnan(log(V(-1), PreciseMath))));
+    VERIFY(all_of(isnan(log(V(-1), FastMath))));
+    VERIFY(all_of(isnan(log2(V(L::quiet_NaN()), PreciseMath))));
+}
+
+// log1p {{{1
+TEST_TYPES(V, testLog1p, RealTypes)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937 rng;
+    setFuzzyness<T>(1);
+    for (int i = 0; i < Iterations / int(V::Size); ++i) {
+        V x = uniform<V>(rng, -1, 1);
+        FUZZY_COMPARE(log1p(x), reference(x, [](long double a) { return std::log1p(a); }))
+            << "x = " << x;
+        x = logUniform<V>(rng, 0, L::max_exponent);
+        FUZZY_COMPARE(log1p(x), reference(x, [](long double a) { return std::log1p(a); }))
+            << "x = " << x;
+        x = uniform<V>(rng, -1, 1) * logUniform<V>(rng, L::min_exponent, 0);
+        FUZZY_COMPARE(log1p(x), reference(x, [](long double a) { return std::log1p(a); }))
+            << "x = " << x;
+        FUZZY_COMPARE(log1p(x, FastMath),
+                      reference(x, [](long double a) { return std::log1p(a); }))
+            << "x = " << x;
+    }
+    COMPARE(log1p(V(0)), V(0));
+    COMPARE(log1p(V(L::denorm_min())), V(L::denorm_min()));
+    COMPARE(log1p(V(-1)), V(-L::infinity()));
+    COMPARE(log1p(V(L::infinity())), V(L::infinity()));
+    VERIFY(all_of(isnan(log1p(V(-2)))));
+    VERIFY(all_of(isnan(log1p(V(-L::infinity())))));
+}
+
+// cbrt {{{1
+TEST_TYPES(V, testCbrt, RealTypes)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937 rng;
+    for (int i = 0; i < Iterations / int(V::Size); ++i) {
+        const V sign = iif(uniform<V>(rng, -1, 1) < 0, V(-1), V(1));
+        setFuzzyness<T>(1);
+        V x = sign * logUniform<V>(rng, L::min_exponent - L::digits, L::max_exponent);
+        FUZZY_COMPARE(cbrt(x), reference(x, [](long double a) { return std::cbrt(a); }))
+            << "x = " << x;
+        setFuzzyness<T>(4);
+        x = sign * logUniform<V>(rng, L::min_exponent, L::max_exponent);
+        FUZZY_COMPARE(cbrt(x, FastMath), reference(x, [](long double a) { return std::cbrt(a); }))
+            << "x = " << x;
+    }
+    for (int n = -100; n <= 100; ++n) {
+        COMPARE(cbrt(V(T(n * n * n))), V(T(n))) << "n = " << n;
+    }
+    COMPARE(cbrt(V(T(-0.))), V(T(-0.)));
+    COMPARE(cbrt(V(L::infinity())), V(L::infinity()));
+    COMPARE(cbrt(V(-L::infinity())), V(-L::infinity()));
+    VERIFY(all_of(isnan(cbrt(V(L::quiet_NaN())))));
+}
+
+// pow {{{1
+TEST_TYPES(V, testPow, RealTypes)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    std::mt19937 rng;
+    const auto ref = [](long double a, long double b) { return std::pow(a, b); };
+    for (int i = 0; i < Iterations / int(V::Size); ++i) {
+        setFuzzyness<T>(1);
+        V x = uniform<V>(rng, 0, 100);
+        V y = uniform<V>(rng, -20, 20);
+        FUZZY_COMPARE(pow(x, y), reference(x, y, ref)) << "x = " << x << ", y = " << y;
+        // |y| ≤ 1 keeps the result within [x, 1/x] and therefore normal
+        x = logUniform<V>(rng, L::min_exponent, L::max_exponent);
+        y = uniform<V>(rng, -1, 1);
+        FUZZY_COMPARE(pow(x, y), reference(x, y, ref)) << "x = " << x << ", y = " << y;
+        // subnormal x
+        x = logUniform<V>(rng, L::min_exponent - L::digits, L::min_exponent - 1);
+        y = uniform<V>(rng, T(-0.5), T(0.5));
+        FUZZY_COMPARE(pow(x, y), reference(x, y, ref)) << "x = " << x << ", y = " << y;
+        // results over the whole range
+        x = uniform<V>(rng, 0.5, 2);
+        y = uniform<V>(rng, L::min_exponent - 1, L::max_exponent) / log2(x, PreciseMath);
+        FUZZY_COMPARE(pow(x, y), reference(x, y, ref)) << "x = " << x << ", y = " << y;
+        y = uniform<V>(rng, L::min_exponent - L::digits, L::min_exponent - 1) /
+            log2(x, PreciseMath);
+        verifySubnormal(pow(x, y), reference(x, y, ref));
+        // negative base, integral exponent
+        x = uniform<V>(rng, -10, 0);
+        y = floor(uniform<V>(rng, -30, 30));
+        FUZZY_COMPARE(pow(x, y), reference(x, y, ref)) << "x = " << x << ", y = " << y;
+        setFuzzyness<T>(4);
+        x = uniform<V>(rng, 0, 100);
+        y = uniform<V>(rng, -10, 10);
+        FUZZY_COMPARE(pow(x, y, FastMath), reference(x, y, ref))
+            << "x = " << x << ", y = " << y;
+    }
+    // the special cases of C99 Annex F
+    setFuzzyness<T>(1);
+    const T inf = L::infinity();
+    const T nan = L::quiet_NaN();
+    const T special[] = {0, -0., 1, -1, 2, -2, T(0.5), T(-0.5), 3, -3, T(2.5), inf, -inf, nan};
+    for (T a : special) {
+        for (T b : special) {
+            const V r = pow(V(a), V(b));
+            const T expected = std::pow(a, b);
+            if (std::isnan(expected)) {
+                VERIFY(all_of(isnan(r))) << "pow(" << a << ", " << b << ") = " << r;
+            } else {
+                FUZZY_COMPARE(r, V(expected)) << "pow(" << a << ", " << b << ")";
+                COMPARE(isnegative(r), isnegative(V(expected)))
+                    << "pow(" << a << ", " << b << ")";
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -307,6 +307,35 @@ TEST(testMallocAlignment)
     COMPARE((reinterpret_cast<std::uintptr_t>(&a[0]) & mask), 0ul);
 }
 
+// testMallocHugePages{{{1
+TEST(testMallocHugePages)
+{
+    constexpr std::size_t N = 3 << 20;
+    float *a = Vc::malloc<float, Vc::AlignOnHugePage>(N);
+    COMPARE((reinterpret_cast<std::uintptr_t>(a) & ((2 << 20) - 1)), 0ul);
+    a[0] = 1.f;
+    a[N - 1] = 2.f;
+    COMPARE(a[0], 1.f);
+    COMPARE(a[N - 1], 2.f);
+    Vc::free(a);
+
+    a = Vc::malloc<float, Vc::AlignOnPageInterleaved>(N);
+    COMPARE((reinterpret_cast<std::uintptr_t>(a) & 4095), 0ul);
+    for (std::size_t i = 0; i < N; i += 1024) {
+        a[i] = float(i);
+    }
+    for (std::size_t i = 0; i < N; i += 1024) {
+        COMPARE(a[i], float(i));
+    }
+    Vc::free(a);
+
+    a = Vc::malloc<float, Vc::AlignOnHugePageInterleaved>(N);
+    COMPARE((reinterpret_cast<std::uintptr_t>(a) & ((2 << 20) - 1)), 0ul);
+    a[N - 1] = 3.f;
+    COMPARE(a[N - 1], 3.f);
+    Vc::free(a);
+}
+
 // testIif{{{1
 template <typename A, typename B, typename C,
           typename = decltype(Vc::iif(std::declval<A>(), std::declval<B>(),